@@ -241,6 +241,8 @@ namespace bs
 	class AsyncOp;
 	class HardwareBufferManager;
 	class FontManager;
+	class FontRasterizer;
+	class DynamicFontAtlas;
 	class DepthStencilState;
 	class RenderStateManager;
 	class RasterizerState;
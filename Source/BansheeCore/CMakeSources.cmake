@@ -100,6 +100,7 @@ set(BS_BANSHEECORE_INC_RENDERER
 	"Renderer/BsRenderer.h"
 	"Renderer/BsRendererMeshData.h"
 	"Renderer/BsParamBlocks.h"
+	"Renderer/BsParamBlockRing.h"
 	"Renderer/BsCamera.h"
 	"Renderer/BsRenderSettings.h"
 	"Renderer/BsRendererExtension.h"
@@ -155,6 +156,7 @@ set(BS_BANSHEECORE_INC_RENDERAPI
 	"RenderAPI/BsRenderAPICapabilities.h"
 	"RenderAPI/BsViewport.h"
 	"RenderAPI/BsCommandBuffer.h"
+	"RenderAPI/BsRenderAPIStateCache.h"
 	"RenderAPI/BsGpuPipelineState.h"
 	"RenderAPI/BsGpuPipelineParamInfo.h"
 	"RenderAPI/BsVertexDataDesc.h"
@@ -195,6 +197,7 @@ set(BS_BANSHEECORE_INC_MATERIAL
 	"Material/BsMaterialManager.h"
 	"Material/BsMaterial.h"
 	"Material/BsMaterialParam.h"
+	"Material/BsMaterialParamHandle.h"
 	"Material/BsShaderManager.h"
 	"Material/BsMaterialParams.h"
 	"Material/BsGpuParamsSet.h"
@@ -241,6 +244,8 @@ set(BS_BANSHEECORE_INC_TEXT
 	"Text/BsFontImportOptions.h"
 	"Text/BsFontDesc.h"
 	"Text/BsFont.h"
+	"Text/BsFontRasterizer.h"
+	"Text/BsDynamicFontAtlas.h"
 )
 
 set(BS_BANSHEECORE_SRC_PROFILING
@@ -385,6 +390,7 @@ set(BS_BANSHEECORE_SRC_RENDERER
 	"Renderer/BsRenderer.cpp"
 	"Renderer/BsRendererMeshData.cpp"
 	"Renderer/BsParamBlocks.cpp"
+	"Renderer/BsParamBlockRing.cpp"
 	"Renderer/BsCamera.cpp"
 	"Renderer/BsRenderSettings.cpp"
 	"Renderer/BsRendererExtension.cpp"
@@ -427,6 +433,7 @@ set(BS_BANSHEECORE_SRC_MATERIAL
 	"Material/BsShader.cpp"
 	"Material/BsTechnique.cpp"
 	"Material/BsMaterialParam.cpp"
+	"Material/BsMaterialParamHandle.cpp"
 	"Material/BsShaderManager.cpp"
 	"Material/BsMaterialParams.cpp"
 	"Material/BsGpuParamsSet.cpp"
@@ -448,6 +455,7 @@ set(BS_BANSHEECORE_SRC_TEXT
 	"Text/BsFont.cpp"
 	"Text/BsFontImportOptions.cpp"
 	"Text/BsFontManager.cpp"
+	"Text/BsDynamicFontAtlas.cpp"
 	"Text/BsTextData.cpp"
 )
 
@@ -477,6 +485,7 @@ set(BS_BANSHEECORE_SRC_RENDERAPI
 	"RenderAPI/BsRenderAPICapabilities.cpp"
 	"RenderAPI/BsViewport.cpp"
 	"RenderAPI/BsCommandBuffer.cpp"
+	"RenderAPI/BsRenderAPIStateCache.cpp"
 	"RenderAPI/BsGpuPipelineState.cpp"
 	"RenderAPI/BsGpuPipelineParamInfo.cpp"
 	"RenderAPI/BsVertexDataDesc.cpp"
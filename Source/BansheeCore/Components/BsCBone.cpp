@@ -12,6 +12,7 @@ namespace bs
 	CBone::CBone()
 	{
 		setName("Bone");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = TCF_Parent;
 	}
@@ -20,6 +21,7 @@ namespace bs
 		: Component(parent)
 	{
 		setName("Bone");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = TCF_Parent;
 	}
@@ -11,6 +11,7 @@ namespace bs
 	CCamera::CCamera()
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("Camera");
 	}
 
@@ -18,6 +19,7 @@ namespace bs
 		: Component(parent)
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("Camera");
 	}
 
@@ -12,6 +12,7 @@ namespace bs
 	CCharacterController::CCharacterController()
 	{
 		setName("CharacterController");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -20,6 +21,7 @@ namespace bs
 		: Component(parent)
 	{
 		setName("CharacterController");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -13,6 +13,7 @@ namespace bs
 	CCollider::CCollider()
 	{
 		setName("Collider");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
@@ -21,6 +22,7 @@ namespace bs
 		: Component(parent)
 	{
 		setName("Collider");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
@@ -13,6 +13,8 @@ namespace bs
 	CJoint::CJoint(JOINT_DESC& desc)
 		:mDesc(desc)
 	{
+		setFlag(ComponentFlag::NoUpdate, true);
+
 		mPositions[0] = Vector3::ZERO;
 		mPositions[1] = Vector3::ZERO;
 
@@ -24,6 +26,7 @@ namespace bs
 		: Component(parent), mDesc(desc)
 	{
 		setName("Joint");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mPositions[0] = Vector3::ZERO;
 		mPositions[1] = Vector3::ZERO;
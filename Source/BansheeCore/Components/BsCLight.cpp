@@ -9,6 +9,7 @@ namespace bs
 	CLight::CLight()
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("Light");
 	}
 
@@ -18,6 +19,7 @@ namespace bs
 		mCastsShadows(castsShadows), mSpotAngle(spotAngle), mSpotFalloffAngle(spotFalloffAngle)
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("Light");
 	}
 
@@ -9,6 +9,7 @@ namespace bs
 	CLightProbeVolume::CLightProbeVolume()
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("LightProbeVolume");
 	}
 
@@ -16,6 +17,7 @@ namespace bs
 		:Component(parent), mVolume(volume), mCellCount(cellCount)
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("LightProbeVolume");
 	}
 
@@ -9,6 +9,7 @@ namespace bs
 	CReflectionProbe::CReflectionProbe()
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("ReflectionProbe");
 	}
 
@@ -16,6 +17,7 @@ namespace bs
 		: Component(parent)
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("ReflectionProbe");
 	}
 
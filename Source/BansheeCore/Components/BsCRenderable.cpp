@@ -15,6 +15,7 @@ namespace bs
 	{
 		setName("Renderable");
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 	}
 
 	CRenderable::CRenderable(const HSceneObject& parent)
@@ -22,6 +23,7 @@ namespace bs
 	{
 		setName("Renderable");
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 	}
 
 	void CRenderable::setMesh(HMesh mesh)
@@ -14,6 +14,7 @@ namespace bs
 	CRigidbody::CRigidbody()
 	{
 		setName("Rigidbody");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
@@ -22,6 +23,7 @@ namespace bs
 		: Component(parent)
 	{
 		setName("Rigidbody");
+		setFlag(ComponentFlag::NoUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
@@ -10,6 +10,7 @@ namespace bs
 	CSkybox::CSkybox()
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("Skybox");
 	}
 
@@ -17,6 +18,7 @@ namespace bs
 		: Component(parent)
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoUpdate, true);
 		setName("Skybox");
 	}
 
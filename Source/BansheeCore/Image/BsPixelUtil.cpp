@@ -6,6 +6,8 @@
 #include "Math/BsMath.h"
 #include "Error/BsException.h"
 #include "Image/BsTexture.h"
+#include "Math/BsSIMD.h"
+#include "Threading/BsTaskScheduler.h"
 #include <nvtt.h>
 
 namespace bs 
@@ -1198,43 +1200,6 @@ namespace bs
 		UINT8* bufferEnd;
 	};
 
-	/**	Handles output from NVTT library for a mip-map chain. */
-	struct NVTTMipmapOutputHandler : public nvtt::OutputHandler
-	{
-		NVTTMipmapOutputHandler(const Vector<SPtr<PixelData>>& buffers)
-			:buffers(buffers), bufferWritePos(nullptr), bufferEnd(nullptr)
-		{ }
-
-		void beginImage(int size, int width, int height, int depth, int face, int miplevel) override
-		{ 
-			assert(miplevel >= 0 && miplevel < (int)buffers.size());
-			assert((UINT32)size == buffers[miplevel]->getConsecutiveSize());
-
-			activeBuffer = buffers[miplevel];
-
-			bufferWritePos = activeBuffer->getData();
-			bufferEnd = bufferWritePos + activeBuffer->getConsecutiveSize();
-		}
-
-		bool writeData(const void* data, int size) override
-		{
-			assert((bufferWritePos + size) <= bufferEnd);
-			memcpy(bufferWritePos, data, size);
-			bufferWritePos += size;
-
-			return true;
-		}
-
-		void endImage() override
-		{ }
-
-		Vector<SPtr<PixelData>> buffers;
-		SPtr<PixelData> activeBuffer;
-
-		UINT8* bufferWritePos;
-		UINT8* bufferEnd;
-	};
-
 	nvtt::Format toNVTTFormat(PixelFormat format)
 	{
 		switch (format)
@@ -1294,22 +1259,6 @@ namespace bs
 		return nvtt::AlphaMode_None;
 	}
 
-	nvtt::WrapMode toNVTTWrapMode(MipMapWrapMode wrapMode)
-	{
-		switch (wrapMode)
-		{
-		case MipMapWrapMode::Clamp:
-			return nvtt::WrapMode_Clamp;
-		case MipMapWrapMode::Mirror:
-			return nvtt::WrapMode_Mirror;
-		case MipMapWrapMode::Repeat:
-			return nvtt::WrapMode_Repeat;
-		}
-
-		// Unknown alpha mode
-		return nvtt::WrapMode_Mirror;
-	}
-
 	UINT32 PixelUtil::getNumElemBytes(PixelFormat format)
 	{
 		return getDescriptionFor(format).elemBytes;
@@ -1865,6 +1814,555 @@ namespace bs
 		}
 	}
 
+	/** Minimum number of pixels processed by a single task, when processing large images in parallel. */
+	static constexpr UINT32 MIN_PIXELS_PER_TASK = 64 * 1024;
+
+	/**
+	 * Calls @p func for ranges of rows covering [0, @p numRows). If the task scheduler is running and the image is
+	 * large enough, the rows are split into multiple ranges processed in parallel. Otherwise @p func is called once for
+	 * the entire range on the current thread.
+	 *
+	 * @param[in]	name		Name of the tasks to create.
+	 * @param[in]	numRows		Total number of rows to process.
+	 * @param[in]	rowWidth	Number of pixels in a single row.
+	 * @param[in]	func		Function that processes a range of rows. Receives the first row and one past the last row.
+	 */
+	static void processRows(const String& name, UINT32 numRows, UINT32 rowWidth,
+		const std::function<void(UINT32, UINT32)>& func)
+	{
+		UINT32 numTasks = 1;
+		if (TaskScheduler::isStarted() && rowWidth > 0)
+		{
+			UINT32 maxTasks = TaskScheduler::instance().getNumWorkers() + 1;
+			UINT32 minRowsPerTask = Math::divideAndRoundUp(MIN_PIXELS_PER_TASK, rowWidth);
+
+			numTasks = std::min(maxTasks, numRows / minRowsPerTask);
+		}
+
+		if (numTasks <= 1)
+		{
+			func(0, numRows);
+			return;
+		}
+
+		UINT32 numPerTask = Math::divideAndRoundUp(numRows, numTasks);
+
+		Vector<SPtr<Task>> tasks;
+		tasks.reserve(numTasks - 1);
+
+		// First range gets executed on this thread
+		for (UINT32 i = 1; i < numTasks; i++)
+		{
+			UINT32 start = i * numPerTask;
+			UINT32 end = std::min(start + numPerTask, numRows);
+
+			SPtr<Task> task = Task::create(name, std::bind(func, start, end));
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		func(0, std::min(numPerTask, numRows));
+
+		for (auto& entry : tasks)
+			entry->wait();
+	}
+
+	/** Types of pixel formats that have specialized conversion kernels. */
+	enum class PixelConversionType
+	{
+		Unorm8, /**< Unsigned normalized format with 8 bits per channel, with any channel order. */
+		Float16, /**< Format with a 16-bit float per channel, in RGBA order. */
+		Float32, /**< Format with a 32-bit float per channel, in RGBA order. */
+		Generic /**< Any other format, converted through packColor()/unpackColor(). */
+	};
+
+	/** Information required by pixel conversion kernels for converting between a specific pair of formats. */
+	struct PixelConversionInfo
+	{
+		PixelFormat srcFormat;
+		PixelFormat dstFormat;
+		UINT32 srcPixelSize;
+		UINT32 dstPixelSize;
+
+		/** Byte offsets of the R, G, B and A channels in source and destination Unorm8 pixels, or -1 if not present. */
+		INT32 srcOffsets[4];
+		INT32 dstOffsets[4];
+
+		/**
+		 * For each byte of a destination Unorm8 pixel, index of the source pixel byte it is copied from. Bytes without
+		 * a source are set to the value in @p swizzleConstants.
+		 */
+		UINT8 swizzleIndices[4];
+		UINT8 swizzleKeepMask[4];
+		UINT8 swizzleConstants[4];
+	};
+
+	/** Converts a row of pixels from one format to another. */
+	typedef void(*PixelConversionRowFunc)(const UINT8* src, UINT8* dst, UINT32 numPixels,
+		const PixelConversionInfo& info);
+
+	/** Reads pixels of Unorm8 formats. */
+	struct Unorm8PixelReader
+	{
+		static void read(const UINT8* src, float* output, const PixelConversionInfo& info)
+		{
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				INT32 offset = info.srcOffsets[i];
+				if (offset >= 0)
+					output[i] = Bitwise::uintToUnorm(src[offset], 8);
+				else
+					output[i] = i == 3 ? 1.0f : 0.0f;
+			}
+		}
+	};
+
+	/** Writes pixels of Unorm8 formats. */
+	struct Unorm8PixelWriter
+	{
+		static void write(const float* input, UINT8* dst, const PixelConversionInfo& info)
+		{
+			memset(dst, 0, info.dstPixelSize);
+
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				INT32 offset = info.dstOffsets[i];
+				if (offset >= 0)
+					dst[offset] = (UINT8)Bitwise::unormToUint(input[i], 8);
+			}
+		}
+	};
+
+	/**
+	 * Reads pixels of formats with a 16-bit float per channel.
+	 *
+	 * @tparam	N	Number of channels in the format.
+	 */
+	template<UINT32 N>
+	struct Float16PixelReader
+	{
+		static void read(const UINT8* src, float* output, const PixelConversionInfo& info)
+		{
+			const UINT16* values = (const UINT16*)src;
+			for (UINT32 i = 0; i < N; i++)
+				output[i] = Bitwise::halfToFloat(values[i]);
+
+			for (UINT32 i = N; i < 3; i++)
+				output[i] = 0.0f;
+
+			if (N < 4)
+				output[3] = 1.0f;
+		}
+	};
+
+	/**
+	 * Writes pixels of formats with a 16-bit float per channel.
+	 *
+	 * @tparam	N	Number of channels in the format.
+	 */
+	template<UINT32 N>
+	struct Float16PixelWriter
+	{
+		static void write(const float* input, UINT8* dst, const PixelConversionInfo& info)
+		{
+			UINT16* values = (UINT16*)dst;
+			for (UINT32 i = 0; i < N; i++)
+				values[i] = Bitwise::floatToHalf(input[i]);
+		}
+	};
+
+	/**
+	 * Reads pixels of formats with a 32-bit float per channel.
+	 *
+	 * @tparam	N	Number of channels in the format.
+	 */
+	template<UINT32 N>
+	struct Float32PixelReader
+	{
+		static void read(const UINT8* src, float* output, const PixelConversionInfo& info)
+		{
+			const float* values = (const float*)src;
+			for (UINT32 i = 0; i < N; i++)
+				output[i] = values[i];
+
+			for (UINT32 i = N; i < 3; i++)
+				output[i] = 0.0f;
+
+			if (N < 4)
+				output[3] = 1.0f;
+		}
+	};
+
+	/**
+	 * Writes pixels of formats with a 32-bit float per channel.
+	 *
+	 * @tparam	N	Number of channels in the format.
+	 */
+	template<UINT32 N>
+	struct Float32PixelWriter
+	{
+		static void write(const float* input, UINT8* dst, const PixelConversionInfo& info)
+		{
+			float* values = (float*)dst;
+			for (UINT32 i = 0; i < N; i++)
+				values[i] = input[i];
+		}
+	};
+
+	/**
+	 * Converts a row of pixels by reading each pixel into floating point RGBA and writing it back out. Produces the
+	 * same results as packColor()/unpackColor(), but without per-pixel format lookups.
+	 */
+	template<class Reader, class Writer>
+	void convertPixelRow(const UINT8* src, UINT8* dst, UINT32 numPixels, const PixelConversionInfo& info)
+	{
+		float color[4];
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			Reader::read(src, color, info);
+			Writer::write(color, dst, info);
+
+			src += info.srcPixelSize;
+			dst += info.dstPixelSize;
+		}
+	}
+
+	/** Converts a row of pixels using packColor()/unpackColor(). Supports all uncompressed formats. */
+	static void convertPixelRowGeneric(const UINT8* src, UINT8* dst, UINT32 numPixels, const PixelConversionInfo& info)
+	{
+		float r, g, b, a;
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			PixelUtil::unpackColor(&r, &g, &b, &a, info.srcFormat, src);
+			PixelUtil::packColor(r, g, b, a, info.dstFormat, dst);
+
+			src += info.srcPixelSize;
+			dst += info.dstPixelSize;
+		}
+	}
+
+	/** Converts a row of pixels between two Unorm8 formats, by reordering the channel bytes. */
+	static void swizzlePixelRow(const UINT8* src, UINT8* dst, UINT32 numPixels, const PixelConversionInfo& info)
+	{
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			for (UINT32 j = 0; j < info.dstPixelSize; j++)
+				dst[j] = (src[info.swizzleIndices[j]] & info.swizzleKeepMask[j]) | info.swizzleConstants[j];
+
+			src += info.srcPixelSize;
+			dst += info.dstPixelSize;
+		}
+	}
+
+	/**
+	 * Creates a mask usable with simd::permute_bytes16 that applies the provided per-pixel byte pattern to four 4-byte
+	 * pixels at once.
+	 */
+	static simd::uint8x16 makePixelByteMask(const UINT8* pattern, bool offsetByPixel)
+	{
+		SIMDPP_ALIGN(16) UINT8 mask[16];
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+				mask[i * 4 + j] = (UINT8)(pattern[j] + (offsetByPixel ? i * 4 : 0));
+		}
+
+		return simd::load<simd::uint8x16>(mask);
+	}
+
+	/** Version of swizzlePixelRow() for formats with 4-byte pixels, that converts four pixels at once. */
+	static void swizzlePixelRow4(const UINT8* src, UINT8* dst, UINT32 numPixels, const PixelConversionInfo& info)
+	{
+		simd::uint8x16 indices = makePixelByteMask(info.swizzleIndices, true);
+		simd::uint8x16 keepMask = makePixelByteMask(info.swizzleKeepMask, false);
+		simd::uint8x16 constants = makePixelByteMask(info.swizzleConstants, false);
+
+		UINT32 numVectors = numPixels / 4;
+		for (UINT32 i = 0; i < numVectors; i++)
+		{
+			simd::uint8x16 pixels = simd::load_u<simd::uint8x16>(src);
+			pixels = simd::bit_or(simd::bit_and(simd::permute_bytes16(pixels, indices), keepMask), constants);
+			simd::store_u(dst, pixels);
+
+			src += 16;
+			dst += 16;
+		}
+
+		swizzlePixelRow(src, dst, numPixels - numVectors * 4, info);
+	}
+
+	/** Converts a row of pixels from a Unorm8 format with 4-byte pixels to PF_RGBA32F, four pixels at a time. */
+	static void convertPixelRowUnorm8ToRGBA32F(const UINT8* src, UINT8* dst, UINT32 numPixels,
+		const PixelConversionInfo& info)
+	{
+		// Reorder the bytes to RGBA, with missing channels set to their defaults
+		UINT8 indices[4], keepMask[4], constants[4];
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			INT32 offset = info.srcOffsets[i];
+			indices[i] = offset >= 0 ? (UINT8)offset : 0;
+			keepMask[i] = offset >= 0 ? 0xFF : 0x00;
+			constants[i] = offset >= 0 || i != 3 ? 0x00 : 0xFF;
+		}
+
+		simd::uint8x16 indicesVec = makePixelByteMask(indices, true);
+		simd::uint8x16 keepMaskVec = makePixelByteMask(keepMask, false);
+		simd::uint8x16 constantsVec = makePixelByteMask(constants, false);
+		simd::float32<16> maxValue = simd::splat(255.0f);
+
+		UINT32 numVectors = numPixels / 4;
+		for (UINT32 i = 0; i < numVectors; i++)
+		{
+			simd::uint8x16 pixels = simd::load_u<simd::uint8x16>(src);
+			pixels = simd::bit_or(simd::bit_and(simd::permute_bytes16(pixels, indicesVec), keepMaskVec), constantsVec);
+
+			// Note: Dividing instead of multiplying by the reciprocal, to match Bitwise::uintToUnorm() exactly
+			simd::float32<16> values = simd::to_float32(simd::to_int32(pixels));
+			values = simd::div(values, maxValue);
+			simd::store_u((float*)dst, values);
+
+			src += 16;
+			dst += 64;
+		}
+
+		convertPixelRow<Unorm8PixelReader, Float32PixelWriter<4>>(src, dst, numPixels - numVectors * 4, info);
+	}
+
+	/** Converts a row of pixels from PF_RGBA32F to a Unorm8 format with 4-byte pixels, four pixels at a time. */
+	static void convertPixelRowRGBA32FToUnorm8(const UINT8* src, UINT8* dst, UINT32 numPixels,
+		const PixelConversionInfo& info)
+	{
+		// Reorder the bytes from RGBA to the destination layout, with unused bytes set to zero
+		UINT8 indices[4], keepMask[4], constants[4];
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			indices[i] = 0;
+			keepMask[i] = 0x00;
+			constants[i] = 0x00;
+		}
+
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			INT32 offset = info.dstOffsets[i];
+			if (offset < 0)
+				continue;
+
+			indices[offset] = (UINT8)i;
+			keepMask[offset] = 0xFF;
+		}
+
+		simd::uint8x16 indicesVec = makePixelByteMask(indices, true);
+		simd::uint8x16 keepMaskVec = makePixelByteMask(keepMask, false);
+		simd::uint8x16 constantsVec = makePixelByteMask(constants, false);
+		simd::float32<16> scale = simd::splat(256.0f);
+		simd::float32<16> minValue = simd::splat(0.0f);
+		simd::float32<16> maxValue = simd::splat(255.0f);
+
+		UINT32 numVectors = numPixels / 4;
+		for (UINT32 i = 0; i < numVectors; i++)
+		{
+			// Note: Same as Bitwise::unormToUint(), values are scaled by 256 and truncated, clamping to [0, 255]
+			simd::float32<16> values = simd::load_u<simd::float32<16>>((const float*)src);
+			values = simd::min(simd::max(simd::mul(values, scale), minValue), maxValue);
+
+			simd::uint8x16 pixels = simd::to_uint8(simd::to_int32(values));
+			pixels = simd::bit_or(simd::bit_and(simd::permute_bytes16(pixels, indicesVec), keepMaskVec), constantsVec);
+			simd::store_u(dst, pixels);
+
+			src += 64;
+			dst += 16;
+		}
+
+		convertPixelRow<Float32PixelReader<4>, Unorm8PixelWriter>(src, dst, numPixels - numVectors * 4, info);
+	}
+
+	/**
+	 * Determines which type of conversion kernel can be used for the provided format. For Unorm8 formats outputs the
+	 * byte offset of each channel, and for float formats the number of channels.
+	 */
+	static PixelConversionType getPixelConversionType(PixelFormat format, INT32* offsets, UINT32& numChannels)
+	{
+		const PixelFormatDescription& desc = getDescriptionFor(format);
+		numChannels = desc.componentCount;
+
+		if ((desc.flags & (PFF_COMPRESSED | PFF_DEPTH)) != 0)
+			return PixelConversionType::Generic;
+
+#if BS_ENDIAN == BS_ENDIAN_LITTLE
+		UINT32 unorm8Flags = PFF_INTEGER | PFF_NORMALIZED;
+		if ((desc.flags & (unorm8Flags | PFF_SIGNED)) == unorm8Flags && desc.componentType == PCT_BYTE &&
+			desc.elemBytes <= 4)
+		{
+			UINT8 bits[] = { desc.rbits, desc.gbits, desc.bbits, desc.abits };
+			UINT8 shifts[] = { desc.rshift, desc.gshift, desc.bshift, desc.ashift };
+
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				if (i < desc.componentCount && (i < 3 || (desc.flags & PFF_HASALPHA) != 0))
+				{
+					if (bits[i] != 8 || (shifts[i] % 8) != 0)
+						return PixelConversionType::Generic;
+
+					offsets[i] = shifts[i] / 8;
+				}
+				else
+					offsets[i] = -1;
+			}
+
+			return PixelConversionType::Unorm8;
+		}
+#endif
+
+		if ((desc.flags & PFF_FLOAT) != 0)
+		{
+			if (desc.componentType == PCT_FLOAT16 && desc.elemBytes == desc.componentCount * 2)
+				return PixelConversionType::Float16;
+
+			if (desc.componentType == PCT_FLOAT32 && desc.elemBytes == desc.componentCount * 4)
+				return PixelConversionType::Float32;
+		}
+
+		return PixelConversionType::Generic;
+	}
+
+	/**
+	 * Returns a row conversion function specialized for converting from the provided reader to the provided
+	 * destination format type, or null if one doesn't exist.
+	 */
+	template<class Reader>
+	PixelConversionRowFunc getPixelConversionRowFunc(PixelConversionType dstType, UINT32 dstChannels)
+	{
+		switch (dstType)
+		{
+		case PixelConversionType::Unorm8:
+			return &convertPixelRow<Reader, Unorm8PixelWriter>;
+		case PixelConversionType::Float16:
+			switch (dstChannels)
+			{
+			case 1: return &convertPixelRow<Reader, Float16PixelWriter<1>>;
+			case 2: return &convertPixelRow<Reader, Float16PixelWriter<2>>;
+			case 3: return &convertPixelRow<Reader, Float16PixelWriter<3>>;
+			case 4: return &convertPixelRow<Reader, Float16PixelWriter<4>>;
+			default: return nullptr;
+			}
+		case PixelConversionType::Float32:
+			switch (dstChannels)
+			{
+			case 1: return &convertPixelRow<Reader, Float32PixelWriter<1>>;
+			case 2: return &convertPixelRow<Reader, Float32PixelWriter<2>>;
+			case 3: return &convertPixelRow<Reader, Float32PixelWriter<3>>;
+			case 4: return &convertPixelRow<Reader, Float32PixelWriter<4>>;
+			default: return nullptr;
+			}
+		default:
+			return nullptr;
+		}
+	}
+
+	/**
+	 * Finds the fastest row conversion function that can convert between the provided formats, and fills out the
+	 * information required by it. Falls back to convertPixelRowGeneric() if no specialized function exists.
+	 */
+	static PixelConversionRowFunc findPixelConversionRowFunc(PixelFormat srcFormat, PixelFormat dstFormat,
+		PixelConversionInfo& info)
+	{
+		info.srcFormat = srcFormat;
+		info.dstFormat = dstFormat;
+		info.srcPixelSize = PixelUtil::getNumElemBytes(srcFormat);
+		info.dstPixelSize = PixelUtil::getNumElemBytes(dstFormat);
+
+		UINT32 srcChannels, dstChannels;
+		PixelConversionType srcType = getPixelConversionType(srcFormat, info.srcOffsets, srcChannels);
+		PixelConversionType dstType = getPixelConversionType(dstFormat, info.dstOffsets, dstChannels);
+
+		PixelConversionRowFunc func = nullptr;
+		switch (srcType)
+		{
+		case PixelConversionType::Unorm8:
+			if (dstType == PixelConversionType::Unorm8)
+			{
+				// Swizzle only, channels missing in the source get the same defaults unpackColor() would give them
+				for (UINT32 i = 0; i < 4; i++)
+				{
+					info.swizzleIndices[i] = 0;
+					info.swizzleKeepMask[i] = 0x00;
+					info.swizzleConstants[i] = 0x00;
+				}
+
+				for (UINT32 i = 0; i < 4; i++)
+				{
+					INT32 dstOffset = info.dstOffsets[i];
+					if (dstOffset < 0)
+						continue;
+
+					INT32 srcOffset = info.srcOffsets[i];
+					if (srcOffset >= 0)
+					{
+						info.swizzleIndices[dstOffset] = (UINT8)srcOffset;
+						info.swizzleKeepMask[dstOffset] = 0xFF;
+					}
+					else if (i == 3)
+						info.swizzleConstants[dstOffset] = 0xFF;
+				}
+
+				if (info.srcPixelSize == 4 && info.dstPixelSize == 4)
+					return &swizzlePixelRow4;
+
+				return &swizzlePixelRow;
+			}
+
+			if (dstFormat == PF_RGBA32F && info.srcPixelSize == 4)
+				return &convertPixelRowUnorm8ToRGBA32F;
+
+			func = getPixelConversionRowFunc<Unorm8PixelReader>(dstType, dstChannels);
+			break;
+		case PixelConversionType::Float16:
+			switch (srcChannels)
+			{
+			case 1: func = getPixelConversionRowFunc<Float16PixelReader<1>>(dstType, dstChannels); break;
+			case 2: func = getPixelConversionRowFunc<Float16PixelReader<2>>(dstType, dstChannels); break;
+			case 3: func = getPixelConversionRowFunc<Float16PixelReader<3>>(dstType, dstChannels); break;
+			case 4: func = getPixelConversionRowFunc<Float16PixelReader<4>>(dstType, dstChannels); break;
+			default: break;
+			}
+			break;
+		case PixelConversionType::Float32:
+			if (srcFormat == PF_RGBA32F && dstType == PixelConversionType::Unorm8 && info.dstPixelSize == 4)
+				return &convertPixelRowRGBA32FToUnorm8;
+
+			switch (srcChannels)
+			{
+			case 1: func = getPixelConversionRowFunc<Float32PixelReader<1>>(dstType, dstChannels); break;
+			case 2: func = getPixelConversionRowFunc<Float32PixelReader<2>>(dstType, dstChannels); break;
+			case 3: func = getPixelConversionRowFunc<Float32PixelReader<3>>(dstType, dstChannels); break;
+			case 4: func = getPixelConversionRowFunc<Float32PixelReader<4>>(dstType, dstChannels); break;
+			default: break;
+			}
+			break;
+		default:
+			break;
+		}
+
+		if (func == nullptr)
+			func = &convertPixelRowGeneric;
+
+		return func;
+	}
+
+	bool PixelUtil::_convertPixelRow(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat,
+		UINT32 numPixels, bool generic)
+	{
+		PixelConversionInfo info;
+		PixelConversionRowFunc convertRow = findPixelConversionRowFunc(srcFormat, dstFormat, info);
+
+		if (generic)
+			convertRow = &convertPixelRowGeneric;
+
+		convertRow(src, dst, numPixels, info);
+		return convertRow != &convertPixelRowGeneric;
+	}
+
 	void PixelUtil::bulkPixelConversion(const PixelData &src, PixelData &dst)
 	{
 		assert(src.getWidth() == dst.getWidth() &&
@@ -1947,41 +2445,38 @@ namespace bs
 			return;
 		}
 
-		UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
-		UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
-		UINT8 *srcptr = static_cast<UINT8*>(src.getData())
-			+ (src.getLeft() + src.getTop() * src.getRowPitch() + src.getFront() * src.getSlicePitch()) * srcPixelSize;
-		UINT8 *dstptr = static_cast<UINT8*>(dst.getData())
-			+ (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
+		PixelConversionInfo info;
+		PixelConversionRowFunc convertRow = findPixelConversionRowFunc(src.getFormat(), dst.getFormat(), info);
 
-		// Calculate pitches+skips in bytes
-		UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
-		UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
-		UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
-		UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
+		const UINT8* srcptr = static_cast<UINT8*>(src.getData())
+			+ (src.getLeft() + src.getTop() * src.getRowPitch() + src.getFront() * src.getSlicePitch()) * info.srcPixelSize;
+		UINT8* dstptr = static_cast<UINT8*>(dst.getData())
+			+ (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * info.dstPixelSize;
 
-		// The brute force fallback
-		float r, g, b, a;
-		for (UINT32 z = src.getFront(); z < src.getBack(); z++)
+		// Calculate pitches in bytes
+		const UINT32 srcRowPitchBytes = src.getRowPitch() * info.srcPixelSize;
+		const UINT32 srcSlicePitchBytes = src.getSlicePitch() * info.srcPixelSize;
+		const UINT32 dstRowPitchBytes = dst.getRowPitch() * info.dstPixelSize;
+		const UINT32 dstSlicePitchBytes = dst.getSlicePitch() * info.dstPixelSize;
+
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
+		const UINT32 numRows = height * src.getDepth();
+
+		// Large images get split into row ranges converted in parallel
+		processRows("PixelConversion", numRows, width, [&](UINT32 start, UINT32 end)
 		{
-			for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
+			for (UINT32 i = start; i < end; i++)
 			{
-				for (UINT32 x = src.getLeft(); x < src.getRight(); x++)
-				{
-					unpackColor(&r, &g, &b, &a, src.getFormat(), srcptr);
-					packColor(r, g, b, a, dst.getFormat(), dstptr);
+				UINT32 z = i / height;
+				UINT32 y = i % height;
 
-					srcptr += srcPixelSize;
-					dstptr += dstPixelSize;
-				}
-
-				srcptr += srcRowSkipBytes;
-				dstptr += dstRowSkipBytes;
+				convertRow(
+					srcptr + z * srcSlicePitchBytes + y * srcRowPitchBytes,
+					dstptr + z * dstSlicePitchBytes + y * dstRowPitchBytes,
+					width, info);
 			}
-
-			srcptr += srcSliceSkipBytes;
-			dstptr += dstSliceSkipBytes;
-		}
+		});
 	}
 
 	void PixelUtil::flipComponentOrder(PixelData& data)
@@ -2438,121 +2933,519 @@ namespace bs
 		}	
 	}
 
-	Vector<SPtr<PixelData>> PixelUtil::genMipmaps(const PixelData& src, const MipMapGenOptions& options)
+	/** Converts a color channel value from sRGB (gamma) space to linear space. */
+	static float sRGBToLinear(float value)
 	{
-		Vector<SPtr<PixelData>> outputMipBuffers;
+		if (value <= 0.04045f)
+			return value / 12.92f;
 
-		if (src.getDepth() != 1)
+		return std::pow((value + 0.055f) / 1.055f, 2.4f);
+	}
+
+	/** Converts a color channel value from linear space to sRGB (gamma) space. */
+	static float linearToSRGB(float value)
+	{
+		if (value <= 0.0031308f)
+			return value * 12.92f;
+
+		return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+	}
+
+	/** Evaluates the modified Bessel function of the first kind, of order zero. */
+	static float besselI0(float x)
+	{
+		float halfX = x * 0.5f;
+		float sum = 1.0f;
+		float term = 1.0f;
+
+		for (UINT32 i = 1; i < 32; i++)
 		{
-			LOGERR("Mipmap generation failed. 3D texture formats not supported.")
-			return outputMipBuffers;
+			float factor = halfX / i;
+			term *= factor * factor;
+			sum += term;
+
+			if (term < sum * 1e-8f)
+				break;
 		}
 
-		if (isCompressed(src.getFormat()))
+		return sum;
+	}
+
+	/** Returns the radius of a mipmap filter, in destination pixels. */
+	static float getMipFilterWidth(MipMapFilter filter)
+	{
+		switch (filter)
 		{
-			LOGERR("Mipmap generation failed. Source data cannot be compressed.")
-			return outputMipBuffers;
+		default:
+		case MipMapFilter::Box:
+			return 0.5f;
+		case MipMapFilter::Triangle:
+			return 1.0f;
+		case MipMapFilter::Kaiser:
+			return 3.0f;
 		}
+	}
 
-		if (!Bitwise::isPow2(src.getWidth()) || !Bitwise::isPow2(src.getHeight()))
+	/** Evaluates a mipmap filter at the specified distance from the filter center, in destination pixels. */
+	static float evaluateMipFilter(MipMapFilter filter, float x)
+	{
+		x = std::abs(x);
+
+		switch (filter)
 		{
-			LOGERR("Mipmap generation failed. Texture width & height must be powers of 2.");
-			return outputMipBuffers;
+		default:
+		case MipMapFilter::Box:
+			return x <= 0.5f ? 1.0f : 0.0f;
+		case MipMapFilter::Triangle:
+			return std::max(1.0f - x, 0.0f);
+		case MipMapFilter::Kaiser:
+		{
+			// Kaiser windowed sinc, using the same parameters as NVTT (alpha 4, stretch 1)
+			static constexpr float ALPHA = 4.0f;
+
+			float width = getMipFilterWidth(filter);
+			if (x >= width)
+				return 0.0f;
+
+			float sinc = 1.0f;
+			if (x > 0.0001f)
+				sinc = std::sin(Math::PI * x) / (Math::PI * x);
+
+			float t = x / width;
+			return sinc * besselI0(ALPHA * std::sqrt(1.0f - t * t)) / besselI0(ALPHA);
+		}
 		}
+	}
 
-		PixelFormat interimFormat = isFloatingPoint(src.getFormat()) ? PF_RGBA32F : PF_BGRA8;
+	/**
+	 * Weights of a filter that halves the size of an image along one axis. Destination pixel @p x is calculated from
+	 * source pixels starting at 2 * @p x + @p offset, one for each weight.
+	 */
+	struct MipFilterKernel
+	{
+		static constexpr UINT32 MAX_TAPS = 12;
 
-		PixelData interimData(src.getWidth(), src.getHeight(), 1, interimFormat);
-		interimData.allocateInternalBuffer();
-		bulkPixelConversion(src, interimData);
-		
-		if (interimFormat != PF_RGBA32F)
-			flipComponentOrder(interimData);
+		INT32 offset = 0;
+		UINT32 numTaps = 0;
+		float weights[MAX_TAPS];
+	};
 
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(true);
-		io.setNormalMap(options.isNormalMap);
-		io.setNormalizeMipmaps(options.normalizeMipmaps);
-		io.setWrapMode(toNVTTWrapMode(options.wrapMode));
+	/** Creates a kernel for downsampling an image by half, using the specified filter. */
+	static MipFilterKernel createMipFilterKernel(MipMapFilter filter)
+	{
+		// Number of points the filter is evaluated at, across a single source pixel
+		static constexpr UINT32 NUM_SAMPLES = 32;
 
-		if (interimFormat == PF_RGBA32F)
-			io.setFormat(nvtt::InputFormat_RGBA_32F);
-		else
-			io.setFormat(nvtt::InputFormat_BGRA_8UB);
+		float width = getMipFilterWidth(filter);
 
-		if (options.isSRGB)
-			io.setGamma(2.2f, 2.2f);
-		else
-			io.setGamma(1.0f, 1.0f);
+		// Destination pixel x is centered at source coordinate 2x + 1, so source pixel 2x + k covers the range
+		// [k - 1, k] relative to the center, or [(k - 1) / 2, k / 2] in destination pixels. The filter is averaged over
+		// that range rather than evaluated at the pixel center, same as NVTT does.
+		INT32 first = (INT32)std::floor(1.0f - width * 2.0f);
+		INT32 last = (INT32)std::ceil(width * 2.0f);
 
-		io.setMipmapData(interimData.getData(), src.getWidth(), src.getHeight());
+		MipFilterKernel kernel;
+		kernel.offset = first;
 
-		nvtt::CompressionOptions co;
-		co.setFormat(nvtt::Format_RGBA);
-		
-		if (interimFormat == PF_RGBA32F)
+		float totalWeight = 0.0f;
+		for (INT32 k = first; k <= last; k++)
 		{
-			co.setPixelType(nvtt::PixelType_Float);
-			co.setPixelFormat(32, 32, 32, 32);
+			float weight = 0.0f;
+			for (UINT32 i = 0; i < NUM_SAMPLES; i++)
+				weight += evaluateMipFilter(filter, ((k - 1) + (i + 0.5f) / NUM_SAMPLES) * 0.5f);
+
+			weight /= NUM_SAMPLES;
+
+			// Skip pixels outside of the filter support
+			if (weight == 0.0f)
+			{
+				if (kernel.numTaps == 0)
+					kernel.offset++;
+
+				continue;
+			}
+
+			assert(kernel.numTaps < MipFilterKernel::MAX_TAPS);
+
+			kernel.weights[kernel.numTaps++] = weight;
+			totalWeight += weight;
 		}
-		else
+
+		for (UINT32 i = 0; i < kernel.numTaps; i++)
+			kernel.weights[i] /= totalWeight;
+
+		return kernel;
+	}
+
+	/** Maps a pixel coordinate that might be outside of the image back into the image, according to the wrap mode. */
+	static UINT32 wrapMipCoordinate(INT32 coord, UINT32 size, MipMapWrapMode wrapMode)
+	{
+		INT32 isize = (INT32)size;
+		if (coord >= 0 && coord < isize)
+			return (UINT32)coord;
+
+		switch (wrapMode)
 		{
-			co.setPixelType(nvtt::PixelType_UnsignedNorm);
-			co.setPixelFormat(32, 0x0000FF00, 0x00FF0000, 0xFF000000, 0x000000FF);
+		case MipMapWrapMode::Clamp:
+			return (UINT32)Math::clamp(coord, 0, isize - 1);
+		case MipMapWrapMode::Repeat:
+		{
+			INT32 wrapped = coord % isize;
+			return (UINT32)(wrapped < 0 ? wrapped + isize : wrapped);
 		}
+		default:
+		case MipMapWrapMode::Mirror:
+		{
+			if (size == 1)
+				return 0;
 
-		UINT32 numMips = getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
+			// Mirrors around the edge pixel, without repeating it
+			coord = std::abs(coord);
+			while (coord >= isize)
+				coord = std::abs(isize * 2 - coord - 2);
+
+			return (UINT32)coord;
+		}
+		}
+	}
+
+	/** 
+	 * Halves the size of an image using the box filter, by averaging each 2x2 block of source pixels. Both source and
+	 * destination must be PF_RGBA32F, and the source must be at least 2 pixels wide and tall.
+	 */
+	static void downsampleMipBox(const PixelData& src, PixelData& dst)
+	{
+		const UINT32 dstWidth = dst.getWidth();
+		const UINT32 srcRowPitch = src.getRowPitch() * 4;
+		const UINT32 dstRowPitch = dst.getRowPitch() * 4;
 
-		Vector<SPtr<PixelData>> rgbaMipBuffers;
+		const float* srcData = (const float*)src.getData();
+		float* dstData = (float*)dst.getData();
 
-		// Note: This can be done more effectively without creating so many temp buffers
-		// and working with the original formats directly, but it would complicate the code
-		// too much at the moment.
-		UINT32 curWidth = src.getWidth();
-		UINT32 curHeight = src.getHeight();
-		for (UINT32 i = 0; i < numMips; i++)
+		processRows("MipmapDownsample", dst.getHeight(), dstWidth, [&](UINT32 start, UINT32 end)
 		{
-			rgbaMipBuffers.push_back(bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, interimFormat));
-			rgbaMipBuffers.back()->allocateInternalBuffer();
+			simd::float32x4 quarter = simd::splat(0.25f);
 
-			if (curWidth > 1) 
-				curWidth = curWidth / 2;
+			for (UINT32 y = start; y < end; y++)
+			{
+				const float* srcRow0 = srcData + y * 2 * srcRowPitch;
+				const float* srcRow1 = srcRow0 + srcRowPitch;
+				float* dstRow = dstData + y * dstRowPitch;
+
+				for (UINT32 x = 0; x < dstWidth; x++)
+				{
+					simd::float32x4 sum = simd::add(
+						simd::add(simd::load_u<simd::float32x4>(srcRow0), simd::load_u<simd::float32x4>(srcRow0 + 4)),
+						simd::add(simd::load_u<simd::float32x4>(srcRow1), simd::load_u<simd::float32x4>(srcRow1 + 4)));
+
+					simd::store_u(dstRow, simd::mul(sum, quarter));
+
+					srcRow0 += 8;
+					srcRow1 += 8;
+					dstRow += 4;
+				}
+			}
+		});
+	}
+
+	/** 
+	 * Halves the width of an image using the provided kernel. If the source is only one pixel wide it is copied
+	 * instead. Both source and destination must be PF_RGBA32F.
+	 */
+	static void downsampleMipHorizontal(const PixelData& src, PixelData& dst, const MipFilterKernel& kernel,
+		MipMapWrapMode wrapMode)
+	{
+		const UINT32 srcWidth = src.getWidth();
+		const UINT32 dstWidth = dst.getWidth();
+		const UINT32 srcRowPitch = src.getRowPitch() * 4;
+		const UINT32 dstRowPitch = dst.getRowPitch() * 4;
+
+		const float* srcData = (const float*)src.getData();
+		float* dstData = (float*)dst.getData();
+
+		processRows("MipmapDownsample", src.getHeight(), srcWidth, [&](UINT32 start, UINT32 end)
+		{
+			simd::float32x4 weights[MipFilterKernel::MAX_TAPS];
+			for (UINT32 i = 0; i < kernel.numTaps; i++)
+				weights[i] = simd::splat(kernel.weights[i]);
 
-			if (curHeight > 1)
-				curHeight = curHeight / 2;
+			for (UINT32 y = start; y < end; y++)
+			{
+				const float* srcRow = srcData + y * srcRowPitch;
+				float* dstRow = dstData + y * dstRowPitch;
+
+				if (srcWidth == 1)
+				{
+					memcpy(dstRow, srcRow, sizeof(float) * 4);
+					continue;
+				}
+
+				for (UINT32 x = 0; x < dstWidth; x++)
+				{
+					INT32 first = (INT32)x * 2 + kernel.offset;
+					simd::float32x4 sum = simd::splat(0.0f);
+
+					if (first >= 0 && first + (INT32)kernel.numTaps <= (INT32)srcWidth)
+					{
+						const float* srcPixel = srcRow + first * 4;
+						for (UINT32 i = 0; i < kernel.numTaps; i++)
+						{
+							sum = simd::add(sum, simd::mul(simd::load_u<simd::float32x4>(srcPixel), weights[i]));
+							srcPixel += 4;
+						}
+					}
+					else
+					{
+						for (UINT32 i = 0; i < kernel.numTaps; i++)
+						{
+							UINT32 srcX = wrapMipCoordinate(first + (INT32)i, srcWidth, wrapMode);
+							const float* srcPixel = srcRow + srcX * 4;
+
+							sum = simd::add(sum, simd::mul(simd::load_u<simd::float32x4>(srcPixel), weights[i]));
+						}
+					}
+
+					simd::store_u(dstRow + x * 4, sum);
+				}
+			}
+		});
+	}
+
+	/** 
+	 * Halves the height of an image using the provided kernel. If the source is only one pixel tall it is copied
+	 * instead. Both source and destination must be PF_RGBA32F.
+	 */
+	static void downsampleMipVertical(const PixelData& src, PixelData& dst, const MipFilterKernel& kernel,
+		MipMapWrapMode wrapMode)
+	{
+		const UINT32 srcHeight = src.getHeight();
+		const UINT32 width = dst.getWidth();
+		const UINT32 srcRowPitch = src.getRowPitch() * 4;
+		const UINT32 dstRowPitch = dst.getRowPitch() * 4;
+
+		const float* srcData = (const float*)src.getData();
+		float* dstData = (float*)dst.getData();
+
+		processRows("MipmapDownsample", dst.getHeight(), width, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 y = start; y < end; y++)
+			{
+				float* dstRow = dstData + y * dstRowPitch;
+
+				if (srcHeight == 1)
+				{
+					memcpy(dstRow, srcData, sizeof(float) * 4 * width);
+					continue;
+				}
+
+				// Accumulate one source row at a time, so rows are read sequentially
+				INT32 first = (INT32)y * 2 + kernel.offset;
+				for (UINT32 i = 0; i < kernel.numTaps; i++)
+				{
+					UINT32 srcY = wrapMipCoordinate(first + (INT32)i, srcHeight, wrapMode);
+					const float* srcRow = srcData + srcY * srcRowPitch;
+					simd::float32x4 weight = simd::splat(kernel.weights[i]);
+
+					for (UINT32 x = 0; x < width; x++)
+					{
+						simd::float32x4 value = simd::mul(simd::load_u<simd::float32x4>(srcRow + x * 4), weight);
+
+						if (i > 0)
+							value = simd::add(value, simd::load_u<simd::float32x4>(dstRow + x * 4));
+
+						simd::store_u(dstRow + x * 4, value);
+					}
+				}
+			}
+		});
+	}
+
+	/** 
+	 * Halves the size of an image using the provided filter. Both source and destination must be PF_RGBA32F, and the
+	 * destination must be half the size of the source, but at least one pixel, in each dimension.
+	 */
+	static void downsampleMip(const PixelData& src, PixelData& dst, MipMapFilter filter, const MipFilterKernel& kernel,
+		MipMapWrapMode wrapMode)
+	{
+		// Box filter over a power of two image never needs to wrap, and can be done in a single pass
+		if (filter == MipMapFilter::Box && src.getWidth() > 1 && src.getHeight() > 1)
+		{
+			downsampleMipBox(src, dst);
+			return;
 		}
 
-		rgbaMipBuffers.push_back(bs_shared_ptr_new<PixelData>(curWidth, curHeight, 1, interimFormat));
-		rgbaMipBuffers.back()->allocateInternalBuffer();
+		PixelData temp(dst.getWidth(), src.getHeight(), 1, PF_RGBA32F);
+		temp.allocateInternalBuffer();
 
-		NVTTMipmapOutputHandler outputHandler(rgbaMipBuffers);
+		downsampleMipHorizontal(src, temp, kernel, wrapMode);
+		downsampleMipVertical(temp, dst, kernel, wrapMode);
 
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
+		temp.freeInternalBuffer();
+	}
 
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
+	/** 
+	 * Converts the RGB channels of a PF_RGBA32F image between linear and sRGB (gamma) space. If @p isUnorm8 is true all
+	 * the values must be multiples of 1/255 (i.e. converted from an 8-bit unorm format), which allows the conversion to
+	 * use a lookup table.
+	 */
+	static void convertMipColorSpace(PixelData& data, bool toLinear, bool isUnorm8)
+	{
+		const UINT32 width = data.getWidth();
+		const UINT32 rowPitch = data.getRowPitch() * 4;
+		float* pixels = (float*)data.getData();
+
+		float lookup[256];
+		if (isUnorm8)
+		{
+			for (UINT32 i = 0; i < 256; i++)
+			{
+				float value = Bitwise::uintToUnorm(i, 8);
+				lookup[i] = toLinear ? sRGBToLinear(value) : linearToSRGB(value);
+			}
+		}
+
+		processRows("MipmapColorSpace", data.getHeight(), width, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 y = start; y < end; y++)
+			{
+				float* row = pixels + y * rowPitch;
+				for (UINT32 x = 0; x < width; x++)
+				{
+					for (UINT32 i = 0; i < 3; i++)
+					{
+						float& value = row[x * 4 + i];
+
+						if (isUnorm8)
+							value = lookup[(UINT32)(value * 255.0f + 0.5f)];
+						else
+							value = toLinear ? sRGBToLinear(value) : linearToSRGB(value);
+					}
+				}
+			}
+		});
+	}
+
+	/** Normalizes the normals encoded in the RGB channels of a PF_RGBA32F image. */
+	static void normalizeMipNormals(PixelData& data)
+	{
+		const UINT32 width = data.getWidth();
+		const UINT32 rowPitch = data.getRowPitch() * 4;
+		float* pixels = (float*)data.getData();
+
+		processRows("MipmapNormalize", data.getHeight(), width, [&](UINT32 start, UINT32 end)
 		{
-			LOGERR("Mipmap generation failed. Internal error.");
+			for (UINT32 y = start; y < end; y++)
+			{
+				float* row = pixels + y * rowPitch;
+				for (UINT32 x = 0; x < width; x++)
+				{
+					float* pixel = row + x * 4;
+
+					Vector3 normal(pixel[0] * 2.0f - 1.0f, pixel[1] * 2.0f - 1.0f, pixel[2] * 2.0f - 1.0f);
+					float length = normal.length();
+					if (length <= 0.0f)
+						continue;
+
+					normal /= length;
+
+					pixel[0] = normal.x * 0.5f + 0.5f;
+					pixel[1] = normal.y * 0.5f + 0.5f;
+					pixel[2] = normal.z * 0.5f + 0.5f;
+				}
+			}
+		});
+	}
+
+	Vector<SPtr<PixelData>> PixelUtil::genMipmaps(const PixelData& src, const MipMapGenOptions& options)
+	{
+		Vector<SPtr<PixelData>> outputMipBuffers;
+
+		if (src.getDepth() != 1)
+		{
+			// Pixel data can't describe array slices, so each slice (or cubemap face) must be passed separately. Data with
+			// depth is only ever a 3D texture, which would require filtering across slices as well.
+			LOGERR("Mipmap generation failed. 3D texture formats not supported. For texture arrays and cubemaps, " 
+				"generate mipmaps for each array slice or face separately.")
 			return outputMipBuffers;
 		}
 
-		interimData.freeInternalBuffer();
+		if (isCompressed(src.getFormat()))
+		{
+			LOGERR("Mipmap generation failed. Source data cannot be compressed.")
+			return outputMipBuffers;
+		}
+
+		if (!Bitwise::isPow2(src.getWidth()) || !Bitwise::isPow2(src.getHeight()))
+		{
+			LOGERR("Mipmap generation failed. Texture width & height must be powers of 2.");
+			return outputMipBuffers;
+		}
+
+		UINT32 numMips = getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
+
+		// Top level is an exact copy of the source
+		SPtr<PixelData> topLevel = bs_shared_ptr_new<PixelData>(src.getWidth(), src.getHeight(), 1, src.getFormat());
+		topLevel->allocateInternalBuffer();
+		bulkPixelConversion(src, *topLevel);
+
+		outputMipBuffers.push_back(topLevel);
+
+		// Filtering is done in 32-bit floating point, in linear space. Each level is generated from the previous one.
+		SPtr<PixelData> level = bs_shared_ptr_new<PixelData>(src.getWidth(), src.getHeight(), 1, PF_RGBA32F);
+		level->allocateInternalBuffer();
+		bulkPixelConversion(src, *level);
+
+		bool isGammaSpace = options.isSRGB && !options.isNormalMap;
+		if (isGammaSpace)
+		{
+			INT32 channelOffsets[4];
+			UINT32 numChannels;
+			bool isUnorm8 = getPixelConversionType(src.getFormat(), channelOffsets, numChannels) ==
+				PixelConversionType::Unorm8;
+
+			convertMipColorSpace(*level, true, isUnorm8);
+		}
+
+		MipFilterKernel kernel = createMipFilterKernel(options.filter);
 
-		for (UINT32 i = 0; i < (UINT32)rgbaMipBuffers.size(); i++)
+		for (UINT32 i = 1; i <= numMips; i++)
 		{
-			SPtr<PixelData> argbBuffer = rgbaMipBuffers[i];
-			SPtr<PixelData> outputBuffer = bs_shared_ptr_new<PixelData>(argbBuffer->getWidth(), argbBuffer->getHeight(), 1, src.getFormat());
+			UINT32 width = std::max(level->getWidth() / 2, 1U);
+			UINT32 height = std::max(level->getHeight() / 2, 1U);
+
+			SPtr<PixelData> nextLevel = bs_shared_ptr_new<PixelData>(width, height, 1, PF_RGBA32F);
+			nextLevel->allocateInternalBuffer();
+
+			downsampleMip(*level, *nextLevel, options.filter, kernel, options.wrapMode);
+			level->freeInternalBuffer();
+
+			if (options.isNormalMap && options.normalizeMipmaps)
+				normalizeMipNormals(*nextLevel);
+
+			level = nextLevel;
+
+			SPtr<PixelData> outputBuffer = bs_shared_ptr_new<PixelData>(width, height, 1, src.getFormat());
 			outputBuffer->allocateInternalBuffer();
 
-			bulkPixelConversion(*argbBuffer, *outputBuffer);
-			argbBuffer->freeInternalBuffer();
+			if (isGammaSpace)
+			{
+				PixelData gammaLevel(width, height, 1, PF_RGBA32F);
+				gammaLevel.allocateInternalBuffer();
+				memcpy(gammaLevel.getData(), level->getData(), level->getConsecutiveSize());
+
+				convertMipColorSpace(gammaLevel, false, false);
+				bulkPixelConversion(gammaLevel, *outputBuffer);
+
+				gammaLevel.freeInternalBuffer();
+			}
+			else
+				bulkPixelConversion(*level, *outputBuffer);
 
 			outputMipBuffers.push_back(outputBuffer);
 		}
 
+		level->freeInternalBuffer();
+
 		return outputMipBuffers;
 	}
 }
@@ -241,6 +241,8 @@ namespace bs
 		/**
 		 * Converts pixels from one format to another. Provided pixel data objects must have previously allocated buffers
 		 * of adequate size and their sizes must match.
+		 *
+		 * @note	Large images are split into groups of rows converted in parallel, if the task scheduler is running.
 		 */
 		static void bulkPixelConversion(const PixelData& src, PixelData& dst);
 
@@ -256,6 +258,11 @@ namespace bs
 		 *
 		 * @return	A list of calculated mip-map data. First entry is the largest mip and other follow in order from 
 		 *			largest to smallest.
+		 *
+		 * @note	sRGB data is filtered in linear space. Large images are split into groups of rows processed in 
+		 *			parallel, if the task scheduler is running.
+		 * @note	Only 2D data is supported. Texture arrays and cubemaps require a separate call for each array slice or
+		 *			face, and 3D data is rejected.
 		 */
 		static Vector<SPtr<PixelData>> genMipmaps(const PixelData& src, const MipMapGenOptions& options);
 
@@ -286,6 +293,29 @@ namespace bs
 		 * @param[in]	bpp		Number of bits per pixel of the pixels in the buffer.
 		 */
 		static void applyGamma(UINT8* buffer, float gamma, UINT32 size, UINT8 bpp);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Converts a single row of pixels between two uncompressed formats, using the same conversion kernel as
+		 * bulkPixelConversion() would for that pair of formats. 
+		 *
+		 * @param[in]	src			Pointer to the first source pixel. Doesn't need to be aligned.
+		 * @param[in]	srcFormat	Format of the source pixels.
+		 * @param[in]	dst			Pointer to the first destination pixel. Doesn't need to be aligned.
+		 * @param[in]	dstFormat	Format of the destination pixels.
+		 * @param[in]	numPixels	Number of pixels to convert.
+		 * @param[in]	generic		If true the pixels are converted one by one through unpackColor() and packColor()
+		 *							even if a specialized kernel exists. Used as reference output when validating the
+		 *							kernels.
+		 * @return					True if a specialized kernel was used, false if the generic path was used.
+		 */
+		static bool _convertPixelRow(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, 
+			UINT32 numPixels, bool generic = false);
+
+		/** @} */
 	};
 
 	/** @} */
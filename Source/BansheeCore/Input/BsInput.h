@@ -137,29 +137,29 @@ namespace bs
 		String getDeviceName(InputDevice type, UINT32 idx);
 
 		/** Triggered whenever a button is first pressed. */
-		Event<void(const ButtonEvent&)> onButtonDown;
+		UnsyncEvent<void(const ButtonEvent&)> onButtonDown;
 
 		/**	Triggered whenever a button is first released. */
-		Event<void(const ButtonEvent&)> onButtonUp;
+		UnsyncEvent<void(const ButtonEvent&)> onButtonUp;
 
 		/**	Triggered whenever user inputs a text character. */
-		Event<void(const TextInputEvent&)> onCharInput;
+		UnsyncEvent<void(const TextInputEvent&)> onCharInput;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) moves. */
-		Event<void(const PointerEvent&)> onPointerMoved;
+		UnsyncEvent<void(const PointerEvent&)> onPointerMoved;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) button is pressed. */
-		Event<void(const PointerEvent&)> onPointerPressed;
+		UnsyncEvent<void(const PointerEvent&)> onPointerPressed;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) button is released. */
-		Event<void(const PointerEvent&)> onPointerReleased;
+		UnsyncEvent<void(const PointerEvent&)> onPointerReleased;
 
 		/**	Triggers when some pointing device (mouse cursor, touch) button is double clicked. */
-		Event<void(const PointerEvent&)> onPointerDoubleClick;
+		UnsyncEvent<void(const PointerEvent&)> onPointerDoubleClick;
 
 		// TODO Low priority: Remove this, I can emulate it using virtual input
 		/**	Triggers on special input commands. */
-		Event<void(InputCommandType)> onInputCommand;
+		UnsyncEvent<void(InputCommandType)> onInputCommand;
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -455,9 +455,11 @@ namespace bs
 	template<bool Core>
 	TGpuParamsSet<Core>::TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
 		const SPtr<MaterialParamsType>& params)
-		:mPassParams(technique->getNumPasses()), mParamVersion(0)
+		:mPassParams(technique->getNumPasses()), mParamVersion(0), mNumDirtyParams(0)
 	{
 		UINT32 numPasses = technique->getNumPasses();
+		bool columnMajorMatrices = ct::RenderAPI::instance().getAPIInfo().isFlagSet(
+			RenderAPIFeatureFlag::ColumnMajorMatrices);
 
 		// Create GpuParams for each pass and shader stage
 		for (UINT32 i = 0; i < numPasses; i++)
@@ -573,11 +575,21 @@ namespace bs
 						// Parameter shouldn't be in the valid parameter list if it cannot be found
 						assert(paramIdx != (UINT32)-1);
 
+						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramIdx);
+						const GpuParamDataTypeInfo& typeInfo = 
+							GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+
 						mDataParamInfos.push_back(DataParamInfo());
 						DataParamInfo& paramInfo = mDataParamInfos.back();
 						paramInfo.paramIdx = paramIdx;
 						paramInfo.blockIdx = globalBlockIdx;
-						paramInfo.offset = dataParam.second.cpuMemOffset;
+						paramInfo.offset = dataParam.second.cpuMemOffset * sizeof(UINT32);
+						paramInfo.dataOffset = materialParamInfo->index;
+						paramInfo.elementSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+						paramInfo.arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
+						paramInfo.dataType = materialParamInfo->dataType;
+						paramInfo.transpose = columnMajorMatrices && 
+							paramInfo.dataType >= GPDT_MATRIX_2X2 && paramInfo.dataType <= GPDT_MATRIX_4X4;
 					}
 				}
 			}
@@ -679,6 +691,7 @@ namespace bs
 
 			ObjectParamInfo* objInfos = (ObjectParamInfo*)(mPassParamInfos + numPasses);
 			memcpy(objInfos, objParamInfos.data(), totalNumObjects * sizeof(ObjectParamInfo));
+			mObjectParamInfos = objInfos;
 
 			UINT32 objInfoOffset = 0;
 
@@ -776,6 +789,57 @@ namespace bs
 			bs_frame_free(offsets);
 		}
 		bs_frame_clear();
+
+		// Generate a lookup from material parameters to all the locations they are written to, so that dirty parameters
+		// can be updated without iterating over all of them
+		auto forEachParamRef = [&](auto func)
+		{
+			for (UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+				func(mDataParamInfos[i].paramIdx, ParamRef { ParamRefType::Data, 0, i });
+
+			for (UINT32 i = 0; i < numPasses; i++)
+			{
+				for (UINT32 j = 0; j < NUM_STAGES; j++)
+				{
+					const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+					auto addObjectRefs = [&](ObjectParamInfo* infos, UINT32 numInfos, ParamRefType type)
+					{
+						for (UINT32 k = 0; k < numInfos; k++)
+						{
+							UINT32 infoIdx = (UINT32)(infos + k - mObjectParamInfos);
+							func(infos[k].paramIdx, ParamRef { type, i, infoIdx });
+						}
+					};
+
+					addObjectRefs(stageInfo.textures, stageInfo.numTextures, ParamRefType::Texture);
+					addObjectRefs(stageInfo.loadStoreTextures, stageInfo.numLoadStoreTextures, 
+						ParamRefType::LoadStoreTexture);
+					addObjectRefs(stageInfo.buffers, stageInfo.numBuffers, ParamRefType::Buffer);
+					addObjectRefs(stageInfo.samplerStates, stageInfo.numSamplerStates, ParamRefType::SamplerState);
+				}
+			}
+		};
+
+		UINT32 numMaterialParams = params->getNumParams();
+		mParamRefOffsets.assign(numMaterialParams + 1, 0);
+
+		UINT32 numRefs = 0;
+		forEachParamRef([&](UINT32 paramIdx, const ParamRef& ref)
+		{
+			mParamRefOffsets[paramIdx + 1]++;
+			numRefs++;
+		});
+
+		for (UINT32 i = 0; i < numMaterialParams; i++)
+			mParamRefOffsets[i + 1] += mParamRefOffsets[i];
+
+		mParamRefs.resize(numRefs);
+		Vector<UINT32> writeOffsets(mParamRefOffsets.begin(), mParamRefOffsets.end() - 1);
+		forEachParamRef([&](UINT32 paramIdx, const ParamRef& ref)
+		{
+			mParamRefs[writeOffsets[paramIdx]++] = ref;
+		});
 	}
 
 	template<bool Core>
@@ -862,183 +926,235 @@ namespace bs
 	template<bool Core>
 	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		// Only visit the parameters recorded in the dirty ring, unless it overflowed since the last update (or this is the
+		// first update), in which case we need to check all parameters
+		UINT64 numDirtyParams = params->getNumDirtyParams();
+		bool ringOverflow = (numDirtyParams - mNumDirtyParams) > MaterialParams::DIRTY_RING_SIZE;
+
+		if (updateAll || ringOverflow || mParamVersion == 0)
+			updateFull(params, updateAll);
+		else
+			updateDirty(params);
+
+		mParamVersion = params->getParamVersion();
+		mNumDirtyParams = numDirtyParams;
+	}
 
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateFull(const SPtr<MaterialParamsType>& params, bool updateAll)
+	{
 		// Update data params
 		for(auto& paramInfo : mDataParamInfos)
 		{
-			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
-			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
-				continue;
-
 			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
 			if (materialParamInfo->version <= mParamVersion && !updateAll)
 				continue;
 
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
-			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+			updateDataParam(paramInfo, params);
+		}
 
-			UINT8* data = params->getData(materialParamInfo->index);
+		// Update object params
+		UINT32 numPasses = (UINT32)mPassParams.size();
 
-			bool transposeMatrices = ct::RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
-			if (transposeMatrices)
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			for(UINT32 j = 0; j < NUM_STAGES; j++)
 			{
-				auto writeTransposed = [&](auto& temp)
+				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+				auto updateObjectParams = [&](const ObjectParamInfo* infos, UINT32 numInfos, ParamRefType type)
 				{
-					for (UINT32 i = 0; i < arraySize; i++)
+					for (UINT32 k = 0; k < numInfos; k++)
 					{
-						UINT32 arrayOffset = i * paramSize;
-						memcpy(&temp, data + arrayOffset, paramSize);
-						auto transposed = temp.transpose();
+						const MaterialParams::ParamData* materialParamInfo = params->getParamData(infos[k].paramIdx);
+						if (materialParamInfo->version <= mParamVersion && !updateAll)
+							continue;
 
-						paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &transposed, paramSize);
+						updateObjectParam(type, i, infos[k], params);
 					}
 				};
 
-				switch (materialParamInfo->dataType)
-				{
-				case GPDT_MATRIX_2X2:
-				{
-					MatrixNxM<2, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X3:
-				{
-					MatrixNxM<2, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X4:
-				{
-					MatrixNxM<2, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X2:
-				{
-					MatrixNxM<3, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X3:
-				{
-					Matrix3 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X4:
-				{
-					MatrixNxM<3, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X2:
-				{
-					MatrixNxM<4, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X3:
-				{
-					MatrixNxM<4, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X4:
-				{
-					Matrix4 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				default:
-				{
-					paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
-					break;
-				}
-				}
+				updateObjectParams(stageInfo.textures, stageInfo.numTextures, ParamRefType::Texture);
+				updateObjectParams(stageInfo.loadStoreTextures, stageInfo.numLoadStoreTextures, 
+					ParamRefType::LoadStoreTexture);
+				updateObjectParams(stageInfo.buffers, stageInfo.numBuffers, ParamRefType::Buffer);
+				updateObjectParams(stageInfo.samplerStates, stageInfo.numSamplerStates, ParamRefType::SamplerState);
 			}
-			else
-				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+
+			mPassParams[i]->_markCoreDirty();
 		}
+	}
 
-		// Update object params
-		UINT32 numPasses = (UINT32)mPassParams.size();
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateDirty(const SPtr<MaterialParamsType>& params)
+	{
+		// Note: The same parameter can appear in the ring multiple times, in which case it will be written multiple times.
+		// This is harmless, and still cheaper than tracking which parameters were already visited.
+		UINT64 dirtyPassMask = 0;
 
-		for(UINT32 i = 0; i < numPasses; i++)
+		UINT64 numDirtyParams = params->getNumDirtyParams();
+		for (UINT64 i = mNumDirtyParams; i < numDirtyParams; i++)
 		{
-			SPtr<GpuParamsType> paramPtr = mPassParams[i];
+			UINT32 paramIdx = params->getDirtyParam(i);
 
-			for(UINT32 j = 0; j < NUM_STAGES; j++)
+			UINT32 refStart = mParamRefOffsets[paramIdx];
+			UINT32 refEnd = mParamRefOffsets[paramIdx + 1];
+			for (UINT32 j = refStart; j < refEnd; j++)
 			{
-				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
-
-				for(UINT32 k = 0; k < stageInfo.numTextures; k++)
+				const ParamRef& ref = mParamRefs[j];
+				if (ref.type == ParamRefType::Data)
+					updateDataParam(mDataParamInfos[ref.infoIdx], params);
+				else
 				{
-					const ObjectParamInfo& paramInfo = stageInfo.textures[k];
-
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
-
-					TextureSurface surface;
-					TextureType texture;
-					params->getTexture(*materialParamInfo, texture, surface);
-
-					paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+					updateObjectParam(ref.type, ref.passIdx, mObjectParamInfos[ref.infoIdx], params);
+					dirtyPassMask |= 1ULL << ref.passIdx;
 				}
+			}
+		}
 
-				for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[k];
-
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
-
-					TextureSurface surface;
-					TextureType texture;
-					params->getLoadStoreTexture(*materialParamInfo, texture, surface);
+		UINT32 numPasses = (UINT32)mPassParams.size();
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			if ((dirtyPassMask & (1ULL << i)) != 0)
+				mPassParams[i]->_markCoreDirty();
+		}
+	}
 
-					paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
-				}
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateDataParam(const DataParamInfo& paramInfo, const SPtr<MaterialParamsType>& params)
+	{
+		const BlockInfo& blockInfo = mBlocks[paramInfo.blockIdx];
+		const ParamBlockPtrType& paramBlock = blockInfo.buffer;
+		if (paramBlock == nullptr || !blockInfo.allowUpdate)
+			return;
 
-				for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.buffers[k];
+		UINT8* data = params->getData(paramInfo.dataOffset);
+		if (!paramInfo.transpose)
+		{
+			paramBlock->write(paramInfo.offset, data, paramInfo.elementSize * paramInfo.arraySize);
+			return;
+		}
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+		auto writeTransposed = [&](auto& temp)
+		{
+			for (UINT32 i = 0; i < paramInfo.arraySize; i++)
+			{
+				UINT32 arrayOffset = i * paramInfo.elementSize;
+				memcpy(&temp, data + arrayOffset, paramInfo.elementSize);
+				auto transposed = temp.transpose();
 
-					BufferType buffer;
-					params->getBuffer(*materialParamInfo, buffer);
+				paramBlock->write(paramInfo.offset + arrayOffset, &transposed, paramInfo.elementSize);
+			}
+		};
 
-					paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
-				}
+		switch (paramInfo.dataType)
+		{
+		case GPDT_MATRIX_2X2:
+		{
+			MatrixNxM<2, 2> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_2X3:
+		{
+			MatrixNxM<2, 3> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_2X4:
+		{
+			MatrixNxM<2, 4> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_3X2:
+		{
+			MatrixNxM<3, 2> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_3X3:
+		{
+			Matrix3 matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_3X4:
+		{
+			MatrixNxM<3, 4> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_4X2:
+		{
+			MatrixNxM<4, 2> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_4X3:
+		{
+			MatrixNxM<4, 3> matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		case GPDT_MATRIX_4X4:
+		{
+			Matrix4 matrix;
+			writeTransposed(matrix);
+		}
+			break;
+		default:
+			paramBlock->write(paramInfo.offset, data, paramInfo.elementSize * paramInfo.arraySize);
+			break;
+		}
+	}
 
-				for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.samplerStates[k];
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateObjectParam(ParamRefType type, UINT32 passIdx, const ObjectParamInfo& paramInfo,
+		const SPtr<MaterialParamsType>& params)
+	{
+		const SPtr<GpuParamsType>& paramPtr = mPassParams[passIdx];
+		const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+		switch(type)
+		{
+		case ParamRefType::Texture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params->getTexture(*materialParamInfo, texture, surface);
 
-					SamplerStateType samplerState;
-					params->getSamplerState(*materialParamInfo, samplerState);
+			paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+			break;
+		case ParamRefType::LoadStoreTexture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params->getLoadStoreTexture(*materialParamInfo, texture, surface);
 
-					paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
-				}
-			}
+			paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+			break;
+		case ParamRefType::Buffer:
+		{
+			BufferType buffer;
+			params->getBuffer(*materialParamInfo, buffer);
 
-			paramPtr->_markCoreDirty();
+			paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
 		}
+			break;
+		case ParamRefType::SamplerState:
+		{
+			SamplerStateType samplerState;
+			params->getSamplerState(*materialParamInfo, samplerState);
 
-		mParamVersion = params->getParamVersion();
+			paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
+		}
+			break;
+		default:
+			break;
+		}
 	}
 
 	template class TGpuParamsSet <false>;
@@ -72,7 +72,12 @@ namespace bs
 		{
 			UINT32 paramIdx;
 			UINT32 blockIdx;
-			UINT32 offset;
+			UINT32 offset; /**< Offset into the parameter block buffer, in bytes. */
+			UINT32 dataOffset; /**< Offset into the material parameter data buffer, in bytes. */
+			UINT32 elementSize;
+			UINT32 arraySize;
+			GpuParamDataType dataType;
+			bool transpose;
 		};
 
 		/** Information about how an object parameter maps from a material parameter to a GPU stage slot. */
@@ -102,6 +107,23 @@ namespace bs
 			StageParamInfo stages[GPT_COUNT];
 		};
 
+		/** Types of parameters that can be referenced by ParamRef. */
+		enum class ParamRefType
+		{
+			Data, Texture, LoadStoreTexture, Buffer, SamplerState
+		};
+
+		/** 
+		 * Reference to a single location a material parameter is written to, used for updating only the dirty 
+		 * parameters.
+		 */
+		struct ParamRef
+		{
+			ParamRefType type;
+			UINT32 passIdx;
+			UINT32 infoIdx; /**< Index into mDataParamInfos for data parameters, or mObjectParamInfos otherwise. */
+		};
+
 	public:
 		TGpuParamsSet() {}
 		TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
@@ -173,12 +195,34 @@ namespace bs
 	private:
 		template<bool Core2> friend class TMaterial;
 
+		/** Writes the value of a data parameter from @p params into its parameter block buffer. */
+		void updateDataParam(const DataParamInfo& paramInfo, const SPtr<MaterialParamsType>& params);
+
+		/** Writes the value of an object parameter from @p params into the GPU params object of the specified pass. */
+		void updateObjectParam(ParamRefType type, UINT32 passIdx, const ObjectParamInfo& paramInfo,
+			const SPtr<MaterialParamsType>& params);
+
+		/** Updates all parameters whose version is newer than the last update, or all of them if @p updateAll is true. */
+		void updateFull(const SPtr<MaterialParamsType>& params, bool updateAll);
+
+		/** Updates only the parameters recorded in the dirty ring of @p params since the last update. */
+		void updateDirty(const SPtr<MaterialParamsType>& params);
+
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
 		PassParamInfo* mPassParamInfos;
+		ObjectParamInfo* mObjectParamInfos;
+
+		/** 
+		 * For each material parameter, offset of its first entry in mParamRefs. Contains one extra entry at the end so
+		 * that the number of references for parameter i is mParamRefOffsets[i + 1] - mParamRefOffsets[i].
+		 */
+		Vector<UINT32> mParamRefOffsets;
+		Vector<ParamRef> mParamRefs;
 
 		UINT64 mParamVersion;
+		UINT64 mNumDirtyParams;
 		UINT8* mData;
 	};
 
@@ -188,6 +188,103 @@ namespace bs
 		return TMaterialParamSampState<Core>(name, getMaterialPtr(this));
 	}
 
+	template<bool Core>
+	void TMaterial<Core>::setTexture(const MaterialTextureParamHandle& handle, const TextureType& value, 
+		const TextureSurface& surface)
+	{
+		const MaterialParams::ParamData* data = resolveParam(handle);
+		if (data == nullptr)
+			return;
+
+		// If there is a default value, assign that instead of null
+		TextureType newValue = value;
+		if (newValue == nullptr)
+			mParams->getDefaultTexture(*data, newValue);
+
+		mParams->setTexture(*data, newValue, surface);
+		_markCoreDirty();
+		_markDependenciesDirty();
+		_markResourcesDirty();
+	}
+
+	template<bool Core>
+	typename TMaterial<Core>::TextureType TMaterial<Core>::getTexture(const MaterialTextureParamHandle& handle) const
+	{
+		TextureType texture;
+
+		const MaterialParams::ParamData* data = resolveParam(handle);
+		if (data == nullptr)
+			return texture;
+
+		TextureSurface surface;
+		mParams->getTexture(*data, texture, surface);
+
+		return texture;
+	}
+
+	template<bool Core>
+	void TMaterial<Core>::setBuffer(const MaterialBufferParamHandle& handle, const BufferType& value)
+	{
+		const MaterialParams::ParamData* data = resolveParam(handle);
+		if (data == nullptr)
+			return;
+
+		mParams->setBuffer(*data, value);
+		_markCoreDirty();
+		_markDependenciesDirty();
+	}
+
+	template<bool Core>
+	void TMaterial<Core>::setSamplerState(const MaterialSamplerStateParamHandle& handle, const SamplerStateType& value)
+	{
+		const MaterialParams::ParamData* data = resolveParam(handle);
+		if (data == nullptr)
+			return;
+
+		// If there is a default value, assign that instead of null
+		SamplerStateType newValue = value;
+		if (newValue == nullptr)
+			mParams->getDefaultSamplerState(*data, newValue);
+
+		mParams->setSamplerState(*data, newValue);
+		_markCoreDirty();
+		_markDependenciesDirty();
+	}
+
+	template<bool Core>
+	typename TMaterial<Core>::SamplerStateType TMaterial<Core>::getSamplerState(
+		const MaterialSamplerStateParamHandle& handle) const
+	{
+		SamplerStateType samplerState;
+
+		const MaterialParams::ParamData* data = resolveParam(handle);
+		if (data != nullptr)
+			mParams->getSamplerState(*data, samplerState);
+
+		return samplerState;
+	}
+
+	template<bool Core>
+	const MaterialParams::ParamData* TMaterial<Core>::resolveParam(const MaterialParamHandle& handle, 
+		UINT32 arrayIdx) const
+	{
+		throwIfNotInitialized();
+
+		UINT32 paramIdx = handle.resolve(*mParams);
+		if (paramIdx == (UINT32)-1)
+			return nullptr;
+
+		const MaterialParams::ParamData* data = mParams->getParamData(paramIdx);
+		if (arrayIdx >= data->arraySize)
+		{
+			LOGWRN("Array index out of range. Provided index was " + toString(arrayIdx) + 
+				" but array length is " + toString(data->arraySize));
+			return nullptr;
+		}
+
+		return data;
+	}
+
 	template<bool Core>
 	void TMaterial<Core>::initializeTechniques(bool allVariations, const ShaderVariation& variation)
 	{
@@ -492,13 +589,14 @@ namespace bs
 			mParams->getSyncData(nullptr, paramsSize, syncAllParams);
 
 		UINT32 numTechniques = (UINT32)mTechniques.size();
-		UINT32 size = sizeof(bool) + sizeof(UINT32) * 2 + sizeof(SPtr<ct::Shader>) + 
+		UINT32 size = sizeof(bool) * 2 + sizeof(UINT32) * 2 + sizeof(SPtr<ct::Shader>) + 
 			sizeof(SPtr<ct::Technique>) * numTechniques + paramsSize;
 
 		UINT8* buffer = allocator->alloc(size);
 		char* dataPtr = (char*)buffer;
 
 		dataPtr = rttiWriteElem(syncAllParams, dataPtr);
+		dataPtr = rttiWriteElem(mInstancingEnabled, dataPtr);
 		
 		SPtr<ct::Shader>* shader = new (dataPtr)SPtr<ct::Shader>();
 		if (mShader.isLoaded(false))
@@ -832,6 +930,7 @@ namespace bs
 
 		bool syncAllParams;
 		dataPtr = rttiReadElem(syncAllParams, dataPtr);
+		dataPtr = rttiReadElem(mInstancingEnabled, dataPtr);
 
 		if(syncAllParams)
 			mParams = nullptr;
@@ -7,6 +7,7 @@
 #include "Resources/BsIResourceListener.h"
 #include "Material/BsMaterialParam.h"
 #include "Material/BsMaterialParams.h"
+#include "Material/BsMaterialParamHandle.h"
 #include "Material/BsTechnique.h"
 #include "Math/BsVector2.h"
 #include "Math/BsVector3.h"
@@ -147,6 +148,15 @@ namespace bs
 		/** Returns the total number of techniques supported by this material. */
 		UINT32 getNumTechniques() const { return (UINT32)mTechniques.size(); }
 
+		/** 
+		 * Determines if the renderer is allowed to merge objects using this material into instanced draw calls. Only 
+		 * relevant if the shader provides an instanced variation. Enabled by default.
+		 */
+		void setInstancingEnabled(bool enabled) { mInstancingEnabled = enabled; _markCoreDirty(); }
+
+		/** @copydoc setInstancingEnabled */
+		bool getInstancingEnabled() const { return mInstancingEnabled; }
+
 		/** Attempts to find a technique matching the specified variation and tags. Returns -1 if none can be found. */
 		UINT32 findTechnique(const FIND_TECHNIQUE_DESC& desc) const;
 
@@ -191,13 +201,63 @@ namespace bs
 		 */
 		void updateParamsSet(const SPtr<GpuParamsSetType>& paramsSet, bool updateAll = false);
 
+		/**
+		 * Assigns a value to the data parameter referenced by the provided handle. Unlike the name-based setters this 
+		 * doesn't require a name lookup, as long as the handle was already used with a material using the same shader.
+		 *
+		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
+		 */
+		template<class T>
+		void setValue(const TMaterialDataParamHandle<T>& handle, const T& value, UINT32 arrayIdx = 0)
+		{
+			const MaterialParams::ParamData* data = resolveParam(handle, arrayIdx);
+			if (data == nullptr)
+				return;
+
+			mParams->setDataParam(*data, arrayIdx, value);
+			_markCoreDirty();
+		}
+
+		/**
+		 * Returns the value of the data parameter referenced by the provided handle. 
+		 *
+		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
+		 */
+		template<class T>
+		T getValue(const TMaterialDataParamHandle<T>& handle, UINT32 arrayIdx = 0) const
+		{
+			T output{};
+
+			const MaterialParams::ParamData* data = resolveParam(handle, arrayIdx);
+			if (data != nullptr)
+				mParams->getDataParam(*data, arrayIdx, output);
+
+			return output;
+		}
+
+		/** Assigns a texture to the shader parameter referenced by the provided handle. */
+		void setTexture(const MaterialTextureParamHandle& handle, const TextureType& value, 
+			const TextureSurface& surface = TextureSurface::COMPLETE);
+
+		/** Returns a texture assigned to the shader parameter referenced by the provided handle. */
+		TextureType getTexture(const MaterialTextureParamHandle& handle) const;
+
+		/** Assigns a buffer to the shader parameter referenced by the provided handle. */
+		void setBuffer(const MaterialBufferParamHandle& handle, const BufferType& value);
+
+		/** Assigns a sampler state to the shader parameter referenced by the provided handle. */
+		void setSamplerState(const MaterialSamplerStateParamHandle& handle, const SamplerStateType& value);
+
+		/** Returns a sampler state assigned to the shader parameter referenced by the provided handle. */
+		SamplerStateType getSamplerState(const MaterialSamplerStateParamHandle& handle) const;
+
 		/**   
 		 * Assigns a float value to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetFloat)
-		void setFloat(const String& name, float value, UINT32 arrayIdx = 0)	{ return getParamFloat(name).set(value, arrayIdx); }
+		void setFloat(const String& name, float value, UINT32 arrayIdx = 0)	{ setValue(MaterialFloatParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a color to the shader parameter with the specified name. 
@@ -205,7 +265,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetColor)
-		void setColor(const String& name, const Color& value, UINT32 arrayIdx = 0) { return getParamColor(name).set(value, arrayIdx); }
+		void setColor(const String& name, const Color& value, UINT32 arrayIdx = 0) { setValue(MaterialColorParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 2D vector to the shader parameter with the specified name. 
@@ -213,7 +273,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetVector2)
-		void setVec2(const String& name, const Vector2& value, UINT32 arrayIdx = 0)	{ return getParamVec2(name).set(value, arrayIdx); }
+		void setVec2(const String& name, const Vector2& value, UINT32 arrayIdx = 0)	{ setValue(MaterialVec2ParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 3D vector to the shader parameter with the specified name. 
@@ -221,7 +281,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetVector3)
-		void setVec3(const String& name, const Vector3& value, UINT32 arrayIdx = 0)	{ return getParamVec3(name).set(value, arrayIdx); }
+		void setVec3(const String& name, const Vector3& value, UINT32 arrayIdx = 0)	{ setValue(MaterialVec3ParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 4D vector to the shader parameter with the specified name. 
@@ -229,7 +289,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetVector4)
-		void setVec4(const String& name, const Vector4& value, UINT32 arrayIdx = 0)	{ return getParamVec4(name).set(value, arrayIdx); }
+		void setVec4(const String& name, const Vector4& value, UINT32 arrayIdx = 0)	{ setValue(MaterialVec4ParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 3x3 matrix to the shader parameter with the specified name. 
@@ -237,7 +297,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetMatrix3)
-		void setMat3(const String& name, const Matrix3& value, UINT32 arrayIdx = 0)	{ return getParamMat3(name).set(value, arrayIdx); }
+		void setMat3(const String& name, const Matrix3& value, UINT32 arrayIdx = 0)	{ setValue(MaterialMat3ParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 4x4 matrix to the shader parameter with the specified name. 
@@ -245,7 +305,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
 		BS_SCRIPT_EXPORT(n:SetMatrix4)
-		void setMat4(const String& name, const Matrix4& value, UINT32 arrayIdx = 0)	{ return getParamMat4(name).set(value, arrayIdx); }
+		void setMat4(const String& name, const Matrix4& value, UINT32 arrayIdx = 0)	{ setValue(MaterialMat4ParamHandle(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a structure to the shader parameter with the specified name.
@@ -259,7 +319,7 @@ namespace bs
 		/** Assigns a texture to the shader parameter with the specified name. */
 		void setTexture(const String& name, const TextureType& value, const TextureSurface& surface = TextureSurface::COMPLETE)
 		{
-			return getParamTexture(name).set(value, surface);
+			setTexture(MaterialTextureParamHandle(name), value, surface);
 		}
 
 		/** Assigns a texture to be used for random load/store operations to the shader parameter with the specified name. */
@@ -269,10 +329,13 @@ namespace bs
 		}
 
 		/** Assigns a buffer to the shader parameter with the specified name. */
-		void setBuffer(const String& name, const BufferType& value) { return getParamBuffer(name).set(value); }
+		void setBuffer(const String& name, const BufferType& value) { setBuffer(MaterialBufferParamHandle(name), value); }
 
 		/** Assigns a sampler state to the shader parameter with the specified name. */
-		void setSamplerState(const String& name, const SamplerStateType& value) { return getParamSamplerState(name).set(value); }
+		void setSamplerState(const String& name, const SamplerStateType& value) 
+		{ 
+			setSamplerState(MaterialSamplerStateParamHandle(name), value); 
+		}
 
 		/**
 		 * Returns a float value assigned with the parameter with the specified name.
@@ -280,7 +343,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetFloat)
-		float getFloat(const String& name, UINT32 arrayIdx = 0) const { return getParamFloat(name).get(arrayIdx); }
+		float getFloat(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialFloatParamHandle(name), arrayIdx); }
 
 		/**
 		 * Returns a color assigned with the parameter with the specified name.
@@ -288,7 +351,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetColor)
-		Color getColor(const String& name, UINT32 arrayIdx = 0) const { return getParamColor(name).get(arrayIdx); }
+		Color getColor(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialColorParamHandle(name), arrayIdx); }
 
 		/**
 		 * Returns a 2D vector assigned with the parameter with the specified name.
@@ -296,7 +359,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetVector2)
-		Vector2 getVec2(const String& name, UINT32 arrayIdx = 0) const { return getParamVec2(name).get(arrayIdx); }
+		Vector2 getVec2(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialVec2ParamHandle(name), arrayIdx); }
 
 		/**
 		 * Returns a 3D vector assigned with the parameter with the specified name.
@@ -304,7 +367,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetVector3)
-		Vector3 getVec3(const String& name, UINT32 arrayIdx = 0) const { return getParamVec3(name).get(arrayIdx); }
+		Vector3 getVec3(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialVec3ParamHandle(name), arrayIdx); }
 
 		/**
 		 * Returns a 4D vector assigned with the parameter with the specified name.
@@ -312,7 +375,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetVector4)
-		Vector4 getVec4(const String& name, UINT32 arrayIdx = 0) const { return getParamVec4(name).get(arrayIdx); }
+		Vector4 getVec4(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialVec4ParamHandle(name), arrayIdx); }
 
 		/**
 		 * Returns a 3x3 matrix assigned with the parameter with the specified name.
@@ -320,7 +383,7 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetMatrix3)
-		Matrix3 getMat3(const String& name, UINT32 arrayIdx = 0) const { return getParamMat3(name).get(arrayIdx); }
+		Matrix3 getMat3(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialMat3ParamHandle(name), arrayIdx); }
 
 		/**
 		 * Returns a 4x4 matrix assigned with the parameter with the specified name.
@@ -328,13 +391,16 @@ namespace bs
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
 		BS_SCRIPT_EXPORT(n:GetMatrix4)
-		Matrix4 getMat4(const String& name, UINT32 arrayIdx = 0) const { return getParamMat4(name).get(arrayIdx); }
+		Matrix4 getMat4(const String& name, UINT32 arrayIdx = 0) const { return getValue(MaterialMat4ParamHandle(name), arrayIdx); }
 
 		/** Returns a texture assigned with the parameter with the specified name. */
-		TextureType getTexture(const String& name) const { return getParamTexture(name).get(); }
+		TextureType getTexture(const String& name) const { return getTexture(MaterialTextureParamHandle(name)); }
 
 		/** Returns a sampler state assigned with the parameter with the specified name. */
-		SamplerStateType getSamplerState(const String& name) const	{ return getParamSamplerState(name).get(); }
+		SamplerStateType getSamplerState(const String& name) const	
+		{ 
+			return getSamplerState(MaterialSamplerStateParamHandle(name)); 
+		}
 
 		/**
 		 * Returns a buffer representing a structure assigned to the parameter with the specified name.
@@ -583,9 +649,16 @@ namespace bs
 		/** Throw an exception if no shader is set, or no acceptable technique was found. */
 		void throwIfNotInitialized() const;
 
+		/** 
+		 * Resolves the parameter handle for the current shader. Returns null and logs an error if the parameter doesn't
+		 * exist, or if @p arrayIdx is out of range.
+		 */
+		const MaterialParams::ParamData* resolveParam(const MaterialParamHandle& handle, UINT32 arrayIdx = 0) const;
+
 		ShaderType mShader;
 		SPtr<MaterialParamsType> mParams;
 		Vector<SPtr<TechniqueType>> mTechniques;
+		bool mInstancingEnabled = true;
 	};
 
 	/** @} */
@@ -0,0 +1,24 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Material/BsMaterialParamHandle.h"
+
+namespace bs
+{
+	UINT32 MaterialParamHandle::resolveSlow(const MaterialParamsBase& params) const
+	{
+		UINT32 paramIdx;
+		auto result = params.getParamIndex(mName, mType, mDataType, 0, paramIdx);
+
+		if (result != MaterialParamsBase::GetParamResult::Success)
+		{
+			params.reportGetParamError(result, mName.empty() ? StringUtil::BLANK : String(mName.cstr()), 0);
+			return (UINT32)-1;
+		}
+
+		UINT32 layoutId = params.getLayoutId();
+		if (layoutId != (UINT32)-1)
+			mCache.store(((UINT64)layoutId << 32) | paramIdx, std::memory_order_relaxed);
+
+		return paramIdx;
+	}
+}
@@ -0,0 +1,131 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Material/BsMaterialParams.h"
+
+namespace bs
+{
+	/** @addtogroup Material
+	 *  @{
+	 */
+
+	/**
+	 * Handle to a named material parameter. Unlike the handles returned by Material::getParam* methods, this handle is
+	 * not tied to a specific material. Instead it can be used for accessing the parameter on any material, and it will
+	 * cache the parameter location for the last shader it was used with. This means the name lookup is only performed
+	 * once for all materials sharing the same shader.
+	 *
+	 * Handles are normally constructed once (e.g. as static or member variables) using a compile-time hashed name (see
+	 * BS_SID), and then passed to Material::setParam, Material::setTexture and similar methods.
+	 *
+	 * @note	Thread safe. The same handle may be used with different materials from multiple threads at once.
+	 */
+	class BS_CORE_EXPORT MaterialParamHandle
+	{
+	public:
+		MaterialParamHandle(const StringID& name, MaterialParamsBase::ParamType type, GpuParamDataType dataType)
+			:mName(name), mType(type), mDataType(dataType), mCache(INVALID_CACHE)
+		{ }
+
+		MaterialParamHandle(const MaterialParamHandle& other)
+			:mName(other.mName), mType(other.mType), mDataType(other.mDataType)
+			, mCache(other.mCache.load(std::memory_order_relaxed))
+		{ }
+
+		MaterialParamHandle& operator=(const MaterialParamHandle& other)
+		{
+			mName = other.mName;
+			mType = other.mType;
+			mDataType = other.mDataType;
+			mCache.store(other.mCache.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+			return *this;
+		}
+
+		/** Returns the name of the parameter the handle points to. */
+		const StringID& getName() const { return mName; }
+
+		/**
+		 * Finds the index of the parameter in the provided parameters object. If the object has the same layout as the
+		 * object the handle was last resolved with, the cached index is returned without performing a lookup.
+		 *
+		 * @param[in]	params		Parameters to find the parameter in.
+		 * @return					Index of the parameter that can be passed to MaterialParamsBase::getParamData, or -1 if
+		 *							the parameter wasn't found or is of invalid type. In the latter case an error is
+		 *							logged.
+		 */
+		UINT32 resolve(const MaterialParamsBase& params) const
+		{
+			UINT32 layoutId = params.getLayoutId();
+			UINT64 cache = mCache.load(std::memory_order_relaxed);
+
+			if (layoutId != (UINT32)-1 && (UINT32)(cache >> 32) == layoutId)
+				return (UINT32)cache;
+
+			return resolveSlow(params);
+		}
+
+	private:
+		static const UINT64 INVALID_CACHE = (UINT64)-1;
+
+		/** Performs the parameter lookup and updates the cache. */
+		UINT32 resolveSlow(const MaterialParamsBase& params) const;
+
+		StringID mName;
+		MaterialParamsBase::ParamType mType;
+		GpuParamDataType mDataType;
+
+		/** Layout ID in the upper 32 bits, and the parameter index in the lower 32 bits. */
+		mutable std::atomic<UINT64> mCache;
+	};
+
+	/** Handle to a material data parameter of type @p T. See MaterialParamHandle. */
+	template<class T>
+	class TMaterialDataParamHandle : public MaterialParamHandle
+	{
+	public:
+		TMaterialDataParamHandle(const StringID& name)
+			:MaterialParamHandle(name, MaterialParamsBase::ParamType::Data,
+				(GpuParamDataType)TGpuDataParamInfo<T>::TypeId)
+		{ }
+	};
+
+	/** Handle to a material texture parameter. See MaterialParamHandle. */
+	class MaterialTextureParamHandle : public MaterialParamHandle
+	{
+	public:
+		MaterialTextureParamHandle(const StringID& name)
+			:MaterialParamHandle(name, MaterialParamsBase::ParamType::Texture, GPDT_UNKNOWN)
+		{ }
+	};
+
+	/** Handle to a material buffer parameter. See MaterialParamHandle. */
+	class MaterialBufferParamHandle : public MaterialParamHandle
+	{
+	public:
+		MaterialBufferParamHandle(const StringID& name)
+			:MaterialParamHandle(name, MaterialParamsBase::ParamType::Buffer, GPDT_UNKNOWN)
+		{ }
+	};
+
+	/** Handle to a material sampler state parameter. See MaterialParamHandle. */
+	class MaterialSamplerStateParamHandle : public MaterialParamHandle
+	{
+	public:
+		MaterialSamplerStateParamHandle(const StringID& name)
+			:MaterialParamHandle(name, MaterialParamsBase::ParamType::Sampler, GPDT_UNKNOWN)
+		{ }
+	};
+
+	typedef TMaterialDataParamHandle<float> MaterialFloatParamHandle;
+	typedef TMaterialDataParamHandle<Color> MaterialColorParamHandle;
+	typedef TMaterialDataParamHandle<Vector2> MaterialVec2ParamHandle;
+	typedef TMaterialDataParamHandle<Vector3> MaterialVec3ParamHandle;
+	typedef TMaterialDataParamHandle<Vector4> MaterialVec4ParamHandle;
+	typedef TMaterialDataParamHandle<Matrix3> MaterialMat3ParamHandle;
+	typedef TMaterialDataParamHandle<Matrix4> MaterialMat4ParamHandle;
+
+	/** @} */
+}
@@ -121,7 +121,7 @@ namespace bs
 		mAlloc.clear();
 	}
 
-	UINT32 MaterialParamsBase::getParamIndex(const String& name) const
+	UINT32 MaterialParamsBase::getParamIndex(const StringID& name) const
 	{
 		auto iterFind = mParamLookup.find(name);
 		if (iterFind == mParamLookup.end())
@@ -130,7 +130,7 @@ namespace bs
 		return iterFind->second;
 	}
 
-	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const String& name, ParamType type,
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const StringID& name, ParamType type,
 		GpuParamDataType dataType, UINT32 arrayIdx, UINT32& output) const
 	{
 		auto iterFind = mParamLookup.find(name);
@@ -150,7 +150,7 @@ namespace bs
 		return GetParamResult::Success;
 	}
 
-	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const String& name, ParamType type, 
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const StringID& name, ParamType type, 
 		GpuParamDataType dataType, UINT32 arrayIdx, const ParamData** output) const
 	{
 		auto iterFind = mParamLookup.find(name);
@@ -216,6 +216,8 @@ namespace bs
 			shader->getBufferParams(),
 			shader->getSamplerParams())
 	{
+		mLayoutId = shader->getId();
+
 		auto& dataParams = shader->getDataParams();
 		auto& textureParams = shader->getTextureParams();
 		auto& samplerParams = shader->getSamplerParams();
@@ -454,7 +456,7 @@ namespace bs
 		}
 
 		memcpy(structParam.data, value, structParam.dataSize);
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -480,7 +482,7 @@ namespace bs
 		textureParam.isLoadStore = false;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -494,7 +496,7 @@ namespace bs
 	{
 		mBufferParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -513,7 +515,7 @@ namespace bs
 		textureParam.isLoadStore = true;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -533,7 +535,7 @@ namespace bs
 	{
 		mSamplerStateParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -846,6 +848,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx);
 
 			UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[(int)param.dataType];
@@ -863,6 +866,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -878,6 +882,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -893,6 +898,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
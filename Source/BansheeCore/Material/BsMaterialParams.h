@@ -120,7 +120,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @return					Index of the parameter, or -1 if not found.
 		 */
-		UINT32 getParamIndex(const String& name) const;
+		UINT32 getParamIndex(const StringID& name) const;
 
 		/** 
 		 * Returns an index of the parameter with the specified name. Index can be used in a call to getParamData(UINT32) to
@@ -135,7 +135,7 @@ namespace bs
 		 * @param[out]	output		Index of the requested parameter, only valid if success is returned.
 		 * @return					Success or error state of the request.
 		 */
-		GetParamResult getParamIndex(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+		GetParamResult getParamIndex(const StringID& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			UINT32& output) const;
 
 		/**
@@ -153,7 +153,7 @@ namespace bs
 		 *							some other error was reported.
 		 * @return					Success or error state of the request.
 		 */
-		GetParamResult getParamData(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+		GetParamResult getParamData(const StringID& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			const ParamData** output) const;
 
 		/**
@@ -164,6 +164,13 @@ namespace bs
 		/** Returns the total number of parameters managed by this object. */
 		UINT32 getNumParams() const { return (UINT32)mParams.size(); }
 
+		/** 
+		 * Returns an identifier that is shared by all parameter objects with the same parameter layout (i.e. created from
+		 * the same shader). Parameter indices are interchangeable between objects with the same layout. Returns -1 if the
+		 * layout is not known (e.g. the object was deserialized).
+		 */
+		UINT32 getLayoutId() const { return mLayoutId; }
+
 		/**
 		 * Logs an error that was reported by getParamData().
 		 *
@@ -206,7 +213,7 @@ namespace bs
 			assert(sizeof(input) == paramTypeSize);
 			memcpy(&mDataParamsBuffer[param.index + arrayIdx * paramTypeSize], &input, paramTypeSize);
 
-			param.version = ++mParamVersion;
+			markParamDirty(param);
 		}
 
 		/** Returns pointer to the internal data buffer for a data parameter at the specified index. */
@@ -218,10 +225,40 @@ namespace bs
 		/** Returns a counter that gets incremented whenever a parameter gets updated. */
 		UINT64 getParamVersion() const { return mParamVersion; }
 
+		/** 
+		 * Returns the total number of parameter changes recorded in the dirty ring. Callers can remember this value and
+		 * later use getDirtyParam() to find out which parameters changed since. If more than DIRTY_RING_SIZE changes were
+		 * made in the meantime the ring has overflowed and the caller must assume all parameters are dirty.
+		 */
+		UINT64 getNumDirtyParams() const { return mNumDirtyParams; }
+
+		/** 
+		 * Returns the index of the parameter that was changed at the specified position in the dirty ring. Only positions
+		 * in range [getNumDirtyParams() - DIRTY_RING_SIZE, getNumDirtyParams()) are valid.
+		 */
+		UINT32 getDirtyParam(UINT64 position) const { return mDirtyRing[position & (DIRTY_RING_SIZE - 1)]; }
+
+		/** Number of most recent parameter changes that are kept track of. Must be a power of two. */
+		static const UINT32 DIRTY_RING_SIZE = 64;
+
 	protected:
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
 
-		UnorderedMap<String, UINT32> mParamLookup;
+		/** Increments the parameter version and records the parameter in the dirty ring. */
+		void markParamDirty(const ParamData& param) const
+		{
+			param.version = ++mParamVersion;
+			recordDirtyParam((UINT32)(&param - mParams.data()));
+		}
+
+		/** Records a parameter with the specified index in the dirty ring, without changing its version. */
+		void recordDirtyParam(UINT32 paramIdx) const
+		{
+			mDirtyRing[mNumDirtyParams & (DIRTY_RING_SIZE - 1)] = paramIdx;
+			mNumDirtyParams++;
+		}
+
+		UnorderedMap<StringID, UINT32> mParamLookup;
 		Vector<ParamData> mParams;
 
 		UINT8* mDataParamsBuffer = nullptr;
@@ -232,7 +269,11 @@ namespace bs
 		UINT32 mNumBufferParams = 0;
 		UINT32 mNumSamplerParams = 0;
 
+		UINT32 mLayoutId = (UINT32)-1;
+
 		mutable UINT64 mParamVersion = 1;
+		mutable UINT32 mDirtyRing[DIRTY_RING_SIZE];
+		mutable UINT64 mNumDirtyParams = 0;
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
 	};
 
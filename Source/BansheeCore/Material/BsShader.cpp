@@ -518,6 +518,10 @@ namespace bs
 		SPtr<Shader> newShader = bs_core_ptr<Shader>(new (bs_alloc<Shader>()) Shader());
 		newShader->_setThisPtr(newShader);
 
+		// ID isn't serialized, deserialized shaders need a fresh one just like newly created shaders
+		newShader->mId = ct::Shader::mNextShaderId.fetch_add(1, std::memory_order_relaxed);
+		assert(newShader->mId < std::numeric_limits<UINT32>::max() && "Created too many shaders, reached maximum id.");
+
 		return newShader;
 	}
 
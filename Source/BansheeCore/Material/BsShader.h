@@ -228,7 +228,7 @@ namespace bs
 		typedef typename TSHADER_DESC<Core>::TextureType TextureType;
 		typedef typename TSHADER_DESC<Core>::SamplerStateType SamplerStateType;
 
-		TShader() { }
+		TShader() :mId(0) { }
 		TShader(const String& name, const TSHADER_DESC<Core>& desc, const Vector<SPtr<TechniqueType>>& techniques, UINT32 id);
 		virtual ~TShader();
 	
@@ -293,6 +293,8 @@ namespace bs
 
 	namespace ct
 	{
+	UINT64 Mesh::mNextVersion = 0;
+
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc, GpuDeviceFlags deviceMask)
 		: MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr)
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType), mDeviceMask(deviceMask)
@@ -343,6 +345,8 @@ namespace bs
 			mVertexData->setBuffer(i, vertexBuffer);
 		}
 
+		mVersion = ++mNextVersion;
+
 		// TODO Low priority - DX11 (and maybe OpenGL)? allow an optimization that allows you to set
 		// buffer data upon buffer construction, instead of setting it in a second step like I do here
 		if (mTempInitialMeshData != nullptr)
@@ -379,6 +383,8 @@ namespace bs
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		mVersion = ++mNextVersion;
+
 		if (discardEntireBuffer)
 		{
 			if ((mUsage & MU_STATIC) != 0)
@@ -299,6 +299,13 @@ namespace bs
 		/** Returns an object containing all shapes used for morph animation, if any are available. */
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/** 
+		 * Returns a version that can be used for detecting modifications of the mesh contents by external systems. The
+		 * version changes whenever the mesh is initialized or its data is written through writeData(). Versions are unique
+		 * across all meshes, so a mesh created at the address of a destroyed mesh never reports the same version.
+		 */
+		UINT64 getVersion() const { return mVersion; }
+
 		/**
 		 * Updates the current mesh with the provided data.
 		 *
@@ -396,6 +403,9 @@ namespace bs
 		SPtr<MeshData> mTempInitialMeshData;
 		SPtr<Skeleton> mSkeleton; // Immutable
 		SPtr<MorphShapes> mMorphShapes; // Immutable
+		UINT64 mVersion = 0;
+
+		static UINT64 mNextVersion;
 	};
 
 	/** @} */
@@ -34,6 +34,9 @@ namespace bs
 		bool& getItalic(FontImportOptions* obj) { return obj->mItalic; }
 		void setItalic(FontImportOptions* obj, bool& value) { obj->mItalic = value; }
 
+		bool& getDynamic(FontImportOptions* obj) { return obj->mDynamic; }
+		void setDynamic(FontImportOptions* obj, bool& value) { obj->mDynamic = value; }
+
 	public:
 		FontImportOptionsRTTI()
 		{
@@ -43,6 +46,7 @@ namespace bs
 			addPlainField("mRenderMode", 3, &FontImportOptionsRTTI::getRenderMode, &FontImportOptionsRTTI::setRenderMode);
 			addPlainField("mBold", 4, &FontImportOptionsRTTI::getBold, &FontImportOptionsRTTI::setBold);
 			addPlainField("mItalic", 5, &FontImportOptionsRTTI::getItalic, &FontImportOptionsRTTI::setItalic);
+			addPlainField("mDynamic", 6, &FontImportOptionsRTTI::getDynamic, &FontImportOptionsRTTI::setDynamic);
 		}
 
 		const String& getRTTIName() override
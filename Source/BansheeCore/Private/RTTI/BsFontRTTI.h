@@ -7,6 +7,7 @@
 #include "Text/BsFont.h"
 #include "Text/BsFontManager.h"
 #include "Image/BsTexture.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -80,6 +81,10 @@ namespace bs
 
 		UINT32 getNumBitmaps(Font* obj)
 		{
+			// Bitmaps of dynamic fonts are generated at runtime
+			if(obj->isDynamic())
+				return 0;
+
 			return (UINT32)obj->mFontDataPerSize.size();
 		}
 
@@ -90,10 +95,48 @@ namespace bs
 			initData->fontDataPerSize.resize(size);
 		}
 
+		SPtr<DataStream> getFontFile(Font* obj, UINT32& size)
+		{
+			if(obj->mFontFile == nullptr)
+			{
+				size = 0;
+				return bs_shared_ptr_new<MemoryDataStream>(nullptr, 0, false);
+			}
+
+			size = (UINT32)obj->mFontFile->size();
+			return bs_shared_ptr_new<MemoryDataStream>(obj->mFontFile->getPtr(), size, false);
+		}
+
+		void setFontFile(Font* obj, const SPtr<DataStream>& value, UINT32 size)
+		{
+			if(size == 0)
+				return;
+
+			obj->mFontFile = bs_shared_ptr_new<MemoryDataStream>(size);
+			value->read(obj->mFontFile->getPtr(), size);
+		}
+
+		UINT32& getDPI(Font* obj) { return obj->mDynamicDesc.dpi; }
+		void setDPI(Font* obj, UINT32& value) { obj->mDynamicDesc.dpi = value; }
+
+		FontRenderMode& getRenderMode(Font* obj) { return obj->mDynamicDesc.renderMode; }
+		void setRenderMode(Font* obj, FontRenderMode& value) { obj->mDynamicDesc.renderMode = value; }
+
+		UINT32& getPageSize(Font* obj) { return obj->mDynamicDesc.pageSize; }
+		void setPageSize(Font* obj, UINT32& value) { obj->mDynamicDesc.pageSize = value; }
+
+		UINT32& getMaxPagesPerSize(Font* obj) { return obj->mDynamicDesc.maxPagesPerSize; }
+		void setMaxPagesPerSize(Font* obj, UINT32& value) { obj->mDynamicDesc.maxPagesPerSize = value; }
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addDataBlockField("mFontFile", 1, &FontRTTI::getFontFile, &FontRTTI::setFontFile, 0);
+			addPlainField("mDPI", 2, &FontRTTI::getDPI, &FontRTTI::setDPI);
+			addPlainField("mRenderMode", 3, &FontRTTI::getRenderMode, &FontRTTI::setRenderMode);
+			addPlainField("mPageSize", 4, &FontRTTI::getPageSize, &FontRTTI::setPageSize);
+			addPlainField("mMaxPagesPerSize", 5, &FontRTTI::getMaxPagesPerSize, &FontRTTI::setMaxPagesPerSize);
 		}
 
 		const String& getRTTIName() override
@@ -126,7 +169,10 @@ namespace bs
 			Font* font = static_cast<Font*>(obj);
 			FontInitData* initData = any_cast<FontInitData*>(font->mRTTIData);
 
-			font->initialize(initData->fontDataPerSize);
+			if(font->mFontFile != nullptr)
+				font->initialize(font->mFontFile, font->mDynamicDesc);
+			else
+				font->initialize(initData->fontDataPerSize);
 
 			bs_delete(initData);
 		}
@@ -105,7 +105,7 @@ namespace bs
 			UINT32 paramIdx = (UINT32)obj->mParams.size();
 			obj->mParams.push_back(param.data);
 
-			obj->mParamLookup[param.name] = paramIdx;
+			obj->mParamLookup[StringID(param.name)] = paramIdx;
 		}
 
 		UINT32 getParamDataArraySize(MaterialParams* obj)
@@ -208,7 +208,7 @@ namespace bs
 			for (auto& entry : paramsObj->mParamLookup)
 			{
 				UINT32 paramIdx = entry.second;
-				matParams.push_back({ entry.first, paramsObj->mParams[paramIdx] });
+				matParams.push_back({ entry.first.cstr(), paramsObj->mParams[paramIdx] });
 			}
 
 			paramsObj->mRTTIData = matParams;
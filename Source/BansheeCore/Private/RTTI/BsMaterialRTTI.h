@@ -22,11 +22,15 @@ namespace bs
 		SPtr<MaterialParams> getMaterialParams(Material* obj) { return obj->mParams; }
 		void setMaterialParams(Material* obj, SPtr<MaterialParams> value) { obj->mRTTIData = value; }
 
+		bool& getInstancingEnabled(Material* obj) { return obj->mInstancingEnabled; }
+		void setInstancingEnabled(Material* obj, bool& value) { obj->mInstancingEnabled = value; }
+
 	public:
 		MaterialRTTI()
 		{
 			addReflectableField("mShader", 0, &MaterialRTTI::getShader, &MaterialRTTI::setShader);
 			addReflectablePtrField("mMaterialParams", 2, &MaterialRTTI::getMaterialParams, &MaterialRTTI::setMaterialParams);
+			addPlainField("mInstancingEnabled", 3, &MaterialRTTI::getInstancingEnabled, &MaterialRTTI::setInstancingEnabled);
 		}
 
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override;
@@ -0,0 +1,318 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Private/UnitTests/BsCoreTestSuite.h"
+#include "Image/BsPixelUtil.h"
+#include "Image/BsPixelData.h"
+#include "Utility/BsBitwise.h"
+#include "Math/BsMath.h"
+
+#include <random>
+#include <nvtt.h>
+
+namespace bs
+{
+	/** Fills the buffer with random pixels of the provided format. Float values are mostly kept in the [0, 1] range. */
+	void fillRandomPixels(PixelFormat format, UINT8* data, UINT32 numPixels, std::mt19937& rng)
+	{
+		UINT32 pixelSize = PixelUtil::getNumElemBytes(format);
+		PixelComponentType componentType = PixelUtil::getElementType(format);
+		bool isFloat = PixelUtil::isFloatingPoint(format);
+
+		// Include some values outside of [0, 1] to test clamping, as well as some exact values
+		std::uniform_real_distribution<float> floatDist(-0.25f, 1.25f);
+		auto randomFloat = [&]()
+		{
+			if ((rng() % 16) == 0)
+				return (rng() % 3) * 0.5f;
+
+			return floatDist(rng);
+		};
+
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			UINT8* pixel = data + i * pixelSize;
+
+			if (isFloat && componentType == PCT_FLOAT32)
+			{
+				for (UINT32 j = 0; j < pixelSize / sizeof(float); j++)
+				{
+					float value = randomFloat();
+					memcpy(pixel + j * sizeof(float), &value, sizeof(value));
+				}
+			}
+			else if (isFloat && componentType == PCT_FLOAT16)
+			{
+				for (UINT32 j = 0; j < pixelSize / sizeof(UINT16); j++)
+				{
+					UINT16 value = Bitwise::floatToHalf(randomFloat());
+					memcpy(pixel + j * sizeof(UINT16), &value, sizeof(value));
+				}
+			}
+			else
+			{
+				for (UINT32 j = 0; j < pixelSize; j++)
+					pixel[j] = (UINT8)rng();
+			}
+		}
+	}
+
+	/** Writes all mip levels generated by NVTT into a set of pre-allocated buffers. */
+	struct NVTTTestOutputHandler : public nvtt::OutputHandler
+	{
+		NVTTTestOutputHandler(const Vector<SPtr<PixelData>>& buffers)
+			:buffers(buffers)
+		{ }
+
+		void beginImage(int size, int width, int height, int depth, int face, int miplevel) override
+		{
+			writePos = nullptr;
+			if (miplevel < 0 || miplevel >= (int)buffers.size() || (UINT32)size != buffers[miplevel]->getConsecutiveSize())
+				return;
+
+			writePos = buffers[miplevel]->getData();
+		}
+
+		bool writeData(const void* data, int size) override
+		{
+			if (writePos == nullptr)
+				return false;
+
+			memcpy(writePos, data, size);
+			writePos += size;
+
+			return true;
+		}
+
+		void endImage() override
+		{ }
+
+		Vector<SPtr<PixelData>> buffers;
+		UINT8* writePos = nullptr;
+	};
+
+	/** 
+	 * Generates a mip chain for a PF_RGBA8 image using NVTT, the way PixelUtil::genMipmaps() used to. Channels are
+	 * filtered independently, so the RGBA data is passed to NVTT as-is and read back in the same order. Returns an empty
+	 * list on failure.
+	 */
+	Vector<SPtr<PixelData>> generateNVTTMipmaps(const PixelData& src, MipMapFilter filter, bool isSRGB)
+	{
+		nvtt::InputOptions io;
+		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
+		io.setFormat(nvtt::InputFormat_BGRA_8UB);
+		io.setMipmapGeneration(true);
+		io.setMipmapFilter(filter == MipMapFilter::Kaiser ? nvtt::MipmapFilter_Kaiser : nvtt::MipmapFilter_Box);
+		io.setKaiserParameters(3.0f, 4.0f, 1.0f);
+		io.setWrapMode(nvtt::WrapMode_Mirror);
+
+		if (isSRGB)
+			io.setGamma(2.2f, 2.2f);
+		else
+			io.setGamma(1.0f, 1.0f);
+
+		io.setMipmapData(src.getData(), src.getWidth(), src.getHeight());
+
+		nvtt::CompressionOptions co;
+		co.setFormat(nvtt::Format_RGBA);
+		co.setPixelType(nvtt::PixelType_UnsignedNorm);
+		co.setPixelFormat(32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+
+		UINT32 numMips = PixelUtil::getMaxMipmaps(src.getWidth(), src.getHeight(), 1, src.getFormat());
+
+		Vector<SPtr<PixelData>> output;
+		for (UINT32 i = 0; i <= numMips; i++)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(src.getWidth(), src.getHeight(), 1, i, width, height, depth);
+
+			SPtr<PixelData> level = bs_shared_ptr_new<PixelData>(width, height, 1, PF_RGBA8);
+			level->allocateInternalBuffer();
+
+			output.push_back(level);
+		}
+
+		NVTTTestOutputHandler outputHandler(output);
+
+		nvtt::OutputOptions oo;
+		oo.setOutputHeader(false);
+		oo.setOutputHandler(&outputHandler);
+
+		nvtt::Compressor compressor;
+		if (!compressor.process(io, co, oo))
+			output.clear();
+
+		return output;
+	}
+
+	void CoreTestSuite::startUp()
+	{
+	}
+
+	void CoreTestSuite::shutDown()
+	{
+	}
+
+	CoreTestSuite::CoreTestSuite()
+	{
+		BS_ADD_TEST(CoreTestSuite::testPixelConversion);
+		BS_ADD_TEST(CoreTestSuite::testMipmapGeneration);
+	}
+
+	void CoreTestSuite::testPixelConversion()
+	{
+		static const PixelFormat FORMATS[] = { PF_R8, PF_RG8, PF_RGB8, PF_BGR8, PF_BGRA8, PF_RGBA8, PF_R16F, PF_RG16F,
+			PF_RGBA16F, PF_R32F, PF_RG32F, PF_RGB32F, PF_RGBA32F, PF_RGBA16, PF_RG16, PF_RGBA16U, PF_R8U, PF_RGBA8S };
+
+		// Not a multiple of four, so the kernels processing multiple pixels at once also go through their scalar tail
+		static constexpr UINT32 NUM_PIXELS = 1027;
+		static constexpr UINT32 MAX_PIXEL_SIZE = 16;
+
+		// Source and destination buffers are offset so they are unaligned, and the padding after the destination pixels
+		// is checked to ensure the kernels don't write past the end of the row
+		static constexpr UINT32 SRC_OFFSET = 1;
+		static constexpr UINT32 DST_OFFSET = 3;
+		static constexpr UINT32 PADDING = 16;
+
+		std::mt19937 rng(1234);
+
+		Vector<UINT8> src(NUM_PIXELS * MAX_PIXEL_SIZE + SRC_OFFSET);
+		Vector<UINT8> kernelOutput(NUM_PIXELS * MAX_PIXEL_SIZE + DST_OFFSET + PADDING);
+		Vector<UINT8> genericOutput(kernelOutput.size());
+
+		UINT32 numSpecialized = 0;
+		for (auto& srcFormat : FORMATS)
+		{
+			for (auto& dstFormat : FORMATS)
+			{
+				if (srcFormat == dstFormat)
+					continue;
+
+				fillRandomPixels(srcFormat, src.data() + SRC_OFFSET, NUM_PIXELS, rng);
+
+				memset(kernelOutput.data(), 0xCD, kernelOutput.size());
+				memset(genericOutput.data(), 0xCD, genericOutput.size());
+
+				if (!PixelUtil::_convertPixelRow(src.data() + SRC_OFFSET, srcFormat, kernelOutput.data() + DST_OFFSET, 
+					dstFormat, NUM_PIXELS))
+					continue;
+
+				PixelUtil::_convertPixelRow(src.data() + SRC_OFFSET, srcFormat, genericOutput.data() + DST_OFFSET,
+					dstFormat, NUM_PIXELS, true);
+
+				numSpecialized++;
+
+				UINT32 numBytes = DST_OFFSET + NUM_PIXELS * PixelUtil::getNumElemBytes(dstFormat) + PADDING;
+				BS_TEST_ASSERT_MSG(memcmp(kernelOutput.data(), genericOutput.data(), numBytes) == 0,
+					"Pixel conversion from " + PixelUtil::getFormatName(srcFormat) + " to " + 
+					PixelUtil::getFormatName(dstFormat) + " doesn't match the generic conversion.");
+			}
+		}
+
+		// Make sure the test actually exercised the kernels
+		BS_TEST_ASSERT(numSpecialized > 0);
+	}
+
+	void CoreTestSuite::testMipmapGeneration()
+	{
+		// Non-square, so the last few levels only get filtered in one direction
+		static constexpr UINT32 WIDTH = 64;
+		static constexpr UINT32 HEIGHT = 32;
+
+		// Linear results should only differ due to rounding. sRGB results differ more, as NVTT uses a 2.2 gamma curve
+		// instead of the exact sRGB curve.
+		static constexpr float MAX_ERROR_LINEAR = 2.0f;
+		static constexpr float MAX_MEAN_ERROR_LINEAR = 0.5f;
+		static constexpr float MAX_ERROR_SRGB = 12.0f;
+		static constexpr float MAX_MEAN_ERROR_SRGB = 1.5f;
+
+		std::mt19937 rng(1234);
+
+		// Smooth patterns with a bit of noise, representative of typical texture content
+		PixelData src(WIDTH, HEIGHT, 1, PF_RGBA8);
+		src.allocateInternalBuffer();
+
+		UINT8* srcPixels = src.getData();
+		for (UINT32 y = 0; y < HEIGHT; y++)
+		{
+			for (UINT32 x = 0; x < WIDTH; x++)
+			{
+				float values[4] =
+				{
+					127.5f + 127.5f * std::sin(Math::TWO_PI * x / 16.0f),
+					255.0f * y / (HEIGHT - 1),
+					127.5f + 127.5f * std::cos(Math::TWO_PI * (x + y) / 32.0f),
+					255.0f - 128.0f * x / (WIDTH - 1)
+				};
+
+				UINT8* pixel = srcPixels + (y * WIDTH + x) * 4;
+				for (UINT32 i = 0; i < 4; i++)
+				{
+					float noise = (float)(rng() % 9) - 4.0f;
+					pixel[i] = (UINT8)Math::clamp(values[i] + noise + 0.5f, 0.0f, 255.0f);
+				}
+			}
+		}
+
+		static const MipMapFilter FILTERS[] = { MipMapFilter::Box, MipMapFilter::Kaiser };
+		for (auto& filter : FILTERS)
+		{
+			for (UINT32 sRGB = 0; sRGB < 2; sRGB++)
+			{
+				String testName = String(filter == MipMapFilter::Box ? "Box" : "Kaiser") + (sRGB ? " sRGB" : " linear");
+
+				MipMapGenOptions options;
+				options.filter = filter;
+				options.wrapMode = MipMapWrapMode::Mirror;
+				options.isSRGB = sRGB != 0;
+
+				float maxAllowedError = sRGB ? MAX_ERROR_SRGB : MAX_ERROR_LINEAR;
+				float maxAllowedMeanError = sRGB ? MAX_MEAN_ERROR_SRGB : MAX_MEAN_ERROR_LINEAR;
+
+				Vector<SPtr<PixelData>> mips = PixelUtil::genMipmaps(src, options);
+				Vector<SPtr<PixelData>> reference = generateNVTTMipmaps(src, filter, sRGB != 0);
+
+				BS_TEST_ASSERT_MSG(!reference.empty(), testName + ": NVTT mipmap generation failed.");
+				if (reference.empty())
+					continue;
+
+				BS_TEST_ASSERT_MSG(mips.size() == reference.size(), testName + ": Mip level count doesn't match NVTT.");
+				if (mips.size() != reference.size())
+					continue;
+
+				for (UINT32 mip = 0; mip < (UINT32)mips.size(); mip++)
+				{
+					const PixelData& level = *mips[mip];
+					const PixelData& refLevel = *reference[mip];
+
+					if (level.getWidth() != refLevel.getWidth() || level.getHeight() != refLevel.getHeight())
+					{
+						BS_TEST_ASSERT_MSG(false, testName + ": Size of mip level " + toString(mip) + 
+							" doesn't match NVTT.");
+						continue;
+					}
+
+					UINT32 numValues = level.getWidth() * level.getHeight() * 4;
+					const UINT8* values = level.getData();
+					const UINT8* refValues = refLevel.getData();
+
+					float maxError = 0.0f;
+					float totalError = 0.0f;
+					for (UINT32 i = 0; i < numValues; i++)
+					{
+						float error = std::abs((float)values[i] - (float)refValues[i]);
+
+						maxError = std::max(maxError, error);
+						totalError += error;
+					}
+
+					float meanError = totalError / numValues;
+					BS_TEST_ASSERT_MSG(maxError <= maxAllowedError && meanError <= maxAllowedMeanError, testName + ": Mip level " +
+						toString(mip) + " differs from NVTT (max error " + toString(maxError) + ", mean error " +
+						toString(meanError) + ").");
+				}
+			}
+		}
+
+		src.freeInternalBuffer();
+	}
+}
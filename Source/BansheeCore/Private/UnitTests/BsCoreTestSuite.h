@@ -0,0 +1,20 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "Testing/BsTestSuite.h"
+
+namespace bs
+{
+	class CoreTestSuite : public TestSuite
+	{
+	public:
+		CoreTestSuite();
+		void startUp() override;
+		void shutDown() override;
+
+	private:
+		void testPixelConversion();
+		void testMipmapGeneration();
+	};
+}
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include <atomic>
 
 namespace bs
 {
@@ -23,41 +24,84 @@ namespace bs
 		RenderStatObject_Query
 	};
 
+	/** 
+	 * Counter storing the value of a single render statistic. Counters can be incremented from multiple threads at once
+	 * (e.g. when command buffers are recorded on worker threads), and otherwise behave as a plain integer.
+	 */
+	class RenderStatCounter
+	{
+	public:
+		RenderStatCounter(UINT64 value = 0)
+			:mValue(value)
+		{ }
+
+		RenderStatCounter(const RenderStatCounter& other)
+			:mValue(other.mValue.load(std::memory_order_relaxed))
+		{ }
+
+		RenderStatCounter& operator=(const RenderStatCounter& other)
+		{
+			mValue.store(other.mValue.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			return *this;
+		}
+
+		RenderStatCounter& operator+=(UINT64 count)
+		{
+			mValue.fetch_add(count, std::memory_order_relaxed);
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			mValue.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		operator UINT64() const { return mValue.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<UINT64> mValue;
+	};
+
 	/** Object that stores various render statistics. */
 	struct BS_CORE_EXPORT RenderStatsData
 	{
-		RenderStatsData()
-		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
-		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
-		{ }
+		RenderStatCounter numDrawCalls;
+		RenderStatCounter numComputeCalls;
+		RenderStatCounter numRenderTargetChanges;
+		RenderStatCounter numPresents;
+		RenderStatCounter numClears;
 
-		UINT64 numDrawCalls;
-		UINT64 numComputeCalls;
-		UINT64 numRenderTargetChanges;
-		UINT64 numPresents;
-		UINT64 numClears;
+		RenderStatCounter numVertices;
+		RenderStatCounter numPrimitives;
 
-		UINT64 numVertices;
-		UINT64 numPrimitives;
+		RenderStatCounter numPipelineStateChanges;
 
-		UINT64 numPipelineStateChanges;
+		RenderStatCounter numGpuParamBinds; 
+		RenderStatCounter numVertexBufferBinds; 
+		RenderStatCounter numIndexBufferBinds;
 
-		UINT64 numGpuParamBinds; 
-		UINT64 numVertexBufferBinds; 
-		UINT64 numIndexBufferBinds;
+		RenderStatCounter numResourceWrites;
+		RenderStatCounter numResourceReads;
 
-		UINT64 numResourceWrites;
-		UINT64 numResourceReads;
+		RenderStatCounter numObjectsCreated; 
+		RenderStatCounter numObjectsDestroyed;
 
-		UINT64 numObjectsCreated; 
-		UINT64 numObjectsDestroyed;
+		RenderStatCounter numSceneActorUpdates;
+
+		RenderStatCounter numInstancedDrawCalls;
+		RenderStatCounter numMergedDrawCalls;
+
+		RenderStatCounter numRedundantStateChanges;
+
+		RenderStatCounter numShadowCacheHits;
+		RenderStatCounter numShadowCacheMisses;
 	};
 
 	/**
 	 * Tracks various render system statistics.
 	 *
-	 * @note	Core thread only.
+	 * @note	Core thread only, except for the increment methods which may also be called by threads recording command
+	 *			buffers.
 	 */
 	class BS_CORE_EXPORT RenderStats : public Module<RenderStats>
 	{
@@ -98,6 +142,44 @@ namespace bs
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
 		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
 
+		/** 
+		 * Increments the counter of scene actors that had their state synced with their scene object. Called from the
+		 * simulation thread.
+		 */
+		void addNumSceneActorUpdates(UINT32 count) { mData.numSceneActorUpdates += count; }
+
+		/** 
+		 * Increments the counter of instanced draw calls, indicating how many draw calls were issued for batches of objects
+		 * merged by the renderer. Instanced draw calls are also counted as regular draw calls.
+		 */
+		void incNumInstancedDrawCalls() { mData.numInstancedDrawCalls++; }
+
+		/**
+		 * Increments the counter of merged draw calls, indicating how many draw calls were avoided by merging objects into
+		 * instanced draw calls. Number of draw calls before batching equals the sum of this value and the number of draw
+		 * calls.
+		 */
+		void addNumMergedDrawCalls(UINT32 count) { mData.numMergedDrawCalls += count; }
+
+		/**
+		 * Increments the counter of redundant state changes, indicating how many pipeline state, GPU parameter, vertex
+		 * buffer, index buffer, vertex declaration or draw operation binds were skipped because the same state was
+		 * already bound. Skipped binds are not counted by the other bind counters.
+		 */
+		void incNumRedundantStateChanges() { mData.numRedundantStateChanges++; }
+
+		/**
+		 * Increments the counter of shadow maps that were able to re-use their cached static shadow casters, instead of
+		 * re-rendering them.
+		 */
+		void incNumShadowCacheHits() { mData.numShadowCacheHits++; }
+
+		/**
+		 * Increments the counter of shadow maps that could have used cached static shadow casters, but had to re-render
+		 * them because the cache was missing or out of date.
+		 */
+		void incNumShadowCacheMisses() { mData.numShadowCacheMisses++; }
+
 		/**
 		 * Increments created GPU resource counter. 
 		 *
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "RenderAPI/BsRenderAPIStateCache.h"
 
 namespace bs { namespace ct
 {
@@ -79,6 +80,14 @@ namespace bs { namespace ct
 		/** Returns the device index this buffer will execute on. */
 		UINT32 getDeviceIdx() const { return mDeviceIdx; }
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns an object that tracks state bound on the command buffer, used for skipping redundant binds. */
+		RenderAPIStateCache& _getStateCache() { return mStateCache; }
+
+		/** @} */
 	protected:
 		CommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
 
@@ -86,6 +95,7 @@ namespace bs { namespace ct
 		UINT32 mDeviceIdx;
 		UINT32 mQueueIdx;
 		bool mIsSecondary;
+		RenderAPIStateCache mStateCache;
 	};
 
 	/** @} */
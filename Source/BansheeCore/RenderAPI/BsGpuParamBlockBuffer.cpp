@@ -89,6 +89,27 @@ namespace bs
 
 	namespace ct
 	{
+	/** Parameter block buffer that references a range of another buffer. */
+	class GpuParamBlockBufferView : public GpuParamBlockBuffer
+	{
+	public:
+		GpuParamBlockBufferView(const SPtr<GpuParamBlockBuffer>& parent, UINT32 offset, UINT32 size)
+			:GpuParamBlockBuffer(parent, offset, size)
+		{ }
+
+		/** 
+		 * @copydoc GpuParamBlockBuffer::writeToGPU 
+		 *
+		 * Views have no GPU storage of their own, so this updates the view's range in the parent buffer, and uploads the
+		 * entire parent buffer.
+		 */
+		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override
+		{
+			write(0, data, mSize);
+			mParent->flushToGPU(queueIdx);
+		}
+	};
+
 	GpuParamBlockBuffer::GpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
 		:mUsage(usage), mSize(size), mCachedData(nullptr), mGPUBufferDirty(false)
 	{
@@ -98,9 +119,18 @@ namespace bs
 		memset(mCachedData, 0, mSize);
 	}
 
+	GpuParamBlockBuffer::GpuParamBlockBuffer(const SPtr<GpuParamBlockBuffer>& parent, UINT32 offset, UINT32 size)
+		:mUsage(parent->mUsage), mSize(size), mCachedData(parent->mCachedData + offset), mGPUBufferDirty(false)
+		, mParent(parent), mOffset(offset)
+	{
+		assert(parent->mParent == nullptr && "Views of views are not supported.");
+		assert((offset % VIEW_ALIGNMENT) == 0 && (offset + size) <= parent->mSize);
+	}
+
 	GpuParamBlockBuffer::~GpuParamBlockBuffer()
 	{
-		if (mCachedData != nullptr)
+		// Views reference the parent's memory
+		if (mCachedData != nullptr && mParent == nullptr)
 			bs_free(mCachedData);
 	}
 
@@ -116,7 +146,7 @@ namespace bs
 #endif
 
 		memcpy(mCachedData + offset, data, size);
-		mGPUBufferDirty = true;
+		markDirty();
 	}
 
 	void GpuParamBlockBuffer::read(UINT32 offset, void* data, UINT32 size)
@@ -145,11 +175,17 @@ namespace bs
 #endif
 
 		memset(mCachedData + offset, 0, size);
-		mGPUBufferDirty = true;
+		markDirty();
 	}
 
 	void GpuParamBlockBuffer::flushToGPU(UINT32 queueIdx)
 	{
+		if (mParent != nullptr)
+		{
+			mParent->flushToGPU(queueIdx);
+			return;
+		}
+
 		if (mGPUBufferDirty)
 		{
 			writeToGPU(mCachedData, queueIdx);
@@ -169,5 +205,18 @@ namespace bs
 	{
 		return HardwareBufferManager::instance().createGpuParamBlockBuffer(size, usage, deviceMask);
 	}
+
+	SPtr<GpuParamBlockBuffer> GpuParamBlockBuffer::createView(const SPtr<GpuParamBlockBuffer>& parent, UINT32 offset,
+		UINT32 size)
+	{
+		GpuParamBlockBufferView* view = 
+			new (bs_alloc<GpuParamBlockBufferView>()) GpuParamBlockBufferView(parent, offset, size);
+
+		SPtr<GpuParamBlockBuffer> viewPtr = bs_shared_ptr<GpuParamBlockBufferView>(view);
+		viewPtr->_setThisPtr(viewPtr);
+		viewPtr->initialize();
+
+		return viewPtr;
+	}
 	}
 }
\ No newline at end of file
@@ -81,6 +81,9 @@ namespace bs
 	/**
 	 * Core thread version of a bs::GpuParamBlockBuffer.
 	 *
+	 * A buffer can also be created as a view of a range of another, larger buffer (see createView()). Views don't have
+	 * any storage of their own and all reads and writes go to the parent buffer, which is uploaded to the GPU as a whole.
+	 *
 	 * @note	Core thread only.
 	 */
 	class BS_CORE_EXPORT GpuParamBlockBuffer : public CoreObject
@@ -130,11 +133,40 @@ namespace bs
 		/**	Returns the size of the buffer in bytes. */
 		UINT32 getSize() const { return mSize; }
 
+		/** Checks if the cached data was modified since the last call to flushToGPU(). */
+		bool isDirty() const { return mParent != nullptr ? mParent->mGPUBufferDirty : mGPUBufferDirty; }
+
+		/** Returns the buffer this buffer is a view of, or null if the buffer isn't a view. */
+		const SPtr<GpuParamBlockBuffer>& getParent() const { return mParent; }
+
+		/** Returns the offset of the view within the parent buffer, in bytes. Zero if the buffer isn't a view. */
+		UINT32 getOffset() const { return mOffset; }
+
 		/** @copydoc HardwareBufferManager::createGpuParamBlockBuffer */
 		static SPtr<GpuParamBlockBuffer> create(UINT32 size, GpuParamBlockUsage usage = GPBU_DYNAMIC,
 			GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
+		/**
+		 * Creates a view of a range of the provided buffer. The view can be bound as any other parameter block buffer, in
+		 * which case the render API binds the parent buffer at the view's offset. Only supported if the render API
+		 * reports RenderAPIFeatureFlag::ParamBlockViews.
+		 *
+		 * @param[in]	parent		Buffer to create the view of. Must not be a view itself.
+		 * @param[in]	offset		Offset into the parent buffer, in bytes. Must be a multiple of VIEW_ALIGNMENT.
+		 * @param[in]	size		Size of the view, in bytes.
+		 */
+		static SPtr<GpuParamBlockBuffer> createView(const SPtr<GpuParamBlockBuffer>& parent, UINT32 offset, UINT32 size);
+
+		/** Alignment required for view offsets, in bytes. Satisfies the offset requirements of all render APIs. */
+		static const UINT32 VIEW_ALIGNMENT = 256;
+
 	protected:
+		/** Constructs a view of a range of the parent buffer. */
+		GpuParamBlockBuffer(const SPtr<GpuParamBlockBuffer>& parent, UINT32 offset, UINT32 size);
+
+		/** Marks the buffer (or the parent buffer, for views) as requiring an upload on the next flush. */
+		void markDirty() { if (mParent != nullptr) mParent->mGPUBufferDirty = true; else mGPUBufferDirty = true; }
+
 		/** @copydoc CoreObject::syncToCore */
 		void syncToCore(const CoreSyncData& data)  override;
 
@@ -143,6 +175,9 @@ namespace bs
 
 		UINT8* mCachedData;
 		bool mGPUBufferDirty;
+
+		SPtr<GpuParamBlockBuffer> mParent;
+		UINT32 mOffset = 0;
 	};
 
 	/** @} */
@@ -745,6 +745,18 @@ namespace bs
 		return std::static_pointer_cast<GpuParams>(getThisPtr());
 	}
 
+	bool GpuParams::hasDirtyParamBlocks() const
+	{
+		UINT32 numParamBlocks = mParamInfo->getNumElements(GpuPipelineParamInfo::ParamType::ParamBlock);
+		for (UINT32 i = 0; i < numParamBlocks; i++)
+		{
+			if (mParamBlockBuffers[i] != nullptr && mParamBlockBuffers[i]->isDirty())
+				return true;
+		}
+
+		return false;
+	}
+
 	void GpuParams::syncToCore(const CoreSyncData& data)
 	{
 		UINT32 numParamBlocks = mParamInfo->getNumElements(GpuPipelineParamInfo::ParamType::ParamBlock);
@@ -820,6 +832,8 @@ namespace bs
 			mSamplerStates[i] = samplers[i];
 			samplers[i].~SPtr<SamplerState>();
 		}
+
+		mVersion++;
 	}
 
 	SPtr<GpuParams> GpuParams::create(const SPtr<GraphicsPipelineState>& pipelineState, GpuDeviceFlags deviceMask)
@@ -369,6 +369,22 @@ namespace bs
 		static SPtr<GpuParams> create(const SPtr<GpuPipelineParamInfo>& paramInfo,
 										  GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
+		/** 
+		 * Returns a counter that is incremented whenever any of the bound param block buffers, textures, buffers or 
+		 * sampler states change. Can be used for determining if the parameters need to be re-bound.
+		 */
+		UINT64 getVersion() const { return mVersion; }
+
+		/** 
+		 * Checks if any of the bound param block buffers have data that hasn't yet been flushed to the GPU. 
+		 * 
+		 * @see		GpuParamBlockBuffer::flushToGPU
+		 */
+		bool hasDirtyParamBlocks() const;
+
+		/** @copydoc GpuParamsBase::_markCoreDirty */
+		void _markCoreDirty() override { mVersion++; }
+
 	protected:
 		friend class bs::GpuParams;
 		friend class HardwareBufferManager;
@@ -380,6 +396,8 @@ namespace bs
 
 		/** @copydoc CoreObject::syncToCore */
 		void syncToCore(const CoreSyncData& data) override;
+
+		UINT64 mVersion = 0;
 	};
 
 	/** @} */
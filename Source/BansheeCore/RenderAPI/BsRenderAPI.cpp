@@ -12,6 +12,7 @@
 #include "RenderAPI/BsRasterizerState.h"
 #include "RenderAPI/BsGpuBuffer.h"
 #include "RenderAPI/BsGpuPipelineState.h"
+#include "RenderAPI/BsCommandBuffer.h"
 
 using namespace std::placeholders;
 
@@ -192,6 +193,7 @@ namespace bs
 	void RenderAPI::destroyCore()
 	{
 		mActiveRenderTarget = nullptr;
+		mStateCache.reset();
 	}
 
 	const RenderAPICapabilities& RenderAPI::getCapabilities(UINT32 deviceIdx) const
@@ -237,5 +239,13 @@ namespace bs
 
 		return primCount;
 	}
+
+	RenderAPIStateCache& RenderAPI::getStateCache(const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (commandBuffer != nullptr)
+			return commandBuffer->_getStateCache();
+
+		return mStateCache;
+	}
 	}
 }
\ No newline at end of file
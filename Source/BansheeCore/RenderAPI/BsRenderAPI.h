@@ -10,6 +10,7 @@
 #include "RenderAPI/BsRenderWindow.h"
 #include "RenderAPI/BsGpuProgram.h"
 #include "RenderAPI/BsVertexDeclaration.h"
+#include "RenderAPI/BsRenderAPIStateCache.h"
 #include "Math/BsPlane.h"
 #include "Utility/BsModule.h"
 #include "Utility/BsEvent.h"
@@ -202,7 +203,12 @@ namespace bs
 		/** If set, the render API supports compute shaders. */
 		Compute					= 1 << 7,
 		/** If set, the render API supports load-store textures or buffers (AKA unordered access (UAV). */
-		LoadStore				= 1 << 8
+		LoadStore				= 1 << 8,
+		/**
+		 * If set, the render API supports binding a part of a larger parameter block buffer, as created through
+		 * ct::GpuParamBlockBuffer::createView(). Otherwise views must not be bound.
+		 */
+		ParamBlockViews			= 1 << 9
 	};
 
 	typedef Flags<RenderAPIFeatureFlag> RenderAPIFeatures;
@@ -613,6 +619,12 @@ namespace bs
 		/** Converts the number of vertices to number of primitives based on the specified draw operation. */
 		UINT32 vertexCountToPrimCount(DrawOperationType type, UINT32 elementCount);
 
+		/** 
+		 * Returns the cache of bound state for the provided command buffer, or the cache for the immediate context if
+		 * the command buffer is null. 
+		 */
+		RenderAPIStateCache& getStateCache(const SPtr<CommandBuffer>& commandBuffer);
+
 		/************************************************************************/
 		/* 								INTERNAL DATA					       	*/
 		/************************************************************************/
@@ -624,6 +636,7 @@ namespace bs
 		RenderAPICapabilities* mCurrentCapabilities;
 		UINT32 mNumDevices;
 		SPtr<VideoModeInfo> mVideoModeInfo;
+		RenderAPIStateCache mStateCache;
 	};
 
 	/** @} */
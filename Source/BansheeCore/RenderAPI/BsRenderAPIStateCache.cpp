@@ -0,0 +1,143 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "RenderAPI/BsRenderAPIStateCache.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "Profiling/BsRenderStats.h"
+
+namespace bs { namespace ct
+{
+	bool RenderAPIStateCache::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState)
+	{
+		if (pipelineState != nullptr && mGraphicsPipeline == pipelineState)
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		mGraphicsPipeline = pipelineState;
+
+		// Some render API's resolve parameter bindings against the currently bound programs
+		invalidateGpuParams();
+
+		return true;
+	}
+
+	bool RenderAPIStateCache::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState)
+	{
+		if (pipelineState != nullptr && mComputePipeline == pipelineState)
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		mComputePipeline = pipelineState;
+		invalidateGpuParams();
+
+		return true;
+	}
+
+	bool RenderAPIStateCache::setGpuParams(const SPtr<GpuParams>& gpuParams)
+	{
+		if (gpuParams != nullptr && mGpuParams == gpuParams && mGpuParamsVersion == gpuParams->getVersion() &&
+			!gpuParams->hasDirtyParamBlocks())
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		mGpuParams = gpuParams;
+		mGpuParamsVersion = gpuParams != nullptr ? gpuParams->getVersion() : 0;
+
+		return true;
+	}
+
+	bool RenderAPIStateCache::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
+	{
+		if (index + numBuffers > BS_MAX_BOUND_VERTEX_BUFFERS)
+		{
+			for (UINT32 i = index; i < BS_MAX_BOUND_VERTEX_BUFFERS; i++)
+				mVertexBuffers[i] = nullptr;
+
+			return true;
+		}
+
+		bool redundant = numBuffers > 0;
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			if (buffers[i] == nullptr || mVertexBuffers[index + i] != buffers[i])
+			{
+				redundant = false;
+				break;
+			}
+		}
+
+		if (redundant)
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		for (UINT32 i = 0; i < numBuffers; i++)
+			mVertexBuffers[index + i] = buffers[i];
+
+		return true;
+	}
+
+	bool RenderAPIStateCache::setIndexBuffer(const SPtr<IndexBuffer>& buffer)
+	{
+		if (buffer != nullptr && mIndexBuffer == buffer)
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		mIndexBuffer = buffer;
+		return true;
+	}
+
+	bool RenderAPIStateCache::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration)
+	{
+		if (vertexDeclaration != nullptr && mVertexDeclaration == vertexDeclaration)
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		mVertexDeclaration = vertexDeclaration;
+		return true;
+	}
+
+	bool RenderAPIStateCache::setDrawOperation(DrawOperationType op)
+	{
+		if (mDrawOpValid && mDrawOp == op)
+		{
+			BS_INC_RENDER_STAT(NumRedundantStateChanges);
+			return false;
+		}
+
+		mDrawOp = op;
+		mDrawOpValid = true;
+
+		return true;
+	}
+
+	void RenderAPIStateCache::invalidateGpuParams()
+	{
+		mGpuParams = nullptr;
+		mGpuParamsVersion = 0;
+	}
+
+	void RenderAPIStateCache::reset()
+	{
+		mGraphicsPipeline = nullptr;
+		mComputePipeline = nullptr;
+		invalidateGpuParams();
+
+		for (auto& entry : mVertexBuffers)
+			entry = nullptr;
+
+		mIndexBuffer = nullptr;
+		mVertexDeclaration = nullptr;
+		mDrawOpValid = false;
+	}
+}}
@@ -0,0 +1,73 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "RenderAPI/BsRenderAPICapabilities.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of state bound through the render API on a single command buffer (or the immediate context), so that
+	 * render API implementations can skip binds of state that is already bound. Each set method returns true if the
+	 * state needs to be bound, or false if the bind is redundant and can be skipped. Redundant binds are reported
+	 * through render stats.
+	 *
+	 * Binding null always returns true, as the cache doesn't differentiate between null and unknown state. The cache must
+	 * be reset whenever the underlying state is changed outside of the render API calls it tracks (e.g. when a command
+	 * buffer is submitted or its commands are executed on a different context).
+	 */
+	class BS_CORE_EXPORT RenderAPIStateCache
+	{
+	public:
+		/** Registers a graphics pipeline bind. Changing the pipeline also invalidates the bound GPU parameters. */
+		bool setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState);
+
+		/** Registers a compute pipeline bind. Changing the pipeline also invalidates the bound GPU parameters. */
+		bool setComputePipeline(const SPtr<ComputePipelineState>& pipelineState);
+
+		/**
+		 * Registers a GPU parameters bind. The bind is only considered redundant if the same object is being bound, none
+		 * of its parameters changed since the last bind, and none of its parameter block buffers have pending writes.
+		 */
+		bool setGpuParams(const SPtr<GpuParams>& gpuParams);
+
+		/** Registers a bind of one or multiple vertex buffers, starting at the specified slot. */
+		bool setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers);
+
+		/** Registers an index buffer bind. */
+		bool setIndexBuffer(const SPtr<IndexBuffer>& buffer);
+
+		/** Registers a vertex declaration bind. */
+		bool setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration);
+
+		/** Registers a draw operation change. */
+		bool setDrawOperation(DrawOperationType op);
+
+		/**
+		 * Forgets the bound GPU parameters, ensuring the next setGpuParams() call isn't skipped. Should be called when
+		 * parameter bindings are affected by an operation not tracked by the cache (e.g. a render target change).
+		 */
+		void invalidateGpuParams();
+
+		/** Forgets all bound state, ensuring the next bind of any state isn't skipped. */
+		void reset();
+
+	private:
+		SPtr<GraphicsPipelineState> mGraphicsPipeline;
+		SPtr<ComputePipelineState> mComputePipeline;
+		SPtr<GpuParams> mGpuParams;
+		UINT64 mGpuParamsVersion = 0;
+		SPtr<VertexBuffer> mVertexBuffers[BS_MAX_BOUND_VERTEX_BUFFERS];
+		SPtr<IndexBuffer> mIndexBuffer;
+		SPtr<VertexDeclaration> mVertexDeclaration;
+		DrawOperationType mDrawOp = DOT_TRIANGLE_LIST;
+		bool mDrawOpValid = false;
+	};
+
+	/** @} */
+}}
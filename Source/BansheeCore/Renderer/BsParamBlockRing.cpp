@@ -0,0 +1,115 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Renderer/BsParamBlockRing.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Math/BsMath.h"
+
+namespace bs { namespace ct
+{
+	/** Maximum size of a single page buffer when using views. Largest parameter block size supported by all APIs. */
+	static const UINT32 MAX_PAGE_SIZE = 65536;
+
+	ParamBlockRing::ParamBlockRing(UINT32 blockSize, UINT32 slicesPerPage)
+		: ParamBlockRing(blockSize, slicesPerPage,
+			RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ParamBlockViews))
+	{ }
+
+	ParamBlockRing::ParamBlockRing(UINT32 blockSize, UINT32 slicesPerPage, bool useViews)
+		: mBlockSize(blockSize), mSlicesPerPage(std::max(slicesPerPage, 1U)), mUseViews(useViews)
+	{
+		if(mUseViews)
+		{
+			// Views must start at an offset aligned as required by the render API
+			const UINT32 alignment = GpuParamBlockBuffer::VIEW_ALIGNMENT;
+			mStride = Math::divideAndRoundUp(blockSize, alignment) * alignment;
+
+			mSlicesPerPage = Math::clamp(MAX_PAGE_SIZE / mStride, 1U, mSlicesPerPage);
+		}
+		else
+		{
+			// Keep each slice aligned to a full register, same as the param blocks themselves
+			mStride = (blockSize + 15) & ~15U;
+		}
+	}
+
+	ParamBlockRing::~ParamBlockRing()
+	{
+		for(auto& page : mPages)
+		{
+			bs_free(page.data);
+			bs_deleteN(page.slices, mSlicesPerPage);
+		}
+	}
+
+	void ParamBlockRing::reset()
+	{
+		mNumAllocated = 0;
+		mNumFlushed = 0;
+	}
+
+	ParamBlockRing::Slice ParamBlockRing::allocate()
+	{
+		UINT32 pageIdx = mNumAllocated / mSlicesPerPage;
+		UINT32 sliceIdx = mNumAllocated % mSlicesPerPage;
+
+		if(pageIdx >= (UINT32)mPages.size())
+		{
+			Page page;
+			page.data = (UINT8*)bs_alloc(mStride * mSlicesPerPage);
+			page.slices = bs_newN<SPtr<GpuParamBlockBuffer>>(mSlicesPerPage);
+
+			if(mUseViews)
+				page.buffer = GpuParamBlockBuffer::create(mStride * mSlicesPerPage);
+
+			mPages.push_back(page);
+		}
+
+		Page& page = mPages[pageIdx];
+
+		// Buffers and views are created lazily, and then persist for the lifetime of the ring
+		if(page.slices[sliceIdx] == nullptr)
+		{
+			if(mUseViews)
+				page.slices[sliceIdx] = GpuParamBlockBuffer::createView(page.buffer, sliceIdx * mStride, mBlockSize);
+			else
+				page.slices[sliceIdx] = GpuParamBlockBuffer::create(mBlockSize);
+		}
+
+		mNumAllocated++;
+
+		Slice slice;
+		slice.data = page.data + sliceIdx * mStride;
+		slice.buffer = &page.slices[sliceIdx];
+
+		return slice;
+	}
+
+	void ParamBlockRing::flush()
+	{
+		if(mNumFlushed == mNumAllocated)
+			return;
+
+		if(mUseViews)
+		{
+			// Pages are uploaded as a whole, including slices flushed earlier, as buffers can't be partially updated
+			UINT32 firstPage = mNumFlushed / mSlicesPerPage;
+			UINT32 lastPage = (mNumAllocated - 1) / mSlicesPerPage;
+
+			for(UINT32 i = firstPage; i <= lastPage; i++)
+				mPages[i].buffer->writeToGPU(mPages[i].data);
+		}
+		else
+		{
+			for(UINT32 i = mNumFlushed; i < mNumAllocated; i++)
+			{
+				const Page& page = mPages[i / mSlicesPerPage];
+				UINT32 sliceIdx = i % mSlicesPerPage;
+
+				page.slices[sliceIdx]->writeToGPU(page.data + sliceIdx * mStride);
+			}
+		}
+
+		mNumFlushed = mNumAllocated;
+	}
+}}
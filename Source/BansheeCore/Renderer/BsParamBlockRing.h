@@ -0,0 +1,107 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Renderer-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Frame-scoped linear allocator for parameter block data that changes every frame or every view (e.g. per-object and
+	 * per-call transforms). Data for all allocated slices is written into large contiguous pages of CPU memory, and
+	 * uploaded to the GPU in a single pass by calling flush().
+	 *
+	 * If the render API supports parameter block views (RenderAPIFeatureFlag::ParamBlockViews), each page is backed by a
+	 * single GPU buffer and each slice is a view into that buffer. flush() then performs a single buffer write per page,
+	 * and the slices are bound at their offset within the page buffer. Otherwise each slice is backed by its own GPU
+	 * buffer and flush() performs one buffer write per slice.
+	 *
+	 * Slices are handed out in order and recycled when the ring is reset, which means a slice is written to at most once
+	 * between two resets. This allows all the data to be uploaded ahead of rendering, without later writes overwriting
+	 * data still required by earlier draws.
+	 */
+	class BS_CORE_EXPORT ParamBlockRing
+	{
+	public:
+		/** Single entry allocated from the ring. */
+		struct Slice
+		{
+			/** 
+			 * CPU memory to write the parameter block data to. Laid out the same as the parameter block buffer. This is
+			 * the only way to write the slice data, as flush() uploads it directly without going through the buffer.
+			 */
+			UINT8* data;
+
+			/** Buffer that will contain the slice data once flushed, and that should be bound for rendering. */
+			const SPtr<GpuParamBlockBuffer>* buffer;
+		};
+
+		/**
+		 * Constructs a new ring. Uses parameter block views if the active render API supports them.
+		 *
+		 * @param[in]	blockSize		Size of a single parameter block, in bytes.
+		 * @param[in]	slicesPerPage	Number of slices to allocate at once whenever the ring runs out of space.
+		 */
+		ParamBlockRing(UINT32 blockSize, UINT32 slicesPerPage = 256);
+
+		/**
+		 * Constructs a new ring.
+		 *
+		 * @param[in]	blockSize		Size of a single parameter block, in bytes.
+		 * @param[in]	slicesPerPage	Number of slices to allocate at once whenever the ring runs out of space. When
+		 *								using views this will be clamped so a page doesn't exceed 64KB.
+		 * @param[in]	useViews		If true each page is backed by a single buffer and slices are views into it.
+		 *								Must only be enabled if the render API supports parameter block views.
+		 */
+		ParamBlockRing(UINT32 blockSize, UINT32 slicesPerPage, bool useViews);
+		~ParamBlockRing();
+
+		/**
+		 * Makes all the slices available for allocation again. Should be called once all the slices allocated since the
+		 * last reset are no longer needed for rendering, normally at the start of the frame.
+		 */
+		void reset();
+
+		/**
+		 * Allocates a new slice from the ring. The contents of the slice memory are undefined and the caller is expected
+		 * to fully populate it. Data won't be visible to the GPU until flush() is called.
+		 */
+		Slice allocate();
+
+		/**
+		 * Uploads data from all slices allocated since the last flush to the GPU. Performs a single buffer write per page
+		 * when using views, or a buffer write per slice otherwise.
+		 */
+		void flush();
+
+		/** Returns the number of slices allocated since the last reset. */
+		UINT32 getNumAllocated() const { return mNumAllocated; }
+
+		/** Checks if the slices are views into a single per-page buffer. */
+		bool usesViews() const { return mUseViews; }
+
+	private:
+		/** Contiguous block of CPU memory containing data for a set of slices, along with their GPU buffers. */
+		struct Page
+		{
+			UINT8* data;
+			SPtr<GpuParamBlockBuffer> buffer;
+			SPtr<GpuParamBlockBuffer>* slices;
+		};
+
+		UINT32 mBlockSize;
+		UINT32 mStride;
+		UINT32 mSlicesPerPage;
+		bool mUseViews;
+
+		Vector<Page> mPages;
+		UINT32 mNumAllocated = 0;
+		UINT32 mNumFlushed = 0;
+	};
+
+	/** @} */
+}}
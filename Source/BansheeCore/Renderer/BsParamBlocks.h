@@ -61,6 +61,38 @@ namespace bs { namespace ct
 			}
 		}
 
+		/** 
+		 * Sets the parameter in a block of CPU memory that uses the same layout as the parameter block buffer. Caller is
+		 * responsible for ensuring the memory is large enough to hold the entire parameter block.
+		 */
+		void set(UINT8* data, const T& value, UINT32 arrayIdx = 0) const
+		{
+#if BS_DEBUG_MODE
+			if (arrayIdx >= mParamDesc.arraySize)
+			{
+				BS_EXCEPT(InvalidParametersException, "Array index out of range. Array size: " +
+					toString(mParamDesc.arraySize) + ". Requested size: " + toString(arrayIdx));
+			}
+#endif
+
+			UINT32 elementSizeBytes = mParamDesc.elementSize * sizeof(UINT32);
+			UINT32 sizeBytes = std::min(elementSizeBytes, (UINT32)sizeof(T)); // Truncate if it doesn't fit within parameter size
+			UINT8* dst = data + (mParamDesc.cpuMemOffset + arrayIdx * mParamDesc.arrayElementStride) * sizeof(UINT32);
+
+			bool transposeMatrices = RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
+			if (TransposePolicy<T>::transposeEnabled(transposeMatrices))
+			{
+				auto transposed = TransposePolicy<T>::transpose(value);
+				memcpy(dst, &transposed, sizeBytes);
+			}
+			else
+				memcpy(dst, &value, sizeBytes);
+
+			// Set unused bytes to 0
+			if (sizeBytes < elementSizeBytes)
+				memset(dst + sizeBytes, 0, elementSizeBytes - sizeBytes);
+		}
+
 		/** 
 		 * Gets the parameter in the provided parameter block buffer. Caller is responsible for ensuring the param block
 		 * buffer contains this parameter. 
@@ -130,6 +162,7 @@ namespace bs { namespace ct
 		}																													\
 																															\
 		SPtr<GpuParamBlockBuffer> createBuffer() const { return GpuParamBlockBuffer::create(mBlockSize); }					\
+		UINT32 getBlockSize() const { return mBlockSize; }																	\
 																															\
 	private:																												\
 		friend class ParamBlockManager;																						\
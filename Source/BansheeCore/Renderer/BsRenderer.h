@@ -36,6 +36,19 @@ namespace bs
 		return variation;
 	}
 
+	/** Returns a specific vertex input shader variation, with instancing explicitly enabled or disabled. */
+	template<bool skinned, bool morph, bool instanced>
+	static const ShaderVariation& getVertexInputVariation()
+	{
+		static ShaderVariation variation = ShaderVariation({
+			ShaderVariation::Param("SKINNED", skinned),
+			ShaderVariation::Param("MORPH", morph),
+			ShaderVariation::Param("INSTANCED", instanced),
+		});
+
+		return variation;
+	}
+
 	/** Returns a specific forward rendering shader variation. */
 	template<bool skinned, bool morph, bool clustered>
 	static const ShaderVariation& getForwardRenderingVariation()
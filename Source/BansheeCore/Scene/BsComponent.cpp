@@ -7,11 +7,11 @@
 namespace bs
 {
 	Component::Component()
-		:mNotifyFlags(TCF_None), mSceneManagerId(-1)
+		:mNotifyFlags(TCF_None), mSceneManagerId(-1), mUpdateBucketId(-1)
 	{ }
 
 	Component::Component(const HSceneObject& parent)
-		:mNotifyFlags(TCF_None), mSceneManagerId(-1), mParent(parent)
+		:mNotifyFlags(TCF_None), mSceneManagerId(-1), mUpdateBucketId(-1), mParent(parent)
 	{
 		setName("Component");
 	}
@@ -20,7 +20,18 @@ namespace bs
 		 * Note that this flag must be specified on component creation, in its constructor and any later changes
 		 * to the flag will be ignored.
 		 */
-		AlwaysRun = 1 
+		AlwaysRun = 1 << 0,
+		/**
+		 * Signals the scene manager that the component doesn't implement update(), so it will never be called. Components
+		 * with this flag are not added to the per-frame update list. Must be specified in the component constructor.
+		 */
+		NoUpdate = 1 << 1,
+		/**
+		 * Signals that the component's update() method doesn't touch any state outside of the component itself, meaning
+		 * components of the same type can be updated in parallel on multiple threads. Must be specified in the component
+		 * constructor.
+		 */
+		ParallelUpdate = 1 << 2
 	};
 
 	typedef Flags<ComponentFlag> ComponentFlags;
@@ -157,6 +168,15 @@ namespace bs
 		/** Returns an index that unique identifies a component with the SceneManager. */
 		UINT32 getSceneManagerId() const { return mSceneManagerId; }
 
+		/** 
+		 * Sets the location of the component in the SceneManager's update buckets. Index of the bucket is stored in the top 
+		 * 10 bits, and the index within the bucket in the rest. -1 if component is not in any bucket.
+		 */
+		void setUpdateBucketId(UINT32 id) { mUpdateBucketId = id; }
+
+		/** Returns the location of the component in the SceneManager's update buckets. See setUpdateBucketId(). */
+		UINT32 getUpdateBucketId() const { return mUpdateBucketId; }
+
 		/**
 		 * Destroys this component.
 		 *
@@ -175,6 +195,7 @@ namespace bs
 		TransformChangedFlags mNotifyFlags;
 		ComponentFlags mFlags;
 		UINT32 mSceneManagerId;
+		UINT32 mUpdateBucketId;
 
 	private:
 		HSceneObject mParent;
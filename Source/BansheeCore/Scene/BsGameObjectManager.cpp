@@ -41,7 +41,7 @@ namespace bs
 
 	bool GameObjectManager::objectExists(UINT64 id) const
 	{
-		return mObjects.find(id) != mObjects.end();
+		return mObjects.contains(id);
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -49,8 +49,14 @@ namespace bs
 		if (oldId == newId)
 			return;
 
-		mObjects[newId] = mObjects[oldId];
+		auto iterFind = mObjects.find(oldId);
+		if (iterFind == mObjects.end())
+			return;
+
+		// Note: Copy required since insertion below can relocate the existing entries
+		GameObjectHandleBase handle = iterFind->second;
 		mObjects.erase(oldId);
+		mObjects[newId] = handle;
 	}
 
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
@@ -58,16 +64,35 @@ namespace bs
 		if (object.isDestroyed())
 			return;
 
-		UINT64 instanceId = object->getInstanceId();
-		mQueuedForDestroy[instanceId] = object;
+		mQueuedForDestroy.push_back(object);
 	}
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
-		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		if (mQueuedForDestroy.empty())
+			return;
 
-		mQueuedForDestroy.clear();
+		// Objects queued during destruction will be handled on the next call
+		Vector<GameObjectHandleBase> toDestroy;
+		std::swap(toDestroy, mQueuedForDestroy);
+
+		// Destroy in creation order, and only once per object, even if queued multiple times
+		std::sort(toDestroy.begin(), toDestroy.end(),
+			[](const GameObjectHandleBase& lhs, const GameObjectHandleBase& rhs)
+		{
+			return lhs.getInstanceId() < rhs.getInstanceId();
+		});
+
+		UINT64 lastInstanceId = 0;
+		for (auto& entry : toDestroy)
+		{
+			UINT64 instanceId = entry.getInstanceId();
+			if (instanceId == lastInstanceId)
+				continue;
+
+			entry->destroyInternal(entry, true);
+			lastInstanceId = instanceId;
+		}
 	}
 
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object, UINT64 originalId)
@@ -11,6 +11,8 @@
 #include "RenderAPI/BsRenderTarget.h"
 #include "Renderer/BsLightProbeVolume.h"
 #include "Scene/BsSceneActor.h"
+#include "Profiling/BsRenderStats.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -21,6 +23,11 @@ namespace bs
 		UninitializedList = 2
 	};
 
+	/** Number of bits used for encoding the index of a component within an update bucket. */
+	static constexpr UINT32 UPDATE_BUCKET_SLOT_BITS = 22;
+	static constexpr UINT32 UPDATE_BUCKET_SLOT_MASK = (1 << UPDATE_BUCKET_SLOT_BITS) - 1;
+	static constexpr UINT32 UPDATE_BUCKET_MAX_BUCKETS = 1 << (32 - UPDATE_BUCKET_SLOT_BITS);
+
 	SceneManager::SceneManager()
 	{
 		mRootNode = SceneObject::createInternal("SceneRoot");
@@ -87,23 +94,94 @@ namespace bs
 
 	void SceneManager::_bindActor(const SPtr<SceneActor>& actor, const HSceneObject& so)
 	{
-		mBoundActors[actor.get()] = BoundActorData(actor, so);
+		auto iterFind = mBoundActorLookup.find(actor.get());
+		if (iterFind != mBoundActorLookup.end())
+			_unbindActor(actor);
+
+		UINT32 idx = (UINT32)mBoundActors.size();
+		mBoundActors.push_back(BoundActorData(actor, so));
+		mBoundActorLookup[actor.get()] = idx;
+		mBoundActorsPerSO.insert(std::make_pair(so.getInstanceId(), actor.get()));
+
+		so->mNumBoundActors++;
+
+		// Make sure the actor receives the current scene object state
+		markBoundActorDirty(idx);
 	}
 
 	void SceneManager::_unbindActor(const SPtr<SceneActor>& actor)
 	{
-		mBoundActors.erase(actor.get());
+		auto iterFind = mBoundActorLookup.find(actor.get());
+		if (iterFind == mBoundActorLookup.end())
+			return;
+
+		UINT32 idx = iterFind->second;
+		mBoundActorLookup.erase(iterFind);
+
+		BoundActorData& data = mBoundActors[idx];
+		if (data.dirty)
+		{
+			auto iterFindDirty = std::find(mDirtyBoundActors.begin(), mDirtyBoundActors.end(), actor.get());
+			if (iterFindDirty != mDirtyBoundActors.end())
+			{
+				std::swap(*iterFindDirty, mDirtyBoundActors.back());
+				mDirtyBoundActors.erase(mDirtyBoundActors.end() - 1);
+			}
+		}
+
+		if (!data.so.isDestroyed())
+			data.so->mNumBoundActors--;
+
+		auto range = mBoundActorsPerSO.equal_range(data.so.getInstanceId());
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			if (iter->second == actor.get())
+			{
+				mBoundActorsPerSO.erase(iter);
+				break;
+			}
+		}
+
+		UINT32 lastIdx = (UINT32)mBoundActors.size() - 1;
+		if (idx != lastIdx)
+		{
+			std::swap(mBoundActors[idx], mBoundActors[lastIdx]);
+			mBoundActorLookup[mBoundActors[idx].actor.get()] = idx;
+		}
+
+		mBoundActors.erase(mBoundActors.end() - 1);
 	}
 
 	HSceneObject SceneManager::_getActorSO(const SPtr<SceneActor>& actor) const
 	{
-		auto iterFind = mBoundActors.find(actor.get());
-		if (iterFind != mBoundActors.end())
-			return iterFind->second.so;
+		auto iterFind = mBoundActorLookup.find(actor.get());
+		if (iterFind != mBoundActorLookup.end())
+			return mBoundActors[iterFind->second].so;
 
 		return HSceneObject();		
 	}
 
+	void SceneManager::_notifyBoundSODirty(const SceneObject& so)
+	{
+		auto range = mBoundActorsPerSO.equal_range(so.getInstanceId());
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			auto iterFind = mBoundActorLookup.find(iter->second);
+			if (iterFind != mBoundActorLookup.end())
+				markBoundActorDirty(iterFind->second);
+		}
+	}
+
+	void SceneManager::markBoundActorDirty(UINT32 idx)
+	{
+		BoundActorData& data = mBoundActors[idx];
+		if (data.dirty)
+			return;
+
+		data.dirty = true;
+		mDirtyBoundActors.push_back(data.actor.get());
+	}
+
 	void SceneManager::_registerCamera(const SPtr<Camera>& camera)
 	{
 		mCameras[camera.get()] = camera;
@@ -151,8 +229,25 @@ namespace bs
 
 	void SceneManager::_updateCoreObjectTransforms()
 	{
-		for (auto& entry : mBoundActors)
-			entry.second.actor->_updateState(*entry.second.so);
+		UINT32 numUpdated = 0;
+		for (auto& entry : mDirtyBoundActors)
+		{
+			auto iterFind = mBoundActorLookup.find(entry);
+			if (iterFind == mBoundActorLookup.end())
+				continue;
+
+			BoundActorData& data = mBoundActors[iterFind->second];
+			data.dirty = false;
+
+			if (data.so.isDestroyed())
+				continue;
+
+			data.actor->_updateState(*data.so);
+			numUpdated++;
+		}
+
+		mDirtyBoundActors.clear();
+		BS_ADD_RENDER_STAT(NumSceneActorUpdates, numUpdated);
 	}
 
 	SPtr<Camera> SceneManager::getMainCamera() const
@@ -232,10 +327,7 @@ namespace bs
 					{
 						entry->onEnabled();
 
-						UINT32 idx = (UINT32)mActiveComponents.size();
-						mActiveComponents.push_back(entry);
-
-						entry->setSceneManagerId(encodeComponentId(idx, ActiveList));
+						addToActiveList(entry);
 					}
 					else
 					{
@@ -263,10 +355,7 @@ namespace bs
 				removeFromInactiveList(component);
 				i--; // Keep the same index next iteration to process the component we just swapped
 
-				UINT32 activeIdx = (UINT32)mActiveComponents.size();
-				mActiveComponents.push_back(component);
-
-				component->setSceneManagerId(encodeComponentId(activeIdx, ActiveList));
+				addToActiveList(component);
 			}
 		}
 		// Stop updates on all active components
@@ -321,10 +410,7 @@ namespace bs
 			{
 				component->onEnabled();
 
-				UINT32 idx = (UINT32)mActiveComponents.size();
-				mActiveComponents.push_back(component);
-
-				component->setSceneManagerId(encodeComponentId(idx, ActiveList));
+				addToActiveList(component);
 			}
 			else
 			{
@@ -354,10 +440,7 @@ namespace bs
 
 			removeFromInactiveList(component);
 
-			UINT32 activeIdx = (UINT32)mActiveComponents.size();
-			mActiveComponents.push_back(component);
-
-			component->setSceneManagerId(encodeComponentId(activeIdx, ActiveList));
+			addToActiveList(component);
 		}
 	}
 
@@ -410,8 +493,21 @@ namespace bs
 		component->onDestroyed();
 	}
 
+	void SceneManager::addToActiveList(const HComponent& component)
+	{
+		UINT32 idx = (UINT32)mActiveComponents.size();
+		mActiveComponents.push_back(component);
+
+		component->setSceneManagerId(encodeComponentId(idx, ActiveList));
+
+		if (!component->hasFlag(ComponentFlag::NoUpdate))
+			addToUpdateBucket(component.get());
+	}
+
 	void SceneManager::removeFromActiveList(const HComponent& component)
 	{
+		removeFromUpdateBucket(component.get());
+
 		UINT32 listType;
 		UINT32 idx;
 		decodeComponentId(component->getSceneManagerId(), idx, listType);
@@ -470,6 +566,81 @@ namespace bs
 		mUninitializedComponents.erase(mUninitializedComponents.end() - 1);
 	}
 
+	void SceneManager::addToUpdateBucket(Component* component)
+	{
+		UINT32 typeId = component->getRTTI()->getRTTIId();
+		bool parallel = component->hasFlag(ComponentFlag::ParallelUpdate);
+
+		UINT64 key = ((UINT64)typeId << 1) | (parallel ? 1 : 0);
+
+		UINT32 bucketIdx;
+		auto iterFind = mUpdateBucketLookup.find(key);
+		if (iterFind == mUpdateBucketLookup.end())
+		{
+			bucketIdx = (UINT32)mUpdateBuckets.size();
+			assert(bucketIdx < UPDATE_BUCKET_MAX_BUCKETS);
+
+			mUpdateBuckets.push_back(ComponentUpdateBucket());
+			ComponentUpdateBucket& bucket = mUpdateBuckets.back();
+			bucket.typeId = typeId;
+			bucket.parallel = parallel;
+
+			auto iterFindPriority = mComponentUpdatePriorities.find(typeId);
+			if (iterFindPriority != mComponentUpdatePriorities.end())
+				bucket.priority = iterFindPriority->second;
+
+			mUpdateBucketLookup[key] = bucketIdx;
+			mUpdateBucketOrder.push_back(bucketIdx);
+			mUpdateOrderDirty = true;
+		}
+		else
+			bucketIdx = iterFind->second;
+
+		Vector<Component*>& components = mUpdateBuckets[bucketIdx].components;
+
+		UINT32 slotIdx = (UINT32)components.size();
+		assert(slotIdx <= UPDATE_BUCKET_SLOT_MASK);
+
+		components.push_back(component);
+		component->setUpdateBucketId((bucketIdx << UPDATE_BUCKET_SLOT_BITS) | slotIdx);
+	}
+
+	void SceneManager::removeFromUpdateBucket(Component* component)
+	{
+		UINT32 bucketId = component->getUpdateBucketId();
+		if (bucketId == (UINT32)-1)
+			return;
+
+		UINT32 bucketIdx = bucketId >> UPDATE_BUCKET_SLOT_BITS;
+		UINT32 slotIdx = bucketId & UPDATE_BUCKET_SLOT_MASK;
+
+		Vector<Component*>& components = mUpdateBuckets[bucketIdx].components;
+		assert(components[slotIdx] == component);
+
+		UINT32 lastIdx = (UINT32)components.size() - 1;
+		if (slotIdx != lastIdx)
+		{
+			std::swap(components[slotIdx], components[lastIdx]);
+			components[slotIdx]->setUpdateBucketId((bucketIdx << UPDATE_BUCKET_SLOT_BITS) | slotIdx);
+		}
+
+		components.erase(components.end() - 1);
+		component->setUpdateBucketId((UINT32)-1);
+	}
+
+	void SceneManager::setComponentUpdatePriority(UINT32 typeId, INT32 priority)
+	{
+		mComponentUpdatePriorities[typeId] = priority;
+
+		for (auto& entry : mUpdateBuckets)
+		{
+			if (entry.typeId == typeId)
+				entry.priority = priority;
+		}
+
+		mUpdateOrderDirty = true;
+	}
+
 	UINT32 SceneManager::encodeComponentId(UINT32 idx, UINT32 type)
 	{
 		assert(idx <= (0x3FFFFFFF));
@@ -490,15 +661,82 @@ namespace bs
 
 	void SceneManager::_update()
 	{
-		// Note: Eventually perform updates based on component types and/or on component priority. Right now we just
-		// iterate in an undefined order, but it wouldn't be hard to change it.
+		if (mUpdateOrderDirty)
+		{
+			std::stable_sort(mUpdateBucketOrder.begin(), mUpdateBucketOrder.end(),
+				[&](UINT32 lhs, UINT32 rhs)
+			{
+				return mUpdateBuckets[lhs].priority < mUpdateBuckets[rhs].priority;
+			});
 
-		for (auto& entry : mActiveComponents)
-			entry->update();
+			mUpdateOrderDirty = false;
+		}
+
+		// Note: Component update() is allowed to create components of new types, which adds new buckets and can
+		// reallocate both the bucket list and the order list. Therefore we iterate by index, never hold on to a bucket
+		// reference across an update() call, and only process the buckets that existed when the loop started. New
+		// buckets get updated starting next frame.
+		UINT32 numBuckets = (UINT32)mUpdateBucketOrder.size();
+		for (UINT32 i = 0; i < numBuckets; i++)
+		{
+			UINT32 bucketIdx = mUpdateBucketOrder[i];
+			if (mUpdateBuckets[bucketIdx].parallel)
+				updateParallel(mUpdateBuckets[bucketIdx]);
+			else
+			{
+				// Note: Not caching the size since components are allowed to be added/removed during update
+				for (UINT32 j = 0; j < (UINT32)mUpdateBuckets[bucketIdx].components.size(); j++)
+					mUpdateBuckets[bucketIdx].components[j]->update();
+			}
+		}
 
 		GameObjectManager::instance().destroyQueuedObjects();
 	}
 
+	void SceneManager::updateParallel(ComponentUpdateBucket& bucket)
+	{
+		static constexpr UINT32 MIN_COMPONENTS_PER_TASK = 64;
+
+		UINT32 numComponents = (UINT32)bucket.components.size();
+		UINT32 maxTasks = TaskScheduler::instance().getNumWorkers() + 1;
+		UINT32 numTasks = std::min(maxTasks, Math::divideAndRoundUp(numComponents, MIN_COMPONENTS_PER_TASK));
+
+		if (numTasks <= 1)
+		{
+			for (UINT32 i = 0; i < numComponents; i++)
+				bucket.components[i]->update();
+
+			return;
+		}
+
+		UINT32 numPerTask = Math::divideAndRoundUp(numComponents, numTasks);
+		auto updateRange = [&bucket](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+				bucket.components[i]->update();
+		};
+
+		Vector<SPtr<Task>> tasks;
+		tasks.reserve(numTasks - 1);
+
+		// First range gets executed on this thread
+		for (UINT32 i = 1; i < numTasks; i++)
+		{
+			UINT32 start = i * numPerTask;
+			UINT32 end = std::min(start + numPerTask, numComponents);
+
+			SPtr<Task> task = Task::create("ComponentUpdate", std::bind(updateRange, start, end));
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		updateRange(0, std::min(numPerTask, numComponents));
+
+		for (auto& entry : tasks)
+			entry->wait();
+	}
+
 	void SceneManager::registerNewSO(const HSceneObject& node)
 	{ 
 		if(mRootNode)
@@ -20,11 +20,21 @@ namespace bs
 		BoundActorData() { }
 
 		BoundActorData(const SPtr<SceneActor>& actor, const HSceneObject& so)
-			:actor(actor), so(so)
+			:actor(actor), so(so), dirty(false)
 		{ }
 
 		SPtr<SceneActor> actor;
 		HSceneObject so;
+		bool dirty;
+	};
+
+	/** Active components of a single type that receive per-frame update() calls. */
+	struct ComponentUpdateBucket
+	{
+		UINT32 typeId = 0;
+		INT32 priority = 0;
+		bool parallel = false;
+		Vector<Component*> components;
 	};
 
 	/** Possible states components can be in. Controls which component callbacks are triggered. */
@@ -64,6 +74,23 @@ namespace bs
 		/** Checks are the components currently in the Running state. */
 		bool isRunning() const { return mComponentState == ComponentState::Running; }
 
+		/** 
+		 * Determines the order in which components of the specified type receive their update() calls, relative to other 
+		 * component types. Components with lower priority are updated first. Default priority is zero. Order of updates 
+		 * between component types with the same priority, or between components of the same type is undefined.
+		 *
+		 * @param[in]	typeId		RTTI type ID of the component type.
+		 * @param[in]	priority	Priority to assign.
+		 */
+		void setComponentUpdatePriority(UINT32 typeId, INT32 priority);
+
+		/** @copydoc setComponentUpdatePriority(UINT32, INT32) */
+		template<class T>
+		void setComponentUpdatePriority(INT32 priority)
+		{
+			setComponentUpdatePriority(T::getRTTIStatic()->getRTTIId(), priority);
+		}
+
 		/** 
 		 * Returns a list of all components of the specified type currently in the scene. 
 		 *
@@ -117,9 +144,18 @@ namespace bs
 		/** Called every frame. Calls update methods on all scene objects and their components. */
 		void _update();
 
-		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
+		/** 
+		 * Updates dirty transforms on any core objects that may be tied with scene objects. Only actors whose scene objects
+		 * were modified since the last call (as reported through _notifyBoundSODirty()) are updated.
+		 */
 		void _updateCoreObjectTransforms();
 
+		/** 
+		 * Notifies the manager that the transform, mobility or active state of a scene object with bound actors has
+		 * changed. All actors bound to the scene object will be updated on the next call to _updateCoreObjectTransforms().
+		 */
+		void _notifyBoundSODirty(const SceneObject& so);
+
 		/** Notifies the manager that a new component has just been created. The manager triggers necessary callbacks. */
 		void _notifyComponentCreated(const HComponent& component, bool parentActive);
 
@@ -157,9 +193,21 @@ namespace bs
 		/**	Callback that is triggered when the main render target size is changed. */
 		void onMainRenderTargetResized();
 
+		/** Adds a component to the active component list, and to its type's update bucket if it requires updates. */
+		void addToActiveList(const HComponent& component);
+
 		/** Removes a component from the active component list. */
 		void removeFromActiveList(const HComponent& component);
 
+		/** Adds a component to the update bucket for its type, creating the bucket if it doesn't exist. */
+		void addToUpdateBucket(Component* component);
+
+		/** Removes a component from its update bucket, if it is in one. */
+		void removeFromUpdateBucket(Component* component);
+
+		/** Calls update() on all components in the bucket, splitting the work over the task scheduler's worker threads. */
+		void updateParallel(ComponentUpdateBucket& bucket);
+
 		/** Removes a component from the inactive component list. */
 		void removeFromInactiveList(const HComponent& component);
 
@@ -178,10 +226,17 @@ namespace bs
 		/** Checks does the specified component type match the provided RTTI id. */
 		static bool isComponentOfType(const HComponent& component, UINT32 rttiId);
 
+		/** Queues the bound actor at the specified index for update in the next _updateCoreObjectTransforms() call. */
+		void markBoundActorDirty(UINT32 idx);
+
 	protected:
 		HSceneObject mRootNode;
 
-		UnorderedMap<SceneActor*, BoundActorData> mBoundActors;
+		Vector<BoundActorData> mBoundActors;
+		UnorderedMap<SceneActor*, UINT32> mBoundActorLookup;
+		UnorderedMultimap<UINT64, SceneActor*> mBoundActorsPerSO;
+		Vector<SceneActor*> mDirtyBoundActors;
+
 		UnorderedMap<Camera*, SPtr<Camera>> mCameras;
 		Vector<SPtr<Camera>> mMainCameras;
 
@@ -189,6 +244,12 @@ namespace bs
 		Vector<HComponent> mInactiveComponents;
 		Vector<HComponent> mUninitializedComponents;
 
+		Vector<ComponentUpdateBucket> mUpdateBuckets;
+		Vector<UINT32> mUpdateBucketOrder;
+		UnorderedMap<UINT64, UINT32> mUpdateBucketLookup;
+		UnorderedMap<UINT32, INT32> mComponentUpdatePriorities;
+		bool mUpdateOrderDirty = false;
+
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
 
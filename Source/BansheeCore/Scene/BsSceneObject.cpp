@@ -17,7 +17,7 @@ namespace bs
 	SceneObject::SceneObject(const String& name, UINT32 flags)
 		: GameObject(), mPrefabHash(0), mFlags(flags), mCachedLocalTfrm(Matrix4::IDENTITY)
 		, mCachedWorldTfrm(Matrix4::IDENTITY), mDirtyFlags(0xFFFFFFFF), mDirtyHash(0), mActiveSelf(true)
-		, mActiveHierarchy(true), mMobility(ObjectMobility::Movable)
+		, mActiveHierarchy(true), mMobility(ObjectMobility::Movable), mNumBoundActors(0)
 	{
 		setName(name);
 	}
@@ -435,6 +435,9 @@ namespace bs
 			mDirtyHash++;
 		}
 
+		if (mNumBoundActors > 0)
+			gSceneManager()._notifyBoundSODirty(*this);
+
 		// Only send component flags if we haven't removed them all
 		if (componentFlags != 0)
 		{
@@ -680,6 +683,9 @@ namespace bs
 		{
 			mActiveHierarchy = activeHierarchy;
 
+			if (mNumBoundActors > 0)
+				gSceneManager()._notifyBoundSODirty(*this);
+
 			if (triggerEvents)
 			{
 				if (activeHierarchy)
@@ -445,6 +445,7 @@ namespace bs
 		bool mActiveSelf;
 		bool mActiveHierarchy;
 		ObjectMobility mMobility;
+		UINT32 mNumBoundActors;
 
 		/**
 		 * Internal version of setParent() that allows you to set a null parent.
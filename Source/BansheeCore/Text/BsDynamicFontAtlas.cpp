@@ -0,0 +1,316 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Text/BsDynamicFontAtlas.h"
+#include "Text/BsFont.h"
+#include "Text/BsFontManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	/** Checks if the character is never rendered as a glyph by the text layout. */
+	static bool isWhitespaceChar(UINT32 charId)
+	{
+		return charId == ' ' || charId == '\t' || charId == '\n' || charId == '\r';
+	}
+
+	DynamicFontAtlas::Page::Page(UINT32 size)
+		:layout(size, size, size, size)
+	{ }
+
+	DynamicFontAtlas::DynamicFontAtlas(const SPtr<FontBitmap>& bitmap, const SPtr<FontRasterizer>& rasterizer,
+		const DYNAMIC_FONT_DESC& desc)
+		:mBitmap(bitmap), mRasterizer(rasterizer), mDesc(desc)
+	{
+		mDesc.pageSize = std::max(mDesc.pageSize, 1U);
+		mDesc.maxPagesPerSize = std::max(mDesc.maxPagesPerSize, 1U);
+	}
+
+	void DynamicFontAtlas::prepare(const WString& text)
+	{
+		// Text layout references the first page even if the text contains only whitespace
+		if(mPages.empty())
+			createPage();
+
+		UINT64 frameIdx = gTime().getFrameIdx();
+
+		// Mark all resident characters as used first, so their pages don't get evicted when making room for the missing
+		// characters below
+		Vector<UINT32> missingChars;
+		for(auto& entry : text)
+		{
+			UINT32 charId = (UINT32)entry;
+			if(isWhitespaceChar(charId))
+				continue;
+
+			if(mUnsupportedChars.find(charId) != mUnsupportedChars.end())
+				charId = FontRasterizer::MISSING_GLYPH_ID;
+
+			auto iterFind = mResidentChars.find(charId);
+			if(iterFind != mResidentChars.end())
+				mPages[iterFind->second].lastUsedFrame = frameIdx;
+			else
+				missingChars.push_back(charId);
+		}
+
+		for(auto& charId : missingChars)
+		{
+			if(mResidentChars.find(charId) != mResidentChars.end())
+				continue;
+
+			if(addChar(charId))
+				continue;
+
+			// Character isn't in the font, so the layout will use the missing glyph in its place
+			mUnsupportedChars.insert(charId);
+
+			if(mResidentChars.find(FontRasterizer::MISSING_GLYPH_ID) == mResidentChars.end())
+				addChar(FontRasterizer::MISSING_GLYPH_ID);
+		}
+	}
+
+	void DynamicFontAtlas::flush()
+	{
+		if(!mIsDirty)
+			return;
+
+		for(auto& page : mPages)
+		{
+			if(!page.isDirty)
+				continue;
+
+			// Upload a copy, as the data is locked until the upload completes, while new characters might get written to
+			// the page in the meantime
+			const TextureProperties& props = page.texture->getProperties();
+			SPtr<PixelData> data = props.allocBuffer(0, 0);
+
+			if(props.getFormat() != page.pixels->getFormat())
+				PixelUtil::bulkPixelConversion(*page.pixels, *data);
+			else
+				memcpy(data->getData(), page.pixels->getData(), page.pixels->getSize());
+
+			page.texture->writeData(data, 0, 0, true);
+			page.isDirty = false;
+		}
+
+		mIsDirty = false;
+	}
+
+	bool DynamicFontAtlas::addChar(UINT32 charId)
+	{
+		bool isMissingGlyph = charId == FontRasterizer::MISSING_GLYPH_ID;
+
+		RasterizedGlyph glyph;
+		if(!mRasterizer->rasterize(mBitmap->size, charId, glyph))
+		{
+			if(!isMissingGlyph)
+				return false;
+
+			// Nothing to substitute the missing glyph with, so store an empty one
+			glyph = RasterizedGlyph();
+		}
+
+		UINT32 pageIdx = 0;
+		UINT32 x = 0;
+		UINT32 y = 0;
+		bool hasPixels = glyph.width > 0 && glyph.height > 0;
+
+		if(hasPixels && !allocate(glyph.width, glyph.height, pageIdx, x, y))
+		{
+			LOGWRN("Character " + toString(charId) + " doesn't fit into a font page of size " + toString(mDesc.pageSize) +
+				". Increase the page size in order to render it.");
+
+			hasPixels = false;
+		}
+
+		if(hasPixels)
+		{
+			Page& page = mPages[pageIdx];
+
+			UINT32 rowPitch = page.pixels->getRowPitch();
+			UINT8* dst = page.pixels->getData() + y * rowPitch + x;
+			const UINT8* src = glyph.pixels.data();
+
+			for(UINT32 row = 0; row < glyph.height; row++)
+			{
+				memcpy(dst, src, glyph.width);
+
+				dst += rowPitch;
+				src += glyph.width;
+			}
+
+			page.chars.push_back(charId);
+			page.lastUsedFrame = gTime().getFrameIdx();
+			page.isDirty = true;
+			mIsDirty = true;
+		}
+		else
+		{
+			glyph.width = 0;
+			glyph.height = 0;
+		}
+
+		bool isNewChar = !isMissingGlyph && mBitmap->characters.find(charId) == mBitmap->characters.end();
+
+		// Characters evicted earlier keep their descriptor, only their location in the atlas changes
+		CharDesc desc;
+		if(!isNewChar)
+			desc = getCharDesc(charId);
+
+		float invPageSize = 1.0f / mDesc.pageSize;
+
+		desc.charId = isMissingGlyph ? 0 : charId;
+		desc.page = pageIdx;
+		desc.width = glyph.width;
+		desc.height = glyph.height;
+		desc.uvX = invPageSize * x;
+		desc.uvY = invPageSize * y;
+		desc.uvWidth = invPageSize * glyph.width;
+		desc.uvHeight = invPageSize * glyph.height;
+		desc.xOffset = glyph.xOffset;
+		desc.yOffset = glyph.yOffset;
+		desc.xAdvance = glyph.xAdvance;
+		desc.yAdvance = glyph.yAdvance;
+
+		if(isMissingGlyph)
+			mBitmap->missingGlyph = desc;
+		else
+		{
+			if(isNewChar)
+				addKerning(desc);
+
+			mBitmap->_setCharDesc(desc);
+		}
+
+		mResidentChars[charId] = pageIdx;
+		return true;
+	}
+
+	bool DynamicFontAtlas::allocate(UINT32 width, UINT32 height, UINT32& page, UINT32& x, UINT32& y)
+	{
+		if(width > mDesc.pageSize || height > mDesc.pageSize)
+			return false;
+
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if(mPages[i].layout.addElement(width, height, x, y))
+			{
+				page = i;
+				return true;
+			}
+		}
+
+		if(mPages.size() < mDesc.maxPagesPerSize)
+			page = createPage();
+		else
+		{
+			// Evict the least recently used page. Pages used during this or the previous frame are skipped, as the text
+			// using them is likely still being displayed. If all pages are in use, grow past the limit instead.
+			UINT64 frameIdx = gTime().getFrameIdx();
+			UINT64 oldestFrame = std::numeric_limits<UINT64>::max();
+			INT32 oldestPage = -1;
+
+			for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+			{
+				const Page& curPage = mPages[i];
+				if(curPage.lastUsedFrame + 1 >= frameIdx)
+					continue;
+
+				if(curPage.lastUsedFrame < oldestFrame)
+				{
+					oldestFrame = curPage.lastUsedFrame;
+					oldestPage = (INT32)i;
+				}
+			}
+
+			if(oldestPage != -1)
+			{
+				page = (UINT32)oldestPage;
+				evictPage(page);
+			}
+			else
+				page = createPage();
+		}
+
+		return mPages[page].layout.addElement(width, height, x, y);
+	}
+
+	UINT32 DynamicFontAtlas::createPage()
+	{
+		UINT32 pageIdx = (UINT32)mPages.size();
+
+		mPages.emplace_back(mDesc.pageSize);
+		Page& page = mPages.back();
+
+		// Text shader only samples the red channel, so a single channel is enough
+		TEXTURE_DESC texDesc;
+		texDesc.width = mDesc.pageSize;
+		texDesc.height = mDesc.pageSize;
+		texDesc.format = PF_R8;
+
+		page.texture = Texture::create(texDesc);
+		page.texture->setName(L"DynamicFontPage" + toWString(pageIdx));
+
+		page.pixels = bs_shared_ptr_new<PixelData>(mDesc.pageSize, mDesc.pageSize, 1, PF_R8);
+		page.pixels->allocateInternalBuffer();
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+
+		page.isDirty = true;
+		mIsDirty = true;
+
+		mBitmap->texturePages.push_back(page.texture);
+		return pageIdx;
+	}
+
+	void DynamicFontAtlas::evictPage(UINT32 pageIdx)
+	{
+		Page& page = mPages[pageIdx];
+
+		for(auto& charId : page.chars)
+			mResidentChars.erase(charId);
+
+		page.chars.clear();
+		page.layout.clear();
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+
+		page.isDirty = true;
+		mIsDirty = true;
+
+		FontManager::instance()._notifyCharactersEvicted();
+	}
+
+	void DynamicFontAtlas::addKerning(CharDesc& desc)
+	{
+		if(!mRasterizer->hasKerning())
+			return;
+
+		for(auto& entry : mBitmap->characters)
+		{
+			UINT32 otherCharId = entry.first;
+
+			INT32 amount = mRasterizer->getKerning(mBitmap->size, desc.charId, otherCharId);
+			if(amount != 0) // We don't store 0 kerning, this is assumed default
+			{
+				KerningPair pair;
+				pair.otherCharId = otherCharId;
+				pair.amount = amount;
+
+				desc.kerningPairs.push_back(pair);
+			}
+
+			INT32 otherAmount = mRasterizer->getKerning(mBitmap->size, otherCharId, desc.charId);
+			if(otherAmount != 0)
+				mBitmap->_addKerningPair(otherCharId, desc.charId, otherAmount);
+		}
+	}
+
+	CharDesc& DynamicFontAtlas::getCharDesc(UINT32 charId)
+	{
+		if(charId == FontRasterizer::MISSING_GLYPH_ID)
+			return mBitmap->missingGlyph;
+
+		return mBitmap->characters[charId];
+	}
+}
@@ -0,0 +1,93 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsFontRasterizer.h"
+#include "Image/BsTextureAtlasLayout.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Manages the texture pages of a single size of a dynamic font. Characters are rasterized on demand and packed into
+	 * the pages of the provided font bitmap. Once all the pages are full the least recently used page is cleared in order
+	 * to make room for new characters, so memory use scales with the characters actually being displayed.
+	 *
+	 * Descriptors of characters whose page was evicted are kept in the font bitmap (so existing references to them remain
+	 * valid), but they must be rasterized again through prepare() before they can be rendered.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT DynamicFontAtlas
+	{
+	public:
+		DynamicFontAtlas(const SPtr<FontBitmap>& bitmap, const SPtr<FontRasterizer>& rasterizer,
+			const DYNAMIC_FONT_DESC& desc);
+
+		/**
+		 * Ensures all the characters in the provided text are rasterized and present in the texture pages, and marks
+		 * their pages as used in the current frame. All missing characters are rasterized in a single batch, and the
+		 * modified pages are uploaded on the next call to flush().
+		 */
+		void prepare(const WString& text);
+
+		/** Uploads the contents of all pages modified since the last call to the GPU. */
+		void flush();
+
+		/** Checks are there any modified pages waiting to be uploaded by flush(). */
+		bool isDirty() const { return mIsDirty; }
+
+	private:
+		/** Single texture page containing rasterized characters. */
+		struct Page
+		{
+			Page(UINT32 size);
+
+			HTexture texture;
+			SPtr<PixelData> pixels;
+			TextureAtlasLayout layout;
+			Vector<UINT32> chars;
+			UINT64 lastUsedFrame = 0;
+			bool isDirty = false;
+		};
+
+		/**
+		 * Rasterizes the character, stores its pixels in one of the pages and updates its descriptor in the font bitmap.
+		 * Returns false if the font doesn't contain the character.
+		 */
+		bool addChar(UINT32 charId);
+
+		/**
+		 * Finds space for an element of the specified size, evicting the least recently used page or creating a new page
+		 * if needed. Returns false if the element can never fit into a page.
+		 */
+		bool allocate(UINT32 width, UINT32 height, UINT32& page, UINT32& x, UINT32& y);
+
+		/** Creates a new empty texture page and returns its index. */
+		UINT32 createPage();
+
+		/** Clears all characters from the page. */
+		void evictPage(UINT32 pageIdx);
+
+		/** Calculates kerning between a newly added character and all existing characters. */
+		void addKerning(CharDesc& desc);
+
+		/** Returns the descriptor stored in the font bitmap for the character with the specified ID. */
+		CharDesc& getCharDesc(UINT32 charId);
+
+		SPtr<FontBitmap> mBitmap;
+		SPtr<FontRasterizer> mRasterizer;
+		DYNAMIC_FONT_DESC mDesc;
+
+		Vector<Page> mPages;
+		UnorderedMap<UINT32, UINT32> mResidentChars; // Maps character ID to the page it is stored in
+		UnorderedSet<UINT32> mUnsupportedChars;
+		bool mIsDirty = false;
+	};
+
+	/** @} */
+}
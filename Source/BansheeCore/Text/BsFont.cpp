@@ -3,19 +3,137 @@
 #include "Text/BsFont.h"
 #include "Private/RTTI/BsFontRTTI.h"
 #include "Text/BsFontManager.h"
+#include "Text/BsDynamicFontAtlas.h"
 #include "Resources/BsResources.h"
 
 namespace bs
 {
+	/** Returns a key that uniquely identifies a pair of characters. */
+	static UINT64 getKerningKey(UINT32 first, UINT32 second)
+	{
+		return ((UINT64)first << 32) | (UINT64)second;
+	}
+
 	const CharDesc& FontBitmap::getCharDesc(UINT32 charId) const
 	{
+		if(mLookup.isBuilt)
+		{
+			const CharDesc* desc;
+			if(charId < NUM_DIRECT_LOOKUP_CHARS)
+				desc = mLookup.direct[charId];
+			else
+			{
+				auto iterFind = mLookup.other.find(charId);
+				desc = iterFind != mLookup.other.end() ? iterFind->second : nullptr;
+			}
+
+			return desc != nullptr ? *desc : missingGlyph;
+		}
+
 		auto iterFind = characters.find(charId);
 		if(iterFind != characters.end())
+			return iterFind->second;
+
+		return missingGlyph;
+	}
+
+	INT32 FontBitmap::getKerning(const CharDesc& first, const CharDesc& second) const
+	{
+		if(first.kerningPairs.empty())
+			return 0;
+
+		if(mLookup.isBuilt)
 		{
-			return characters.at(charId);
+			auto iterFind = mLookup.kerning.find(getKerningKey(first.charId, second.charId));
+			if(iterFind != mLookup.kerning.end())
+				return iterFind->second;
+
+			return 0;
 		}
 
-		return missingGlyph;
+		for(auto& entry : first.kerningPairs)
+		{
+			if(entry.otherCharId == second.charId)
+				return entry.amount;
+		}
+
+		return 0;
+	}
+
+	void FontBitmap::_buildLookupTables()
+	{
+		mLookup.clear();
+
+		for(auto& entry : characters)
+		{
+			const CharDesc& desc = entry.second;
+
+			if(entry.first < NUM_DIRECT_LOOKUP_CHARS)
+				mLookup.direct[entry.first] = &desc;
+			else
+				mLookup.other[entry.first] = &desc;
+
+			// Keep the first entry in case of duplicates, same as a linear search would
+			for(auto& kerningPair : desc.kerningPairs)
+			{
+				UINT64 key = getKerningKey(desc.charId, kerningPair.otherCharId);
+				if(!mLookup.kerning.contains(key))
+					mLookup.kerning[key] = kerningPair.amount;
+			}
+		}
+
+		mLookup.isBuilt = true;
+	}
+
+	void FontBitmap::_setCharDesc(const CharDesc& desc)
+	{
+		CharDesc& entry = characters[desc.charId];
+		entry = desc;
+
+		if(!mLookup.isBuilt)
+			return;
+
+		if(desc.charId < NUM_DIRECT_LOOKUP_CHARS)
+			mLookup.direct[desc.charId] = &entry;
+		else
+			mLookup.other[desc.charId] = &entry;
+
+		for(auto& kerningPair : entry.kerningPairs)
+		{
+			UINT64 key = getKerningKey(entry.charId, kerningPair.otherCharId);
+			if(!mLookup.kerning.contains(key))
+				mLookup.kerning[key] = kerningPair.amount;
+		}
+	}
+
+	void FontBitmap::_addKerningPair(UINT32 first, UINT32 second, INT32 amount)
+	{
+		auto iterFind = characters.find(first);
+		if(iterFind == characters.end())
+			return;
+
+		KerningPair pair;
+		pair.otherCharId = second;
+		pair.amount = amount;
+
+		iterFind->second.kerningPairs.push_back(pair);
+
+		if(!mLookup.isBuilt)
+			return;
+
+		UINT64 key = getKerningKey(first, second);
+		if(!mLookup.kerning.contains(key))
+			mLookup.kerning[key] = amount;
+	}
+
+	void FontBitmap::LookupTables::clear()
+	{
+		for(UINT32 i = 0; i < NUM_DIRECT_LOOKUP_CHARS; i++)
+			direct[i] = nullptr;
+
+		other.clear();
+		kerning.clear();
+		isBuilt = false;
 	}
 
 	RTTITypeBase* FontBitmap::getRTTIStatic()
@@ -35,16 +153,69 @@ namespace bs
 	Font::~Font()
 	{ }
 
+	void Font::destroy()
+	{
+		// Cached text layouts reference the font bitmaps, which would otherwise keep the font textures loaded
+		if(FontManager::isStarted())
+			FontManager::instance()._notifyFontDestroyed(this);
+
+		Resource::destroy();
+	}
+
 	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
+		{
+			(*iter)->_buildLookupTables();
 			mFontDataPerSize[(*iter)->size] = *iter;
+		}
 
 		Resource::initialize();
 	}
 
+	void Font::initialize(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc)
+	{
+		mFontFile = fontFile;
+		mDynamicDesc = desc;
+
+		if(mFontFile != nullptr)
+		{
+			mRasterizer = FontManager::instance()._createRasterizer(mFontFile, mDynamicDesc);
+
+			if(mRasterizer == nullptr)
+				LOGERR("Unable to create a rasterizer for a dynamic font. Make sure the font importer plugin is loaded.");
+		}
+
+		Resource::initialize();
+	}
+
+	void Font::_prepareCharacters(UINT32 size, const WString& text)
+	{
+		if(!isDynamic())
+			return;
+
+		SPtr<DynamicFontAtlas> atlas;
+		{
+			Lock lock(mDynamicMutex);
+
+			auto iterFind = mDynamicAtlases.find(size);
+			if(iterFind == mDynamicAtlases.end())
+				return;
+
+			atlas = iterFind->second;
+		}
+
+		atlas->prepare(text);
+
+		if(atlas->isDirty())
+			FontManager::instance()._queueAtlasUpload(atlas);
+	}
+
 	SPtr<FontBitmap> Font::getBitmap(UINT32 size) const
 	{
+		if(isDynamic())
+			return getDynamicBitmap(size);
+
 		auto iterFind = mFontDataPerSize.find(size);
 
 		if(iterFind == mFontDataPerSize.end())
@@ -53,8 +224,38 @@ namespace bs
 		return iterFind->second;
 	}
 
+	SPtr<FontBitmap> Font::getDynamicBitmap(UINT32 size) const
+	{
+		Lock lock(mDynamicMutex);
+
+		auto iterFind = mFontDataPerSize.find(size);
+		if(iterFind != mFontDataPerSize.end())
+			return iterFind->second;
+
+		FontSizeMetrics metrics;
+		if(!mRasterizer->getMetrics(size, metrics))
+			return nullptr;
+
+		SPtr<FontBitmap> bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = size;
+		bitmap->baselineOffset = metrics.baselineOffset;
+		bitmap->lineHeight = metrics.lineHeight;
+		bitmap->spaceWidth = metrics.spaceWidth;
+		bitmap->missingGlyph = CharDesc();
+		bitmap->_buildLookupTables();
+
+		mFontDataPerSize[size] = bitmap;
+		mDynamicAtlases[size] = bs_shared_ptr_new<DynamicFontAtlas>(bitmap, mRasterizer, mDynamicDesc);
+
+		return bitmap;
+	}
+
 	INT32 Font::getClosestSize(UINT32 size) const
 	{
+		// Dynamic fonts can provide any size
+		if(isDynamic())
+			return size;
+
 		UINT32 minDiff = std::numeric_limits<UINT32>::max();
 		UINT32 bestSize = size;
 
@@ -87,6 +288,10 @@ namespace bs
 
 	void Font::getResourceDependencies(FrameVector<HResource>& dependencies) const
 	{
+		// Pages of dynamic fonts are generated at runtime
+		if(isDynamic())
+			return;
+
 		for (auto& fontDataEntry : mFontDataPerSize)
 		{
 			for (auto& texture : fontDataEntry.second->texturePages)
@@ -99,6 +304,9 @@ namespace bs
 
 	void Font::getCoreDependencies(Vector<CoreObject*>& dependencies)
 	{
+		if(isDynamic())
+			return;
+
 		for (auto& fontDataEntry : mFontDataPerSize)
 		{
 			for (auto& texture : fontDataEntry.second->texturePages)
@@ -116,11 +324,23 @@ namespace bs
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
+	HFont Font::createDynamic(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc)
+	{
+		SPtr<Font> newFont = _createDynamicPtr(fontFile, desc);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
 	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		return FontManager::instance().create(fontData);
 	}
 
+	SPtr<Font> Font::_createDynamicPtr(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc)
+	{
+		return FontManager::instance().createDynamic(fontFile, desc);
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
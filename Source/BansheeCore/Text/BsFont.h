@@ -5,6 +5,8 @@
 #include "BsCorePrerequisites.h"
 #include "Resources/BsResource.h"
 #include "Text/BsFontDesc.h"
+#include "Text/BsFontRasterizer.h"
+#include "Utility/BsFlatHashMap.h"
 
 namespace bs
 {
@@ -46,6 +48,60 @@ namespace bs
 		/** All characters in the font referenced by character ID. */
 		Map<UINT32, CharDesc> characters;
 
+		/**
+		 * Returns the kerning offset to apply between two consecutive characters, in pixels.
+		 *
+		 * @param[in]	first	Character that comes first.
+		 * @param[in]	second	Character that follows @p first.
+		 */
+		INT32 getKerning(const CharDesc& first, const CharDesc& second) const;
+
+		/**
+		 * Builds tables used for quickly looking up characters and kerning pairs. Must be called after @p characters has
+		 * been modified, otherwise lookups fall back to slower searches. Called automatically on font initialization.
+		 */
+		void _buildLookupTables();
+
+		/**
+		 * Adds a new character, or replaces an existing one with the same ID, while keeping the lookup tables up to date.
+		 * References to an existing character remain valid after it is replaced.
+		 */
+		void _setCharDesc(const CharDesc& desc);
+
+		/**
+		 * Adds a kerning pair to an existing character, while keeping the lookup tables up to date.
+		 *
+		 * @param[in]	first	Character that comes first. Must be a character present in @p characters.
+		 * @param[in]	second	Character that follows @p first.
+		 * @param[in]	amount	Kerning offset to apply between the two characters, in pixels.
+		 */
+		void _addKerningPair(UINT32 first, UINT32 second, INT32 amount);
+
+	private:
+		/** Number of characters at the start of the Unicode range (ASCII and Latin-1) that are looked up directly. */
+		static constexpr UINT32 NUM_DIRECT_LOOKUP_CHARS = 256;
+
+		/** 
+		 * Tables for quick lookup of character and kerning data. The tables reference entries in the characters map, 
+		 * therefore copies of the tables start out empty and must be rebuilt.
+		 */
+		struct LookupTables
+		{
+			LookupTables() = default;
+			LookupTables(const LookupTables& other) { }
+			LookupTables& operator=(const LookupTables& other) { clear(); return *this; }
+
+			/** Clears all the tables. */
+			void clear();
+
+			const CharDesc* direct[NUM_DIRECT_LOOKUP_CHARS] = { };
+			FlatHashMap<UINT32, const CharDesc*> other;
+			FlatHashMap<UINT64, INT32> kerning;
+			bool isBuilt = false;
+		};
+
+		LookupTables mLookup;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -58,6 +114,10 @@ namespace bs
 	/**
 	 * Font resource containing data about textual characters and how to render text. Contains one or multiple font 
 	 * bitmaps, each for a specific size.
+	 *
+	 * Fonts can also be dynamic, in which case they keep the source font file and create bitmaps for any requested size,
+	 * with characters being rasterized on demand as text using them is laid out. Dynamic fonts require a font rasterizer
+	 * to be registered with the FontManager (usually done by the font importer plugin).
 	 */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:GUI_Engine) Font : public Resource
 	{
@@ -82,9 +142,20 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		INT32 getClosestSize(UINT32 size) const;
 
+		/** Checks is this a dynamic font that rasterizes characters on demand. */
+		bool isDynamic() const { return mRasterizer != nullptr; }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**
+		 * Creates a new dynamic font that rasterizes characters from the provided font file on demand.
+		 *
+		 * @param[in]	fontFile	Contents of the source font file (e.g. a .ttf file).
+		 * @param[in]	desc		Settings controlling how are the characters rasterized and stored.
+		 */
+		static HFont createDynamic(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -99,9 +170,27 @@ namespace bs
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/**
+		 * Initializes a dynamic font using the provided font file.
+		 *
+		 * @note	Internal method. Factory methods will call this automatically for you.
+		 */
+		void initialize(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc);
+
+		/**
+		 * Ensures all characters in the provided text are rasterized for the specified size. Must be called before laying
+		 * out text using a dynamic font. Does nothing for fonts that aren't dynamic.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void _prepareCharacters(UINT32 size, const WString& text);
+
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new dynamic font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createDynamicPtr(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc);
+
 		/** @} */
 
 	protected:
@@ -109,6 +198,9 @@ namespace bs
 
 		Font();
 
+		/** @copydoc Resource::destroy */
+		void destroy() override;
+
 		/** @copydoc Resource::getResourceDependencies */
 		void getResourceDependencies(FrameVector<HResource>& dependencies) const override;
 
@@ -116,7 +208,16 @@ namespace bs
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
 	private:
-		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+		/** Returns the bitmap for the specified size of a dynamic font, creating it if it doesn't exist. */
+		SPtr<FontBitmap> getDynamicBitmap(UINT32 size) const;
+
+		mutable Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+
+		SPtr<MemoryDataStream> mFontFile;
+		DYNAMIC_FONT_DESC mDynamicDesc;
+		SPtr<FontRasterizer> mRasterizer;
+		mutable UnorderedMap<UINT32, SPtr<DynamicFontAtlas>> mDynamicAtlases;
+		mutable Mutex mDynamicMutex;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
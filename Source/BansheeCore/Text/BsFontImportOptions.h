@@ -12,15 +12,6 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/**	Import options that allow you to control how is a font imported. */
 	class BS_CORE_EXPORT FontImportOptions : public ImportOptions
 	{
@@ -48,6 +39,13 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**
+		 * Sets whether the font should be imported as a dynamic font. Dynamic fonts keep the source font file and
+		 * rasterize characters on demand at runtime, for any size, instead of pre-rendering the provided sizes and
+		 * character ranges during import.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +64,9 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/**	Checks whether the font should be imported as a dynamic font. */
+		bool getDynamic() const { return mDynamic; }
+
 		/** Creates a new import options object that allows you to customize how are fonts imported. */
 		static SPtr<FontImportOptions> create();
 
@@ -76,6 +77,7 @@ namespace bs
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mDynamic;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
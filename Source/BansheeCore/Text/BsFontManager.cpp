@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "Text/BsFontManager.h"
 #include "Text/BsFont.h"
+#include "Text/BsDynamicFontAtlas.h"
 
 namespace bs
 {
@@ -14,6 +15,15 @@ namespace bs
 		return newFont;
 	}
 
+	SPtr<Font> FontManager::createDynamic(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc) const
+	{
+		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->initialize(fontFile, desc);
+
+		return newFont;
+	}
+
 	SPtr<Font> FontManager::_createEmpty() const
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -21,4 +31,132 @@ namespace bs
 
 		return newFont;
 	}
-}
\ No newline at end of file
+
+	SPtr<const TextData<>> FontManager::getTextData(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width,
+		UINT32 height, bool wordWrap, bool wordBreak)
+	{
+		SPtr<const FontBitmap> fontData;
+		if(font.isLoaded())
+			fontData = font->getBitmap(font->getClosestSize(fontSize));
+
+		if(fontData == nullptr)
+			return bs_shared_ptr_new<TextData<>>(text, font, fontSize, width, height, wordWrap, wordBreak);
+
+		// Characters used by a cached layout might have been evicted, and their pages need to be marked as used even if 
+		// the layout is reused. This must happen before the key is built, as it can evict other characters.
+		font->_prepareCharacters(fontData->size, text);
+
+		// Height doesn't affect the layout, and width and word break only matter when wrapping. Normalize them so more 
+		// layouts can be shared.
+		TextLayoutKey key;
+		key.wordWrap = wordWrap && width > 0;
+		key.wordBreak = key.wordWrap && wordBreak;
+		key.width = key.wordWrap ? width : 0;
+		key.fontData = fontData.get();
+		key.evictionCount = getCharacterEvictionCount();
+		key.text = text;
+		key.textHash = std::hash<WString>()(text);
+
+		{
+			Lock lock(mTextLayoutMutex);
+
+			auto iterFind = mTextLayoutLookup.find(key);
+			if(iterFind != mTextLayoutLookup.end())
+			{
+				mTextLayouts.splice(mTextLayouts.begin(), mTextLayouts, iterFind->second);
+				return iterFind->second->textData;
+			}
+		}
+
+		// Note: The cached text data keeps the font bitmap referenced, so its address can't be reused by another bitmap
+		// while the entry exists. The font itself is only referenced weakly, and the entry is removed when it is destroyed.
+		SPtr<const TextData<>> textData = bs_shared_ptr_new<TextData<>>(text, font, fontSize, key.width, 0, key.wordWrap, 
+			key.wordBreak);
+
+		Lock lock(mTextLayoutMutex);
+
+		// Another thread might have added the same layout in the meantime
+		if(mTextLayoutLookup.find(key) != mTextLayoutLookup.end())
+			return textData;
+
+		mTextLayouts.push_front({ key, font.get(), textData });
+		mTextLayoutLookup[key] = mTextLayouts.begin();
+
+		if(mTextLayouts.size() > MAX_CACHED_TEXT_LAYOUTS)
+		{
+			mTextLayoutLookup.erase(mTextLayouts.back().key);
+			mTextLayouts.pop_back();
+		}
+
+		return textData;
+	}
+
+	void FontManager::_update()
+	{
+		Vector<SPtr<DynamicFontAtlas>> atlases;
+		{
+			Lock lock(mAtlasUploadMutex);
+			std::swap(atlases, mQueuedAtlasUploads);
+		}
+
+		for(auto& atlas : atlases)
+			atlas->flush();
+	}
+
+	SPtr<FontRasterizer> FontManager::_createRasterizer(const SPtr<MemoryDataStream>& fontFile,
+		const DYNAMIC_FONT_DESC& desc) const
+	{
+		if(mRasterizerFactory == nullptr)
+			return nullptr;
+
+		return mRasterizerFactory(fontFile, desc);
+	}
+
+	void FontManager::_queueAtlasUpload(const SPtr<DynamicFontAtlas>& atlas)
+	{
+		Lock lock(mAtlasUploadMutex);
+
+		auto iterFind = std::find(mQueuedAtlasUploads.begin(), mQueuedAtlasUploads.end(), atlas);
+		if(iterFind == mQueuedAtlasUploads.end())
+			mQueuedAtlasUploads.push_back(atlas);
+	}
+
+	void FontManager::_notifyFontDestroyed(const Font* font)
+	{
+		Lock lock(mTextLayoutMutex);
+
+		for(auto iter = mTextLayouts.begin(); iter != mTextLayouts.end();)
+		{
+			if(iter->font == font)
+			{
+				mTextLayoutLookup.erase(iter->key);
+				iter = mTextLayouts.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void FontManager::_notifyCharactersEvicted()
+	{
+		mCharacterEvictionCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	size_t FontManager::TextLayoutKey::HashFunction::operator()(const TextLayoutKey& key) const
+	{
+		size_t hash = key.textHash;
+		hash_combine(hash, key.fontData);
+		hash_combine(hash, key.evictionCount);
+		hash_combine(hash, key.width);
+		hash_combine(hash, key.wordWrap);
+		hash_combine(hash, key.wordBreak);
+
+		return hash;
+	}
+
+	bool FontManager::TextLayoutKey::EqualFunction::operator()(const TextLayoutKey& lhs, const TextLayoutKey& rhs) const
+	{
+		return lhs.textHash == rhs.textHash && lhs.fontData == rhs.fontData && lhs.evictionCount == rhs.evictionCount &&
+			lhs.width == rhs.width && lhs.wordWrap == rhs.wordWrap && lhs.wordBreak == rhs.wordBreak && lhs.text == rhs.text;
+	}
+}
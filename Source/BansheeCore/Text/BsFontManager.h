@@ -4,6 +4,8 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Text/BsTextData.h"
+#include "Text/BsFontRasterizer.h"
 
 namespace bs
 {
@@ -11,19 +13,118 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Handles creation of fonts. */
+	/**	Handles creation of fonts, and caching of text layouts generated using those fonts. */
 	class BS_CORE_EXPORT FontManager : public Module<FontManager>
 	{
 	public:
 		/**	Creates a new font from the provided populated font data structure. */
 		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData) const;
 
+		/** Creates a new dynamic font that rasterizes characters from the provided font file on demand. */
+		SPtr<Font> createDynamic(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc) const;
+
 		/**
 		 * Creates an empty font.
 		 *
 		 * @note	Internal method. Used by factory methods.
 		 */
 		SPtr<Font> _createEmpty() const;
+
+		/**
+		 * Returns text data containing the layout of the provided string. Parameters are the same as for the TextData 
+		 * constructor. Recently used layouts are cached, so calls with the same string and parameters are able to reuse an
+		 * existing layout instead of generating a new one.
+		 *
+		 * @note	Thread safe, except when used with dynamic fonts, whose text must be laid out on the sim thread.
+		 */
+		SPtr<const TextData<>> getTextData(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width = 0, 
+			UINT32 height = 0, bool wordWrap = false, bool wordBreak = true);
+
+		/**
+		 * Uploads any characters of dynamic fonts rasterized since the last call. Should be called once per frame, after
+		 * all text for the frame has been laid out.
+		 */
+		void _update();
+
+		/**
+		 * Registers a factory used for creating rasterizers for dynamic fonts. Normally called by the font importer plugin
+		 * when it is loaded.
+		 */
+		void _setRasterizerFactory(const FontRasterizerFactory& factory) { mRasterizerFactory = factory; }
+
+		/** Creates a rasterizer for a dynamic font. Returns null if no rasterizer factory is registered. */
+		SPtr<FontRasterizer> _createRasterizer(const SPtr<MemoryDataStream>& fontFile, 
+			const DYNAMIC_FONT_DESC& desc) const;
+
+		/** Queues pages of a dynamic font atlas to be uploaded on the next call to _update(). */
+		void _queueAtlasUpload(const SPtr<DynamicFontAtlas>& atlas);
+
+		/** 
+		 * Notifies the manager that characters of a dynamic font were evicted from their texture page, invalidating any
+		 * existing text layouts and geometry using them.
+		 */
+		void _notifyCharactersEvicted();
+
+		/**
+		 * Returns a counter that is incremented every time characters of a dynamic font are evicted from their texture
+		 * page. Any geometry generated from text layouts before the counter changed might reference texture areas that 
+		 * now contain different characters, and should be rebuilt.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT64 getCharacterEvictionCount() const { return mCharacterEvictionCount.load(std::memory_order_relaxed); }
+
+		/** 
+		 * Notifies the manager that a font is being destroyed, removing all text layouts using it from the cache. This
+		 * releases the font bitmaps and their textures held by the cached layouts.
+		 */
+		void _notifyFontDestroyed(const Font* font);
+
+	private:
+		/** Maximum number of text layouts to keep in the cache. */
+		static constexpr UINT32 MAX_CACHED_TEXT_LAYOUTS = 1024;
+
+		/** Key that uniquely identifies a text layout. */
+		struct TextLayoutKey
+		{
+			class HashFunction
+			{
+			public:
+				size_t operator()(const TextLayoutKey& key) const;
+			};
+
+			class EqualFunction
+			{
+			public:
+				bool operator()(const TextLayoutKey& lhs, const TextLayoutKey& rhs) const;
+			};
+
+			WString text;
+			size_t textHash;
+			const FontBitmap* fontData;
+			UINT64 evictionCount;
+			UINT32 width;
+			bool wordWrap;
+			bool wordBreak;
+		};
+
+		/** Text layout stored in the cache. */
+		struct CachedTextLayout
+		{
+			TextLayoutKey key;
+			const Font* font;
+			SPtr<const TextData<>> textData;
+		};
+
+		List<CachedTextLayout> mTextLayouts; // Most recently used first
+		UnorderedMap<TextLayoutKey, List<CachedTextLayout>::iterator, TextLayoutKey::HashFunction, 
+			TextLayoutKey::EqualFunction> mTextLayoutLookup;
+		Mutex mTextLayoutMutex;
+
+		FontRasterizerFactory mRasterizerFactory;
+		Vector<SPtr<DynamicFontAtlas>> mQueuedAtlasUploads;
+		std::atomic<UINT64> mCharacterEvictionCount{0};
+		Mutex mAtlasUploadMutex;
 	};
 
 	/** @} */
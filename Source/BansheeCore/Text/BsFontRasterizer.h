@@ -0,0 +1,93 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsFontDesc.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Settings that control how are characters of a dynamic font rasterized and stored at runtime. */
+	struct DYNAMIC_FONT_DESC
+	{
+		/** Dots per inch resolution to use when rendering the characters. */
+		UINT32 dpi = 96;
+
+		/** Determines how are the characters rendered. */
+		FontRenderMode renderMode = FontRenderMode::HintedSmooth;
+
+		/** Width and height of a single texture page that rasterized characters are stored in, in pixels. */
+		UINT32 pageSize = 512;
+
+		/**
+		 * Number of texture pages a single font size can use before least recently used pages start getting evicted to
+		 * make room for new characters.
+		 */
+		UINT32 maxPagesPerSize = 4;
+	};
+
+	/** Metrics of a font of a specific size, as reported by FontRasterizer. */
+	struct FontSizeMetrics
+	{
+		INT32 baselineOffset = 0; /**< Y offset to the baseline on which the characters are placed, in pixels. */
+		UINT32 lineHeight = 0; /**< Height of a single line of the font, in pixels. */
+		UINT32 spaceWidth = 0; /**< Width of a space, in pixels. */
+	};
+
+	/** Pixels and metrics of a single rasterized character, as reported by FontRasterizer. */
+	struct RasterizedGlyph
+	{
+		UINT32 width = 0, height = 0; /**< Width/height of the character bitmap, in pixels. */
+		INT32 xOffset = 0, yOffset = 0; /**< Offset for the visible portion of the character, in pixels. */
+		INT32 xAdvance = 0, yAdvance = 0; /**< How much to advance the pen after writing this character, in pixels. */
+
+		/** Coverage of the character, one byte per pixel, rows tightly packed. */
+		Vector<UINT8> pixels;
+	};
+
+	/**
+	 * Renders characters from a source font file on demand. Used by dynamic fonts to rasterize characters as they are
+	 * needed, instead of all characters being rendered during import. Implemented by font importer plugins, and created
+	 * through the factory registered with FontManager::_setRasterizerFactory().
+	 */
+	class BS_CORE_EXPORT FontRasterizer
+	{
+	public:
+		virtual ~FontRasterizer() = default;
+
+		/** Retrieves metrics for the font of the specified size. Returns false if the size is not supported. */
+		virtual bool getMetrics(UINT32 size, FontSizeMetrics& output) = 0;
+
+		/**
+		 * Rasterizes a single character.
+		 *
+		 * @param[in]	size	Font size to render the character at, in points.
+		 * @param[in]	charId	Unicode key of the character to render, or MISSING_GLYPH_ID to render the glyph used for
+		 *						characters not present in the font.
+		 * @param[out]	output	Rasterized character pixels and metrics.
+		 * @return				False if the font doesn't contain the character, or if the character failed to render.
+		 */
+		virtual bool rasterize(UINT32 size, UINT32 charId, RasterizedGlyph& output) = 0;
+
+		/** Returns the kerning offset to apply between two consecutive characters, in pixels. */
+		virtual INT32 getKerning(UINT32 size, UINT32 first, UINT32 second) = 0;
+
+		/** Checks if the font provides any kerning information. */
+		virtual bool hasKerning() const = 0;
+
+		/** Character ID that can be provided to rasterize() in order to render the missing glyph. */
+		static constexpr UINT32 MISSING_GLYPH_ID = (UINT32)-1;
+	};
+
+	/**
+	 * Creates a rasterizer for the provided font file. Returns null if the font file cannot be used with the rasterizer.
+	 */
+	typedef std::function<SPtr<FontRasterizer>(const SPtr<MemoryDataStream>&, const DYNAMIC_FONT_DESC&)>
+		FontRasterizerFactory;
+
+	/** @} */
+}
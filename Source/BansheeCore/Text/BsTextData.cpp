@@ -21,9 +21,9 @@ namespace bs
 	}
 
 	// Assumes charIdx is an index right after last char in the list (if any). All chars need to be sequential.
-	UINT32 TextDataBase::TextWord::addChar(UINT32 charIdx, const CharDesc& desc)
+	UINT32 TextDataBase::TextWord::addChar(UINT32 charIdx, const CharDesc& desc, const FontBitmap& fontData)
 	{
-		UINT32 charWidth = calcCharWidth(mLastChar, desc);
+		UINT32 charWidth = calcCharWidth(mLastChar, desc, fontData);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, desc.height);
@@ -38,28 +38,16 @@ namespace bs
 		return charWidth;
 	}
 
-	UINT32 TextDataBase::TextWord::calcWidthWithChar(const CharDesc& desc)
+	UINT32 TextDataBase::TextWord::calcWidthWithChar(const CharDesc& desc, const FontBitmap& fontData)
 	{
-		return mWidth + calcCharWidth(mLastChar, desc);
+		return mWidth + calcCharWidth(mLastChar, desc, fontData);
 	}
 
-	UINT32 TextDataBase::TextWord::calcCharWidth(const CharDesc* prevDesc, const CharDesc& desc)
+	UINT32 TextDataBase::TextWord::calcCharWidth(const CharDesc* prevDesc, const CharDesc& desc, const FontBitmap& fontData)
 	{
 		UINT32 charWidth = desc.xAdvance;
 		if (prevDesc != nullptr)
-		{
-			UINT32 kerning = 0;
-			for (size_t j = 0; j < prevDesc->kerningPairs.size(); j++)
-			{
-				if (prevDesc->kerningPairs[j].otherCharId == desc.charId)
-				{
-					kerning = prevDesc->kerningPairs[j].amount;
-					break;
-				}
-			}
-
-			charWidth += kerning;
-		}
+			charWidth += fontData.getKerning(*prevDesc, desc);
 
 		return charWidth;
 	}
@@ -100,7 +88,7 @@ namespace bs
 		}
 
 		TextWord& lastWord = MemBuffer->WordBuffer[mWordsEnd];
-		charWidth = lastWord.addChar(charIdx, charDesc);
+		charWidth = lastWord.addChar(charIdx, charDesc, *mTextData->mFontData);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, lastWord.getHeight());
@@ -160,18 +148,19 @@ namespace bs
 	UINT32 TextDataBase::TextLine::calcWidthWithChar(const CharDesc& desc)
 	{
 		UINT32 charWidth = 0;
+		const FontBitmap& fontData = *mTextData->mFontData;
 
 		if (!mIsEmpty)
 		{
 			TextWord& lastWord = MemBuffer->WordBuffer[mWordsEnd];
 			if (lastWord.isSpacer())
-				charWidth = TextWord::calcCharWidth(nullptr, desc);
+				charWidth = TextWord::calcCharWidth(nullptr, desc, fontData);
 			else
-				charWidth = lastWord.calcWidthWithChar(desc) - lastWord.getWidth();
+				charWidth = lastWord.calcWidthWithChar(desc, fontData) - lastWord.getWidth();
 		}
 		else
 		{
-			charWidth = TextWord::calcCharWidth(nullptr, desc);
+			charWidth = TextWord::calcCharWidth(nullptr, desc, fontData);
 		}
 
 		return mWidth + charWidth;
@@ -261,17 +250,7 @@ namespace bs
 					
 					kerning = 0;
 					if((j + 1) <= word.getCharsEnd())
-					{
-						const CharDesc& nextChar = mTextData->getChar(j + 1);
-						for(size_t j = 0; j < curChar.kerningPairs.size(); j++)
-						{
-							if(curChar.kerningPairs[j].otherCharId == nextChar.charId)
-							{
-								kerning = curChar.kerningPairs[j].amount;
-								break;
-							}
-						}
-					}
+						kerning = mTextData->mFontData->getKerning(curChar, mTextData->getChar(j + 1));
 
 					if(curChar.page != page)
 						continue;
@@ -352,7 +331,7 @@ namespace bs
 
 	TextDataBase::TextDataBase(const WString& text, const HFont& font, UINT32 fontSize, UINT32 width, UINT32 height, bool wordWrap, bool wordBreak)
 		: mChars(nullptr), mNumChars(0), mWords(nullptr), mNumWords(0), mLines(nullptr), mNumLines(0), mPageInfos(nullptr)
-		, mNumPageInfos(0), mFont(font), mFontData(nullptr)
+		, mNumPageInfos(0), mFont(font.getWeak()), mFontData(nullptr)
 	{
 		// In order to reduce number of memory allocations algorithm first calculates data into temporary buffers and then copies the results
 		initAlloc();
@@ -361,6 +340,9 @@ namespace bs
 		{
 			UINT32 nearestSize = font->getClosestSize(fontSize);
 			mFontData = font->getBitmap(nearestSize);
+
+			if(mFontData != nullptr)
+				font->_prepareCharacters(nearestSize, text);
 		}
 
 		if(mFontData == nullptr || mFontData->texturePages.size() == 0)
@@ -372,7 +354,6 @@ namespace bs
 		}
 
 		bool widthIsLimited = width > 0;
-		mFont = font;
 
 		UINT32 curLineIdx = MemBuffer->allocLine(this);
 		UINT32 curHeight = mFontData->lineHeight;
@@ -428,7 +409,7 @@ namespace bs
 						UINT32 lastWordIdx = curLine->removeLastWord();
 						TextWord& lastWord = MemBuffer->WordBuffer[lastWordIdx];
 
-						bool wordFits = lastWord.calcWidthWithChar(charDesc) <= width;
+						bool wordFits = lastWord.calcWidthWithChar(charDesc, *mFontData) <= width;
 						if (wordFits && !curLine->isEmpty())
 						{
 							curLine->finalize(false);
@@ -37,9 +37,10 @@ namespace bs
 			 *
 			 * @param[in]	charIdx		Sequential index of the character in the original string.
 			 * @param[in]	desc		Character description from the font.
+			 * @param[in]	fontData	Font the character belongs to.
 			 * @return					How many pixels did the added character expand the word by.
 			 */
-			UINT32 addChar(UINT32 charIdx, const CharDesc& desc);
+			UINT32 addChar(UINT32 charIdx, const CharDesc& desc, const FontBitmap& fontData);
 
 			/** Adds a space to the word. Word must have previously have been declared as a "spacer". */
 			void addSpace(UINT32 spaceWidth);
@@ -53,10 +54,11 @@ namespace bs
 			/**
 			 * Calculates new width of the word if we were to add the provided character, without actually adding it.
 			 *
-			 * @param[in]	desc	Character description from the font.
-			 * @return				Width of the word in pixels with the character appended to it.
+			 * @param[in]	desc		Character description from the font.
+			 * @param[in]	fontData	Font the character belongs to.
+			 * @return					Width of the word in pixels with the character appended to it.
 			 */
-			UINT32 calcWidthWithChar(const CharDesc& desc);
+			UINT32 calcWidthWithChar(const CharDesc& desc, const FontBitmap& fontData);
 
 			/**
 			 * Returns true if word is a spacer. Spacers contain just a space of a certain length with no actual characters.
@@ -77,9 +79,10 @@ namespace bs
 			 *
 			 * @param[in]	prevDesc	Descriptor of the character preceding the one we need the width for. Can be null.
 			 * @param[in]	desc		Character description from the font.
+			 * @param[in]	fontData	Font the characters belong to.
 			 * @return 					How many pixels would the added character expand the word by.
 			 */
-			static UINT32 calcCharWidth(const CharDesc* prevDesc, const CharDesc& desc);
+			static UINT32 calcCharWidth(const CharDesc* prevDesc, const CharDesc& desc, const FontBitmap& fontData);
 
 		private:
 			UINT32 mCharsStart, mCharsEnd;
@@ -287,7 +290,7 @@ namespace bs
 		PageInfo* mPageInfos;
 		UINT32 mNumPageInfos;
 
-		HFont mFont;
+		WeakResourceHandle<Font> mFont; // Weak, so layouts cached by the FontManager don't keep the font loaded
 		SPtr<const FontBitmap> mFontData;
 
 		// Static buffers used to reduce runtime memory allocation
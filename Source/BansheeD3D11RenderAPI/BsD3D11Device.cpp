@@ -6,13 +6,14 @@
 namespace bs { namespace ct
 {
 	D3D11Device::D3D11Device() 
-		:mD3D11Device(nullptr), mImmediateContext(nullptr), mClassLinkage(nullptr)
+		:mD3D11Device(nullptr), mImmediateContext(nullptr), mImmediateContext1(nullptr), mClassLinkage(nullptr)
 	{
 	}
 
 	D3D11Device::D3D11Device(ID3D11Device* device)
 		: mD3D11Device(device)
 		, mImmediateContext(nullptr)
+		, mImmediateContext1(nullptr)
 		, mInfoQueue(nullptr)
 		, mClassLinkage(nullptr)
 	{
@@ -22,6 +23,20 @@ namespace bs { namespace ct
 		{
 			device->GetImmediateContext(&mImmediateContext);
 
+			// Binding ranges of constant buffers requires the DX11.1 runtime and driver support
+			D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+			ZeroMemory(&options, sizeof(options));
+
+			HRESULT optionsHr = mD3D11Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options));
+			if (SUCCEEDED(optionsHr) && options.ConstantBufferOffsetting)
+			{
+				if (FAILED(mImmediateContext->QueryInterface(__uuidof(ID3D11DeviceContext1), 
+					(LPVOID*)&mImmediateContext1)))
+				{
+					mImmediateContext1 = nullptr;
+				}
+			}
+
 #if BS_DEBUG_MODE
 			// This interface is not available unless we created the device with debug layer
 			HRESULT hr = mD3D11Device->QueryInterface(__uuidof(ID3D11InfoQueue), (LPVOID*)&mInfoQueue);
@@ -59,6 +74,7 @@ namespace bs { namespace ct
 
 		SAFE_RELEASE(mInfoQueue);
 		SAFE_RELEASE(mD3D11Device);
+		SAFE_RELEASE(mImmediateContext1);
 		SAFE_RELEASE(mImmediateContext);
 		SAFE_RELEASE(mClassLinkage);
 	}
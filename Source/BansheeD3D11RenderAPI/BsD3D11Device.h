@@ -34,6 +34,12 @@ namespace bs { namespace ct
 		/**	Returns DX11 immediate context object. */
 		ID3D11DeviceContext* getImmediateContext() const { return mImmediateContext; }
 
+		/** 
+		 * Returns the DX11.1 interface of the immediate context, if the runtime supports it and the driver supports
+		 * binding constant buffer ranges. Null otherwise.
+		 */
+		ID3D11DeviceContext1* getImmediateContext1() const { return mImmediateContext1; }
+
 		/**	Returns DX11 class linkage object. */
 		ID3D11ClassLinkage* getClassLinkage() const { return mClassLinkage; }
 
@@ -63,6 +69,7 @@ namespace bs { namespace ct
 
 		ID3D11Device* mD3D11Device;
 		ID3D11DeviceContext* mImmediateContext;
+		ID3D11DeviceContext1* mImmediateContext1;
 		ID3D11InfoQueue* mInfoQueue; 
 		ID3D11ClassLinkage* mClassLinkage;
 	};
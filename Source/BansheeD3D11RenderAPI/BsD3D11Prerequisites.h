@@ -16,6 +16,7 @@
 #endif
 
 #include <d3d11.h>
+#include <d3d11_1.h>
 #include <d3d11shader.h>
 #include <D3Dcompiler.h>
 
@@ -174,6 +174,7 @@ namespace bs { namespace ct
 		mActiveVertexShader = nullptr;
 		mActiveRenderTarget = nullptr;
 		mActiveDepthStencilState = nullptr;
+		mStateCache.reset();
 
 		RenderStateManager::shutDown();
 		RenderWindowManager::shutDown();
@@ -206,6 +207,9 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setGraphicsPipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<GraphicsPipelineState>& pipelineState)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -303,6 +307,9 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setComputePipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<ComputePipelineState>& pipelineState)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -335,6 +342,9 @@ namespace bs { namespace ct
 
 	void D3D11RenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setGpuParams(gpuParams))
+			return;
+
 		auto executeRef = [&](const SPtr<GpuParams>& gpuParams)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -370,14 +380,20 @@ namespace bs { namespace ct
 				FrameVector<ID3D11ShaderResourceView*> srvs(8);
 				FrameVector<ID3D11UnorderedAccessView*> uavs(8);
 				FrameVector<ID3D11Buffer*> constBuffers(8);
+				FrameVector<UINT32> constBufferFirst(8);
+				FrameVector<UINT32> constBufferCount(8);
 				FrameVector<ID3D11SamplerState*> samplers(8);
+				bool hasConstBufferViews = false;
 
 				auto populateViews = [&](GpuProgramType type)
 				{
 					srvs.clear();
 					uavs.clear();
 					constBuffers.clear();
+					constBufferFirst.clear();
+					constBufferCount.clear();
 					samplers.clear();
+					hasConstBufferViews = false;
 
 					SPtr<GpuParamDesc> paramDesc = gpuParams->getParamDesc(type);
 					if (paramDesc == nullptr)
@@ -481,19 +497,42 @@ namespace bs { namespace ct
 						SPtr<GpuParamBlockBuffer> buffer = gpuParams->getParamBlockBuffer(iter->second.set, slot);
 
 						while (slot >= (UINT32)constBuffers.size())
+						{
 							constBuffers.push_back(nullptr);
+							constBufferFirst.push_back(0);
+							constBufferCount.push_back(0);
+						}
 
 						if (buffer != nullptr)
 						{
 							buffer->flushToGPU();
 
-							const D3D11GpuParamBlockBuffer* d3d11paramBlockBuffer =
-								static_cast<const D3D11GpuParamBlockBuffer*>(buffer.get());
-							constBuffers[slot] = d3d11paramBlockBuffer->getD3D11Buffer();
+							// Ranges are specified in 16 byte constants, and their size must be a multiple of 16 constants
+							constBufferCount[slot] = Math::divideAndRoundUp(buffer->getSize(), 256U) * 16;
+
+							// Views bind a range of their parent's buffer
+							const SPtr<GpuParamBlockBuffer>& parent = buffer->getParent();
+							if (parent != nullptr)
+							{
+								const D3D11GpuParamBlockBuffer* d3d11paramBlockBuffer =
+									static_cast<const D3D11GpuParamBlockBuffer*>(parent.get());
+								constBuffers[slot] = d3d11paramBlockBuffer->getD3D11Buffer();
+								constBufferFirst[slot] = buffer->getOffset() / 16;
+
+								hasConstBufferViews = true;
+							}
+							else
+							{
+								const D3D11GpuParamBlockBuffer* d3d11paramBlockBuffer =
+									static_cast<const D3D11GpuParamBlockBuffer*>(buffer.get());
+								constBuffers[slot] = d3d11paramBlockBuffer->getD3D11Buffer();
+							}
 						}
 					}
 				};
 
+				ID3D11DeviceContext1* context1 = mDevice->getImmediateContext1();
+
 				UINT32 numSRVs = 0;
 				UINT32 numUAVs = 0;
 				UINT32 numConstBuffers = 0;
@@ -508,7 +547,15 @@ namespace bs { namespace ct
 					context->VSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
-					context->VSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				{
+					if (hasConstBufferViews)
+					{
+						context1->VSSetConstantBuffers1(0, numConstBuffers, constBuffers.data(), 
+							constBufferFirst.data(), constBufferCount.data());
+					}
+					else
+						context->VSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				}
 
 				if (numSamplers > 0)
 					context->VSSetSamplers(0, numSamplers, samplers.data());
@@ -530,7 +577,15 @@ namespace bs { namespace ct
 				}
 
 				if (numConstBuffers > 0)
-					context->PSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				{
+					if (hasConstBufferViews)
+					{
+						context1->PSSetConstantBuffers1(0, numConstBuffers, constBuffers.data(), 
+							constBufferFirst.data(), constBufferCount.data());
+					}
+					else
+						context->PSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				}
 
 				if (numSamplers > 0)
 					context->PSSetSamplers(0, numSamplers, samplers.data());
@@ -544,7 +599,15 @@ namespace bs { namespace ct
 					context->GSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
-					context->GSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				{
+					if (hasConstBufferViews)
+					{
+						context1->GSSetConstantBuffers1(0, numConstBuffers, constBuffers.data(), 
+							constBufferFirst.data(), constBufferCount.data());
+					}
+					else
+						context->GSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				}
 
 				if (numSamplers > 0)
 					context->GSSetSamplers(0, numSamplers, samplers.data());
@@ -558,7 +621,15 @@ namespace bs { namespace ct
 					context->HSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
-					context->HSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				{
+					if (hasConstBufferViews)
+					{
+						context1->HSSetConstantBuffers1(0, numConstBuffers, constBuffers.data(), 
+							constBufferFirst.data(), constBufferCount.data());
+					}
+					else
+						context->HSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				}
 
 				if (numSamplers > 0)
 					context->HSSetSamplers(0, numSamplers, samplers.data());
@@ -572,7 +643,15 @@ namespace bs { namespace ct
 					context->DSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
-					context->DSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				{
+					if (hasConstBufferViews)
+					{
+						context1->DSSetConstantBuffers1(0, numConstBuffers, constBuffers.data(), 
+							constBufferFirst.data(), constBufferCount.data());
+					}
+					else
+						context->DSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				}
 
 				if (numSamplers > 0)
 					context->DSSetSamplers(0, numSamplers, samplers.data());
@@ -593,7 +672,15 @@ namespace bs { namespace ct
 				}
 
 				if (numConstBuffers > 0)
-					context->CSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				{
+					if (hasConstBufferViews)
+					{
+						context1->CSSetConstantBuffers1(0, numConstBuffers, constBuffers.data(), 
+							constBufferFirst.data(), constBufferCount.data());
+					}
+					else
+						context->CSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
+				}
 
 				if (numSamplers > 0)
 					context->CSSetSamplers(0, numSamplers, samplers.data());
@@ -642,6 +729,9 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers, 
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		auto executeRef = [&](UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -675,7 +765,9 @@ namespace bs { namespace ct
 			executeRef(index, buffers, numBuffers);
 		else
 		{
-			auto execute = [=]() { executeRef(index, buffers, numBuffers); };
+			// Buffer array is owned by the caller, so keep a copy around until the command executes
+			Vector<SPtr<VertexBuffer>> bufferCopy(buffers, buffers + numBuffers);
+			auto execute = [=]() mutable { executeRef(index, bufferCopy.data(), numBuffers); };
 
 			SPtr<D3D11CommandBuffer> cb = std::static_pointer_cast<D3D11CommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
@@ -686,6 +778,9 @@ namespace bs { namespace ct
 
 	void D3D11RenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setIndexBuffer(buffer))
+			return;
+
 		auto executeRef = [&](const SPtr<IndexBuffer>& buffer)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -719,6 +814,9 @@ namespace bs { namespace ct
 	void D3D11RenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration, 
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setVertexDeclaration(vertexDeclaration))
+			return;
+
 		auto executeRef = [&](const SPtr<VertexDeclaration>& vertexDeclaration)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -739,6 +837,9 @@ namespace bs { namespace ct
 
 	void D3D11RenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setDrawOperation(op))
+			return;
+
 		auto executeRef = [&](DrawOperationType op)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1078,6 +1179,9 @@ namespace bs { namespace ct
 			applyViewport();
 		};
 
+		// Binding a render target unbinds any shader resource views referencing the same surfaces
+		getStateCache(commandBuffer).invalidateGpuParams();
+
 		if (commandBuffer == nullptr)
 			executeRef(target, readOnlyFlags);
 		else
@@ -1105,6 +1209,9 @@ namespace bs { namespace ct
 		SPtr<D3D11CommandBuffer> secondaryCb = std::static_pointer_cast<D3D11CommandBuffer>(secondary);
 
 		cb->appendSecondary(secondaryCb);
+
+		// State bound by the secondary buffer is unknown to the primary buffer
+		cb->_getStateCache().reset();
 	}
 
 	void D3D11RenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
@@ -1115,6 +1222,10 @@ namespace bs { namespace ct
 
 		cb->executeCommands();
 		cb->clear();
+
+		// Executed commands could have changed the immediate state, and the command buffer will start fresh
+		cb->_getStateCache().reset();
+		mStateCache.reset();
 	}
 
 	void D3D11RenderAPI::applyViewport()
@@ -1361,6 +1472,10 @@ namespace bs { namespace ct
 			RenderAPIFeatureFlag::Compute | 
 			RenderAPIFeatureFlag::LoadStore;
 
+		// Views are bound through the DX11.1 constant buffer range bindings
+		if (mDevice != nullptr && mDevice->getImmediateContext1() != nullptr)
+			featureFlags |= RenderAPIFeatureFlag::ParamBlockViews;
+
 		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
 
 		return info;
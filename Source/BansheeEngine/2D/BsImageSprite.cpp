@@ -70,6 +70,19 @@ namespace bs
 			texPage++;
 		}
 
+		mDesc = desc;
+		queueTessellation();
+	}
+
+	void ImageSprite::tessellate(FrameAlloc& scratch) const
+	{
+		const IMAGE_SPRITE_DESC& desc = mDesc;
+		SpriteRenderElement& renderElem = mCachedRenderElements[0];
+
+		bool useScale9Grid = desc.borderLeft > 0 || desc.borderRight > 0 || 
+			desc.borderTop > 0 || desc.borderBottom > 0;
+
+		UINT32 numQuads = renderElem.numQuads;
 		for(UINT32 i = 0; i < numQuads; i++)
 		{
 			renderElem.indexes[i * 6 + 0] = i * 4 + 0;
@@ -237,12 +250,12 @@ namespace bs
 			renderElem.uvs[2] = desc.texture->transformUV(Vector2(uvOffset.x, uvOffset.y + uvScale.y));
 			renderElem.uvs[3] = desc.texture->transformUV(Vector2(uvOffset.x + uvScale.x, uvOffset.y + uvScale.y));
 		}
-
-		updateBounds();
 	}
 
 	void ImageSprite::clearMesh()
 	{
+		cancelTessellation();
+
 		for (auto& renderElem : mCachedRenderElements)
 		{
 			UINT32 vertexCount = renderElem.numQuads * 4;
@@ -62,9 +62,15 @@ namespace bs
 		 */
 		static Vector2 getTextureUVScale(Vector2I sourceSize, Vector2I destSize, TextureScaleMode scaleMode);
 
+	protected:
+		/** @copydoc Sprite::tessellate */
+		void tessellate(FrameAlloc& scratch) const override;
+
 	private:
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
+
+		IMAGE_SPRITE_DESC mDesc; // Description used for generating the current geometry
 	};
 
 	/** @} */
@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "2D/BsTextSprite.h"
+#include "2D/BsSpriteManager.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
 #include "Mesh/BsMeshUtility.h"
@@ -11,10 +12,14 @@ namespace bs
 	{ }
 
 	Sprite::~Sprite()
-	{ }
+	{
+		cancelTessellation();
+	}
 
 	Rect2I Sprite::getBounds(const Vector2I& offset, const Rect2I& clipRect) const 
 	{
+		resolveTessellation();
+
 		Rect2I bounds = mBounds;
 
 		if(clipRect.width > 0 && clipRect.height > 0)
@@ -50,6 +55,8 @@ namespace bs
 		UINT32 maxNumVerts, UINT32 maxNumIndices, UINT32 vertexStride, UINT32 indexStride, UINT32 renderElementIdx, 
 		const Vector2I& offset, const Rect2I& clipRect, bool clip) const
 	{
+		resolveTessellation();
+
 		const auto& renderElem = mCachedRenderElements.at(renderElementIdx);
 
 		UINT32 startVert = vertexOffset;
@@ -202,6 +209,23 @@ namespace bs
 		return Vector2I();
 	}
 
+	void Sprite::queueTessellation()
+	{
+		SpriteManager::instance().queueTessellation(this);
+	}
+
+	void Sprite::cancelTessellation()
+	{
+		if (mBatchIdx != (UINT32)-1)
+			SpriteManager::instance().cancelTessellation(this);
+	}
+
+	void Sprite::resolveTessellation() const
+	{
+		if (mBatchIdx != (UINT32)-1)
+			SpriteManager::instance().resolveTessellation(this);
+	}
+
 	void Sprite::updateBounds() const
 	{
 		Vector2 min;
@@ -154,14 +154,38 @@ namespace bs
 		static void clipTrianglesToRect(UINT8* vertices, UINT8* uv, UINT32 numTris, UINT32 vertStride, 
 			const Rect2I& clipRect, const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback);
 	protected:
+		friend class SpriteManager;
+
 		/**	Returns the offset needed to move the sprite in order for it to respect the provided anchor. */
 		static Vector2I getAnchorOffset(SpriteAnchor anchor, UINT32 width, UINT32 height);
 
 		/**	Calculates the bounds of all sprite vertices. */
 		void updateBounds() const;
 
+		/**
+		 * Generates the geometry of all render elements, into the buffers allocated during the last update. Must only
+		 * read data stored by the sprite itself, as it may be called from a worker thread.
+		 *
+		 * @param[in]	scratch		Allocator to use for any temporary allocations. All allocations must be freed before
+		 *							the method returns.
+		 */
+		virtual void tessellate(FrameAlloc& scratch) const = 0;
+
+		/** 
+		 * Generates the sprite geometry by calling tessellate(), or queues it to be generated later if a sprite batch is
+		 * active. Should be called by implementations once they allocate the geometry buffers during an update.
+		 */
+		void queueTessellation();
+
+		/** Removes the sprite from the active sprite batch, if it was queued. Must be called before freeing the buffers. */
+		void cancelTessellation();
+
+		/** Generates the sprite geometry immediately if it is still waiting in the active sprite batch. */
+		void resolveTessellation() const;
+
 		mutable Rect2I mBounds;
 		mutable Vector<SpriteRenderElement> mCachedRenderElements;
+		mutable UINT32 mBatchIdx = (UINT32)-1;
 	};
 
 	/** @} */
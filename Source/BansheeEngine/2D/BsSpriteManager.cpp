@@ -2,6 +2,8 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "2D/BsSpriteManager.h"
 #include "2D/BsSpriteMaterials.h"
+#include "2D/BsSprite.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -22,6 +24,9 @@ namespace bs
 	{
 		for(auto& entry : mMaterials)
 			bs_delete(entry.second);
+
+		for(auto& entry : mScratchAllocs)
+			bs_delete(entry);
 	}
 
 	SpriteMaterial* SpriteManager::getMaterial(UINT32 id) const
@@ -32,4 +37,132 @@ namespace bs
 
 		return nullptr;
 	}
-}
\ No newline at end of file
+
+	void SpriteManager::_beginBatch()
+	{
+		assert(!mIsBatchActive);
+		mIsBatchActive = true;
+	}
+
+	void SpriteManager::_endBatch()
+	{
+		assert(mIsBatchActive);
+		mIsBatchActive = false;
+
+		// Remove entries left behind by sprites that were resolved or destroyed while the batch was active
+		UINT32 numSprites = 0;
+		for (auto& entry : mBatch)
+		{
+			if (entry != nullptr)
+				mBatch[numSprites++] = entry;
+		}
+
+		mBatch.resize(numSprites);
+		if (numSprites == 0)
+			return;
+
+		UINT32 maxTasks = TaskScheduler::instance().getNumWorkers() + 1;
+		UINT32 numTasks = std::min(maxTasks, Math::divideAndRoundUp(numSprites, MIN_SPRITES_PER_TASK));
+		numTasks = std::max(numTasks, 1U);
+
+		// Make sure all allocators exist before starting the tasks, as they're created on demand
+		for (UINT32 i = 0; i < numTasks; i++)
+			getScratchAlloc(i);
+
+		UINT32 numPerTask = Math::divideAndRoundUp(numSprites, numTasks);
+		auto tessellateRange = [this](UINT32 start, UINT32 end, UINT32 allocIdx)
+		{
+			FrameAlloc& scratch = *mScratchAllocs[allocIdx];
+			scratch.setOwnerThread(BS_THREAD_CURRENT_ID);
+			scratch.markFrame();
+
+			for (UINT32 i = start; i < end; i++)
+				tessellate(mBatch[i], scratch);
+
+			scratch.clear();
+		};
+
+		Vector<SPtr<Task>> tasks;
+		tasks.reserve(numTasks - 1);
+
+		// First range gets executed on this thread
+		for (UINT32 i = 1; i < numTasks; i++)
+		{
+			UINT32 start = i * numPerTask;
+			UINT32 end = std::min(start + numPerTask, numSprites);
+
+			SPtr<Task> task = Task::create("SpriteTessellation", std::bind(tessellateRange, start, end, i));
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		tessellateRange(0, std::min(numPerTask, numSprites), 0);
+
+		for (auto& entry : tasks)
+			entry->wait();
+
+		mBatch.clear();
+	}
+
+	void SpriteManager::queueTessellation(const Sprite* sprite)
+	{
+		if (!mIsBatchActive)
+		{
+			tessellateImmediate(sprite);
+			return;
+		}
+
+		// Already queued, the geometry will be generated from the latest data when the batch ends
+		if (sprite->mBatchIdx != (UINT32)-1)
+			return;
+
+		sprite->mBatchIdx = (UINT32)mBatch.size();
+		mBatch.push_back(sprite);
+	}
+
+	void SpriteManager::cancelTessellation(const Sprite* sprite)
+	{
+		if (sprite->mBatchIdx == (UINT32)-1)
+			return;
+
+		mBatch[sprite->mBatchIdx] = nullptr;
+		sprite->mBatchIdx = (UINT32)-1;
+	}
+
+	void SpriteManager::resolveTessellation(const Sprite* sprite)
+	{
+		if (sprite->mBatchIdx == (UINT32)-1)
+			return;
+
+		mBatch[sprite->mBatchIdx] = nullptr;
+		tessellateImmediate(sprite);
+	}
+
+	void SpriteManager::tessellateImmediate(const Sprite* sprite)
+	{
+		// The first allocator is only ever used on this thread, worker threads use the rest
+		FrameAlloc& scratch = getScratchAlloc(0);
+		scratch.markFrame();
+
+		tessellate(sprite, scratch);
+
+		scratch.clear();
+	}
+
+	void SpriteManager::tessellate(const Sprite* sprite, FrameAlloc& scratch)
+	{
+		sprite->mBatchIdx = (UINT32)-1;
+
+		sprite->tessellate(scratch);
+		sprite->updateBounds();
+	}
+
+	FrameAlloc& SpriteManager::getScratchAlloc(UINT32 idx)
+	{
+		while (idx >= (UINT32)mScratchAllocs.size())
+			mScratchAllocs.push_back(bs_new<FrameAlloc>(SCRATCH_ALLOC_BLOCK_SIZE));
+
+		return *mScratchAllocs[idx];
+	}
+}
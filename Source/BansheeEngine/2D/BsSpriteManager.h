@@ -12,7 +12,11 @@ namespace bs
 	 *  @{
 	 */
 
-	/** Contains materials used for sprite rendering. */
+	/** 
+	 * Contains materials used for sprite rendering, and handles batched generation of sprite geometry.
+	 *
+	 * @note	Sim thread only.
+	 */
 	class BS_EXPORT SpriteManager : public Module<SpriteManager>
 	{
 		/** Types of sprite materials accessible by default. */
@@ -72,9 +76,50 @@ namespace bs
 			mMaterials[id] = newMaterial;
 			return newMaterial;
 		}
+
+		/** 
+		 * Starts a sprite batch. While the batch is active, updated sprites don't generate their geometry immediately, 
+		 * but instead queue it to be generated for all sprites at once when the batch ends. If the geometry of a queued
+		 * sprite is accessed before the batch ends, it is generated immediately.
+		 */
+		void _beginBatch();
+
+		/** 
+		 * Ends the sprite batch started with _beginBatch(), and generates geometry for all the sprites queued during it.
+		 * Large batches are split into chunks that are processed in parallel by the task scheduler.
+		 */
+		void _endBatch();
+
 	private:
+		friend class Sprite;
+
+		/** Generates the geometry for the sprite if no batch is active, or queues it to be generated when it ends. */
+		void queueTessellation(const Sprite* sprite);
+
+		/** Removes the sprite from the active batch, without generating its geometry. */
+		void cancelTessellation(const Sprite* sprite);
+
+		/** Generates the geometry for a sprite queued in the active batch, and removes it from the batch. */
+		void resolveTessellation(const Sprite* sprite);
+
+		/** Generates the geometry for the sprite on the calling thread. */
+		void tessellateImmediate(const Sprite* sprite);
+
+		/** Generates the geometry for the sprite, using the provided allocator for temporary allocations. */
+		static void tessellate(const Sprite* sprite, FrameAlloc& scratch);
+
+		/** Returns the scratch allocator with the specified index, creating it if it doesn't exist. */
+		FrameAlloc& getScratchAlloc(UINT32 idx);
+
+		static constexpr UINT32 MIN_SPRITES_PER_TASK = 64;
+		static constexpr UINT32 SCRATCH_ALLOC_BLOCK_SIZE = 64 * 1024;
+
 		UnorderedMap<UINT32, SpriteMaterial*> mMaterials;
 		UINT32 builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Count];
+
+		Vector<const Sprite*> mBatch;
+		Vector<FrameAlloc*> mScratchAllocs;
+		bool mIsBatchActive = false;
 	};
 
 	/** @} */
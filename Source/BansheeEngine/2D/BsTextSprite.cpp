@@ -4,10 +4,12 @@
 #include "Text/BsTextData.h"
 #include "Math/BsVector2.h"
 #include "2D/BsSpriteManager.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
 	TextSprite::TextSprite()
+		: mWidth(0), mHeight(0), mHorzAlign(THA_Left), mVertAlign(TVA_Top), mAnchor(SA_TopLeft)
 	{
 
 	}
@@ -19,62 +21,93 @@ namespace bs
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
-		bs_frame_mark();
-		{
-			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, desc.wordBreak);
+		SPtr<const TextData<>> textData = FontManager::instance().getTextData(desc.text, desc.font, desc.fontSize, 
+			desc.width, desc.height, desc.wordWrap, desc.wordBreak);
 
-			UINT32 numPages = textData.getNumPages();
+		// If the layout and its placement didn't change we can keep the existing quads, and only update the materials
+		bool quadsValid = textData == mTextData && mCachedRenderElements.size() == textData->getNumPages() && 
+			desc.width == mWidth && desc.height == mHeight && desc.horzAlign == mHorzAlign && desc.vertAlign == mVertAlign &&
+			desc.anchor == mAnchor;
 
-			// Free all previous memory
+		if (quadsValid)
+		{
 			for (auto& cachedElem : mCachedRenderElements)
 			{
-				if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
-				if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
-				if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
+				cachedElem.matInfo.groupId = groupId;
+				cachedElem.matInfo.tint = desc.color;
 			}
 
-			mAlloc.clear();
+			return;
+		}
 
-			// Resize cached mesh array to needed size
-			if (mCachedRenderElements.size() != numPages)
-				mCachedRenderElements.resize(numPages);
+		mTextData = textData;
+		mWidth = desc.width;
+		mHeight = desc.height;
+		mHorzAlign = desc.horzAlign;
+		mVertAlign = desc.vertAlign;
+		mAnchor = desc.anchor;
 
-			// Actually generate a mesh
-			UINT32 texPage = 0;
-			for (auto& cachedElem : mCachedRenderElements)
-			{
-				UINT32 newNumQuads = textData.getNumQuadsForPage(texPage);
+		UINT32 numPages = textData->getNumPages();
+
+		// Free all previous memory
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
+			if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
+			if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
+		}
+
+		mAlloc.clear();
 
-				cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
-				cachedElem.numQuads = newNumQuads;
+		// Resize cached mesh array to needed size
+		if (mCachedRenderElements.size() != numPages)
+			mCachedRenderElements.resize(numPages);
 
-				const HTexture& tex = textData.getTextureForPage(texPage);
+		// Actually generate a mesh
+		UINT32 texPage = 0;
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			UINT32 newNumQuads = textData->getNumQuadsForPage(texPage);
 
-				SpriteMaterialInfo& matInfo = cachedElem.matInfo;
-				matInfo.groupId = groupId;
-				matInfo.texture = tex;
-				matInfo.tint = desc.color;
+			cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
+			cachedElem.numQuads = newNumQuads;
 
-				cachedElem.material = SpriteManager::instance().getTextMaterial();
+			const HTexture& tex = textData->getTextureForPage(texPage);
 
-				texPage++;
-			}
+			SpriteMaterialInfo& matInfo = cachedElem.matInfo;
+			matInfo.groupId = groupId;
+			matInfo.texture = tex;
+			matInfo.tint = desc.color;
 
-			// Calc alignment and anchor offsets and set final line positions
-			for (UINT32 j = 0; j < numPages; j++)
-			{
-				SpriteRenderElement& renderElem = mCachedRenderElements[j];
+			cachedElem.material = SpriteManager::instance().getTextMaterial();
 
-				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
-					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
-			}
+			texPage++;
 		}
 
-		bs_frame_clear();
+		queueTessellation();
+	}
 
-		updateBounds();
+	void TextSprite::tessellate(FrameAlloc& scratch) const
+	{
+		// Calc alignment and anchor offsets and set final line positions
+		UINT32 numLines = mTextData->getNumLines();
+
+		Vector2I* alignmentOffsets = (Vector2I*)scratch.alloc(sizeof(Vector2I) * numLines);
+		getAlignmentOffsets(*mTextData, mWidth, mHeight, mHorzAlign, mVertAlign, alignmentOffsets);
+		Vector2I offset = getAnchorOffset(mAnchor, mWidth, mHeight);
+
+		UINT32 numPages = (UINT32)mCachedRenderElements.size();
+		for (UINT32 j = 0; j < numPages; j++)
+		{
+			SpriteRenderElement& renderElem = mCachedRenderElements[j];
+
+			genPageQuads(j, *mTextData, alignmentOffsets, offset, renderElem.vertices, renderElem.uvs, 
+				renderElem.indexes, renderElem.numQuads);
+		}
+
+		scratch.free((UINT8*)alignmentOffsets);
 	}
 
 	UINT32 TextSprite::genTextQuads(UINT32 page, const TextDataBase& textData, UINT32 width, UINT32 height,
@@ -87,6 +120,17 @@ namespace bs
 		getAlignmentOffsets(textData, width, height, horzAlign, vertAlign, alignmentOffsets);
 		Vector2I offset = getAnchorOffset(anchor, width, height);
 
+		genPageQuads(page, textData, alignmentOffsets, offset, vertices, uv, indices, bufferSizeQuads);
+
+		bs_stack_delete(alignmentOffsets, numLines);
+		return newNumQuads;
+	}
+
+	void TextSprite::genPageQuads(UINT32 page, const TextDataBase& textData, const Vector2I* alignmentOffsets,
+		const Vector2I& offset, Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads)
+	{
+		UINT32 numLines = textData.getNumLines();
+
 		UINT32 quadOffset = 0;
 		for(UINT32 i = 0; i < numLines; i++)
 		{
@@ -103,9 +147,6 @@ namespace bs
 
 			quadOffset += writtenQuads;
 		}
-
-		bs_stack_delete(alignmentOffsets, numLines);
-		return newNumQuads;
 	}
 
 
@@ -199,6 +240,8 @@ namespace bs
 
 	void TextSprite::clearMesh()
 	{
+		cancelTessellation();
+
 		for (auto& renderElem : mCachedRenderElements)
 		{
 			if (renderElem.vertices != nullptr)
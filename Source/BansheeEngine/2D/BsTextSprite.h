@@ -126,14 +126,36 @@ namespace bs
 			TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, Vector2* vertices, Vector2* uv, UINT32* indices, 
 			UINT32 bufferSizeQuads);
 
+	protected:
+		/** @copydoc Sprite::tessellate */
+		void tessellate(FrameAlloc& scratch) const override;
+
 	private:
 		static const int STATIC_CHARS_TO_BUFFER = 25;
 		static const int STATIC_BUFFER_SIZE = STATIC_CHARS_TO_BUFFER * (4 * (2 * sizeof(Vector2)) + (6 * sizeof(UINT32)));
 
+		/** 
+		 * Generates quads for the specified page, using previously calculated alignment offsets for each line and anchor
+		 * offset. 
+		 *
+		 * @see	genTextQuads(UINT32, const TextDataBase&, UINT32, UINT32, TextHorzAlign, TextVertAlign, SpriteAnchor, 
+		 *		Vector2*, Vector2*, UINT32*, UINT32)
+		 */
+		static void genPageQuads(UINT32 page, const TextDataBase& textData, const Vector2I* alignmentOffsets,
+			const Vector2I& offset, Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads);
+
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
 
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
+
+		// Parameters used for generating the current quads
+		SPtr<const TextData<>> mTextData;
+		UINT32 mWidth;
+		UINT32 mHeight;
+		TextHorzAlign mHorzAlign;
+		TextVertAlign mVertAlign;
+		SpriteAnchor mAnchor;
 	};
 
 	/** @} */
@@ -195,6 +195,7 @@ namespace bs
 	class RendererMeshData;
 
 	// 2D
+	class Sprite;
 	class TextSprite;
 	class ImageSprite;
 	class SpriteTexture;
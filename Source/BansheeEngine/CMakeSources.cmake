@@ -47,6 +47,7 @@ set(BS_BANSHEEENGINE_SRC_GUI
 	"GUI/BsGUIListBox.cpp"
 	"GUI/BsGUIMenu.cpp"
 	"GUI/BsGUIHelper.cpp"
+	"GUI/BsGUIHitTestGrid.cpp"
 	"GUI/BsGUIDropDownBoxManager.cpp"
 	"GUI/BsGUIContextMenu.cpp"
 	"GUI/BsGUIButtonBase.cpp"
@@ -223,6 +224,7 @@ set(BS_BANSHEEENGINE_INC_GUI
 	"GUI/BsGUIMenu.h"
 	"GUI/BsGUIContextMenu.h"
 	"GUI/BsGUIHelper.h"
+	"GUI/BsGUIHitTestGrid.h"
 	"GUI/BsGUIDropDownBoxManager.h"
 	"GUI/BsGUIButtonBase.h"
 	"GUI/BsGUITextInputEvent.h"
@@ -37,14 +37,14 @@ namespace bs
 		mBounds.clear();
 		mBounds.push_back(bounds);
 
-		updateClippedBounds();
+		refreshClippedBounds();
 	}
 
 	void GUIDropDownHitBox::setBounds(const Vector<Rect2I>& bounds)
 	{
 		mBounds = bounds;
 
-		updateClippedBounds();
+		refreshClippedBounds();
 	}
 
 	void GUIDropDownHitBox::updateClippedBounds()
@@ -258,6 +258,9 @@ namespace bs
 		 */
 		virtual void updateClippedBounds();
 
+		/** Recalculates element clipped bounds and notifies the parent widget that they might have changed. */
+		void refreshClippedBounds();
+
 		/**
 		 * Helper method that returns style name used by an element of a certain type. If override style is empty, default
 		 * style for that type is returned.
@@ -12,14 +12,14 @@ namespace bs
 {
 	GUIElementBase::GUIElementBase()
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty)
+		, mFlags(GUIElem_Dirty | GUIElem_SizeRangeDirty), mIsCachedSizeRangeValid(false)
 	{
 
 	}
 
 	GUIElementBase::GUIElementBase(const GUIDimensions& dimensions)
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty), mDimensions(dimensions)
+		, mFlags(GUIElem_Dirty | GUIElem_SizeRangeDirty), mIsCachedSizeRangeValid(false), mDimensions(dimensions)
 	{
 
 	}
@@ -208,6 +208,9 @@ namespace bs
 
 	void GUIElementBase::_markLayoutAsDirty() 
 	{ 
+		// Size ranges are tracked even for hidden elements, as layouts account for them as long as they are active
+		_markSizeRangeAsDirty();
+
 		if(!_isVisible())
 			return;
 
@@ -217,6 +220,19 @@ namespace bs
 			mFlags |= GUIElem_Dirty;
 	}
 
+	void GUIElementBase::_markSizeRangeAsDirty()
+	{
+		// Note: Can't stop at the first dirty parent, as clean parents of inactive dirty elements are valid
+		GUIElementBase* currentElement = this;
+		while (currentElement != nullptr)
+		{
+			currentElement->mFlags |= GUIElem_SizeRangeDirty;
+			currentElement->mIsCachedSizeRangeValid = false;
+
+			currentElement = currentElement->mParentElement;
+		}
+	}
+
 	void GUIElementBase::_markContentAsDirty()
 	{
 		if (!_isVisible())
@@ -406,10 +422,19 @@ namespace bs
 
 	void GUIElementBase::_updateOptimalLayoutSizes()
 	{
+		if (!_isSizeRangeDirty())
+			return;
+
 		for(auto& child : mChildren)
 		{
 			child->_updateOptimalLayoutSizes();
 		}
+
+		// Our size range might have been cached before the children were updated
+		if (!mChildren.empty())
+			mIsCachedSizeRangeValid = false;
+
+		mFlags &= ~GUIElem_SizeRangeDirty;
 	}
 
 	void GUIElementBase::_updateLayoutInternal(const GUILayoutData& data)
@@ -428,7 +453,13 @@ namespace bs
 
 	LayoutSizeRange GUIElementBase::_getLayoutSizeRange() const
 	{
-		return _calculateLayoutSizeRange();
+		if (!mIsCachedSizeRangeValid)
+		{
+			mCachedSizeRange = _calculateLayoutSizeRange();
+			mIsCachedSizeRangeValid = true;
+		}
+
+		return mCachedSizeRange;
 	}
 
 	void GUIElementBase::_getElementAreas(const Rect2I& layoutArea, Rect2I* elementAreas, UINT32 numElements,
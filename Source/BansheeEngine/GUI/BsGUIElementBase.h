@@ -39,7 +39,8 @@ namespace bs
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_SizeRangeDirty = 0x80
 		};
 
 	public:
@@ -190,7 +191,8 @@ namespace bs
 
 		/**
 		 * Returns element size range constrained by its layout options. This is different from _calculateLayoutSizeRange()
-		 * because this method may return cached size range. 
+		 * because this method may return cached size range. The cached range is only recalculated after the element's
+		 * layout is marked as dirty.
 		 */
 		virtual LayoutSizeRange _getLayoutSizeRange() const;
 
@@ -285,6 +287,18 @@ namespace bs
 		/**	Returns true if elements contents have changed since last update. */
 		bool _isDirty() const { return (mFlags & GUIElem_Dirty) != 0; }
 
+		/**
+		 * Returns true if the size range of this element or any of its children might have changed since the last call
+		 * to _updateOptimalLayoutSizes().
+		 */
+		bool _isSizeRangeDirty() const { return (mFlags & GUIElem_SizeRangeDirty) != 0; }
+
+		/**
+		 * Marks the size range of this element and all of its parents as dirty, forcing them to be recalculated on the 
+		 * next layout update. Elements with clean size ranges (and their children) are skipped during layout updates.
+		 */
+		void _markSizeRangeAsDirty();
+
 		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
@@ -326,6 +340,9 @@ namespace bs
 		Vector<GUIElementBase*> mChildren;	
 		UINT8 mFlags;
 
+		mutable LayoutSizeRange mCachedSizeRange;
+		mutable bool mIsCachedSizeRangeValid;
+
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
 	};
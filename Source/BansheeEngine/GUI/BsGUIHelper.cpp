@@ -5,6 +5,7 @@
 #include "GUI/BsGUIElementStyle.h"
 #include "GUI/BsGUIDimensions.h"
 #include "Image/BsTexture.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -45,14 +46,11 @@ namespace bs
 
 		if(style.font != nullptr && !text.empty())
 		{
-			bs_frame_mark();
+			SPtr<const TextData<>> textData = FontManager::instance().getTextData(text, style.font, style.fontSize, 
+				wordWrapWidth, 0, style.wordWrap);
 
-			TextData<FrameAlloc> textData(text, style.font, style.fontSize, wordWrapWidth, 0, style.wordWrap);
-
-			contentWidth += textData.getWidth();
-			contentHeight += textData.getNumLines() * textData.getLineHeight(); 
-
-			bs_frame_clear();
+			contentWidth += textData->getWidth();
+			contentHeight += textData->getNumLines() * textData->getLineHeight(); 
 		}
 
 		return Vector2I(contentWidth, contentHeight);
@@ -63,14 +61,10 @@ namespace bs
 		Vector2I size;
 		if (font != nullptr)
 		{
-			bs_frame_mark();
-
-			TextData<FrameAlloc> textData(text, font, fontSize, 0, 0, false);
-
-			size.x = textData.getWidth();
-			size.y = textData.getNumLines() * textData.getLineHeight();
+			SPtr<const TextData<>> textData = FontManager::instance().getTextData(text, font, fontSize);
 
-			bs_frame_clear();
+			size.x = textData->getWidth();
+			size.y = textData->getNumLines() * textData->getLineHeight();
 		}
 
 		return size;
@@ -0,0 +1,178 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "GUI/BsGUIHitTestGrid.h"
+#include "GUI/BsGUIElement.h"
+
+namespace bs
+{
+	/** Divides the value with the divisor, rounding towards negative infinity. */
+	static INT32 floorDivide(INT32 value, INT32 divisor)
+	{
+		if (value >= 0)
+			return value / divisor;
+
+		return -((-value + divisor - 1) / divisor);
+	}
+
+	const UINT32 GUIHitTestGrid::MAX_CELLS_PER_ELEMENT = 256;
+
+	bool GUIHitTestGrid::CellRange::operator==(const CellRange& rhs) const
+	{
+		return minX == rhs.minX && minY == rhs.minY && maxX == rhs.maxX && maxY == rhs.maxY && isLarge == rhs.isLarge;
+	}
+
+	GUIHitTestGrid::GUIHitTestGrid(UINT32 cellSize)
+		:mCellSize(std::max(cellSize, 1U))
+	{ }
+
+	void GUIHitTestGrid::add(GUIElement* element)
+	{
+		mElements.insert(std::make_pair(element, CellRange()));
+		mDirtyElements.insert(element);
+	}
+
+	void GUIHitTestGrid::remove(GUIElement* element)
+	{
+		auto iterFind = mElements.find(element);
+		if (iterFind == mElements.end())
+			return;
+
+		erase(element, iterFind->second);
+
+		mElements.erase(iterFind);
+		mDirtyElements.erase(element);
+	}
+
+	void GUIHitTestGrid::markDirty(GUIElement* element)
+	{
+		if (mElements.find(element) == mElements.end())
+			return;
+
+		mDirtyElements.insert(element);
+	}
+
+	void GUIHitTestGrid::clear()
+	{
+		mCells.clear();
+		mElements.clear();
+		mDirtyElements.clear();
+		mLargeElements.clear();
+	}
+
+	void GUIHitTestGrid::find(const Vector2I& position, Vector<GUIElement*>& elements)
+	{
+		update();
+
+		for (auto& element : mLargeElements)
+		{
+			if (element->_getClippedBounds().contains(position))
+				elements.push_back(element);
+		}
+
+		INT32 cellX = floorDivide(position.x, (INT32)mCellSize);
+		INT32 cellY = floorDivide(position.y, (INT32)mCellSize);
+
+		auto iterFind = mCells.find(getCellKey(cellX, cellY));
+		if (iterFind == mCells.end())
+			return;
+
+		for (auto& element : iterFind->second)
+		{
+			if (element->_getClippedBounds().contains(position))
+				elements.push_back(element);
+		}
+	}
+
+	void GUIHitTestGrid::update()
+	{
+		for (auto& element : mDirtyElements)
+		{
+			CellRange& range = mElements[element];
+			CellRange newRange = getCellRange(element);
+
+			if (range == newRange)
+				continue;
+
+			erase(element, range);
+			insert(element, newRange);
+
+			range = newRange;
+		}
+
+		mDirtyElements.clear();
+	}
+
+	GUIHitTestGrid::CellRange GUIHitTestGrid::getCellRange(GUIElement* element) const
+	{
+		CellRange range;
+
+		const Rect2I& bounds = element->_getClippedBounds();
+		if (bounds.width == 0 || bounds.height == 0)
+			return range;
+
+		range.minX = floorDivide(bounds.x, (INT32)mCellSize);
+		range.minY = floorDivide(bounds.y, (INT32)mCellSize);
+		range.maxX = floorDivide(bounds.x + (INT32)bounds.width - 1, (INT32)mCellSize);
+		range.maxY = floorDivide(bounds.y + (INT32)bounds.height - 1, (INT32)mCellSize);
+
+		UINT64 numCells = (UINT64)(range.maxX - range.minX + 1) * (UINT64)(range.maxY - range.minY + 1);
+		range.isLarge = numCells > MAX_CELLS_PER_ELEMENT;
+
+		return range;
+	}
+
+	void GUIHitTestGrid::insert(GUIElement* element, const CellRange& range)
+	{
+		if (range.isEmpty())
+			return;
+
+		if (range.isLarge)
+		{
+			mLargeElements.push_back(element);
+			return;
+		}
+
+		for (INT32 y = range.minY; y <= range.maxY; y++)
+		{
+			for (INT32 x = range.minX; x <= range.maxX; x++)
+				mCells[getCellKey(x, y)].push_back(element);
+		}
+	}
+
+	void GUIHitTestGrid::erase(GUIElement* element, const CellRange& range)
+	{
+		if (range.isEmpty())
+			return;
+
+		if (range.isLarge)
+		{
+			auto iterFind = std::find(mLargeElements.begin(), mLargeElements.end(), element);
+			if (iterFind != mLargeElements.end())
+				mLargeElements.erase(iterFind);
+
+			return;
+		}
+
+		for (INT32 y = range.minY; y <= range.maxY; y++)
+		{
+			for (INT32 x = range.minX; x <= range.maxX; x++)
+			{
+				auto iterFindCell = mCells.find(getCellKey(x, y));
+				if (iterFindCell == mCells.end())
+					continue;
+
+				Vector<GUIElement*>& cellElements = iterFindCell->second;
+				auto iterFind = std::find(cellElements.begin(), cellElements.end(), element);
+				if (iterFind != cellElements.end())
+				{
+					// Order of elements within a cell doesn't matter, so avoid shifting the remaining elements
+					std::swap(*iterFind, cellElements.back());
+					cellElements.pop_back();
+				}
+
+				if (cellElements.empty())
+					mCells.erase(iterFindCell);
+			}
+		}
+	}
+}
@@ -0,0 +1,91 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Math/BsVector2I.h"
+
+namespace bs
+{
+	/** @addtogroup GUI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Spatial index of GUI element bounds, used for quickly finding elements under a specific point. Elements are sorted
+	 * into a uniform grid of cells, based on their clipped bounds. Elements are re-sorted lazily on the next query, after
+	 * their bounds were marked as dirty.
+	 */
+	class BS_EXPORT GUIHitTestGrid
+	{
+	public:
+		/**
+		 * Constructs a new grid.
+		 *
+		 * @param[in]	cellSize	Width and height of a single grid cell, in pixels.
+		 */
+		GUIHitTestGrid(UINT32 cellSize = 64);
+
+		/** Registers a new element with the grid. */
+		void add(GUIElement* element);
+
+		/** Unregisters an element from the grid. */
+		void remove(GUIElement* element);
+
+		/** Notifies the grid that the clipped bounds of the provided element changed. */
+		void markDirty(GUIElement* element);
+
+		/** Unregisters all elements from the grid. */
+		void clear();
+
+		/**
+		 * Finds all elements whose clipped bounds contain the provided point. Returned elements are not sorted in any
+		 * particular order, nor are they checked for visibility. The caller is expected to perform any more precise
+		 * checks (e.g. GUIElement::_isInBounds()) on the returned elements.
+		 *
+		 * @param[in]	position	Point to test, relative to the parent widget.
+		 * @param[out]	elements	List of elements to append the found elements to.
+		 */
+		void find(const Vector2I& position, Vector<GUIElement*>& elements);
+
+	private:
+		/** Range of cells overlapped by a single element. */
+		struct CellRange
+		{
+			INT32 minX = 0;
+			INT32 minY = 0;
+			INT32 maxX = -1;
+			INT32 maxY = -1;
+			bool isLarge = false;
+
+			bool isEmpty() const { return maxX < minX || maxY < minY; }
+			bool operator==(const CellRange& rhs) const;
+		};
+
+		/** Re-sorts all the elements that were marked as dirty into the cells they overlap. */
+		void update();
+
+		/** Calculates the range of cells that the provided element's clipped bounds overlap. */
+		CellRange getCellRange(GUIElement* element) const;
+
+		/** Inserts the element into all the cells in the provided range. */
+		void insert(GUIElement* element, const CellRange& range);
+
+		/** Removes the element from all the cells in the provided range. */
+		void erase(GUIElement* element, const CellRange& range);
+
+		/** Returns a key that uniquely identifies the cell at the provided coordinates. */
+		static UINT64 getCellKey(INT32 x, INT32 y) { return ((UINT64)(UINT32)x << 32) | (UINT64)(UINT32)y; }
+
+		/** Maximum number of cells an element may overlap, before it is stored outside of the grid. */
+		static const UINT32 MAX_CELLS_PER_ELEMENT;
+
+		UINT32 mCellSize;
+		UnorderedMap<UINT64, Vector<GUIElement*>> mCells;
+		UnorderedMap<GUIElement*, CellRange> mElements;
+		UnorderedSet<GUIElement*> mDirtyElements;
+		Vector<GUIElement*> mLargeElements;
+	};
+
+	/** @} */
+}
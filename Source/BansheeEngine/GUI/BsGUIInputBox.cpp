@@ -108,7 +108,7 @@ namespace bs
 		UINT32 numElements = mImageSprite->getNumRenderElements();
 		numElements += mTextSprite->getNumRenderElements();
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 			numElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
 
 		if(mSelectionShown)
@@ -137,7 +137,10 @@ namespace bs
 		UINT32 localRenderElementIdx;
 		Sprite* sprite = renderElemToSprite(renderElementIdx, localRenderElementIdx);
 
-		UINT32 numQuads = sprite->getNumQuads(localRenderElementIdx);
+		UINT32 numQuads = 0;
+		if(!isCaretHidden(sprite))
+			numQuads = sprite->getNumQuads(localRenderElementIdx);
+
 		numVertices = numQuads * 4;
 		numIndices = numQuads * 6;
 		type = GUIMeshType::Triangle;
@@ -164,7 +167,7 @@ namespace bs
 		TEXT_SPRITE_DESC textDesc = getTextDesc();
 		mTextSprite->update(textDesc, (UINT64)_getParentWidget());
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			gGUIManager().getInputCaretTool()->updateText(this, textDesc); // TODO - These shouldn't be here. Only call this when one of these parameters changes.
 			gGUIManager().getInputCaretTool()->updateSprite();
@@ -209,7 +212,7 @@ namespace bs
 			return mImageSprite;
 		}
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -241,6 +244,11 @@ namespace bs
 		return nullptr;
 	}
 
+	bool GUIInputBox::isCaretHidden(Sprite* sprite) const
+	{
+		return sprite == gGUIManager().getInputCaretTool()->getSprite() && !gGUIManager().getCaretBlinkState();
+	}
+
 	Vector2I GUIInputBox::renderElemToOffset(UINT32 renderElemIdx) const
 	{
 		UINT32 oldNumElements = 0;
@@ -254,7 +262,7 @@ namespace bs
 		if(renderElemIdx < newNumElements)
 			return Vector2I(mLayoutData.area.x, mLayoutData.area.y);;
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -295,7 +303,7 @@ namespace bs
 		if(renderElemIdx < newNumElements)
 			return mLayoutData.getLocalClipRect();
 
-		if(mCaretShown && gGUIManager().getCaretBlinkState())
+		if(mCaretShown)
 		{
 			oldNumElements = newNumElements;
 			newNumElements += gGUIManager().getInputCaretTool()->getSprite()->getNumRenderElements();
@@ -398,6 +406,9 @@ namespace bs
 
 		UINT32 localRenderElementIdx;
 		Sprite* sprite = renderElemToSprite(renderElementIdx, localRenderElementIdx);
+		if(isCaretHidden(sprite))
+			return;
+
 		Vector2I offset = renderElemToOffset(renderElementIdx);
 		Rect2I clipRect = renderElemToClipRect(renderElementIdx);
 
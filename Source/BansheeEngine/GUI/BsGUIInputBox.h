@@ -167,6 +167,12 @@ namespace bs
 		 */
 		Vector2I renderElemToOffset(UINT32 renderElemIdx) const;
 
+		/** 
+		 * Checks if the provided sprite is the input caret, and the caret is currently blinked out. Such caret keeps its
+		 * render element but outputs no geometry, so blinking doesn't change the layout of the element's render elements.
+		 */
+		bool isCaretHidden(Sprite* sprite) const;
+
 		/**
 		 * Returns a clip rectangle that can be used for clipping the render element with the provided index. Rectangle is
 		 * in local coordiantes relative to element origin.
@@ -65,7 +65,13 @@ namespace bs
 		 */
 
 		/** @copydoc GUIElementBase::_getLayoutSizeRange */
-		LayoutSizeRange _getLayoutSizeRange() const override { return _getCachedSizeRange(); }
+		LayoutSizeRange _getLayoutSizeRange() const override 
+		{ 
+			if (_isSizeRangeDirty())
+				return _calculateLayoutSizeRange();
+
+			return _getCachedSizeRange(); 
+		}
 
 		/** Returns a size range that was cached during the last GUIElementBase::_updateOptimalLayoutSizes call. */
 		LayoutSizeRange _getCachedSizeRange() const { return mSizeRange; }
@@ -8,7 +8,7 @@ namespace bs
 {
 	Vector2I GUILayoutUtility::calcOptimalSize(const GUIElementBase* elem)
 	{
-		return elem->_calculateLayoutSizeRange().optimal;
+		return elem->_getLayoutSizeRange().optimal;
 	}
 
 	Vector2I GUILayoutUtility::calcActualSize(UINT32 width, UINT32 height, GUILayout* layout, bool updateOptimalSizes)
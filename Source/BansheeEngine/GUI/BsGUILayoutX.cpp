@@ -15,6 +15,9 @@ namespace bs
 
 	LayoutSizeRange GUILayoutX::_calculateLayoutSizeRange() const
 	{
+		if (!_isSizeRangeDirty())
+			return mSizeRange;
+
 		Vector2I optimalSize;
 		Vector2I minSize;
 		for (auto& child : mChildren)
@@ -22,7 +25,7 @@ namespace bs
 			if (!child->_isActive())
 				continue;
 
-			LayoutSizeRange sizeRange = child->_calculateLayoutSizeRange();
+			LayoutSizeRange sizeRange = child->_getLayoutSizeRange();
 
 			if (child->_getType() == GUIElementBase::Type::FixedSpace)
 				sizeRange.optimal.y = sizeRange.min.y = 0;
@@ -46,6 +49,9 @@ namespace bs
 
 	void GUILayoutX::_updateOptimalLayoutSizes()
 	{
+		if (!_isSizeRangeDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
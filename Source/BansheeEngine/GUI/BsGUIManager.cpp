@@ -4,6 +4,7 @@
 #include "GUI/BsGUIWidget.h"
 #include "GUI/BsGUIElement.h"
 #include "2D/BsSpriteTexture.h"
+#include "2D/BsSpriteManager.h"
 #include "Utility/BsTime.h"
 #include "Scene/BsSceneObject.h"
 #include "Material/BsMaterial.h"
@@ -37,6 +38,7 @@
 #include "RenderAPI/BsSamplerState.h"
 #include "Managers/BsRenderStateManager.h"
 #include "Resources/BsBuiltinResources.h"
+#include "Text/BsFontManager.h"
 
 using namespace std::placeholders;
 
@@ -47,34 +49,42 @@ namespace bs
 		GUIGroupElement()
 		{ }
 
-		GUIGroupElement(GUIElement* _element, UINT32 _renderElement)
-			:element(_element), renderElement(_renderElement)
+		GUIGroupElement(GUIElement* _element, UINT32 _renderElement, UINT32 _depth)
+			:element(_element), renderElement(_renderElement), depth(_depth)
 		{ }
 
 		GUIElement* element;
 		UINT32 renderElement;
+		UINT32 depth;
 	};
 
-	struct GUIMaterialGroup
+	struct GUIManager::GUIMaterialGroup
 	{
 		SpriteMaterial* material;
 		SpriteMaterialInfo matInfo;
 		GUIMeshType meshType;
-		UINT32 numVertices;
-		UINT32 numIndices;
 		UINT32 depth;
 		UINT32 minDepth;
 		Rect2I bounds;
-		Vector<GUIGroupElement> elements;
+		FrameVector<GUIMeshElement> elements;
 	};
 
+	/** Returns the clipped bounds of the GUI element, transformed by its parent widget's transform. */
+	Rect2I getTransformedBounds(GUIElement* element)
+	{
+		Rect2I bounds = element->_getClippedBounds();
+		bounds.transform(element->_getParentWidget()->getWorldTfrm());
+
+		return bounds;
+	}
+
 	const UINT32 GUIManager::DRAG_DISTANCE = 3;
 	const float GUIManager::TOOLTIP_HOVER_TIME = 1.0f;
 	const UINT32 GUIManager::MESH_HEAP_INITIAL_NUM_VERTS = 16384;
 	const UINT32 GUIManager::MESH_HEAP_INITIAL_NUM_INDICES = 49152;
 
 	GUIManager::GUIManager()
-		: mCoreDirty(false), mActiveMouseButton(GUIMouseButton::Left), mShowTooltip(false), mTooltipElementHoverStart(0.0f)
+		: mCoreDirty(false), mFontEvictionCount(0), mActiveMouseButton(GUIMouseButton::Left), mShowTooltip(false), mTooltipElementHoverStart(0.0f)
 		, mInputCaret(nullptr), mInputSelection(nullptr), mSeparateMeshesByWidget(true), mDragState(DragState::NoDrag)
 		, mCaretColor(1.0f, 0.6588f, 0.0f), mCaretBlinkInterval(0.5f), mCaretLastBlinkTime(0.0f), mIsCaretOn(false)
 		, mActiveCursor(CursorType::Arrow), mTextSelectionColor(0.0f, 114/255.0f, 188/255.0f)
@@ -219,15 +229,7 @@ namespace bs
 		if(renderData.widgets.size() == 0)
 		{
 			for (auto& entry : renderData.cachedMeshes)
-			{
-				if (entry.mesh == nullptr)
-					continue;
-
-				if(!entry.isLine)
-					mTriangleMeshHeap->dealloc(entry.mesh);
-				else
-					mLineMeshHeap->dealloc(entry.mesh);
-			}
+				releaseMesh(entry);
 
 			mCachedGUIData.erase(renderTarget);
 			mCoreDirty = true;
@@ -368,58 +370,107 @@ namespace bs
 			}
 		}
 
+		// Characters of dynamic fonts were evicted from their textures, so any existing text geometry might reference
+		// the wrong characters and needs to be rebuilt
+		UINT64 fontEvictionCount = FontManager::instance().getCharacterEvictionCount();
+		if(fontEvictionCount != mFontEvictionCount)
+		{
+			for(auto& widgetInfo : mWidgets)
+			{
+				for(auto& element : widgetInfo.widget->getElements())
+					element->_markContentAsDirty();
+			}
+
+			mFontEvictionCount = fontEvictionCount;
+		}
+
 		PROFILE_CALL(updateMeshes(), "UpdateMeshes");
 
 		// Send potentially updated meshes to core for rendering
 		if (mCoreDirty)
 		{
-			UnorderedMap<SPtr<ct::Camera>, Vector<GUICoreRenderData>> corePerCameraData;
+			updateCoreData();
+			mCoreDirty = false;
+		}
+	}
+
+	void GUIManager::updateCoreData()
+	{
+		UnorderedMap<SPtr<ct::Camera>, Vector<GUICoreRenderData>> changedCameraData;
+		UnorderedSet<SPtr<ct::Camera>> activeCameras;
 
-			for (auto& viewportData : mCachedGUIData)
+		for (auto& viewportData : mCachedGUIData)
+		{
+			GUIRenderData& renderData = viewportData.second;
+
+			SPtr<Camera> camera;
+			for (auto& widget : renderData.widgets)
 			{
-				const GUIRenderData& renderData = viewportData.second;
+				camera = widget->getCamera();
+				if (camera != nullptr)
+					break;
+			}
 
-				SPtr<Camera> camera;
-				for (auto& widget : viewportData.second.widgets)
-				{
-					camera = widget->getCamera();
-					if (camera != nullptr)
-						break;
-				}
+			SPtr<ct::Camera> coreCamera;
+			if (camera != nullptr)
+				coreCamera = camera->getCore();
 
-				if (camera == nullptr)
-					continue;
+			if (coreCamera != renderData.coreCamera)
+			{
+				renderData.coreCamera = coreCamera;
+				renderData.isCoreDirty = true;
+			}
 
-				auto insertedData = corePerCameraData.insert(std::make_pair(camera->getCore(), Vector<GUICoreRenderData>()));
-				Vector<GUICoreRenderData>& cameraData = insertedData.first->second;
+			if (coreCamera == nullptr)
+				continue;
 
-				for (auto& entry : renderData.cachedMeshes)
-				{
-					if (entry.mesh == nullptr)
-						continue;
+			// Only the first viewport rendered by a camera is used
+			if (!activeCameras.insert(coreCamera).second)
+				continue;
 
-					cameraData.push_back(GUICoreRenderData());
-					GUICoreRenderData& newEntry = cameraData.back();
+			if (!renderData.isCoreDirty)
+				continue;
 
-					SPtr<ct::Texture> textureCore;
-					if (entry.matInfo.texture.isLoaded())
-						textureCore = entry.matInfo.texture->getCore();
-					else
-						textureCore = nullptr;
-
-					newEntry.material = entry.material;
-					newEntry.texture = textureCore;
-					newEntry.tint = entry.matInfo.tint;
-					newEntry.mesh = entry.mesh->getCore();
-					newEntry.worldTransform = entry.widget->getWorldTfrm();
-					newEntry.additionalData = entry.matInfo.additionalData;
-				}
-			}
+			renderData.isCoreDirty = false;
+
+			Vector<GUICoreRenderData>& cameraData = changedCameraData[coreCamera];
+			for (auto& entry : renderData.cachedMeshes)
+			{
+				if (entry.mesh == nullptr)
+					continue;
 
-			gCoreThread().queueCommand(std::bind(&ct::GUIRenderer::updateData, mRenderer.get(), corePerCameraData));
+				cameraData.push_back(GUICoreRenderData());
+				GUICoreRenderData& newEntry = cameraData.back();
 
-			mCoreDirty = false;
+				SPtr<ct::Texture> textureCore;
+				if (entry.matInfo.texture.isLoaded())
+					textureCore = entry.matInfo.texture->getCore();
+				else
+					textureCore = nullptr;
+
+				newEntry.material = entry.material;
+				newEntry.texture = textureCore;
+				newEntry.tint = entry.matInfo.tint;
+				newEntry.mesh = entry.mesh->getCore();
+				newEntry.worldTransform = entry.widget->getWorldTfrm();
+				newEntry.additionalData = entry.matInfo.additionalData;
+			}
 		}
+
+		Vector<SPtr<ct::Camera>> removedCameras;
+		for (auto& camera : mCoreCameras)
+		{
+			if (activeCameras.find(camera) == activeCameras.end())
+				removedCameras.push_back(camera);
+		}
+
+		mCoreCameras = std::move(activeCameras);
+
+		if (changedCameraData.empty() && removedCameras.empty())
+			return;
+
+		gCoreThread().queueCommand(std::bind(&ct::GUIRenderer::updateData, mRenderer.get(), changedCameraData, 
+			removedCameras));
 	}
 
 	void GUIManager::processDestroyQueue()
@@ -431,272 +482,462 @@ namespace bs
 
 	void GUIManager::updateMeshes()
 	{
-		for(auto& cachedMeshData : mCachedGUIData)
+		// Render data that needs its meshes updated, along with information on what changed
+		struct DirtyRenderData
 		{
-			GUIRenderData& renderData = cachedMeshData.second;
+			GUIRenderData* renderData;
+			bool rebuildAll;
+			FrameUnorderedMap<GUIElement*, UINT32> dirtyElements;
+		};
 
-			// Check if anything is dirty. If nothing is we can skip the update
-			bool isDirty = renderData.isDirty;
-			renderData.isDirty = false;
+		bs_frame_mark();
+		{
+			// Update render elements of all dirty widgets first, and only then build the meshes. This way sprite geometry
+			// of all the elements can be generated in a single batch, split over multiple threads.
+			FrameVector<DirtyRenderData> dirtyRenderData;
 
-			for(auto& widget : renderData.widgets)
+			SpriteManager::instance()._beginBatch();
+			for(auto& cachedMeshData : mCachedGUIData)
 			{
-				if (widget->isDirty(true))
+				GUIRenderData& renderData = cachedMeshData.second;
+
+				// Check if anything is dirty. If nothing is we can skip the update. If only contents of some elements 
+				// changed we can try to update just the meshes those elements are in.
+				dirtyRenderData.push_back(DirtyRenderData());
+
+				DirtyRenderData& entry = dirtyRenderData.back();
+				entry.renderData = &renderData;
+				entry.rebuildAll = renderData.isDirty;
+
+				bool isDirty = renderData.isDirty;
+				renderData.isDirty = false;
+
+				for (auto& widget : renderData.widgets)
 				{
+					if (!widget->isDirty(false))
+						continue;
+
 					isDirty = true;
+
+					if (widget->_isMeshDirty())
+						entry.rebuildAll = true;
+
+					for (auto& element : widget->_getDirtyContents())
+						entry.dirtyElements[element] = 0;
+
+					widget->isDirty(true);
 				}
+
+				if (!isDirty)
+					dirtyRenderData.pop_back();
 			}
+			SpriteManager::instance()._endBatch();
 
-			if(!isDirty)
-				continue;
+			for (auto& entry : dirtyRenderData)
+			{
+				mCoreDirty = true;
+				entry.renderData->isCoreDirty = true;
 
-			mCoreDirty = true;
+				if (entry.rebuildAll || !updateDirtyMeshes(*entry.renderData, entry.dirtyElements))
+					rebuildMeshes(*entry.renderData, entry.dirtyElements);
+			}
+		}
+		bs_frame_clear();
+	}
+
+	void GUIManager::rebuildMeshes(GUIRenderData& renderData, const FrameUnorderedMap<GUIElement*, UINT32>& dirtyElements)
+	{
+		bs_frame_mark();
+		{
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			FrameVector<GUIGroupElement> allElements;
 
-			bs_frame_mark();
+			for (auto& widget : renderData.widgets)
 			{
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
+				const Vector<GUIElement*>& elements = widget->getElements();
+
+				for (auto& element : elements)
 				{
-					UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
-					UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
+					if (!element->_isVisible())
+						continue;
 
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-					return (aDepth > bDepth) || 
-						(aDepth == bDepth && a.element > b.element) || 
-						(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
-				};
+					UINT32 numRenderElems = element->_getNumRenderElements();
+					for (UINT32 i = 0; i < numRenderElems; i++)
+						allElements.push_back(GUIGroupElement(element, i, element->_getRenderElementDepth(i)));
+				}
+			}
 
-				FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
+			std::sort(allElements.begin(), allElements.end(), 
+				[](const GUIGroupElement& a, const GUIGroupElement& b)
+			{
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't
+				// really matter, but the result needs to be deterministic
+				return (a.depth > b.depth) || 
+					(a.depth == b.depth && a.element > b.element) || 
+					(a.depth == b.depth && a.element == b.element && a.renderElement > b.renderElement); 
+			});
+
+			// Group the elements in such a way so that we end up with a smallest amount of
+			// meshes, without breaking back to front rendering order
+			FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
+			for (auto& elem : allElements)
+			{
+				GUIElement* guiElem = elem.element;
+				UINT32 renderElemIdx = elem.renderElement;
+				UINT32 elemDepth = elem.depth;
 
-				for (auto& widget : renderData.widgets)
-				{
-					const Vector<GUIElement*>& elements = widget->getElements();
+				Rect2I tfrmedBounds = getTransformedBounds(guiElem);
 
-					for (auto& element : elements)
-					{
-						if (!element->_isVisible())
-							continue;
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
+				assert(spriteMaterial != nullptr);
 
-						UINT32 numRenderElems = element->_getNumRenderElements();
-						for (UINT32 i = 0; i < numRenderElems; i++)
+				UINT64 hash = spriteMaterial->getMergeHash(matInfo);
+				FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
+				
+				// Try to find a group this material will fit in:
+				//  - Group that has a depth value same or one below elements depth will always be a match
+				//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
+				//    overlap the current elements bounds.
+				GUIMaterialGroup* foundGroup = nullptr;
+
+				for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+				{
+					// If we separate meshes by widget, ignore any groups with widget parents other than mine
+					if (mSeparateMeshesByWidget)
+					{
+						if (groupIter->elements.size() > 0)
 						{
-							allElements.insert(GUIGroupElement(element, i));
+							GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
+							if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
+								continue;
 						}
 					}
-				}
 
-				// Group the elements in such a way so that we end up with a smallest amount of
-				// meshes, without breaking back to front rendering order
-				FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
-				for (auto& elem : allElements)
-				{
-					GUIElement* guiElem = elem.element;
-					UINT32 renderElemIdx = elem.renderElement;
-					UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
-
-					Rect2I tfrmedBounds = guiElem->_getClippedBounds();
-					tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
-
-					SpriteMaterial* spriteMaterial = nullptr;
-					const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
-					assert(spriteMaterial != nullptr);
-
-					UINT64 hash = spriteMaterial->getMergeHash(matInfo);
-					FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
-					
-					// Try to find a group this material will fit in:
-					//  - Group that has a depth value same or one below elements depth will always be a match
-					//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
-					//    overlap the current elements bounds.
-					GUIMaterialGroup* foundGroup = nullptr;
-
-					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+					GUIMaterialGroup& group = *groupIter;
+
+					if (group.depth == elemDepth)
 					{
-						// If we separate meshes by widget, ignore any groups with widget parents other than mine
-						if (mSeparateMeshesByWidget)
+						foundGroup = &group;
+						break;
+					}
+					else
+					{
+						UINT32 startDepth = elemDepth;
+						UINT32 endDepth = group.depth;
+
+						Rect2I potentialGroupBounds = group.bounds;
+						potentialGroupBounds.encapsulate(tfrmedBounds);
+
+						bool foundOverlap = false;
+						for (auto& material : materialGroups)
 						{
-							if (groupIter->elements.size() > 0)
+							for (auto& matGroup : material.second)
 							{
-								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
+								if (&matGroup == &group)
 									continue;
+
+								if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
+									|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+								{
+									if (matGroup.bounds.overlaps(potentialGroupBounds))
+									{
+										foundOverlap = true;
+										break;
+									}
+								}
 							}
 						}
 
-						GUIMaterialGroup& group = *groupIter;
-
-						if (group.depth == elemDepth)
+						if (!foundOverlap)
 						{
 							foundGroup = &group;
 							break;
 						}
-						else
-						{
-							UINT32 startDepth = elemDepth;
-							UINT32 endDepth = group.depth;
+					}
+				}
 
-							Rect2I potentialGroupBounds = group.bounds;
-							potentialGroupBounds.encapsulate(tfrmedBounds);
+				GUIMeshElement meshElement;
+				meshElement.element = guiElem;
+				meshElement.renderElement = renderElemIdx;
+				meshElement.depth = elemDepth;
+				meshElement.mergeHash = hash;
+				meshElement.bounds = tfrmedBounds;
 
-							bool foundOverlap = false;
-							for (auto& material : materialGroups)
-							{
-								for (auto& matGroup : material.second)
-								{
-									if (&matGroup == &group)
-										continue;
+				if (foundGroup == nullptr)
+				{
+					groupsPerMaterial.push_back(GUIMaterialGroup());
+					foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+
+					foundGroup->depth = elemDepth;
+					foundGroup->minDepth = elemDepth;
+					foundGroup->bounds = tfrmedBounds;
+					foundGroup->elements.push_back(meshElement);
+					foundGroup->matInfo = matInfo.clone();
+					foundGroup->material = spriteMaterial;
+
+					UINT32 numVertices;
+					UINT32 numIndices;
+					guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, foundGroup->meshType);
+				}
+				else
+				{
+					foundGroup->bounds.encapsulate(tfrmedBounds);
+					foundGroup->elements.push_back(meshElement);
+					foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
 
-									if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
-										|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
-									{
-										if (matGroup.bounds.overlaps(potentialGroupBounds))
-										{
-											foundOverlap = true;
-											break;
-										}
-									}
-								}
-							}
+					UINT32 numVertices;
+					UINT32 numIndices;
+					GUIMeshType meshType;
+					guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
+					assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
 
-							if (!foundOverlap)
-							{
-								foundGroup = &group;
-								break;
-							}
-						}
-					}
+					spriteMaterial->merge(foundGroup->matInfo, matInfo);
+				}
+			}
 
-					if (foundGroup == nullptr)
-					{
-						groupsPerMaterial.push_back(GUIMaterialGroup());
-						foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+			// Make a list of all groups, sorted from farthest to nearest (highest depth to lowest)
+			FrameVector<GUIMaterialGroup*> sortedGroups;
+			for(auto& material : materialGroups)
+			{
+				for(auto& group : material.second)
+					sortedGroups.push_back(&group);
+			}
+
+			std::sort(sortedGroups.begin(), sortedGroups.end(), 
+				[](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			{
+				// Compare pointers just to differentiate between two groups with the same depth, their order doesn't 
+				// really matter
+				return (a->depth > b->depth) || (a->depth == b->depth && a > b);
+			});
+
+			// Find existing meshes by their first render element, so groups that didn't change can keep their mesh
+			FrameUnorderedMap<GUIElement*, FrameVector<UINT32>> oldMeshesByElement;
+			for (UINT32 i = 0; i < (UINT32)renderData.cachedMeshes.size(); i++)
+			{
+				const GUIMeshData& meshData = renderData.cachedMeshes[i];
+				if (meshData.mesh != nullptr && !meshData.elements.empty())
+					oldMeshesByElement[meshData.elements[0].element].push_back(i);
+			}
 
-						foundGroup->depth = elemDepth;
-						foundGroup->minDepth = elemDepth;
-						foundGroup->bounds = tfrmedBounds;
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->matInfo = matInfo.clone();
-						foundGroup->material = spriteMaterial;
+			Vector<GUIMeshData> oldMeshes = std::move(renderData.cachedMeshes);
 
-						guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
-					}
-					else
+			UINT32 numMeshes = (UINT32)sortedGroups.size();
+			renderData.cachedMeshes.clear();
+			renderData.cachedMeshes.resize(numMeshes);
+			
+			// Fill buffers for each group and update their meshes
+			for(UINT32 i = 0; i < numMeshes; i++)
+			{
+				GUIMaterialGroup* group = sortedGroups[i];
+
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[i];
+				guiMeshData.matInfo = group->matInfo;
+				guiMeshData.material = group->material;
+				guiMeshData.widget = group->elements.empty() ? nullptr : group->elements[0].element->_getParentWidget();
+				guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+				guiMeshData.elements.assign(group->elements.begin(), group->elements.end());
+
+				// Reuse the existing mesh if the group contains the same render elements in the same order, and none of
+				// them changed. This way the mesh heap only receives data for groups that actually changed.
+				bool isDirty = false;
+				for (auto& meshElement : guiMeshData.elements)
+				{
+					if (dirtyElements.find(meshElement.element) != dirtyElements.end())
 					{
-						foundGroup->bounds.encapsulate(tfrmedBounds);
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
-						
-						UINT32 numVertices;
-						UINT32 numIndices;
-						GUIMeshType meshType;
-						guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
-						assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
-
-						foundGroup->numVertices += numVertices;
-						foundGroup->numIndices += numIndices;
-
-						spriteMaterial->merge(foundGroup->matInfo, matInfo);
+						isDirty = true;
+						break;
 					}
 				}
 
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+				if (!isDirty && !guiMeshData.elements.empty())
 				{
-					return (a->depth > b->depth) || (a->depth == b->depth && a > b);
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-				};
-
-				UINT32 numMeshes = 0;
-				FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
-				for(auto& material : materialGroups)
-				{
-					for(auto& group : material.second)
+					auto iterFind = oldMeshesByElement.find(guiMeshData.elements[0].element);
+					if (iterFind != oldMeshesByElement.end())
 					{
-						sortedGroups.insert(&group);
-						numMeshes++;
+						for (auto& oldMeshIdx : iterFind->second)
+						{
+							GUIMeshData& oldMeshData = oldMeshes[oldMeshIdx];
+							if (oldMeshData.mesh == nullptr || oldMeshData.isLine != guiMeshData.isLine ||
+								oldMeshData.elements.size() != guiMeshData.elements.size())
+								continue;
+
+							bool isMatch = true;
+							for (UINT32 j = 0; j < (UINT32)guiMeshData.elements.size(); j++)
+							{
+								const GUIMeshElement& oldElement = oldMeshData.elements[j];
+								const GUIMeshElement& newElement = guiMeshData.elements[j];
+
+								if (oldElement.element != newElement.element || 
+									oldElement.renderElement != newElement.renderElement)
+								{
+									isMatch = false;
+									break;
+								}
+							}
+
+							if (isMatch)
+							{
+								guiMeshData.mesh = oldMeshData.mesh;
+								oldMeshData.mesh = nullptr;
+								break;
+							}
+						}
 					}
 				}
 
-				UINT32 oldNumMeshes = (UINT32)renderData.cachedMeshes.size();
-				for (UINT32 i = 0; i < oldNumMeshes; i++)
-				{
-					if(!renderData.cachedMeshes[i].isLine)
-						mTriangleMeshHeap->dealloc(renderData.cachedMeshes[i].mesh);
-					else
-						mLineMeshHeap->dealloc(renderData.cachedMeshes[i].mesh);
-				}
+				if (guiMeshData.mesh == nullptr)
+					fillMesh(guiMeshData);
+			}
 
-				renderData.cachedMeshes.resize(numMeshes);
-				
-				// Fill buffers for each group and update their meshes
-				UINT32 meshIdx = 0;
-				for(auto& group : sortedGroups)
-				{
-					SPtr<MeshData> meshData;
-					GUIWidget* widget;
+			for (auto& entry : oldMeshes)
+				releaseMesh(entry);
+		}
+		bs_frame_clear();
+	}
 
-					if (group->elements.size() == 0)
-						widget = nullptr;
-					else
-					{
-						GUIElement* elem = group->elements.begin()->element;
-						widget = elem->_getParentWidget();
-					}
+	bool GUIManager::updateDirtyMeshes(GUIRenderData& renderData, FrameUnorderedMap<GUIElement*, UINT32>& dirtyElements)
+	{
+		// Find meshes containing the dirty elements, and make sure none of the properties used for grouping changed
+		FrameVector<UINT32> dirtyMeshes;
+		for (UINT32 i = 0; i < (UINT32)renderData.cachedMeshes.size(); i++)
+		{
+			const GUIMeshData& meshData = renderData.cachedMeshes[i];
 
-					GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
-					guiMeshData.matInfo = group->matInfo;
-					guiMeshData.material = group->material;
-					guiMeshData.widget = widget;
+			bool isMeshDirty = false;
+			for (auto& meshElement : meshData.elements)
+			{
+				auto iterFind = dirtyElements.find(meshElement.element);
+				if (iterFind == dirtyElements.end())
+					continue;
 
-					if (group->meshType == GUIMeshType::Triangle)
-					{
-						meshData = bs_shared_ptr_new<MeshData>(group->numVertices, group->numIndices, mTriangleVertexDesc);
-						guiMeshData.isLine = false;
-					}
-					else // Line
-					{
-						meshData = bs_shared_ptr_new<MeshData>(group->numVertices, group->numIndices, mLineVertexDesc);
-						guiMeshData.isLine = true;
-					}
+				iterFind->second++;
+				isMeshDirty = true;
 
-					UINT8* vertices = meshData->getElementData(VES_POSITION);
-					UINT32* indices = meshData->getIndices32();
+				GUIElement* element = meshElement.element;
+				UINT32 renderElemIdx = meshElement.renderElement;
 
-					UINT32 indexOffset = 0;
-					UINT32 vertexOffset = 0;
-					for(auto& matElement : group->elements)
-					{
-						matElement.element->_fillBuffer(vertices, indices, vertexOffset, indexOffset, group->numVertices,
-							group->numIndices, matElement.renderElement);
+				if (!element->_isVisible() || renderElemIdx >= element->_getNumRenderElements())
+					return false;
 
-						UINT32 numVertices;
-						UINT32 numIndices;
-						GUIMeshType meshType;
-						matElement.element->_getMeshInfo(matElement.renderElement, numVertices, numIndices, meshType);
+				if (element->_getRenderElementDepth(renderElemIdx) != meshElement.depth)
+					return false;
 
-						UINT32 indexStart = indexOffset;
-						UINT32 indexEnd = indexStart + numIndices;
+				if (getTransformedBounds(element) != meshElement.bounds)
+					return false;
 
-						for(UINT32 i = indexStart; i < indexEnd; i++)
-							indices[i] += vertexOffset;
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = element->_getMaterial(renderElemIdx, &spriteMaterial);
+				if (spriteMaterial != meshData.material || spriteMaterial->getMergeHash(matInfo) != meshElement.mergeHash)
+					return false;
+			}
 
-						indexOffset += numIndices;
-						vertexOffset += numVertices;
-					}
+			if (isMeshDirty)
+				dirtyMeshes.push_back(i);
+		}
 
-					if (group->meshType == GUIMeshType::Triangle)
-						guiMeshData.mesh = mTriangleMeshHeap->alloc(meshData);
-					else // Line
-						guiMeshData.mesh = mLineMeshHeap->alloc(meshData, DOT_LINE_LIST);
+		// Make sure no render elements were added or removed
+		for (auto& entry : dirtyElements)
+		{
+			UINT32 numRenderElements = entry.first->_isVisible() ? entry.first->_getNumRenderElements() : 0;
+			if (entry.second != numRenderElements)
+				return false;
+		}
 
-					meshIdx++;
-				}
+		for (auto& meshIdx : dirtyMeshes)
+		{
+			GUIMeshData& meshData = renderData.cachedMeshes[meshIdx];
+
+			// Material info might have changed in a way that doesn't affect the merge hash, so merge it again
+			for (UINT32 i = 0; i < (UINT32)meshData.elements.size(); i++)
+			{
+				const GUIMeshElement& meshElement = meshData.elements[i];
+
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = 
+					meshElement.element->_getMaterial(meshElement.renderElement, &spriteMaterial);
+
+				if (i == 0)
+					meshData.matInfo = matInfo.clone();
+				else
+					spriteMaterial->merge(meshData.matInfo, matInfo);
 			}
 
-			bs_frame_clear();			
+			fillMesh(meshData);
 		}
+
+		return true;
+	}
+
+	void GUIManager::fillMesh(GUIMeshData& meshData)
+	{
+		releaseMesh(meshData);
+
+		UINT32 totalNumVertices = 0;
+		UINT32 totalNumIndices = 0;
+		for (auto& meshElement : meshData.elements)
+		{
+			UINT32 numVertices;
+			UINT32 numIndices;
+			GUIMeshType meshType;
+			meshElement.element->_getMeshInfo(meshElement.renderElement, numVertices, numIndices, meshType);
+
+			totalNumVertices += numVertices;
+			totalNumIndices += numIndices;
+		}
+
+		if (totalNumVertices == 0 || totalNumIndices == 0)
+			return;
+
+		SPtr<MeshData> data;
+		if (!meshData.isLine)
+			data = bs_shared_ptr_new<MeshData>(totalNumVertices, totalNumIndices, mTriangleVertexDesc);
+		else
+			data = bs_shared_ptr_new<MeshData>(totalNumVertices, totalNumIndices, mLineVertexDesc);
+
+		UINT8* vertices = data->getElementData(VES_POSITION);
+		UINT32* indices = data->getIndices32();
+
+		UINT32 indexOffset = 0;
+		UINT32 vertexOffset = 0;
+		for (auto& meshElement : meshData.elements)
+		{
+			meshElement.element->_fillBuffer(vertices, indices, vertexOffset, indexOffset, totalNumVertices,
+				totalNumIndices, meshElement.renderElement);
+
+			UINT32 numVertices;
+			UINT32 numIndices;
+			GUIMeshType meshType;
+			meshElement.element->_getMeshInfo(meshElement.renderElement, numVertices, numIndices, meshType);
+
+			UINT32 indexStart = indexOffset;
+			UINT32 indexEnd = indexStart + numIndices;
+
+			for(UINT32 i = indexStart; i < indexEnd; i++)
+				indices[i] += vertexOffset;
+
+			indexOffset += numIndices;
+			vertexOffset += numVertices;
+		}
+
+		if (!meshData.isLine)
+			meshData.mesh = mTriangleMeshHeap->alloc(data);
+		else
+			meshData.mesh = mLineMeshHeap->alloc(data, DOT_LINE_LIST);
+	}
+
+	void GUIManager::releaseMesh(GUIMeshData& meshData)
+	{
+		if (meshData.mesh == nullptr)
+			return;
+
+		if (!meshData.isLine)
+			mTriangleMeshHeap->dealloc(meshData.mesh);
+		else
+			mLineMeshHeap->dealloc(meshData.mesh);
+
+		meshData.mesh = nullptr;
 	}
 
 	void GUIManager::updateCaretTexture()
@@ -1276,6 +1517,7 @@ namespace bs
 		if(windowUnderPointer != nullptr)
 		{
 			Vector2I windowPos = windowUnderPointer->screenToWindowPos(pointerScreenPos);
+			Vector<GUIElement*> candidateElements;
 
 			UINT32 widgetIdx = 0;
 			for(auto& widgetInfo : mWidgets)
@@ -1290,14 +1532,14 @@ namespace bs
 				if(widgetWindows[widgetIdx] == windowUnderPointer 
 					&& widget->inBounds(windowToBridgedCoords(widget->getTarget()->getTarget(), windowPos)))
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
 					Vector2I localPos = getWidgetRelativePos(widget, pointerScreenPos);
 
-					// Elements with lowest depth (most to the front) get handled first
-					for(auto iter = elements.begin(); iter != elements.end(); ++iter)
-					{
-						GUIElement* element = *iter;
+					// Only test elements whose bounds overlap the pointer. They are sorted by depth below.
+					candidateElements.clear();
+					widget->_findElementsAt(localPos, candidateElements);
 
+					for(auto& element : candidateElements)
+					{
 						if(element->_isVisible() && element->_isInBounds(localPos))
 						{
 							ElementInfoUnderPointer elementInfo(element, widget);
@@ -1762,16 +2004,14 @@ namespace bs
 
 	void GUIRenderer::render(const Camera& camera)
 	{
-		Vector<GUIManager::GUICoreRenderData>& renderData = mPerCameraData[&camera];
+		CameraData& cameraData = mPerCameraData[&camera];
 
 		float invViewportWidth = 1.0f / (camera.getViewport()->getPixelArea().width * 0.5f);
 		float invViewportHeight = 1.0f / (camera.getViewport()->getPixelArea().height * 0.5f);
 		float viewflipYFlip = bs::RenderAPI::getAPIInfo().isFlagSet(RenderAPIFeatureFlag::NDCYAxisDown) ? -1.0f : 1.0f;
 
-		for (auto& entry : renderData)
+		for (auto& buffer : cameraData.paramBlocks)
 		{
-			SPtr<GpuParamBlockBuffer> buffer = mParamBlocks[entry.bufferIdx];
-
 			gGUISpriteParamBlockDef.gInvViewportWidth.set(buffer, invViewportWidth);
 			gGUISpriteParamBlockDef.gInvViewportHeight.set(buffer, invViewportHeight);
 			gGUISpriteParamBlockDef.gViewportYFlip.set(buffer, viewflipYFlip);
@@ -1779,64 +2019,70 @@ namespace bs
 			buffer->flushToGPU();
 		}
 
-		for (auto& entry : renderData)
+		for (UINT32 i = 0; i < (UINT32)cameraData.entries.size(); i++)
 		{
 			// TODO - I shouldn't be re-applying the entire material for each entry, instead just check which programs
 			// changed, and apply only those + the modified constant buffers and/or texture.
 
-			SPtr<GpuParamBlockBuffer> buffer = mParamBlocks[entry.bufferIdx];
+			const GUIManager::GUICoreRenderData& entry = cameraData.entries[i];
+			const SPtr<GpuParamBlockBuffer>& buffer = cameraData.paramBlocks[i];
 
 			entry.material->render(entry.mesh, entry.texture, mSamplerState, buffer, entry.additionalData);
 		}
 	}
 
-	void GUIRenderer::updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& newPerCameraData)
+	void GUIRenderer::updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& changedCameraData,
+		const Vector<SPtr<Camera>>& removedCameras)
 	{
-		bs_frame_mark();
-
+		// Return parameter buffers of removed cameras to the pool, so they can be re-used by other cameras
+		for (auto& camera : removedCameras)
 		{
-			mPerCameraData.clear();
-			mReferencedCameras.clear();
+			auto iterFind = mPerCameraData.find(camera.get());
+			if (iterFind == mPerCameraData.end())
+				continue;
 
-			for (auto& newCameraData : newPerCameraData)
-			{
-				SPtr<Camera> camera = newCameraData.first;
+			Vector<SPtr<GpuParamBlockBuffer>>& paramBlocks = iterFind->second.paramBlocks;
+			mFreeParamBlocks.insert(mFreeParamBlocks.end(), paramBlocks.begin(), paramBlocks.end());
 
-				mPerCameraData.insert(std::make_pair(camera.get(), newCameraData.second));
-				mReferencedCameras.insert(camera);
-			}
+			mPerCameraData.erase(iterFind);
+		}
 
-			// Allocate GPU buffers containing the material parameters
-			UINT32 numBuffers = 0;
-			for (auto& cameraData : mPerCameraData)
-				numBuffers += (UINT32)cameraData.second.size();
+		for (auto& newCameraData : changedCameraData)
+		{
+			const SPtr<Camera>& camera = newCameraData.first;
 
-			UINT32 numAllocatedBuffers = (UINT32)mParamBlocks.size();
-			if (numBuffers > numAllocatedBuffers)
-			{
-				mParamBlocks.resize(numBuffers);
+			CameraData& cameraData = mPerCameraData[camera.get()];
+			cameraData.camera = camera;
+			cameraData.entries = newCameraData.second;
 
-				for (UINT32 i = numAllocatedBuffers; i < numBuffers; i++)
-					mParamBlocks[i] = gGUISpriteParamBlockDef.createBuffer();
+			// Allocate GPU buffers containing the material parameters
+			UINT32 numEntries = (UINT32)cameraData.entries.size();
+			while (cameraData.paramBlocks.size() > numEntries)
+			{
+				mFreeParamBlocks.push_back(cameraData.paramBlocks.back());
+				cameraData.paramBlocks.pop_back();
 			}
 
-			UINT32 curBufferIdx = 0;
-			for (auto& cameraData : mPerCameraData)
+			while (cameraData.paramBlocks.size() < numEntries)
 			{
-				for(auto& entry : cameraData.second)
+				if (!mFreeParamBlocks.empty())
 				{
-					SPtr<GpuParamBlockBuffer> buffer = mParamBlocks[curBufferIdx];
+					cameraData.paramBlocks.push_back(mFreeParamBlocks.back());
+					mFreeParamBlocks.pop_back();
+				}
+				else
+					cameraData.paramBlocks.push_back(gGUISpriteParamBlockDef.createBuffer());
+			}
 
-					gGUISpriteParamBlockDef.gTint.set(buffer, entry.tint);
-					gGUISpriteParamBlockDef.gWorldTransform.set(buffer, entry.worldTransform);
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				const GUIManager::GUICoreRenderData& entry = cameraData.entries[i];
+				const SPtr<GpuParamBlockBuffer>& buffer = cameraData.paramBlocks[i];
 
-					entry.bufferIdx = curBufferIdx;
-					curBufferIdx++;
-				}
+				gGUISpriteParamBlockDef.gTint.set(buffer, entry.tint);
+				gGUISpriteParamBlockDef.gWorldTransform.set(buffer, entry.worldTransform);
 			}
 		}
-
-		bs_frame_clear();
 	}
 	}
 }
\ No newline at end of file
@@ -48,6 +48,22 @@ namespace bs
 			Dragging
 		};
 
+		/** 
+		 * Render element of a GUI element that is a part of a GUI mesh, along with the properties the mesh was grouped 
+		 * by. If none of the properties change the element can be updated without affecting any other meshes.
+		 */
+		struct GUIMeshElement
+		{
+			GUIElement* element;
+			UINT32 renderElement;
+			UINT32 depth;
+			UINT64 mergeHash;
+			Rect2I bounds;
+		};
+
+		/** Group of GUI render elements that can be rendered using a single mesh, used while building the meshes. */
+		struct GUIMaterialGroup;
+
 		/** Data required for rendering a single GUI mesh. */
 		struct GUIMeshData
 		{
@@ -56,18 +72,21 @@ namespace bs
 			SpriteMaterialInfo matInfo;
 			GUIWidget* widget;
 			bool isLine;
+			Vector<GUIMeshElement> elements;
 		};
 
 		/**	GUI render data for a single viewport. */
 		struct GUIRenderData
 		{
 			GUIRenderData()
-				:isDirty(true)
+				:isDirty(true), isCoreDirty(true)
 			{ }
 
 			Vector<GUIMeshData> cachedMeshes;
 			Vector<GUIWidget*> widgets;
+			SPtr<ct::Camera> coreCamera; /**< Camera the render data was last sent to the core thread with. */
 			bool isDirty;
+			bool isCoreDirty; /**< True if the render data changed since it was last sent to the core thread. */
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -79,7 +98,6 @@ namespace bs
 			Color tint;
 			Matrix4 worldTransform;
 			SPtr<SpriteMaterialExtraInfo> additionalData;
-			UINT32 bufferIdx;
 		};
 
 		/**	Container for a GUI widget. */
@@ -230,6 +248,43 @@ namespace bs
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/** 
+		 * Regroups all GUI elements rendered by the provided render data into meshes. Must be called if any change might
+		 * affect how are the elements grouped. Groups that end up with the same elements as before, none of which are
+		 * dirty, keep their existing mesh, while the rest of the meshes are rebuilt.
+		 *
+		 * @param[in]	renderData		Render data containing the meshes to rebuild.
+		 * @param[in]	dirtyElements	Elements whose contents changed since the meshes were last built.
+		 */
+		void rebuildMeshes(GUIRenderData& renderData, const FrameUnorderedMap<GUIElement*, UINT32>& dirtyElements);
+
+		/** 
+		 * Rebuilds only the meshes containing the provided elements, keeping the existing mesh grouping. Fails if any of 
+		 * the elements changed in a way that affects the grouping (e.g. changed depth, bounds, material or number of 
+		 * render elements), in which case no meshes are modified and rebuildMeshes() should be called instead.
+		 *
+		 * @param[in]	renderData		Render data containing the meshes to update.
+		 * @param[in]	dirtyElements	Elements whose contents changed, mapped to a counter (must be zero) that will be
+		 *								used for counting their render elements present in the meshes.
+		 * @return						True if the meshes were updated, false if a full rebuild is required.
+		 */
+		bool updateDirtyMeshes(GUIRenderData& renderData, FrameUnorderedMap<GUIElement*, UINT32>& dirtyElements);
+
+		/** 
+		 * Generates geometry for all elements in the mesh and allocates a new mesh for it, releasing the previous one. 
+		 * Mesh is set to null if the elements don't have any geometry.
+		 */
+		void fillMesh(GUIMeshData& meshData);
+
+		/** Releases the mesh of the provided mesh data back to the mesh heap it was allocated from, if any. */
+		void releaseMesh(GUIMeshData& meshData);
+
+		/** 
+		 * Sends render data of all viewports that changed since the last call to the core thread, along with a list of
+		 * cameras that no longer render any GUI.
+		 */
+		void updateCoreData();
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -353,7 +408,9 @@ namespace bs
 		SPtr<MeshHeap> mLineMeshHeap;
 
 		SPtr<ct::GUIRenderer> mRenderer;
+		UnorderedSet<SPtr<ct::Camera>> mCoreCameras;
 		bool mCoreDirty;
+		UINT64 mFontEvictionCount;
 
 		SPtr<VertexDataDesc> mTriangleVertexDesc;
 		SPtr<VertexDataDesc> mLineVertexDesc;
@@ -452,16 +509,26 @@ namespace bs
 		void render(const Camera& camera) override;
 
 	private:
+		/** GUI render data and material parameter buffers for a single camera. */
+		struct CameraData
+		{
+			SPtr<Camera> camera;
+			Vector<GUIManager::GUICoreRenderData> entries;
+			Vector<SPtr<GpuParamBlockBuffer>> paramBlocks;
+		};
+
 		/**
-		 * Updates the internal data that determines what will be rendered on the next render() call.
+		 * Updates the internal data that determines what will be rendered on the next render() call. Data for cameras
+		 * not present in either of the parameters remains unchanged.
 		 *
-		 * @param[in]	perCameraData	GUI mesh/material per viewport.
+		 * @param[in]	changedCameraData	GUI mesh/material for each camera whose GUI changed since the last call.
+		 * @param[in]	removedCameras		Cameras that no longer render any GUI.
 		 */
-		void updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& perCameraData);
+		void updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& changedCameraData,
+			const Vector<SPtr<Camera>>& removedCameras);
 
-		UnorderedMap<const Camera*, Vector<GUIManager::GUICoreRenderData>> mPerCameraData;
-		Set<SPtr<Camera>> mReferencedCameras;
-		Vector<SPtr<GpuParamBlockBuffer>> mParamBlocks;
+		UnorderedMap<const Camera*, CameraData> mPerCameraData;
+		Vector<SPtr<GpuParamBlockBuffer>> mFreeParamBlocks;
 		SPtr<SamplerState> mSamplerState;
 	};
 	}
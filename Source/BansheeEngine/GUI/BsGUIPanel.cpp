@@ -24,6 +24,9 @@ namespace bs
 
 	LayoutSizeRange GUIPanel::_calculateLayoutSizeRange() const
 	{
+		if (!_isSizeRangeDirty())
+			return mSizeRange;
+
 		Vector2I optimalSize;
 		Vector2I minSize;
 
@@ -32,7 +35,7 @@ namespace bs
 			if (!child->_isActive())
 				continue;
 
-			LayoutSizeRange sizeRange = child->_calculateLayoutSizeRange();
+			LayoutSizeRange sizeRange = child->_getLayoutSizeRange();
 
 			if (child->_getType() == GUIElementBase::Type::FixedSpace || child->_getType() == GUIElementBase::Type::FlexibleSpace)
 			{
@@ -82,6 +85,9 @@ namespace bs
 
 	void GUIPanel::_updateOptimalLayoutSizes()
 	{
+		if (!_isSizeRangeDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
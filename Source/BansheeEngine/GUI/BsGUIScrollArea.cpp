@@ -72,11 +72,17 @@ namespace bs
 
 	LayoutSizeRange GUIScrollArea::_getLayoutSizeRange() const
 	{
+		if (_isSizeRangeDirty())
+			return _calculateLayoutSizeRange();
+
 		return mSizeRange;
 	}
 
 	void GUIScrollArea::_updateOptimalLayoutSizes()
 	{
+		if (!_isSizeRangeDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
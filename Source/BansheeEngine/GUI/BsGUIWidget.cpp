@@ -80,6 +80,7 @@ namespace bs
 
 		mElements.clear();
 		mDirtyContents.clear();
+		mHitTestGrid.clear();
 	}
 
 	void GUIWidget::setDepth(UINT8 depth)
@@ -255,6 +256,7 @@ namespace bs
 		if (elem->_getType() == GUIElementBase::Type::Element)
 		{
 			mElements.push_back(static_cast<GUIElement*>(elem));
+			mHitTestGrid.add(static_cast<GUIElement*>(elem));
 			mWidgetIsDirty = true;
 		}
 	}
@@ -272,7 +274,10 @@ namespace bs
 		}
 
 		if (elem->_getType() == GUIElementBase::Type::Element)
+		{
 			mDirtyContents.erase(static_cast<GUIElement*>(elem));
+			mHitTestGrid.remove(static_cast<GUIElement*>(elem));
+		}
 	}
 
 	void GUIWidget::_markMeshDirty(GUIElementBase* elem)
@@ -286,6 +291,16 @@ namespace bs
 			mDirtyContents.insert(static_cast<GUIElement*>(elem));
 	}
 
+	void GUIWidget::_markBoundsDirty(GUIElement* elem)
+	{
+		mHitTestGrid.markDirty(elem);
+	}
+
+	void GUIWidget::_findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements)
+	{
+		mHitTestGrid.find(position, elements);
+	}
+
 	void GUIWidget::setSkin(const HGUISkin& skin)
 	{
 		mSkin = skin;
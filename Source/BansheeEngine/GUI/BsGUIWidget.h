@@ -8,6 +8,7 @@
 #include "Math/BsQuaternion.h"
 #include "Math/BsMatrix4.h"
 #include "Utility/BsEvent.h"
+#include "GUI/BsGUIHitTestGrid.h"
 
 namespace bs
 {
@@ -120,11 +121,32 @@ namespace bs
 		void _markMeshDirty(GUIElementBase* elem);
 
 		/**
-		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the entire
-		 * widget mesh will be rebuilt as well).
+		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt. Only the GUI meshes 
+		 * containing the element will be rebuilt, unless the change affects how the meshes are grouped.
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/** 
+		 * Checks if the widget mesh needs to be fully rebuilt, for reasons other than element contents changing (e.g.
+		 * elements being added, removed or hidden). Cleared by isDirty().
+		 */
+		bool _isMeshDirty() const { return mWidgetIsDirty; }
+
+		/** Returns a list of elements whose contents changed since the widget was last cleaned by isDirty(). */
+		const Set<GUIElement*>& _getDirtyContents() const { return mDirtyContents; }
+
+		/** Notifies the widget that the clipped bounds of the provided element changed. */
+		void _markBoundsDirty(GUIElement* elem);
+
+		/**
+		 * Finds all elements whose clipped bounds contain the provided widget-relative position. Elements are returned in
+		 * no particular order and aren't checked for visibility or exact bounds (see GUIElement::_isInBounds()).
+		 * 
+		 * @param[in]	position	Position relative to the widget.
+		 * @param[out]	elements	List to append the found elements to.
+		 */
+		void _findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements);
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
@@ -191,6 +213,7 @@ namespace bs
 		HEvent mOwnerTargetResizedConn;
 
 		Set<GUIElement*> mDirtyContents;
+		GUIHitTestGrid mHitTestGrid;
 
 		mutable UINT64 mCachedRTId;
 		mutable bool mWidgetIsDirty;
@@ -98,13 +98,13 @@ namespace bs
 		float getAxisValue(const VirtualAxis& axis, UINT32 deviceIdx = 0) const;
 
 		/**	Triggered when a virtual button is pressed. */
-		Event<void(const VirtualButton&, UINT32 deviceIdx)> onButtonDown;
+		UnsyncEvent<void(const VirtualButton&, UINT32 deviceIdx)> onButtonDown;
 
 		/**	Triggered when a virtual button is released. */
-		Event<void(const VirtualButton&, UINT32 deviceIdx)> onButtonUp;
+		UnsyncEvent<void(const VirtualButton&, UINT32 deviceIdx)> onButtonUp;
 
 		/**	Triggered every frame when a virtual button is being held down. */
-		Event<void(const VirtualButton&, UINT32 deviceIdx)> onButtonHeld;
+		UnsyncEvent<void(const VirtualButton&, UINT32 deviceIdx)> onButtonHeld;
 
 		/** @name Internal
 		 *  @{
@@ -22,16 +22,25 @@ namespace bs { namespace ct
 		mSortableElements.clear();
 		mSortableElementIdx.clear();
 		mElements.clear();
+		mInstanceable.clear();
+		mNumInstanceable = 0;
 
 		mSortedRenderElements.clear();
+		mSortedElementInfos.clear();
+		mInstanceBatches.clear();
+		mInstancedElements.clear();
 	}
 
-	void RenderQueue::add(RenderableElement* element, float distFromCamera)
+	void RenderQueue::add(RenderableElement* element, float distFromCamera, bool instanceable)
 	{
 		SPtr<Material> material = element->material;
 		SPtr<Shader> shader = material->getShader();
 
 		mElements.push_back(element);
+		mInstanceable.push_back(instanceable);
+
+		if (instanceable)
+			mNumInstanceable++;
 		
 		UINT32 queuePriority = shader->getQueuePriority();
 		QueueSortType sortType = shader->getQueueSortType();
@@ -112,6 +121,7 @@ namespace bs { namespace ct
 			if (separablePasses)
 			{
 				mSortedRenderElements.push_back(RenderQueueElement());
+				mSortedElementInfos.push_back({ (UINT32)currentElementIdx, elem.shaderId });
 
 				RenderQueueElement& sortedElem = mSortedRenderElements.back();
 				sortedElem.renderElem = renderElem;
@@ -133,6 +143,7 @@ namespace bs { namespace ct
 				for (UINT32 j = 0; j < numPassesInCurrentElement; j++)
 				{
 					mSortedRenderElements.push_back(RenderQueueElement());
+					mSortedElementInfos.push_back({ (UINT32)currentElementIdx, elem.shaderId });
 
 					RenderQueueElement& sortedElem = mSortedRenderElements.back();
 					sortedElem.renderElem = renderElem;
@@ -146,6 +157,126 @@ namespace bs { namespace ct
 				numPassesInCurrentElement = 0;
 			}			
 		}
+
+		if (mNumInstanceable > 1)
+			batchInstances();
+	}
+
+	void RenderQueue::batchInstances()
+	{
+		UINT32 numSorted = (UINT32)mSortedRenderElements.size();
+
+		// Assign each instanceable entry to a batch and count the number of entries per batch
+		mInstanceBatches.clear();
+		mInstancedElements.clear();
+		mInstanceBatchLookup.clear();
+		mElementBatchIds.assign(numSorted, (UINT32)-1);
+
+		for (UINT32 i = 0; i < numSorted; i++)
+		{
+			const SortedElementInfo& info = mSortedElementInfos[i];
+			if (!mInstanceable[info.elementIdx])
+				continue;
+
+			const RenderQueueElement& sortedElem = mSortedRenderElements[i];
+			const RenderableElement* renderElem = sortedElem.renderElem;
+
+			InstanceBatchKey key;
+			key.mesh = renderElem->mesh.get();
+			key.indexOffset = renderElem->subMesh.indexOffset;
+			key.indexCount = renderElem->subMesh.indexCount;
+			key.material = renderElem->material.get();
+			key.passIdx = sortedElem.passIdx;
+
+			auto iterFind = mInstanceBatchLookup.insert(std::make_pair(key, (UINT32)mInstanceBatches.size()));
+			if (iterFind.second)
+				mInstanceBatches.push_back({ 0, 0 });
+
+			UINT32 batchIdx = iterFind.first->second;
+			mElementBatchIds[i] = batchIdx;
+			mInstanceBatches[batchIdx].numElements++;
+		}
+
+		// Only batches with more than one element are worth an instanced draw, dissolve the rest
+		UINT32 numBatches = (UINT32)mInstanceBatches.size();
+		mBatchRemap.assign(numBatches, (UINT32)-1);
+
+		UINT32 numInstanced = 0;
+		UINT32 numValidBatches = 0;
+		for (UINT32 i = 0; i < numBatches; i++)
+		{
+			UINT32 numElements = mInstanceBatches[i].numElements;
+			if (numElements < 2)
+				continue;
+
+			mBatchRemap[i] = numValidBatches;
+			mInstanceBatches[numValidBatches] = { numInstanced, 0 };
+
+			numInstanced += numElements;
+			numValidBatches++;
+		}
+
+		mInstanceBatches.resize(numValidBatches);
+		if (numValidBatches == 0)
+			return;
+
+		// Move the batched elements into the instanced element list, keeping only the first element of each batch in the
+		// sorted list. Pass application needs to be re-evaluated since the elements before the kept ones might have moved.
+		mInstancedElements.resize(numInstanced);
+
+		UINT32 numKept = 0;
+		UINT32 prevShaderId = (UINT32)-1;
+		UINT32 prevPassIdx = (UINT32)-1;
+		bool prevInstanced = false;
+		for (UINT32 i = 0; i < numSorted; i++)
+		{
+			RenderQueueElement sortedElem = mSortedRenderElements[i];
+			const SortedElementInfo& info = mSortedElementInfos[i];
+
+			UINT32 batchIdx = mElementBatchIds[i] != (UINT32)-1 ? mBatchRemap[mElementBatchIds[i]] : (UINT32)-1;
+			bool instanced = batchIdx != (UINT32)-1;
+			if (instanced)
+			{
+				RenderQueueInstanceBatch& batch = mInstanceBatches[batchIdx];
+				mInstancedElements[batch.firstElement + batch.numElements] = sortedElem.renderElem;
+				batch.numElements++;
+
+				if (batch.numElements > 1)
+					continue;
+
+				sortedElem.instanceBatchIdx = batchIdx;
+			}
+
+			// Instanced draws use a different technique, so they always require the pass to be applied, as does the first
+			// draw following them
+			if (instanced || prevInstanced)
+				sortedElem.applyPass = true;
+			else if (!sortedElem.applyPass)
+				sortedElem.applyPass = prevShaderId != info.shaderId || prevPassIdx != sortedElem.passIdx;
+
+			prevShaderId = info.shaderId;
+			prevPassIdx = sortedElem.passIdx;
+			prevInstanced = instanced;
+
+			mSortedRenderElements[numKept] = sortedElem;
+			mSortedElementInfos[numKept] = info;
+			numKept++;
+		}
+
+		mSortedRenderElements.resize(numKept);
+		mSortedElementInfos.resize(numKept);
+	}
+
+	size_t RenderQueue::InstanceBatchKeyHash::operator()(const InstanceBatchKey& key) const
+	{
+		size_t hash = 0;
+		bs::hash_combine(hash, key.mesh);
+		bs::hash_combine(hash, key.indexOffset);
+		bs::hash_combine(hash, key.indexCount);
+		bs::hash_combine(hash, key.material);
+		bs::hash_combine(hash, key.passIdx);
+
+		return hash;
 	}
 
 	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
@@ -26,12 +26,28 @@ namespace bs { namespace ct
 	struct BS_EXPORT RenderQueueElement
 	{
 		RenderQueueElement()
-			:renderElem(nullptr), passIdx(0), applyPass(true)
+			:renderElem(nullptr), passIdx(0), applyPass(true), instanceBatchIdx((UINT32)-1)
 		{ }
 
 		RenderableElement* renderElem;
 		UINT32 passIdx;
 		bool applyPass;
+
+		/** 
+		 * Index of the instance batch (as returned by RenderQueue::getInstanceBatches()) to render in place of this element,
+		 * or -1 if the element should be rendered on its own. When valid, @p renderElem is the first element of the batch.
+		 */
+		UINT32 instanceBatchIdx;
+	};
+
+	/** Set of elements sharing the same mesh, material and pass that can be rendered using a single instanced draw call. */
+	struct BS_EXPORT RenderQueueInstanceBatch
+	{
+		/** Index of the first element of the batch, in the array returned by RenderQueue::getInstancedElements(). */
+		UINT32 firstElement;
+
+		/** Number of elements (instances) in the batch. */
+		UINT32 numElements;
 	};
 
 	/**
@@ -51,6 +67,35 @@ namespace bs { namespace ct
 			UINT32 passIdx;
 		};
 
+		/** Information about an entry in the sorted element list, used for merging elements into instance batches. */
+		struct SortedElementInfo
+		{
+			UINT32 elementIdx;
+			UINT32 shaderId;
+		};
+
+		/** Key that uniquely identifies a set of elements that can be merged into a single instanced draw call. */
+		struct InstanceBatchKey
+		{
+			bool operator== (const InstanceBatchKey& rhs) const
+			{
+				return mesh == rhs.mesh && indexOffset == rhs.indexOffset && indexCount == rhs.indexCount && 
+					material == rhs.material && passIdx == rhs.passIdx;
+			}
+
+			const void* mesh;
+			UINT32 indexOffset;
+			UINT32 indexCount;
+			const void* material;
+			UINT32 passIdx;
+		};
+
+		/** Calculates a hash value for an InstanceBatchKey. */
+		struct InstanceBatchKeyHash
+		{
+			size_t operator()(const InstanceBatchKey& key) const;
+		};
+
 	public:
 		RenderQueue(StateReduction grouping = StateReduction::Distance);
 		virtual ~RenderQueue() { }
@@ -60,8 +105,13 @@ namespace bs { namespace ct
 		 *
 		 * @param[in]	element			Renderable element to add to the queue.
 		 * @param[in]	distFromCamera	Distance of this object from the camera. Used for distance sorting.
+		 * @param[in]	instanceable	If true the element may be merged with other instanceable elements using the same
+		 *								mesh, material and pass, into an instanced draw call. Elements don't need to be
+		 *								adjacent in the sorted queue to be merged. Caller is responsible for ensuring such
+		 *								elements can be rendered using instancing, and that they don't depend on draw order
+		 *								(e.g. opaque elements).
 		 */
-		void add(RenderableElement* element, float distFromCamera);
+		void add(RenderableElement* element, float distFromCamera, bool instanceable = false);
 
 		/**	Clears all render operations from the queue. */
 		void clear();
@@ -72,6 +122,18 @@ namespace bs { namespace ct
 		/** Returns a list of sorted render elements. Caller must ensure sort() is called before this method. */
 		const Vector<RenderQueueElement>& getSortedElements() const;
 
+		/** 
+		 * Returns a list of instance batches referenced by the sorted render elements. Caller must ensure sort() is called 
+		 * before this method.
+		 */
+		const Vector<RenderQueueInstanceBatch>& getInstanceBatches() const { return mInstanceBatches; }
+
+		/** 
+		 * Returns a list of all elements that are part of an instance batch, with elements of a single batch laid out
+		 * sequentially. Caller must ensure sort() is called before this method.
+		 */
+		const Vector<RenderableElement*>& getInstancedElements() const { return mInstancedElements; }
+
 		/**
 		 * Controls if and how a render queue groups renderable objects by material in order to reduce number of state 
 		 * changes.
@@ -88,12 +150,29 @@ namespace bs { namespace ct
 		/**	Callback used for sorting elements with material grouping after sorting. */
 		static bool elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
+		/** 
+		 * Merges sorted elements marked as instanceable into instance batches. Elements are grouped by their mesh,
+		 * material and pass across the entire queue, not only within runs of consecutive entries. Each batch is rendered
+		 * in place of its first element, while the remaining elements of the batch are removed from the sorted element
+		 * list. This means batched elements can be drawn earlier than their sorted position.
+		 */
+		void batchInstances();
+
 		Vector<SortableElement> mSortableElements;
 		Vector<UINT32> mSortableElementIdx;
 		Vector<RenderableElement*> mElements;
+		Vector<bool> mInstanceable;
+		UINT32 mNumInstanceable = 0;
 
 		Vector<RenderQueueElement> mSortedRenderElements;
+		Vector<SortedElementInfo> mSortedElementInfos;
 		StateReduction mStateReductionMode;
+
+		Vector<RenderQueueInstanceBatch> mInstanceBatches;
+		Vector<RenderableElement*> mInstancedElements;
+		UnorderedMap<InstanceBatchKey, UINT32, InstanceBatchKeyHash> mInstanceBatchLookup;
+		Vector<UINT32> mElementBatchIds;
+		Vector<UINT32> mBatchRemap;
 	};
 
 	/** @} */
@@ -180,12 +180,13 @@ namespace bs { namespace ct
 		draw(mesh, mesh->getProperties().getSubMesh(0), numInstances);
 	}
 
-	void RendererUtility::draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances)
+	void RendererUtility::draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 		SPtr<VertexData> vertexData = mesh->getVertexData();
 
-		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration);
+		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration, commandBuffer);
 
 		auto& vertexBuffers = vertexData->getBuffers();
 		if (vertexBuffers.size() > 0)
@@ -208,29 +209,30 @@ namespace bs { namespace ct
 				buffers[iter->first - startSlot] = iter->second;
 			}
 
-			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1);
+			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1, commandBuffer);
 		}
 
 		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
-		rapi.setIndexBuffer(indexBuffer);
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
 
-		rapi.setDrawOperation(subMesh.drawOp);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
 
 		UINT32 indexCount = subMesh.indexCount;
 		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(), 
-			vertexData->vertexCount, numInstances);
+			vertexData->vertexCount, numInstances, commandBuffer);
 
 		mesh->_notifyUsedOnGPU();
 	}
 
 	void RendererUtility::drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
-		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration)
+		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		// Bind buffers and draw
 		RenderAPI& rapi = RenderAPI::instance();
 
 		SPtr<VertexData> vertexData = mesh->getVertexData();
-		rapi.setVertexDeclaration(morphVertexDeclaration);
+		rapi.setVertexDeclaration(morphVertexDeclaration, commandBuffer);
 
 		auto& meshBuffers = vertexData->getBuffers();
 		SPtr<VertexBuffer> allBuffers[BS_MAX_BOUND_VERTEX_BUFFERS];
@@ -253,16 +255,16 @@ namespace bs { namespace ct
 			allBuffers[iter->first - startSlot] = iter->second;
 
 		allBuffers[1] = morphVertices;
-		rapi.setVertexBuffers(startSlot, allBuffers, endSlot - startSlot + 1);
+		rapi.setVertexBuffers(startSlot, allBuffers, endSlot - startSlot + 1, commandBuffer);
 
 		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
-		rapi.setIndexBuffer(indexBuffer);
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
 
-		rapi.setDrawOperation(subMesh.drawOp);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
 
 		UINT32 indexCount = subMesh.indexCount;
 		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(),
-			vertexData->vertexCount, 1);
+			vertexData->vertexCount, 1, commandBuffer);
 
 		mesh->_notifyUsedOnGPU();
 	}
@@ -408,7 +410,12 @@ namespace bs { namespace ct
 			}
 		}
 		else
-			return get(getVariation<1, true>());
+		{
+			if(isColor)
+				return get(getVariation<1, true>());
+			else
+				return get(getVariation<1, false>());
+		}
 	}
 
 	ClearParamDef gClearParamDef;
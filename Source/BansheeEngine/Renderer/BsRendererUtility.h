@@ -131,10 +131,15 @@ namespace bs { namespace ct
 		 * @param[in]	mesh			Mesh to draw.
 		 * @param[in]	subMesh			Portion of the mesh to draw.
 		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operations on. If not provided operations
+		 *								are executed immediately. Otherwise they are executed when the command buffer is
+		 *								submitted.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, or any thread if a command buffer is provided and the render API supports multi-threaded
+		 *			command buffer recording.
 		 */
-		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1);
+		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh with an additional vertex buffer containing morph shape vertices.
@@ -145,11 +150,15 @@ namespace bs { namespace ct
 		 *										Expected to contain the same number of vertices as the source mesh.
 		 * @param[in]	morphVertexDeclaration	Vertex declaration describing vertices of the provided mesh and the vertices
 		 *										provided in the morph vertex buffer.
+		 * @param[in]	commandBuffer			Optional command buffer to queue the operations on. If not provided 
+		 *										operations are executed immediately. Otherwise they are executed when the
+		 *										command buffer is submitted.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, or any thread if a command buffer is provided and the render API supports multi-threaded
+		 *			command buffer recording.
 		 */
 		void drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& morphVertices, 
-			const SPtr<VertexDeclaration>& morphVertexDeclaration);
+			const SPtr<VertexDeclaration>& morphVertexDeclaration, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Blits contents of the provided texture into the currently bound render target. If the provided texture contains
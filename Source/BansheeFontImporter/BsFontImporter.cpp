@@ -1,12 +1,15 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFontImporter.h"
+#include "BsFreeTypeFontRasterizer.h"
 #include "Text/BsFontImportOptions.h"
 #include "Image/BsPixelData.h"
 #include "Image/BsTexture.h"
 #include "Image/BsTextureAtlasLayout.h"
 #include "BsCoreApplication.h"
 #include "CoreThread/BsCoreThread.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 #include <ft2build.h>
 #include <freetype/freetype.h>
@@ -51,6 +54,29 @@ namespace bs
 	{
 		const FontImportOptions* fontImportOptions = static_cast<const FontImportOptions*>(importOptions.get());
 
+		// Dynamic fonts keep the font file and rasterize characters at runtime, so no rendering is done during import
+		if (fontImportOptions->getDynamic())
+		{
+			SPtr<DataStream> fileStream = FileSystem::openFile(filePath);
+			if (fileStream == nullptr)
+				BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ".");
+
+			SPtr<MemoryDataStream> fontFile = bs_shared_ptr_new<MemoryDataStream>(fileStream);
+
+			DYNAMIC_FONT_DESC desc;
+			desc.dpi = fontImportOptions->getDPI();
+			desc.renderMode = fontImportOptions->getRenderMode();
+
+			SPtr<Font> newFont = Font::_createDynamicPtr(fontFile, desc);
+			if (!newFont->isDynamic())
+				BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ". Unsupported file format.");
+
+			WString fileName = filePath.getWFilename(false);
+			newFont->setName(fileName);
+
+			return newFont;
+		}
+
 		FT_Library library;
 
 		FT_Error error = FT_Init_FreeType(&library);
@@ -73,25 +99,7 @@ namespace bs
 		Vector<UINT32> fontSizes = fontImportOptions->getFontSizes();
 		UINT32 dpi = fontImportOptions->getDPI();
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->getRenderMode())
-		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
-		}
+		FT_Int32 loadFlags = FreeTypeFontRasterizer::getLoadFlags(fontImportOptions->getRenderMode());
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "Importer/BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeFontRasterizer.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -19,6 +21,9 @@ namespace bs
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		// Allows dynamic fonts to rasterize characters at runtime
+		FontManager::instance()._setRasterizerFactory(&FreeTypeFontRasterizer::create);
+
 		return nullptr;
 	}
 }
\ No newline at end of file
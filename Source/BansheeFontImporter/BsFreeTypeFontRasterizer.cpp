@@ -0,0 +1,200 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFreeTypeFontRasterizer.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	FreeTypeFontRasterizer::FreeTypeFontRasterizer(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc)
+		:mFontFile(fontFile), mLoadFlags(getLoadFlags(desc.renderMode)), mDPI(desc.dpi)
+	{
+		if (FT_Init_FreeType(&mLibrary))
+		{
+			LOGERR("Error occurred during FreeType library initialization.");
+			mLibrary = nullptr;
+			return;
+		}
+
+		FT_Error error = FT_New_Memory_Face(mLibrary, (const FT_Byte*)mFontFile->getPtr(), (FT_Long)mFontFile->size(),
+			0, &mFace);
+
+		if (error == FT_Err_Unknown_File_Format)
+		{
+			LOGERR("Failed to load a dynamic font. Unsupported file format.");
+			mFace = nullptr;
+		}
+		else if (error)
+		{
+			LOGERR("Failed to load a dynamic font. Unknown error.");
+			mFace = nullptr;
+		}
+	}
+
+	FreeTypeFontRasterizer::~FreeTypeFontRasterizer()
+	{
+		if (mFace != nullptr)
+			FT_Done_Face(mFace);
+
+		if (mLibrary != nullptr)
+			FT_Done_FreeType(mLibrary);
+	}
+
+	bool FreeTypeFontRasterizer::getMetrics(UINT32 size, FontSizeMetrics& output)
+	{
+		if (!setSize(size))
+			return false;
+
+		output.baselineOffset = (INT32)(mFace->size->metrics.ascender >> 6);
+		output.lineHeight = (UINT32)(mFace->size->metrics.height >> 6);
+
+		if (FT_Load_Char(mFace, 32, mLoadFlags))
+			output.spaceWidth = 0;
+		else
+			output.spaceWidth = (UINT32)(mFace->glyph->advance.x >> 6);
+
+		return true;
+	}
+
+	bool FreeTypeFontRasterizer::rasterize(UINT32 size, UINT32 charId, RasterizedGlyph& output)
+	{
+		if (!setSize(size))
+			return false;
+
+		FT_UInt glyphIdx = 0;
+		if (charId != MISSING_GLYPH_ID)
+		{
+			glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+
+			// Character not present in the font
+			if (glyphIdx == 0)
+				return false;
+		}
+
+		if (FT_Load_Glyph(mFace, glyphIdx, mLoadFlags))
+			return false;
+
+		if (FT_Render_Glyph(mFace->glyph, FT_LOAD_TARGET_MODE(mLoadFlags)))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+
+		output.width = (UINT32)slot->bitmap.width;
+		output.height = (UINT32)slot->bitmap.rows;
+		output.xOffset = slot->bitmap_left;
+		output.yOffset = slot->bitmap_top;
+		output.xAdvance = (INT32)(slot->advance.x >> 6);
+		output.yAdvance = (INT32)(slot->advance.y >> 6);
+		output.pixels.resize(output.width * output.height);
+
+		if (output.width == 0 || output.height == 0)
+			return true;
+
+		if (slot->bitmap.buffer == nullptr)
+			return false;
+
+		const UINT8* sourceBuffer = slot->bitmap.buffer;
+		UINT8* dstBuffer = output.pixels.data();
+
+		if (slot->bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for (UINT32 bitmapRow = 0; bitmapRow < output.height; bitmapRow++)
+			{
+				memcpy(dstBuffer, sourceBuffer, output.width);
+
+				dstBuffer += output.width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (slot->bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for (UINT32 bitmapRow = 0; bitmapRow < output.height; bitmapRow++)
+			{
+				for (UINT32 bitmapColumn = 0; bitmapColumn < output.width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					dstBuffer[bitmapColumn] = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+				}
+
+				dstBuffer += output.width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else
+		{
+			LOGERR("Unsupported pixel mode for a FreeType bitmap.");
+			return false;
+		}
+
+		return true;
+	}
+
+	INT32 FreeTypeFontRasterizer::getKerning(UINT32 size, UINT32 first, UINT32 second)
+	{
+		if (!hasKerning() || !setSize(size))
+			return 0;
+
+		FT_UInt firstGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)first);
+		FT_UInt secondGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)second);
+
+		if (firstGlyphIdx == 0 || secondGlyphIdx == 0)
+			return 0;
+
+		FT_Vector kerning;
+		if (FT_Get_Kerning(mFace, firstGlyphIdx, secondGlyphIdx, FT_KERNING_DEFAULT, &kerning))
+			return 0;
+
+		return (INT32)(kerning.x >> 6); // Y kerning is ignored because it is so rare
+	}
+
+	bool FreeTypeFontRasterizer::hasKerning() const
+	{
+		return mFace != nullptr && FT_HAS_KERNING(mFace);
+	}
+
+	bool FreeTypeFontRasterizer::setSize(UINT32 size)
+	{
+		if (mFace == nullptr)
+			return false;
+
+		if (mCurrentSize == size)
+			return true;
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+		if (FT_Set_Char_Size(mFace, ftSize, 0, mDPI, mDPI))
+		{
+			LOGERR("Could not set character size: " + toString(size));
+			return false;
+		}
+
+		mCurrentSize = size;
+		return true;
+	}
+
+	FT_Int32 FreeTypeFontRasterizer::getLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+
+	SPtr<FontRasterizer> FreeTypeFontRasterizer::create(const SPtr<MemoryDataStream>& fontFile,
+		const DYNAMIC_FONT_DESC& desc)
+	{
+		SPtr<FreeTypeFontRasterizer> rasterizer = bs_shared_ptr_new<FreeTypeFontRasterizer>(fontFile, desc);
+		if (rasterizer->mFace == nullptr)
+			return nullptr;
+
+		return rasterizer;
+	}
+}
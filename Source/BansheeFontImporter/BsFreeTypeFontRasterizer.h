@@ -0,0 +1,58 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "Text/BsFontRasterizer.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace bs
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Font rasterizer implementation that renders characters of dynamic fonts by using the FreeType library. */
+	class FreeTypeFontRasterizer : public FontRasterizer
+	{
+	public:
+		FreeTypeFontRasterizer(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc);
+		~FreeTypeFontRasterizer();
+
+		/** @copydoc FontRasterizer::getMetrics */
+		bool getMetrics(UINT32 size, FontSizeMetrics& output) override;
+
+		/** @copydoc FontRasterizer::rasterize */
+		bool rasterize(UINT32 size, UINT32 charId, RasterizedGlyph& output) override;
+
+		/** @copydoc FontRasterizer::getKerning */
+		INT32 getKerning(UINT32 size, UINT32 first, UINT32 second) override;
+
+		/** @copydoc FontRasterizer::hasKerning */
+		bool hasKerning() const override;
+
+		/** Returns FreeType glyph load flags corresponding to the provided render mode. */
+		static FT_Int32 getLoadFlags(FontRenderMode renderMode);
+
+		/**
+		 * Creates a new rasterizer for the provided font file. Returns null if the file isn't a font format supported by
+		 * FreeType.
+		 */
+		static SPtr<FontRasterizer> create(const SPtr<MemoryDataStream>& fontFile, const DYNAMIC_FONT_DESC& desc);
+
+	private:
+		/** Changes the size of the characters rendered by the face, if different from the current size. */
+		bool setSize(UINT32 size);
+
+		SPtr<MemoryDataStream> mFontFile; // Referenced by the face, so it must outlive it
+		FT_Library mLibrary = nullptr;
+		FT_Face mFace = nullptr;
+		FT_Int32 mLoadFlags;
+		UINT32 mDPI;
+		UINT32 mCurrentSize = 0;
+	};
+
+	/** @} */
+}
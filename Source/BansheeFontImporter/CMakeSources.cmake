@@ -1,11 +1,13 @@
 set(BS_BANSHEEFONTIMPORTER_INC_NOFILTER
 	"BsFontPrerequisites.h"
 	"BsFontImporter.h"
+	"BsFreeTypeFontRasterizer.h"
 )
 
 set(BS_BANSHEEFONTIMPORTER_SRC_NOFILTER
 	"BsFontPlugin.cpp"
 	"BsFontImporter.cpp"
+	"BsFreeTypeFontRasterizer.cpp"
 )
 
 source_group("Header Files" FILES ${BS_BANSHEEFONTIMPORTER_INC_NOFILTER})
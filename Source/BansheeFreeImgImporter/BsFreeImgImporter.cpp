@@ -16,11 +16,44 @@
 #include "FreeImage.h"
 #include "Utility/BsBitwise.h"
 #include "Renderer/BsRenderer.h"
+#include "Threading/BsTaskScheduler.h"
 
 using namespace std::placeholders;
 
 namespace bs
 {
+	/** 
+	 * Calls @p func once for each face in range [0, @p numFaces). Faces are processed in parallel if the task scheduler
+	 * is running.
+	 */
+	void processFaces(UINT32 numFaces, const std::function<void(UINT32)>& func)
+	{
+		if (numFaces <= 1 || !TaskScheduler::isStarted())
+		{
+			for (UINT32 i = 0; i < numFaces; i++)
+				func(i);
+
+			return;
+		}
+
+		Vector<SPtr<Task>> tasks;
+		tasks.reserve(numFaces - 1);
+
+		// First face gets processed on this thread
+		for (UINT32 i = 1; i < numFaces; i++)
+		{
+			SPtr<Task> task = Task::create("ProcessTextureFace", std::bind(func, i));
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		func(0);
+
+		for (auto& entry : tasks)
+			entry->wait();
+	}
+
 	void FreeImageLoadErrorHandler(FREE_IMAGE_FORMAT fif, const char *message) 
 	{
 		// Callback method as required by FreeImage to report problems
@@ -194,26 +227,57 @@ namespace bs
 		SPtr<Texture> newTexture = Texture::_createPtr(texDesc);
 
 		UINT32 numFaces = (UINT32)faceData.size();
+
+		// Faces sharing the same source data (e.g. a cubemap generated from a single image) reuse the same mip levels
+		Vector<UINT32> uniqueFaces;
+		Vector<UINT32> faceSources(numFaces);
 		for (UINT32 i = 0; i < numFaces; i++)
 		{
+			faceSources[i] = i;
+			for (auto& entry : uniqueFaces)
+			{
+				if (faceData[entry] == faceData[i])
+				{
+					faceSources[i] = entry;
+					break;
+				}
+			}
+
+			if (faceSources[i] == i)
+				uniqueFaces.push_back(i);
+		}
+
+		// Generate mip levels and convert them to the texture format in parallel, but write them from this thread
+		Vector<Vector<SPtr<PixelData>>> faceMipLevels(numFaces);
+		processFaces((UINT32)uniqueFaces.size(), [&](UINT32 idx)
+		{
+			UINT32 faceIdx = uniqueFaces[idx];
+
 			Vector<SPtr<PixelData>> mipLevels;
 			if (numMips > 0)
 			{
 				MipMapGenOptions mipOptions;
 				mipOptions.isSRGB = sRGB;
 
-				mipLevels = PixelUtil::genMipmaps(*faceData[i], mipOptions);
+				mipLevels = PixelUtil::genMipmaps(*faceData[faceIdx], mipOptions);
 			}
 			else
-				mipLevels.push_back(faceData[i]);
+				mipLevels.push_back(faceData[faceIdx]);
 
 			for (UINT32 mip = 0; mip < (UINT32)mipLevels.size(); ++mip)
 			{
 				SPtr<PixelData> dst = newTexture->getProperties().allocBuffer(0, mip);
-
 				PixelUtil::bulkPixelConversion(*mipLevels[mip], *dst);
-				newTexture->writeData(dst, i, mip);
+
+				faceMipLevels[faceIdx].push_back(dst);
 			}
+		});
+
+		for (UINT32 i = 0; i < numFaces; i++)
+		{
+			const Vector<SPtr<PixelData>>& mipLevels = faceMipLevels[faceSources[i]];
+			for (UINT32 mip = 0; mip < (UINT32)mipLevels.size(); ++mip)
+				newTexture->writeData(mipLevels[mip], i, mip);
 		}
 
 		fileData->close();
@@ -437,19 +501,18 @@ namespace bs
 	 */
 	void readCubemapList(const SPtr<PixelData>& source, std::array<SPtr<PixelData>, 6>& output, UINT32 faceSize, bool vertical)
 	{
-		Vector2I faceStart;
-		for(UINT32 i = 0; i < 6; i++)
+		processFaces(6, [&](UINT32 i)
 		{
 			output[i] = PixelData::create(faceSize, faceSize, 1, source->getFormat());
 
+			Vector2I faceStart;
 			if (vertical)
-				faceStart.y += faceSize;
+				faceStart.y = i * faceSize;
 			else
-				faceStart.x += faceSize;
+				faceStart.x = i * faceSize;
 
-			PixelVolume volume(faceStart.x, faceStart.y, faceStart.x + faceSize, faceStart.y + faceSize);
 			PixelUtil::copy(*source, *output[i], faceStart.x, faceStart.y);
-		}
+		});
 	}
 
 	/** 
@@ -480,20 +543,19 @@ namespace bs
 		const UINT32* faceIndices = vertical ? vertFaceIndices : horzFaceIndices;
 		UINT32 numFacesInRow = vertical ? 3 : 4;
 
-		for (UINT32 i = 0; i < 6; i++)
+		processFaces(6, [&](UINT32 i)
 		{
 			output[i] = PixelData::create(faceSize, faceSize, 1, source->getFormat());
 
 			UINT32 faceX = (faceIndices[i] % numFacesInRow) * faceSize;
 			UINT32 faceY = (faceIndices[i] / numFacesInRow) * faceSize;
 
-			PixelVolume volume(faceX, faceY, faceX + faceSize, faceY + faceSize);
 			PixelUtil::copy(*source, *output[i], faceX, faceY);
-		}
 
-		// Flip -Z as it's upside down
-		if (vertical)
-			PixelUtil::mirror(*output[5], MirrorModeBits::X | MirrorModeBits::Y);
+			// Flip -Z as it's upside down
+			if (vertical && i == 5)
+				PixelUtil::mirror(*output[i], MirrorModeBits::X | MirrorModeBits::Y);
+		});
 	}
 
 	/** Method that maps a direction to a point on a plane in range [0, 1] using spherical mapping. */
@@ -528,11 +590,11 @@ namespace bs
 	/** Resizes the provided cubemap faces and outputs a new set of resized faces. */
 	void downsampleCubemap(const std::array<SPtr<PixelData>, 6>& input, std::array<SPtr<PixelData>, 6>& output, UINT32 size)
 	{
-		for(UINT32 i = 0; i < 6; i++)
+		processFaces(6, [&](UINT32 i)
 		{
 			output[i] = PixelData::create(size, size, 1, input[i]->getFormat());
 			PixelUtil::scale(*input[i], *output[i]);
-		}
+		});
 	}
 
 	/** 
@@ -565,7 +627,7 @@ namespace bs
 		};
 
 		float invSize = 1.0f / faceSize;
-		for (UINT32 faceIdx = 0; faceIdx < 6; faceIdx++)
+		processFaces(6, [&](UINT32 faceIdx)
 		{
 			output[faceIdx] = PixelData::create(faceSize, faceSize, 1, source->getFormat());
 
@@ -594,7 +656,7 @@ namespace bs
 					output[faceIdx]->setColorAt(color, x, y);
 				}
 			}
-		}
+		});
 	}
 
 	bool FreeImgImporter::generateCubemap(const SPtr<PixelData>& source, CubemapSourceType sourceType,
@@ -257,6 +257,9 @@ namespace bs { namespace ct
 	void GLRenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setGraphicsPipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<GraphicsPipelineState>& pipelineState)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -373,6 +376,9 @@ namespace bs { namespace ct
 	void GLRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setComputePipeline(pipelineState))
+			return;
+
 		auto executeRef = [&](const SPtr<ComputePipelineState>& pipelineState)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -402,6 +408,7 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		// Note: Not using the state cache here, as texture and buffer uploads modify the same bindings behind its back
 		auto executeRef = [&](const SPtr<GpuParams>& gpuParams)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -925,13 +932,28 @@ namespace bs { namespace ct
 						}
 						else
 						{
-							const GLGpuParamBlockBuffer* glParamBlockBuffer = static_cast<const GLGpuParamBlockBuffer*>(buffer.get());
-
 							UINT32 unit = getUniformUnit(binding - 1);
 							glUniformBlockBinding(glProgram, binding - 1, unit);
 							BS_CHECK_GL_ERROR();
 
-							glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle());
+							// Views bind a range of their parent's buffer
+							const SPtr<GpuParamBlockBuffer>& parent = buffer->getParent();
+							if (parent != nullptr)
+							{
+								const GLGpuParamBlockBuffer* glParamBlockBuffer = 
+									static_cast<const GLGpuParamBlockBuffer*>(parent.get());
+
+								glBindBufferRange(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle(),
+									(GLintptr)buffer->getOffset(), (GLsizeiptr)buffer->getSize());
+							}
+							else
+							{
+								const GLGpuParamBlockBuffer* glParamBlockBuffer = 
+									static_cast<const GLGpuParamBlockBuffer*>(buffer.get());
+
+								glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle());
+							}
+
 							BS_CHECK_GL_ERROR();
 						}
 					}
@@ -1050,6 +1072,10 @@ namespace bs { namespace ct
 			applyViewport();
 		};
 
+		// Window targets might switch the active context, and state is tracked per-context
+		if (target != nullptr && target->getProperties().isWindow)
+			getStateCache(commandBuffer).reset();
+
 		if (commandBuffer == nullptr)
 			executeRef(target, readOnlyFlags);
 		else
@@ -1076,6 +1102,9 @@ namespace bs { namespace ct
 		}
 #endif
 
+		if (!getStateCache(commandBuffer).setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		auto executeRef = [&](UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1092,7 +1121,9 @@ namespace bs { namespace ct
 			executeRef(index, buffers, numBuffers);
 		else
 		{
-			auto execute = [=]() { executeRef(index, buffers, numBuffers); };
+			// Buffer array is owned by the caller, so keep a copy around until the command executes
+			Vector<SPtr<VertexBuffer>> bufferCopy(buffers, buffers + numBuffers);
+			auto execute = [=]() mutable { executeRef(index, bufferCopy.data(), numBuffers); };
 
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
@@ -1102,6 +1133,9 @@ namespace bs { namespace ct
 	void GLRenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setVertexDeclaration(vertexDeclaration))
+			return;
+
 		auto executeRef = [&](const SPtr<VertexDeclaration>& vertexDeclaration)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1122,6 +1156,9 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setDrawOperation(op))
+			return;
+
 		auto executeRef = [&](DrawOperationType op)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1144,6 +1181,9 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getStateCache(commandBuffer).setIndexBuffer(buffer))
+			return;
+
 		auto executeRef = [&](const SPtr<IndexBuffer>& buffer)
 		{
 			THROW_IF_NOT_CORE_THREAD;
@@ -1409,6 +1449,9 @@ namespace bs { namespace ct
 			mCurrentContext->setCurrent(*window);
 
 		target->swapBuffers();
+
+		// State is tracked per-context
+		mStateCache.reset();
 	
 		BS_INC_RENDER_STAT(NumPresents);
 	}
@@ -1419,6 +1462,9 @@ namespace bs { namespace ct
 		SPtr<GLCommandBuffer> secondaryCb = std::static_pointer_cast<GLCommandBuffer>(secondary);
 
 		cb->appendSecondary(secondaryCb);
+
+		// State bound by the secondary buffer is unknown to the primary buffer
+		cb->_getStateCache().reset();
 	}
 
 	void GLRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
@@ -1429,6 +1475,10 @@ namespace bs { namespace ct
 
 		cb->executeCommands();
 		cb->clear();
+
+		// Executed commands could have changed the immediate state, and the command buffer will start fresh
+		cb->_getStateCache().reset();
+		mStateCache.reset();
 	}
 
 	void GLRenderAPI::clearArea(UINT32 buffers, const Color& color, float depth, UINT16 stencil, const Rect2I& clearRect, 
@@ -2771,6 +2821,10 @@ namespace bs { namespace ct
 		featureFlags |= RenderAPIFeatureFlag::LoadStore;
 #endif
 
+		// Views are bound through glBindBufferRange. The spec caps GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT at 256 bytes, so
+		// view offsets are always valid.
+		featureFlags |= RenderAPIFeatureFlag::ParamBlockViews;
+
 		static RenderAPIInfo info(0.0f, 0.0f, -1.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
 								  
 		return info;
@@ -0,0 +1,48 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullCommandBuffer.h"
+#include "Error/BsException.h"
+
+namespace bs { namespace ct
+{
+	NullCommandBuffer::NullCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary)
+		: CommandBuffer(type, deviceIdx, queueIdx, secondary), mActiveDrawOp(DOT_TRIANGLE_LIST)
+	{
+		if (deviceIdx != 0)
+			BS_EXCEPT(InvalidParametersException, "Only a single device supported on the null render API.");
+	}
+
+	void NullCommandBuffer::appendSecondary(const SPtr<NullCommandBuffer>& secondaryBuffer)
+	{
+#if BS_DEBUG_MODE
+		if (!secondaryBuffer->mIsSecondary)
+		{
+			LOGERR("Cannot append a command buffer that is not secondary.");
+			return;
+		}
+
+		if (mIsSecondary)
+		{
+			LOGERR("Cannot append a buffer to a secondary command buffer.");
+			return;
+		}
+#endif
+
+		mCommands.insert(mCommands.end(), secondaryBuffer->mCommands.begin(), secondaryBuffer->mCommands.end());
+	}
+
+	const Vector<NullCommand>& NullCommandBuffer::getCommands() const
+	{
+#if BS_DEBUG_MODE
+		if (mIsSecondary)
+			LOGERR("Cannot execute commands on a secondary buffer.");
+#endif
+
+		return mCommands;
+	}
+
+	void NullCommandBuffer::clear()
+	{
+		mCommands.clear();
+	}
+}}
@@ -0,0 +1,56 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsNullCommandStats.h"
+#include "RenderAPI/BsCommandBuffer.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Single command recorded by the null render API. */
+	struct NullCommand
+	{
+		NullCommandType type;
+		UINT32 elementCount; /**< Number of vertices or indices, for draw calls. */
+		UINT32 primitiveCount; /**< Number of primitives, for draw calls. */
+		UINT32 instanceCount; /**< Number of instances, for draw calls. */
+		UINT64 hash; /**< Hash of the command parameters, or zero if hashing is disabled. */
+	};
+
+	/**
+	 * Command buffer implementation for the null render API. Commands are stored in an internal buffer and are only
+	 * accounted for when the buffer is submitted.
+	 */
+	class NullCommandBuffer : public CommandBuffer
+	{
+	public:
+		/** Registers a new command in the command buffer. */
+		void queueCommand(const NullCommand& command) { mCommands.push_back(command); }
+
+		/** Appends all commands from the secondary buffer into this command buffer. */
+		void appendSecondary(const SPtr<NullCommandBuffer>& secondaryBuffer);
+
+		/** Returns all commands currently recorded in the buffer. Not supported on secondary buffers. */
+		const Vector<NullCommand>& getCommands() const;
+
+		/** Removes all commands from the command buffer. */
+		void clear();
+
+	private:
+		friend class NullCommandBufferManager;
+		friend class NullRenderAPI;
+
+		NullCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
+
+		Vector<NullCommand> mCommands;
+
+		DrawOperationType mActiveDrawOp;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,80 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** Types of commands recorded by the null render API. */
+	enum class NullCommandType
+	{
+		SetGraphicsPipeline,
+		SetComputePipeline,
+		SetGpuParams,
+		SetViewport,
+		SetScissorRect,
+		SetStencilRef,
+		SetVertexBuffers,
+		SetIndexBuffer,
+		SetVertexDeclaration,
+		SetDrawOperation,
+		SetRenderTarget,
+		ClearRenderTarget,
+		ClearViewport,
+		Draw,
+		DrawIndexed,
+		DispatchCompute,
+		SwapBuffers,
+		Count // Keep at end
+	};
+
+	/**
+	 * Statistics about commands executed by the null render API. Commands are counted when they are executed, meaning
+	 * immediately for commands without a command buffer, or when their command buffer is submitted otherwise.
+	 */
+	struct NullCommandStats
+	{
+		/** Number of executed commands, per command type. */
+		UINT64 numCommands[(UINT32)NullCommandType::Count] = { };
+
+		/** Total number of vertices submitted by non-indexed draw calls. */
+		UINT64 numVertices = 0;
+
+		/** Total number of indices submitted by indexed draw calls. */
+		UINT64 numIndices = 0;
+
+		/** Total number of instances submitted by draw calls. Non-instanced draw calls count as a single instance. */
+		UINT64 numInstances = 0;
+
+		/** Total number of primitives submitted by draw calls (not accounting for instancing). */
+		UINT64 numPrimitives = 0;
+
+		/** Number of command buffers submitted for execution. */
+		UINT64 numSubmittedCommandBuffers = 0;
+
+		/**
+		 * Hash of all the executed commands and their parameters, in execution order. Only calculated if hashing was
+		 * enabled. Resources are identified by the order in which they were first referenced since the last reset, so
+		 * the hash is stable across runs as long as the same commands are executed.
+		 */
+		UINT64 hash = 0;
+
+		/** Returns the number of executed commands of the specified type. */
+		UINT64 getNumCommands(NullCommandType type) const { return numCommands[(UINT32)type]; }
+	};
+
+	/**
+	 * Signatures of the functions exported by the null render API plugin, used for accessing the command statistics
+	 * without linking with the plugin. Retrieve them from the plugin library using DynLib::getSymbol(). Core thread only.
+	 */
+	typedef void(*GetNullCommandStatsFunc)(NullCommandStats&);	/**< "getNullCommandStats" */
+	typedef void(*ResetNullCommandStatsFunc)();					/**< "resetNullCommandStats" */
+	typedef void(*SetNullCommandHashingFunc)(bool);				/**< "setNullCommandHashing" */
+
+	/** @} */
+}}
@@ -0,0 +1,23 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullGpuParamBlockBuffer.h"
+
+namespace bs { namespace ct
+{
+	NullGpuParamBlockBuffer::NullGpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
+		:GpuParamBlockBuffer(size, usage, deviceMask)
+	{
+		mGPUData = (UINT8*)bs_alloc(mSize);
+		memset(mGPUData, 0, mSize);
+	}
+
+	NullGpuParamBlockBuffer::~NullGpuParamBlockBuffer()
+	{
+		bs_free(mGPUData);
+	}
+
+	void NullGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
+	{
+		memcpy(mGPUData, data, mSize);
+	}
+}}
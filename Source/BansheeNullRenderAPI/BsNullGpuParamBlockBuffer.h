@@ -0,0 +1,32 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** 
+	 * Null render API implementation of a parameter block buffer. Contents are copied into a separate system memory
+	 * buffer on upload, mirroring the copy a real render API would perform.
+	 */
+	class NullGpuParamBlockBuffer : public GpuParamBlockBuffer
+	{
+	public:
+		NullGpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask);
+		~NullGpuParamBlockBuffer();
+
+		/** @copydoc GpuParamBlockBuffer::writeToGPU */
+		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override;
+
+	private:
+		UINT8* mGPUData;
+	};
+
+	/** @} */
+}}
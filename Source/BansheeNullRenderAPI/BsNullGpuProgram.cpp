@@ -0,0 +1,43 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullGpuProgram.h"
+#include "BsNullHLSLParamParser.h"
+#include "Managers/BsHardwareBufferManager.h"
+#include "Profiling/BsRenderStats.h"
+
+namespace bs { namespace ct
+{
+	NullGpuProgram::NullGpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
+		:GpuProgram(desc, deviceMask)
+	{ }
+
+	NullGpuProgram::~NullGpuProgram()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuProgram);
+	}
+
+	void NullGpuProgram::initialize()
+	{
+		if (!isSupported())
+		{
+			mIsCompiled = false;
+			mCompileError = "Specified program is not supported by the current render system.";
+
+			GpuProgram::initialize();
+			return;
+		}
+
+		NullHLSLParamParser parser;
+		parser.parse(mProperties.getSource(), mProperties.getType(), *mParametersDesc);
+
+		// Vertex inputs are not reflected, an empty declaration is compatible with any vertex buffer layout
+		if (mProperties.getType() == GPT_VERTEX_PROGRAM)
+			mInputDeclaration = HardwareBufferManager::instance().createVertexDeclaration(List<VertexElement>());
+
+		mIsCompiled = true;
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuProgram);
+
+		GpuProgram::initialize();
+	}
+}}
@@ -0,0 +1,33 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsGpuProgram.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** 
+	 * GPU program that doesn't compile into anything. Its parameters are extracted directly from the HLSL source. Used 
+	 * for programs of all types. 
+	 */
+	class NullGpuProgram : public GpuProgram
+	{
+	public:
+		virtual ~NullGpuProgram();
+
+	protected:
+		friend class NullHLSLProgramFactory;
+
+		NullGpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask);
+
+		/** @copydoc GpuProgram::initialize */
+		void initialize() override;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,701 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHLSLParamParser.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Debug/BsDebug.h"
+
+namespace bs { namespace ct
+{
+	/** Returns true if the character can start an HLSL identifier. */
+	static bool isIdentifierStart(char c)
+	{
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+	}
+
+	/** Returns true if the character can be a part of an HLSL identifier or a number. */
+	static bool isIdentifierChar(char c)
+	{
+		return isIdentifierStart(c) || (c >= '0' && c <= '9');
+	}
+
+	void NullHLSLParamParser::parse(const String& source, GpuProgramType type, GpuParamDesc& desc)
+	{
+		mType = type;
+		mDesc = &desc;
+		mCurrentToken = 0;
+		mDefines.clear();
+		mStructSizes.clear();
+		mGlobals.clear();
+
+		for (UINT32 i = 0; i < (UINT32)ParamType::Count; i++)
+			mNextSlot[i] = 0;
+
+		tokenize(source);
+
+		while (mCurrentToken < (UINT32)mTokens.size())
+		{
+			const String& token = peek();
+
+			if (token == "[") // Attribute
+				skipBlock();
+			else if (token == ";" || token == "}" || token == ")" || token == "]")
+				next();
+			else if (token == "struct")
+				parseStruct();
+			else if (token == "cbuffer" || token == "tbuffer")
+				parseConstantBuffer();
+			else if (token == "typedef")
+			{
+				while (mCurrentToken < (UINT32)mTokens.size() && next() != ";")
+				{ }
+			}
+			else if (token == "static" || token == "groupshared")
+				parseGlobalDeclaration(true);
+			else
+				parseGlobalDeclaration(false);
+		}
+
+		// Global variables outside of any constant buffer end up in an implicit constant buffer
+		if (!mGlobals.empty())
+			addParamBlock("$Globals", mGlobals, -1, false);
+
+		mTokens.clear();
+		mDesc = nullptr;
+	}
+
+	void NullHLSLParamParser::tokenize(const String& source)
+	{
+		mTokens.clear();
+
+		UINT32 length = (UINT32)source.size();
+		bool lineStart = true;
+		UINT32 i = 0;
+		while (i < length)
+		{
+			char c = source[i];
+
+			if (c == '\n')
+			{
+				lineStart = true;
+				i++;
+				continue;
+			}
+
+			if (c == ' ' || c == '\t' || c == '\r')
+			{
+				i++;
+				continue;
+			}
+
+			// Comments
+			if (c == '/' && (i + 1) < length)
+			{
+				if (source[i + 1] == '/')
+				{
+					while (i < length && source[i] != '\n')
+						i++;
+
+					continue;
+				}
+
+				if (source[i + 1] == '*')
+				{
+					i += 2;
+					while ((i + 1) < length && !(source[i] == '*' && source[i + 1] == '/'))
+						i++;
+
+					i += 2;
+					continue;
+				}
+			}
+
+			// Preprocessor directives, only simple value defines are recorded
+			if (c == '#' && lineStart)
+			{
+				String directive;
+				i++;
+				while (i < length && source[i] != '\n')
+				{
+					if (source[i] == '\\' && (i + 1) < length && (source[i + 1] == '\n' || source[i + 1] == '\r'))
+					{
+						while (i < length && source[i] != '\n')
+							i++;
+
+						directive += ' ';
+					}
+					else
+						directive += source[i];
+
+					i++;
+				}
+
+				Vector<String> parts = StringUtil::split(directive, " \t\r");
+				parts.erase(std::remove(parts.begin(), parts.end(), ""), parts.end());
+
+				if (parts.size() == 3 && parts[0] == "define" && parts[1].find('(') == String::npos)
+					mDefines[parts[1]] = parts[2];
+
+				continue;
+			}
+
+			lineStart = false;
+
+			if (isIdentifierChar(c))
+			{
+				UINT32 start = i;
+				while (i < length && (isIdentifierChar(source[i]) || (!isIdentifierStart(source[start]) &&
+					source[i] == '.')))
+				{
+					i++;
+				}
+
+				String token = source.substr(start, i - start);
+
+				auto iterFind = mDefines.find(token);
+				if (iterFind != mDefines.end())
+					token = iterFind->second;
+
+				mTokens.push_back(token);
+				continue;
+			}
+
+			mTokens.push_back(String(1, c));
+			i++;
+		}
+	}
+
+	const String& NullHLSLParamParser::peek() const
+	{
+		static const String EMPTY;
+
+		if (mCurrentToken < (UINT32)mTokens.size())
+			return mTokens[mCurrentToken];
+
+		return EMPTY;
+	}
+
+	const String& NullHLSLParamParser::next()
+	{
+		const String& token = peek();
+
+		if (mCurrentToken < (UINT32)mTokens.size())
+			mCurrentToken++;
+
+		return token;
+	}
+
+	void NullHLSLParamParser::skipBlock()
+	{
+		INT32 depth = 0;
+		do
+		{
+			const String& token = next();
+			if (token == "(" || token == "[" || token == "{")
+				depth++;
+			else if (token == ")" || token == "]" || token == "}")
+				depth--;
+
+		} while (depth > 0 && mCurrentToken < (UINT32)mTokens.size());
+	}
+
+	void NullHLSLParamParser::skipQualifiers()
+	{
+		static const char* QUALIFIERS[] = { "const", "extern", "uniform", "volatile", "precise", "shared", "static",
+			"groupshared", "row_major", "column_major", "in", "out", "inout", "nointerpolation", "linear", "centroid",
+			"noperspective", "sample", "globallycoherent" };
+
+		bool found;
+		do
+		{
+			found = false;
+			for (auto& qualifier : QUALIFIERS)
+			{
+				if (peek() == qualifier)
+				{
+					next();
+					found = true;
+					break;
+				}
+			}
+		} while (found);
+	}
+
+	String NullHLSLParamParser::skipTemplateArguments()
+	{
+		if (peek() != "<")
+			return "";
+
+		next();
+		String firstArgument = peek();
+
+		INT32 depth = 1;
+		while (depth > 0 && mCurrentToken < (UINT32)mTokens.size())
+		{
+			const String& token = next();
+			if (token == "<")
+				depth++;
+			else if (token == ">")
+				depth--;
+		}
+
+		return firstArgument;
+	}
+
+	void NullHLSLParamParser::parseVariableSuffix(UINT32& arraySize, INT32& slot)
+	{
+		arraySize = 1;
+		slot = -1;
+
+		while (peek() == "[")
+		{
+			next();
+
+			const String& dimension = next();
+			if (peek() == "]" && isNumber(dimension))
+			{
+				next();
+				arraySize *= std::max(parseUINT32(dimension, 1), 1U);
+			}
+			else
+			{
+				LOGWRN("Unable to determine array size for a parameter, assuming a single element.");
+
+				mCurrentToken--;
+				INT32 depth = 1;
+				while (depth > 0 && mCurrentToken < (UINT32)mTokens.size())
+				{
+					const String& token = next();
+					if (token == "[")
+						depth++;
+					else if (token == "]")
+						depth--;
+				}
+			}
+		}
+
+		// Semantics, register bindings and packing offsets
+		while (peek() == ":")
+		{
+			next();
+
+			const String& binding = next();
+			if (binding == "register" && peek() == "(")
+			{
+				next();
+
+				const String& reg = next();
+				if (reg.size() > 1)
+					slot = parseINT32(reg.substr(1), -1);
+
+				while (mCurrentToken < (UINT32)mTokens.size() && next() != ")")
+				{ }
+			}
+			else if (binding == "packoffset" && peek() == "(")
+				skipBlock();
+		}
+
+		// Initializers
+		if (peek() == "=")
+		{
+			next();
+
+			INT32 depth = 0;
+			while (mCurrentToken < (UINT32)mTokens.size())
+			{
+				const String& token = peek();
+				if (depth == 0 && (token == "," || token == ";"))
+					break;
+
+				if (token == "(" || token == "[" || token == "{")
+					depth++;
+				else if (token == ")" || token == "]" || token == "}")
+					depth--;
+
+				next();
+			}
+		}
+
+		// Sampler state initializers
+		if (peek() == "{")
+			skipBlock();
+	}
+
+	void NullHLSLParamParser::parseStruct()
+	{
+		next(); // struct
+		String name = next();
+
+		if (peek() == "{")
+		{
+			Vector<GpuParamDataDesc> members;
+			parseMembers(members);
+
+			GpuParamBlockDesc blockDesc = RenderAPI::instance().generateParamBlockDesc(name, members);
+			mStructSizes[name] = blockDesc.blockSize * 4;
+		}
+
+		while (mCurrentToken < (UINT32)mTokens.size() && next() != ";")
+		{ }
+	}
+
+	void NullHLSLParamParser::parseMembers(Vector<GpuParamDataDesc>& members)
+	{
+		next(); // {
+
+		while (mCurrentToken < (UINT32)mTokens.size() && peek() != "}")
+		{
+			if (peek() == "[") // Attribute
+			{
+				skipBlock();
+				continue;
+			}
+
+			if (peek() == ";")
+			{
+				next();
+				continue;
+			}
+
+			skipQualifiers();
+
+			String typeName = next();
+			skipTemplateArguments();
+
+			while (mCurrentToken < (UINT32)mTokens.size())
+			{
+				String name = next();
+
+				// Member function
+				if (peek() == "(")
+				{
+					skipBlock();
+
+					if (peek() == "{")
+						skipBlock();
+
+					break;
+				}
+
+				UINT32 arraySize;
+				INT32 slot;
+				parseVariableSuffix(arraySize, slot);
+
+				GpuParamDataDesc memberDesc;
+				memberDesc.name = name;
+				memberDesc.elementSize = 0;
+				memberDesc.arraySize = arraySize;
+				memberDesc.arrayElementStride = 0;
+				memberDesc.cpuMemOffset = 0;
+				memberDesc.gpuMemOffset = 0;
+				memberDesc.paramBlockSlot = 0;
+				memberDesc.paramBlockSet = 0;
+
+				if (parseDataType(typeName, memberDesc.type, memberDesc.elementSize))
+					members.push_back(memberDesc);
+				else
+					LOGWRN("Skipping parameter \"" + name + "\" because it has unsupported type: " + typeName);
+
+				if (peek() != ",")
+					break;
+
+				next();
+			}
+
+			if (peek() == ";")
+				next();
+		}
+
+		next(); // }
+	}
+
+	void NullHLSLParamParser::parseConstantBuffer()
+	{
+		next(); // cbuffer
+		String name = next();
+
+		UINT32 arraySize;
+		INT32 slot;
+		parseVariableSuffix(arraySize, slot);
+
+		Vector<GpuParamDataDesc> members;
+		if (peek() == "{")
+			parseMembers(members);
+
+		addParamBlock(name, members, slot, true);
+	}
+
+	void NullHLSLParamParser::parseGlobalDeclaration(bool discard)
+	{
+		skipQualifiers();
+
+		String typeName = next();
+		skipTemplateArguments();
+
+		if (typeName.empty() || !isIdentifierStart(typeName[0]))
+			return;
+
+		while (mCurrentToken < (UINT32)mTokens.size())
+		{
+			String name = next();
+			if (name.empty() || !isIdentifierStart(name[0]))
+				return;
+
+			// Function declaration or definition
+			if (peek() == "(")
+			{
+				skipBlock();
+
+				// Return value semantic
+				if (peek() == ":")
+				{
+					next();
+					next();
+				}
+
+				if (peek() == "{")
+					skipBlock();
+
+				return;
+			}
+
+			UINT32 arraySize;
+			INT32 slot;
+			parseVariableSuffix(arraySize, slot);
+
+			if (!discard)
+			{
+				GpuParamObjectType objectType;
+				ParamType paramType;
+				Map<String, GpuParamObjectDesc>* output;
+				if (parseObjectType(typeName, objectType, paramType, output))
+				{
+					UINT32& nextSlot = mNextSlot[(UINT32)paramType];
+
+					GpuParamObjectDesc objectDesc;
+					objectDesc.name = name;
+					objectDesc.type = objectType;
+					objectDesc.slot = slot >= 0 ? (UINT32)slot : nextSlot;
+					objectDesc.set = mapParameterToSet(mType, paramType);
+
+					nextSlot = std::max(nextSlot, objectDesc.slot + arraySize);
+					(*output)[name] = objectDesc;
+				}
+				else
+				{
+					GpuParamDataDesc memberDesc;
+					memberDesc.name = name;
+					memberDesc.elementSize = 0;
+					memberDesc.arraySize = arraySize;
+					memberDesc.arrayElementStride = 0;
+					memberDesc.cpuMemOffset = 0;
+					memberDesc.gpuMemOffset = 0;
+					memberDesc.paramBlockSlot = 0;
+					memberDesc.paramBlockSet = 0;
+
+					// Unknown types are ignored, they can't be set through GPU parameters regardless
+					if (parseDataType(typeName, memberDesc.type, memberDesc.elementSize))
+						mGlobals.push_back(memberDesc);
+				}
+			}
+
+			if (peek() != ",")
+				break;
+
+			next();
+		}
+
+		if (peek() == ";")
+			next();
+	}
+
+	bool NullHLSLParamParser::parseDataType(const String& name, GpuParamDataType& type, UINT32& size) const
+	{
+		auto iterFind = mStructSizes.find(name);
+		if (iterFind != mStructSizes.end())
+		{
+			type = GPDT_STRUCT;
+			size = iterFind->second;
+			return true;
+		}
+
+		if (name == "matrix")
+		{
+			type = GPDT_MATRIX_4X4;
+			return true;
+		}
+
+		if (name == "vector")
+		{
+			type = GPDT_FLOAT4;
+			return true;
+		}
+
+		enum class BaseType { Float, Int, Bool };
+		struct BaseTypeName { const char* name; BaseType type; };
+
+		static const BaseTypeName BASE_TYPES[] = {
+			{ "float", BaseType::Float }, { "half", BaseType::Float }, { "double", BaseType::Float },
+			{ "min16float", BaseType::Float }, { "min10float", BaseType::Float }, { "int", BaseType::Int },
+			{ "uint", BaseType::Int }, { "dword", BaseType::Int }, { "min16int", BaseType::Int },
+			{ "min12int", BaseType::Int }, { "min16uint", BaseType::Int }, { "bool", BaseType::Bool } };
+
+		for (auto& entry : BASE_TYPES)
+		{
+			UINT32 prefixLength = (UINT32)strlen(entry.name);
+			if (name.compare(0, prefixLength, entry.name) != 0)
+				continue;
+
+			// Suffix can be empty (scalar), N (vector) or NxM (matrix)
+			String suffix = name.substr(prefixLength);
+
+			UINT32 rows = 1;
+			UINT32 columns = 1;
+			bool isMatrix = false;
+			if (suffix.size() == 1)
+				columns = suffix[0] - '0';
+			else if (suffix.size() == 3 && suffix[1] == 'x')
+			{
+				rows = suffix[0] - '0';
+				columns = suffix[2] - '0';
+				isMatrix = true;
+			}
+			else if (!suffix.empty())
+				continue;
+
+			if (rows < 1 || rows > 4 || columns < 1 || columns > 4)
+				return false;
+
+			if (isMatrix)
+			{
+				// Integer matrices are not supported as GPU parameters, treat them as float matrices as they have the
+				// same layout
+				if (rows < 2 || columns < 2)
+					return false;
+
+				type = (GpuParamDataType)(GPDT_MATRIX_2X2 + (rows - 2) * 3 + (columns - 2));
+				return true;
+			}
+
+			switch (entry.type)
+			{
+			case BaseType::Float:
+				type = (GpuParamDataType)(GPDT_FLOAT1 + (columns - 1));
+				break;
+			case BaseType::Int:
+				type = (GpuParamDataType)(GPDT_INT1 + (columns - 1));
+				break;
+			case BaseType::Bool:
+				type = columns == 1 ? GPDT_BOOL : (GpuParamDataType)(GPDT_INT1 + (columns - 1));
+				break;
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool NullHLSLParamParser::parseObjectType(const String& name, GpuParamObjectType& type, ParamType& paramType,
+		Map<String, GpuParamObjectDesc>*& output) const
+	{
+		struct ObjectTypeName { const char* name; GpuParamObjectType type; ParamType paramType; };
+
+		static const ObjectTypeName OBJECT_TYPES[] = {
+			{ "Texture1D", GPOT_TEXTURE1D, ParamType::Texture },
+			{ "Texture1DArray", GPOT_TEXTURE1DARRAY, ParamType::Texture },
+			{ "Texture2D", GPOT_TEXTURE2D, ParamType::Texture },
+			{ "Texture2DArray", GPOT_TEXTURE2DARRAY, ParamType::Texture },
+			{ "Texture2DMS", GPOT_TEXTURE2DMS, ParamType::Texture },
+			{ "Texture2DMSArray", GPOT_TEXTURE2DMSARRAY, ParamType::Texture },
+			{ "Texture3D", GPOT_TEXTURE3D, ParamType::Texture },
+			{ "TextureCube", GPOT_TEXTURECUBE, ParamType::Texture },
+			{ "TextureCubeArray", GPOT_TEXTURECUBEARRAY, ParamType::Texture },
+			{ "Buffer", GPOT_BYTE_BUFFER, ParamType::Texture },
+			{ "ByteAddressBuffer", GPOT_BYTE_BUFFER, ParamType::Texture },
+			{ "StructuredBuffer", GPOT_STRUCTURED_BUFFER, ParamType::Texture },
+			{ "RWTexture1D", GPOT_RWTEXTURE1D, ParamType::UAV },
+			{ "RWTexture1DArray", GPOT_RWTEXTURE1DARRAY, ParamType::UAV },
+			{ "RWTexture2D", GPOT_RWTEXTURE2D, ParamType::UAV },
+			{ "RWTexture2DArray", GPOT_RWTEXTURE2DARRAY, ParamType::UAV },
+			{ "RWTexture3D", GPOT_RWTEXTURE3D, ParamType::UAV },
+			{ "RWBuffer", GPOT_RWTYPED_BUFFER, ParamType::UAV },
+			{ "RWByteAddressBuffer", GPOT_RWBYTE_BUFFER, ParamType::UAV },
+			{ "RWStructuredBuffer", GPOT_RWSTRUCTURED_BUFFER, ParamType::UAV },
+			{ "AppendStructuredBuffer", GPOT_RWAPPEND_BUFFER, ParamType::UAV },
+			{ "ConsumeStructuredBuffer", GPOT_RWCONSUME_BUFFER, ParamType::UAV },
+			{ "SamplerState", GPOT_SAMPLER2D, ParamType::Sampler },
+			{ "SamplerComparisonState", GPOT_SAMPLER2D, ParamType::Sampler },
+			{ "sampler", GPOT_SAMPLER2D, ParamType::Sampler } };
+
+		for (auto& entry : OBJECT_TYPES)
+		{
+			if (name != entry.name)
+				continue;
+
+			type = entry.type;
+			paramType = entry.paramType;
+
+			switch (entry.type)
+			{
+			case GPOT_SAMPLER2D:
+				output = &mDesc->samplers;
+				break;
+			case GPOT_BYTE_BUFFER:
+			case GPOT_STRUCTURED_BUFFER:
+			case GPOT_RWTYPED_BUFFER:
+			case GPOT_RWBYTE_BUFFER:
+			case GPOT_RWSTRUCTURED_BUFFER:
+			case GPOT_RWAPPEND_BUFFER:
+			case GPOT_RWCONSUME_BUFFER:
+				output = &mDesc->buffers;
+				break;
+			case GPOT_RWTEXTURE1D:
+			case GPOT_RWTEXTURE1DARRAY:
+			case GPOT_RWTEXTURE2D:
+			case GPOT_RWTEXTURE2DARRAY:
+			case GPOT_RWTEXTURE3D:
+				output = &mDesc->loadStoreTextures;
+				break;
+			default:
+				output = &mDesc->textures;
+				break;
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void NullHLSLParamParser::addParamBlock(const String& name, Vector<GpuParamDataDesc>& members, INT32 slot,
+		bool shareable)
+	{
+		UINT32& nextSlot = mNextSlot[(UINT32)ParamType::ConstantBuffer];
+
+		GpuParamBlockDesc blockDesc = RenderAPI::instance().generateParamBlockDesc(name, members);
+		blockDesc.slot = slot >= 0 ? (UINT32)slot : nextSlot;
+		blockDesc.set = mapParameterToSet(mType, ParamType::ConstantBuffer);
+		blockDesc.isShareable = shareable;
+
+		nextSlot = std::max(nextSlot, blockDesc.slot + 1);
+
+		for (auto& member : members)
+		{
+			member.paramBlockSlot = blockDesc.slot;
+			member.paramBlockSet = blockDesc.set;
+			member.gpuMemOffset = member.cpuMemOffset;
+
+			mDesc->params[member.name] = member;
+		}
+
+		mDesc->paramBlocks[name] = blockDesc;
+	}
+
+	UINT32 NullHLSLParamParser::mapParameterToSet(GpuProgramType progType, ParamType paramType)
+	{
+		UINT32 progTypeIdx = (UINT32)progType;
+		UINT32 paramTypeIdx = (UINT32)paramType;
+
+		return progTypeIdx * (UINT32)ParamType::Count + paramTypeIdx;
+	}
+}}
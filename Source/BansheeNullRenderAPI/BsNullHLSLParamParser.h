@@ -0,0 +1,119 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Extracts GPU program parameter descriptions by scanning global declarations in HLSL source code, as there is no
+	 * shader compiler to reflect the parameters with. Constant buffers are laid out using the HLSL packing rules and
+	 * resources are assigned to sets the same way as on DirectX 11.
+	 *
+	 * The scan is purely declarative and has a few limitations compared to real reflection: preprocessor conditionals
+	 * are not evaluated (declarations from all branches are reported), and all declared parameters are reported
+	 * regardless of whether the program entry point actually uses them.
+	 */
+	class NullHLSLParamParser
+	{
+	public:
+		/**
+		 * Parses the provided HLSL source and outputs parameter descriptions.
+		 *
+		 * @param[in]	source		HLSL source code to parse.
+		 * @param[in]	type		Type of the GPU program.
+		 * @param[out]	desc		Output object that will contain parameter descriptions.
+		 */
+		void parse(const String& source, GpuProgramType type, GpuParamDesc& desc);
+
+	private:
+		/** Types of HLSL parameters. */
+		enum class ParamType
+		{
+			ConstantBuffer,
+			Texture,
+			Sampler,
+			UAV,
+			Count // Keep at end
+		};
+
+		/** Splits the source into tokens, skipping comments and preprocessor directives. */
+		void tokenize(const String& source);
+
+		/** Returns the current token, or an empty string if there are no more tokens. */
+		const String& peek() const;
+
+		/** Returns the current token and advances to the next one. */
+		const String& next();
+
+		/** Skips tokens until (and including) the token closing the block opened by the current token. */
+		void skipBlock();
+
+		/** Skips declaration qualifiers (e.g. const, row_major) starting at the current token. */
+		void skipQualifiers();
+
+		/** Skips a template argument list if one starts at the current token. Returns its first argument, if any. */
+		String skipTemplateArguments();
+
+		/**
+		 * Parses optional array dimensions and a register binding following a variable name. Skips any semantics and
+		 * initializers.
+		 *
+		 * @param[out]	arraySize	Total number of array elements, or 1 if the variable is not an array.
+		 * @param[out]	slot		Explicitly specified register slot, or -1 if none is specified.
+		 */
+		void parseVariableSuffix(UINT32& arraySize, INT32& slot);
+
+		/** Parses a struct definition and records its size. */
+		void parseStruct();
+
+		/** Parses the members of a struct or a constant buffer, until and including the closing brace. */
+		void parseMembers(Vector<GpuParamDataDesc>& members);
+
+		/** Parses a constant buffer declaration. */
+		void parseConstantBuffer();
+
+		/** 
+		 * Parses a global declaration that isn't a struct or a constant buffer (resource, data or function). If 
+		 * @p discard is true the declaration is skipped without registering any parameters.
+		 */
+		void parseGlobalDeclaration(bool discard);
+
+		/** 
+		 * Converts an HLSL data type name into a GPU parameter data type. Returns false if the type isn't supported. 
+		 * @p size is only set for struct types, in bytes.
+		 */
+		bool parseDataType(const String& name, GpuParamDataType& type, UINT32& size) const;
+
+		/** 
+		 * Converts an HLSL object type name into a GPU parameter object type, and finds the parameter category it 
+		 * belongs to. Returns false if the name isn't a known object type. 
+		 */
+		bool parseObjectType(const String& name, GpuParamObjectType& type, ParamType& paramType,
+			Map<String, GpuParamObjectDesc>*& output) const;
+
+		/** Registers a constant buffer with the specified members in the output description. */
+		void addParamBlock(const String& name, Vector<GpuParamDataDesc>& members, INT32 slot, bool shareable);
+
+		/** Maps a parameter in a specific shader stage, of a specific type to a unique set index. */
+		static UINT32 mapParameterToSet(GpuProgramType progType, ParamType paramType);
+
+		GpuProgramType mType = GPT_VERTEX_PROGRAM;
+		GpuParamDesc* mDesc = nullptr;
+
+		Vector<String> mTokens;
+		UINT32 mCurrentToken = 0;
+		UnorderedMap<String, String> mDefines;
+		UnorderedMap<String, UINT32> mStructSizes;
+		Vector<GpuParamDataDesc> mGlobals;
+		UINT32 mNextSlot[(UINT32)ParamType::Count] = { };
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,36 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHLSLProgramFactory.h"
+#include "BsNullGpuProgram.h"
+
+namespace bs { namespace ct
+{
+	const String NullHLSLProgramFactory::LANGUAGE_NAME = "hlsl";
+
+	NullHLSLProgramFactory::NullHLSLProgramFactory()
+	{ }
+
+	NullHLSLProgramFactory::~NullHLSLProgramFactory()
+	{ }
+
+	SPtr<GpuProgram> NullHLSLProgramFactory::create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
+	{
+		SPtr<GpuProgram> gpuProg = bs_shared_ptr<NullGpuProgram>(new (bs_alloc<NullGpuProgram>())
+			NullGpuProgram(desc, deviceMask));
+		gpuProg->_setThisPtr(gpuProg);
+
+		return gpuProg;
+	}
+
+	SPtr<GpuProgram> NullHLSLProgramFactory::create(GpuProgramType type, GpuDeviceFlags deviceMask)
+	{
+		GPU_PROGRAM_DESC desc;
+		desc.type = type;
+
+		SPtr<GpuProgram> gpuProg = bs_shared_ptr<NullGpuProgram>(new (bs_alloc<NullGpuProgram>())
+			NullGpuProgram(desc, deviceMask));
+		gpuProg->_setThisPtr(gpuProg);
+
+		return gpuProg;
+	}
+}}
@@ -0,0 +1,76 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
+#include "RenderAPI/BsGpuBuffer.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** 
+	 * Hardware buffer implementation for the null render API, storing its contents in system memory. 
+	 *
+	 * @tparam	Base	Hardware buffer type to implement (vertex, index or generic GPU buffer).
+	 */
+	template<class Base>
+	class TNullHardwareBuffer : public Base
+	{
+	public:
+		template<class Desc>
+		TNullHardwareBuffer(const Desc& desc, GpuDeviceFlags deviceMask)
+			:Base(desc, deviceMask)
+		{
+			mData = (UINT8*)bs_alloc(this->mSize);
+			memset(mData, 0, this->mSize);
+		}
+
+		~TNullHardwareBuffer()
+		{
+			bs_free(mData);
+		}
+
+		/** @copydoc HardwareBuffer::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest, UINT32 deviceIdx = 0, UINT32 queueIdx = 0) override
+		{
+			memcpy(dest, mData + offset, length);
+		}
+
+		/** @copydoc HardwareBuffer::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags = BWT_NORMAL,
+			UINT32 queueIdx = 0) override
+		{
+			memcpy(mData + offset, source, length);
+		}
+
+		/** @copydoc HardwareBuffer::copyData */
+		void copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length, 
+			bool discardWholeBuffer = false, const SPtr<CommandBuffer>& commandBuffer = nullptr) override
+		{
+			srcBuffer.readData(srcOffset, length, mData + dstOffset);
+		}
+
+	protected:
+		/** @copydoc HardwareBuffer::map */
+		void* map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 deviceIdx, UINT32 queueIdx) override
+		{
+			return mData + offset;
+		}
+
+		/** @copydoc HardwareBuffer::unmap */
+		void unmap() override { }
+
+		UINT8* mData;
+	};
+
+	typedef TNullHardwareBuffer<VertexBuffer> NullVertexBuffer;
+	typedef TNullHardwareBuffer<IndexBuffer> NullIndexBuffer;
+	typedef TNullHardwareBuffer<GpuBuffer> NullGpuBuffer;
+
+	/** @} */
+}}
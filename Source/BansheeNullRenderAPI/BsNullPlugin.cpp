@@ -0,0 +1,27 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullPrerequisites.h"
+#include "BsNullRenderAPIFactory.h"
+
+namespace bs
+{
+	extern "C" BS_PLUGIN_EXPORT const char* getPluginName()
+	{
+		return ct::SystemName;
+	}
+
+	extern "C" BS_PLUGIN_EXPORT void getNullCommandStats(ct::NullCommandStats& stats)
+	{
+		stats = ct::gNullRenderAPI().getStats();
+	}
+
+	extern "C" BS_PLUGIN_EXPORT void resetNullCommandStats()
+	{
+		ct::gNullRenderAPI().resetStats();
+	}
+
+	extern "C" BS_PLUGIN_EXPORT void setNullCommandHashing(bool enabled)
+	{
+		ct::gNullRenderAPI().setHashingEnabled(enabled);
+	}
+}
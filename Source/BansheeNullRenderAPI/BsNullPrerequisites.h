@@ -0,0 +1,35 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup NullRenderAPI BansheeNullRenderAPI
+ *	Render API that requires no GPU. All resources live in system memory and submitted commands are only recorded, which
+ *	allows the renderer's CPU cost to be measured on headless machines.
+ */
+
+/** @} */
+
+namespace bs
+{
+	class NullRenderWindow;
+	class NullRenderTexture;
+
+	namespace ct
+	{
+	class NullRenderAPI;
+	class NullRenderWindow;
+	class NullRenderTexture;
+	class NullTexture;
+	class NullGpuProgram;
+	class NullHLSLProgramFactory;
+	class NullCommandBuffer;
+	class NullGpuParamBlockBuffer;
+	struct NullCommandStats;
+	}
+}
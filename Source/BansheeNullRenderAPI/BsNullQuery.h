@@ -0,0 +1,69 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsEventQuery.h"
+#include "RenderAPI/BsTimerQuery.h"
+#include "RenderAPI/BsOcclusionQuery.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** @copydoc EventQuery */
+	class NullEventQuery : public EventQuery
+	{
+	public:
+		/** @copydoc EventQuery::begin */
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { setActive(true); }
+
+		/** @copydoc EventQuery::isReady */
+		bool isReady() const override { return true; }
+	};
+
+	/** Timer query for the null render API. Since no work is performed on the GPU, the reported time is always zero. */
+	class NullTimerQuery : public TimerQuery
+	{
+	public:
+		/** @copydoc TimerQuery::begin */
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { }
+
+		/** @copydoc TimerQuery::end */
+		void end(const SPtr<CommandBuffer>& cb = nullptr) override { setActive(true); }
+
+		/** @copydoc TimerQuery::isReady */
+		bool isReady() const override { return true; }
+
+		/** @copydoc TimerQuery::getTimeMs */
+		float getTimeMs() override { return 0.0f; }
+	};
+
+	/** 
+	 * Occlusion query for the null render API. Since nothing is rasterized, the reported number of samples is always
+	 * zero.
+	 */
+	class NullOcclusionQuery : public OcclusionQuery
+	{
+	public:
+		NullOcclusionQuery(bool binary)
+			:OcclusionQuery(binary)
+		{ }
+
+		/** @copydoc OcclusionQuery::begin */
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { }
+
+		/** @copydoc OcclusionQuery::end */
+		void end(const SPtr<CommandBuffer>& cb = nullptr) override { setActive(true); }
+
+		/** @copydoc OcclusionQuery::isReady */
+		bool isReady() const override { return true; }
+
+		/** @copydoc OcclusionQuery::getNumSamples */
+		UINT32 getNumSamples() override { return 0; }
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,605 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPI.h"
+#include "BsNullCommandBuffer.h"
+#include "BsNullCommandBufferManager.h"
+#include "BsNullTextureManager.h"
+#include "BsNullHardwareBufferManager.h"
+#include "BsNullRenderWindowManager.h"
+#include "BsNullQueryManager.h"
+#include "BsNullHLSLProgramFactory.h"
+#include "BsNullVideoModeInfo.h"
+#include "Managers/BsRenderStateManager.h"
+#include "Managers/BsGpuProgramManager.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsRenderTarget.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Profiling/BsRenderStats.h"
+#include "Math/BsMath.h"
+
+namespace bs { namespace ct
+{
+	/** Returns the bit representation of a floating point value, so it can be hashed exactly. */
+	static UINT64 floatBits(float value)
+	{
+		UINT32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		return bits;
+	}
+
+	NullRenderAPI::NullRenderAPI()
+		: mHLSLFactory(nullptr), mActiveDrawOp(DOT_TRIANGLE_LIST), mHashingEnabled(false)
+	{ }
+
+	NullRenderAPI::~NullRenderAPI()
+	{ }
+
+	const StringID& NullRenderAPI::getName() const
+	{
+		static StringID strName("NullRenderAPI");
+		return strName;
+	}
+
+	void NullRenderAPI::initialize()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mVideoModeInfo = bs_shared_ptr_new<NullVideoModeInfo>();
+
+		CommandBufferManager::startUp<NullCommandBufferManager>();
+
+		// Create the texture manager for use by others
+		bs::TextureManager::startUp<bs::NullTextureManager>();
+		TextureManager::startUp<NullTextureManager>();
+
+		// Create hardware buffer manager
+		bs::HardwareBufferManager::startUp();
+		HardwareBufferManager::startUp<NullHardwareBufferManager>();
+
+		// Create render window manager
+		bs::RenderWindowManager::startUp<bs::NullRenderWindowManager>();
+		RenderWindowManager::startUp<NullRenderWindowManager>();
+
+		// Create query manager
+		QueryManager::startUp<NullQueryManager>();
+
+		// Create render state manager, default states suffice as there is no GPU to create objects on
+		RenderStateManager::startUp();
+
+		// Create & register HLSL factory
+		mHLSLFactory = bs_new<NullHLSLProgramFactory>();
+
+		mNumDevices = 1;
+		mCurrentCapabilities = bs_newN<RenderAPICapabilities>(mNumDevices);
+		initCapabilites(mCurrentCapabilities[0]);
+
+		GpuProgramManager::instance().addFactory("hlsl", mHLSLFactory);
+
+		RenderAPI::initialize();
+	}
+
+	void NullRenderAPI::destroyCore()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mHLSLFactory != nullptr)
+		{
+			bs_delete(mHLSLFactory);
+			mHLSLFactory = nullptr;
+		}
+
+		mActiveRenderTarget = nullptr;
+		mObjectIds.clear();
+		mStateCache.reset();
+
+		QueryManager::shutDown();
+		RenderStateManager::shutDown();
+		RenderWindowManager::shutDown();
+		bs::RenderWindowManager::shutDown();
+		HardwareBufferManager::shutDown();
+		bs::HardwareBufferManager::shutDown();
+		TextureManager::shutDown();
+		bs::TextureManager::shutDown();
+		CommandBufferManager::shutDown();
+
+		RenderAPI::destroyCore();
+	}
+
+	void NullRenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setGraphicsPipeline(pipelineState))
+			return;
+
+		NullCommand command = createCommand(NullCommandType::SetGraphicsPipeline, { getObjectId(pipelineState.get()) });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumPipelineStateChanges);
+	}
+
+	void NullRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setComputePipeline(pipelineState))
+			return;
+
+		NullCommand command = createCommand(NullCommandType::SetComputePipeline, { getObjectId(pipelineState.get()) });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumPipelineStateChanges);
+	}
+
+	void NullRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setGpuParams(gpuParams))
+			return;
+
+		// Param block buffers live in system memory so their contents can be flushed right away, even if the command
+		// is deferred
+		for (UINT32 i = 0; i < GPT_COUNT; i++)
+		{
+			SPtr<GpuParamDesc> paramDesc = gpuParams->getParamDesc((GpuProgramType)i);
+			if (paramDesc == nullptr)
+				continue;
+
+			for (auto& entry : paramDesc->paramBlocks)
+			{
+				SPtr<GpuParamBlockBuffer> buffer = gpuParams->getParamBlockBuffer(entry.second.set, entry.second.slot);
+				if (buffer != nullptr)
+					buffer->flushToGPU();
+			}
+		}
+
+		NullCommand command = createCommand(NullCommandType::SetGpuParams, { getObjectId(gpuParams.get()) });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumGpuParamBinds);
+	}
+
+	void NullRenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::ClearRenderTarget, { buffers, floatBits(color.r),
+			floatBits(color.g), floatBits(color.b), floatBits(color.a), floatBits(depth), stencil, targetMask });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::ClearViewport, { buffers, floatBits(color.r),
+			floatBits(color.g), floatBits(color.b), floatBits(color.a), floatBits(depth), stencil, targetMask });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		mActiveRenderTarget = target;
+		getStateCache(commandBuffer).invalidateGpuParams();
+
+		NullCommand command = createCommand(NullCommandType::SetRenderTarget,
+			{ getObjectId(target.get()), readOnlyFlags, (UINT32)loadMask });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumRenderTargetChanges);
+	}
+
+	void NullRenderAPI::setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::SetViewport, { floatBits(area.x), floatBits(area.y),
+			floatBits(area.width), floatBits(area.height) });
+		recordCommand(command, commandBuffer);
+	}
+
+	void NullRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::SetScissorRect, { left, top, right, bottom });
+		recordCommand(command, commandBuffer);
+	}
+
+	void NullRenderAPI::setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::SetStencilRef, { value });
+		recordCommand(command, commandBuffer);
+	}
+
+	void NullRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setVertexBuffers(index, buffers, numBuffers))
+			return;
+
+		NullCommand command = createCommand(NullCommandType::SetVertexBuffers, { index, numBuffers });
+		if (mHashingEnabled)
+		{
+			size_t hash = (size_t)command.hash;
+			for (UINT32 i = 0; i < numBuffers; i++)
+				hash_combine(hash, getObjectId(buffers[i].get()));
+
+			command.hash = hash;
+		}
+
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumVertexBufferBinds);
+	}
+
+	void NullRenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setIndexBuffer(buffer))
+			return;
+
+		NullCommand command = createCommand(NullCommandType::SetIndexBuffer, { getObjectId(buffer.get()) });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
+	void NullRenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setVertexDeclaration(vertexDeclaration))
+			return;
+
+		NullCommand command = createCommand(NullCommandType::SetVertexDeclaration,
+			{ getObjectId(vertexDeclaration.get()) });
+		recordCommand(command, commandBuffer);
+	}
+
+	void NullRenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (!getStateCache(commandBuffer).setDrawOperation(op))
+			return;
+
+		NullCommand command = createCommand(NullCommandType::SetDrawOperation, { (UINT64)op });
+		recordCommand(command, commandBuffer);
+
+		if (commandBuffer == nullptr)
+			mActiveDrawOp = op;
+		else
+		{
+			SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+			cb->mActiveDrawOp = op;
+		}
+	}
+
+	void NullRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::Draw, { vertexOffset, vertexCount, instanceCount });
+		command.elementCount = vertexCount;
+		command.instanceCount = instanceCount;
+
+		if (commandBuffer == nullptr)
+			command.primitiveCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+		else
+		{
+			SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+			command.primitiveCount = vertexCountToPrimCount(cb->mActiveDrawOp, vertexCount);
+		}
+
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, command.primitiveCount);
+	}
+
+	void NullRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::DrawIndexed,
+			{ startIndex, indexCount, vertexOffset, vertexCount, instanceCount });
+		command.elementCount = indexCount;
+		command.instanceCount = instanceCount;
+
+		if (commandBuffer == nullptr)
+			command.primitiveCount = vertexCountToPrimCount(mActiveDrawOp, indexCount);
+		else
+		{
+			SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+			command.primitiveCount = vertexCountToPrimCount(cb->mActiveDrawOp, indexCount);
+		}
+
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, command.primitiveCount);
+	}
+
+	void NullRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		NullCommand command = createCommand(NullCommandType::DispatchCompute, { numGroupsX, numGroupsY, numGroupsZ });
+		recordCommand(command, commandBuffer);
+
+		BS_INC_RENDER_STAT(NumComputeCalls);
+	}
+
+	void NullRenderAPI::swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+		target->swapBuffers();
+
+		executeCommand(createCommand(NullCommandType::SwapBuffers, { getObjectId(target.get()) }));
+
+		BS_INC_RENDER_STAT(NumPresents);
+	}
+
+	void NullRenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	{
+		SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+		SPtr<NullCommandBuffer> secondaryCb = std::static_pointer_cast<NullCommandBuffer>(secondary);
+
+		cb->appendSecondary(secondaryCb);
+
+		// State bound by the secondary buffer is unknown to the primary buffer
+		cb->_getStateCache().reset();
+	}
+
+	void NullRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	{
+		SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+		if (cb == nullptr)
+			return;
+
+		THROW_IF_NOT_CORE_THREAD;
+
+		for (auto& command : cb->getCommands())
+			executeCommand(command);
+
+		mStats.numSubmittedCommandBuffers++;
+		cb->clear();
+
+		// Executed commands could have changed the immediate state, and the command buffer will start fresh
+		cb->_getStateCache().reset();
+		mStateCache.reset();
+	}
+
+	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
+	{
+		dest = matrix;
+
+		// Convert depth range from [-1,+1] to [0,1], same as DirectX
+		dest[2][0] = (dest[2][0] + dest[3][0]) / 2;
+		dest[2][1] = (dest[2][1] + dest[3][1]) / 2;
+		dest[2][2] = (dest[2][2] + dest[3][2]) / 2;
+		dest[2][3] = (dest[2][3] + dest[3][3]) / 2;
+	}
+
+	const RenderAPIInfo& NullRenderAPI::getAPIInfo() const
+	{
+		RenderAPIFeatures featureFlags =
+			RenderAPIFeatureFlag::TextureViews |
+			RenderAPIFeatureFlag::Compute |
+			RenderAPIFeatureFlag::LoadStore |
+			RenderAPIFeatureFlag::ParamBlockViews;
+
+		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
+
+		return info;
+	}
+
+	GpuParamBlockDesc NullRenderAPI::generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params)
+	{
+		// Programs are parsed from HLSL, so use the same packing rules as DirectX
+		GpuParamBlockDesc block;
+		block.blockSize = 0;
+		block.isShareable = true;
+		block.name = name;
+		block.slot = 0;
+		block.set = 0;
+
+		for (auto& param : params)
+		{
+			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[param.type];
+
+			if (param.arraySize > 1)
+			{
+				// Arrays perform no packing and their elements are always padded and aligned to four component vectors
+				UINT32 size;
+				if(param.type == GPDT_STRUCT)
+					size = Math::divideAndRoundUp(param.elementSize, 16U) * 4;
+				else
+					size = Math::divideAndRoundUp(typeInfo.size, 16U) * 4;
+
+				block.blockSize = Math::divideAndRoundUp(block.blockSize, 4U) * 4;
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				// Last array element isn't rounded up to four component vectors unless it's a struct
+				if(param.type != GPDT_STRUCT)
+				{
+					block.blockSize += size * (param.arraySize - 1);
+					block.blockSize += typeInfo.size / 4;
+				}
+				else
+					block.blockSize += param.arraySize * size;
+			}
+			else
+			{
+				UINT32 size;
+				if(param.type == GPDT_STRUCT)
+				{
+					// Structs are always aligned and arounded up to 4 component vectors
+					size = Math::divideAndRoundUp(param.elementSize, 16U) * 4;
+					block.blockSize = Math::divideAndRoundUp(block.blockSize, 4U) * 4;
+				}
+				else
+				{
+					size = typeInfo.baseTypeSize * (typeInfo.numRows * typeInfo.numColumns) / 4;
+
+					// Pack everything as tightly as possible as long as the data doesn't cross 16 byte boundary
+					UINT32 alignOffset = block.blockSize % 4;
+					if (alignOffset != 0 && size > (4 - alignOffset))
+					{
+						UINT32 padding = (4 - alignOffset);
+						block.blockSize += padding;
+					}
+				}
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size;
+			}
+
+			param.paramBlockSlot = 0;
+			param.paramBlockSet = 0;
+		}
+
+		// Constant buffer size must always be a multiple of 16
+		if (block.blockSize % 4 != 0)
+			block.blockSize += (4 - (block.blockSize % 4));
+
+		return block;
+	}
+
+	void NullRenderAPI::resetStats()
+	{
+		mStats = NullCommandStats();
+		mObjectIds.clear();
+	}
+
+	/************************************************************************/
+	/* 								PRIVATE		                     		*/
+	/************************************************************************/
+
+	void NullRenderAPI::initCapabilites(RenderAPICapabilities& caps) const
+	{
+		caps.setDriverVersion(DriverVersion());
+		caps.setDeviceName("Null device");
+		caps.setRenderAPIName(getName());
+		caps.setVendor(GPU_UNKNOWN);
+
+		caps.setCapability(RSC_TEXTURE_COMPRESSION_BC);
+		caps.setCapability(RSC_GEOMETRY_PROGRAM);
+		caps.setCapability(RSC_TESSELLATION_PROGRAM);
+		caps.setCapability(RSC_COMPUTE_PROGRAM);
+		caps.addShaderProfile("hlsl");
+
+		// Limits match DirectX 11 as the programs are written in HLSL
+		const UINT16 NUM_TEXTURE_UNITS = 128;
+		const UINT16 NUM_PARAM_BLOCK_BUFFERS = 14;
+		const UINT16 NUM_LOAD_STORE_UNITS = 8;
+
+		for (UINT32 i = 0; i < GPT_COUNT; i++)
+		{
+			GpuProgramType progType = (GpuProgramType)i;
+
+			caps.setNumTextureUnits(progType, NUM_TEXTURE_UNITS);
+			caps.setNumGpuParamBlockBuffers(progType, NUM_PARAM_BLOCK_BUFFERS);
+		}
+
+		caps.setNumLoadStoreTextureUnits(GPT_FRAGMENT_PROGRAM, NUM_LOAD_STORE_UNITS);
+		caps.setNumLoadStoreTextureUnits(GPT_COMPUTE_PROGRAM, NUM_LOAD_STORE_UNITS);
+
+		caps.setNumCombinedTextureUnits(NUM_TEXTURE_UNITS * GPT_COUNT);
+		caps.setNumCombinedGpuParamBlockBuffers(NUM_PARAM_BLOCK_BUFFERS * GPT_COUNT);
+		caps.setNumCombinedLoadStoreTextureUnits(NUM_LOAD_STORE_UNITS * 2);
+
+		caps.setMaxBoundVertexBuffers(32);
+		caps.setNumMultiRenderTargets(8);
+	}
+
+	void NullRenderAPI::recordCommand(const NullCommand& command, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (commandBuffer == nullptr)
+		{
+			THROW_IF_NOT_CORE_THREAD;
+			executeCommand(command);
+		}
+		else
+		{
+			SPtr<NullCommandBuffer> cb = std::static_pointer_cast<NullCommandBuffer>(commandBuffer);
+			cb->queueCommand(command);
+		}
+	}
+
+	void NullRenderAPI::executeCommand(const NullCommand& command)
+	{
+		mStats.numCommands[(UINT32)command.type]++;
+
+		switch (command.type)
+		{
+		case NullCommandType::Draw:
+			mStats.numVertices += command.elementCount;
+			mStats.numPrimitives += command.primitiveCount;
+			mStats.numInstances += std::max(command.instanceCount, 1U);
+			break;
+		case NullCommandType::DrawIndexed:
+			mStats.numIndices += command.elementCount;
+			mStats.numPrimitives += command.primitiveCount;
+			mStats.numInstances += std::max(command.instanceCount, 1U);
+			break;
+		default:
+			break;
+		}
+
+		if (mHashingEnabled)
+		{
+			size_t hash = (size_t)mStats.hash;
+			hash_combine(hash, command.hash);
+
+			mStats.hash = hash;
+		}
+	}
+
+	NullCommand NullRenderAPI::createCommand(NullCommandType type, std::initializer_list<UINT64> params)
+	{
+		NullCommand command;
+		command.type = type;
+		command.elementCount = 0;
+		command.primitiveCount = 0;
+		command.instanceCount = 0;
+		command.hash = 0;
+
+		if (mHashingEnabled)
+		{
+			size_t hash = 0;
+			hash_combine(hash, (UINT32)type);
+
+			for (auto& param : params)
+				hash_combine(hash, param);
+
+			command.hash = hash;
+		}
+
+		return command;
+	}
+
+	UINT64 NullRenderAPI::getObjectId(const void* object)
+	{
+		if (!mHashingEnabled || object == nullptr)
+			return 0;
+
+		auto iterFind = mObjectIds.find(object);
+		if (iterFind != mObjectIds.end())
+			return iterFind->second;
+
+		UINT64 id = (UINT64)mObjectIds.size() + 1;
+		mObjectIds[object] = id;
+
+		return id;
+	}
+
+	NullRenderAPI& gNullRenderAPI()
+	{
+		return static_cast<NullRenderAPI&>(RenderAPI::instance());
+	}
+}}
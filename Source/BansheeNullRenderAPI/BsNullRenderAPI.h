@@ -0,0 +1,173 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsNullCommandStats.h"
+#include "RenderAPI/BsRenderAPI.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	struct NullCommand;
+
+	/**
+	 * Render API that doesn't talk to any GPU. Resources are kept in system memory, while submitted commands are only
+	 * counted (and optionally hashed). Follows the same execution model as DirectX 11, meaning commands without a
+	 * command buffer execute immediately, while commands queued on a command buffer execute when it is submitted.
+	 */
+	class NullRenderAPI : public RenderAPI
+	{
+	public:
+		NullRenderAPI();
+		~NullRenderAPI();
+
+		/** @copydoc RenderAPI::getName */
+		const StringID& getName() const override;
+
+		/** @copydoc RenderAPI::setGraphicsPipeline */
+		void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setComputePipeline */
+		void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setGpuParams */
+		void setGpuParams(const SPtr<GpuParams>& gpuParams,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::clearRenderTarget */
+		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::clearViewport */
+		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setRenderTarget */
+		void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setViewport */
+		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setScissorRect */
+		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setStencilRef */
+		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setVertexBuffers */
+		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setIndexBuffer */
+		void setIndexBuffer(const SPtr<IndexBuffer>& buffer,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setVertexDeclaration */
+		void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::setDrawOperation */
+		void setDrawOperation(DrawOperationType op,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::draw */
+		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::drawIndexed */
+		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::dispatchCompute */
+		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
+		/** @copydoc RenderAPI::swapBuffers() */
+		void swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask = 0xFFFFFFFF) override;
+
+		/** @copydoc RenderAPI::addCommands() */
+		void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) override;
+
+		/** @copydoc RenderAPI::submitCommandBuffer() */
+		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) override;
+
+		/** @copydoc RenderAPI::convertProjectionMatrix */
+		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
+
+		/** @copydoc RenderAPI::getAPIInfo */
+		const RenderAPIInfo& getAPIInfo() const override;
+
+		/** @copydoc RenderAPI::generateParamBlockDesc() */
+		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override;
+
+		/************************************************************************/
+		/* 				Internal use by null backend only						*/
+		/************************************************************************/
+
+		/** Returns statistics about all commands executed since the last call to resetStats(). */
+		const NullCommandStats& getStats() const { return mStats; }
+
+		/** Clears all command statistics, including the hash and the resource identifiers used for hashing. */
+		void resetStats();
+
+		/**
+		 * Determines if executed commands should be hashed. Hashing is disabled by default as it adds a per-command
+		 * cost that's not present in other render APIs.
+		 */
+		void setHashingEnabled(bool enabled) { mHashingEnabled = enabled; }
+
+	protected:
+		friend class NullRenderAPIFactory;
+
+		/** @copydoc RenderAPI::initialize */
+		void initialize() override;
+
+		/** @copydoc RenderAPI::destroyCore */
+		void destroyCore() override;
+
+		/** Creates and populates a set of render system capabilities describing which functionality is available. */
+		void initCapabilites(RenderAPICapabilities& caps) const;
+
+		/**
+		 * Executes the command immediately if no command buffer is provided, or queues it on the command buffer
+		 * otherwise.
+		 */
+		void recordCommand(const NullCommand& command, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Accounts for the command in the command statistics. */
+		void executeCommand(const NullCommand& command);
+
+		/**
+		 * Creates a new command of the specified type, hashing the provided parameters if hashing is enabled. Objects
+		 * should be provided through getObjectId().
+		 */
+		NullCommand createCommand(NullCommandType type, std::initializer_list<UINT64> params = {});
+
+		/**
+		 * Returns an identifier for the object that remains the same between runs, as long as objects are referenced in
+		 * the same order. Returns 0 for null objects, or if hashing is disabled.
+		 */
+		UINT64 getObjectId(const void* object);
+
+	private:
+		NullHLSLProgramFactory* mHLSLFactory;
+		DrawOperationType mActiveDrawOp;
+
+		NullCommandStats mStats;
+		bool mHashingEnabled;
+		UnorderedMap<const void*, UINT64> mObjectIds;
+	};
+
+	/**	Provides easy access to the null render API implementation. */
+	NullRenderAPI& gNullRenderAPI();
+
+	/** @} */
+}}
@@ -0,0 +1,16 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPIFactory.h"
+#include "RenderAPI/BsRenderAPI.h"
+
+namespace bs { namespace ct
+{
+	const char* SystemName = "BansheeNullRenderAPI";
+
+	void NullRenderAPIFactory::create()
+	{
+		RenderAPI::startUp<NullRenderAPI>();
+	}
+
+	NullRenderAPIFactory::InitOnStart NullRenderAPIFactory::initOnStart;
+}}
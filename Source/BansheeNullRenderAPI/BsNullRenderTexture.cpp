@@ -0,0 +1,17 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderTexture.h"
+
+namespace bs
+{
+	NullRenderTexture::NullRenderTexture(const RENDER_TEXTURE_DESC& desc)
+		:RenderTexture(desc), mProperties(desc, false)
+	{ }
+
+	namespace ct
+	{
+	NullRenderTexture::NullRenderTexture(const RENDER_TEXTURE_DESC& desc, UINT32 deviceIdx)
+		:RenderTexture(desc, deviceIdx), mProperties(desc, false)
+	{ }
+	}
+}
@@ -0,0 +1,146 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderWindow.h"
+#include "Managers/BsRenderWindowManager.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	NullRenderWindow::NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		:RenderWindow(desc, windowId), mProperties(desc)
+	{ }
+
+	void NullRenderWindow::getCustomAttribute(const String& name, void* pData) const
+	{
+		if (name == "WINDOW")
+		{
+			UINT64* windowHandle = (UINT64*)pData;
+			*windowHandle = 0;
+			return;
+		}
+
+		RenderWindow::getCustomAttribute(name, pData);
+	}
+
+	Vector2I NullRenderWindow::screenToWindowPos(const Vector2I& screenPos) const
+	{
+		return Vector2I(screenPos.x - mProperties.left, screenPos.y - mProperties.top);
+	}
+
+	Vector2I NullRenderWindow::windowToScreenPos(const Vector2I& windowPos) const
+	{
+		return Vector2I(windowPos.x + mProperties.left, windowPos.y + mProperties.top);
+	}
+
+	SPtr<ct::NullRenderWindow> NullRenderWindow::getCore() const
+	{
+		return std::static_pointer_cast<ct::NullRenderWindow>(mCoreSpecific);
+	}
+
+	void NullRenderWindow::syncProperties()
+	{
+		ScopedSpinLock lock(getCore()->mLock);
+		mProperties = getCore()->mSyncedProperties;
+	}
+
+	namespace ct
+	{
+	NullRenderWindow::NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		: RenderWindow(desc, windowId), mProperties(desc), mSyncedProperties(desc)
+	{ }
+
+	void NullRenderWindow::initialize()
+	{
+		// Negative coordinates request a centered window, there is no screen to center on so just use the origin
+		RenderWindowProperties& props = mProperties;
+		props.left = std::max(props.left, 0);
+		props.top = std::max(props.top, 0);
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties = props;
+		}
+
+		bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+		RenderWindow::initialize();
+	}
+
+	void NullRenderWindow::move(INT32 left, INT32 top)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderWindowProperties& props = mProperties;
+		if (!props.isFullScreen)
+		{
+			props.left = left;
+			props.top = top;
+
+			{
+				ScopedSpinLock lock(mLock);
+				mSyncedProperties.left = props.left;
+				mSyncedProperties.top = props.top;
+			}
+
+			bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+		}
+	}
+
+	void NullRenderWindow::resize(UINT32 width, UINT32 height)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderWindowProperties& props = mProperties;
+		if (!props.isFullScreen)
+		{
+			props.width = width;
+			props.height = height;
+
+			{
+				ScopedSpinLock lock(mLock);
+				mSyncedProperties.width = props.width;
+				mSyncedProperties.height = props.height;
+			}
+
+			bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+			_windowMovedOrResized();
+		}
+	}
+
+	void NullRenderWindow::setVSync(bool enabled, UINT32 interval)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if(!enabled)
+			interval = 0;
+
+		mProperties.vsync = enabled;
+		mProperties.vsyncInterval = interval;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties.vsync = enabled;
+			mSyncedProperties.vsyncInterval = interval;
+		}
+
+		bs::RenderWindowManager::instance().notifySyncDataDirty(this);
+	}
+
+	void NullRenderWindow::getCustomAttribute(const String& name, void* pData) const
+	{
+		if (name == "WINDOW")
+		{
+			UINT64* windowHandle = (UINT64*)pData;
+			*windowHandle = 0;
+			return;
+		}
+
+		RenderWindow::getCustomAttribute(name, pData);
+	}
+
+	void NullRenderWindow::syncProperties()
+	{
+		ScopedSpinLock lock(mLock);
+		mProperties = mSyncedProperties;
+	}
+	}
+}
@@ -0,0 +1,28 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderWindowManager.h"
+#include "BsNullRenderWindow.h"
+
+namespace bs
+{
+	SPtr<RenderWindow> NullRenderWindowManager::createImpl(RENDER_WINDOW_DESC& desc, UINT32 windowId, 
+		const SPtr<RenderWindow>& parentWindow)
+	{
+		NullRenderWindow* renderWindow = new (bs_alloc<NullRenderWindow>()) NullRenderWindow(desc, windowId);
+		return bs_core_ptr<NullRenderWindow>(renderWindow);
+	}
+
+	namespace ct
+	{
+	SPtr<RenderWindow> NullRenderWindowManager::createInternal(RENDER_WINDOW_DESC& desc, UINT32 windowId)
+	{
+		NullRenderWindow* renderWindow = new (bs_alloc<NullRenderWindow>()) NullRenderWindow(desc, windowId);
+		SPtr<NullRenderWindow> renderWindowPtr = bs_shared_ptr<NullRenderWindow>(renderWindow);
+
+		renderWindowPtr->_setThisPtr(renderWindowPtr);
+		windowCreated(renderWindow);
+
+		return renderWindowPtr;
+	}
+	}
+}
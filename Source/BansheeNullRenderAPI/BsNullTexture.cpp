@@ -0,0 +1,65 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTexture.h"
+
+namespace bs { namespace ct
+{
+	NullTexture::NullTexture(const TEXTURE_DESC& desc, const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask)
+		: Texture(desc, initialData, deviceMask), mStagingBuffer(nullptr)
+	{ }
+
+	NullTexture::~NullTexture()
+	{
+		if (mStagingBuffer != nullptr)
+			bs_free(mStagingBuffer);
+	}
+
+	PixelData NullTexture::lockImpl(GpuLockOptions options, UINT32 mipLevel, UINT32 face, UINT32 deviceIdx,
+		UINT32 queueIdx)
+	{
+		if (mProperties.getNumSamples() > 1)
+			BS_EXCEPT(InvalidStateException, "Multisampled textures cannot be accessed from the CPU directly.");
+
+		UINT32 mipWidth = std::max(1u, mProperties.getWidth() >> mipLevel);
+		UINT32 mipHeight = std::max(1u, mProperties.getHeight() >> mipLevel);
+		UINT32 mipDepth = std::max(1u, mProperties.getDepth() >> mipLevel);
+
+		PixelData lockedArea(mipWidth, mipHeight, mipDepth, mProperties.getFormat());
+
+		mStagingBuffer = (UINT8*)bs_alloc(lockedArea.getSize());
+		memset(mStagingBuffer, 0, lockedArea.getSize());
+
+		lockedArea.setExternalBuffer(mStagingBuffer);
+		return lockedArea;
+	}
+
+	void NullTexture::unlockImpl()
+	{
+		bs_free(mStagingBuffer);
+		mStagingBuffer = nullptr;
+	}
+
+	void NullTexture::copyImpl(const SPtr<Texture>& target, const TEXTURE_COPY_DESC& desc,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		// Contents aren't retained, nothing to copy
+	}
+
+	void NullTexture::readDataImpl(PixelData& dest, UINT32 mipLevel, UINT32 face, UINT32 deviceIdx, UINT32 queueIdx)
+	{
+		if (mProperties.getNumSamples() > 1)
+		{
+			LOGERR("Multisampled textures cannot be accessed from the CPU directly.");
+			return;
+		}
+
+		memset(dest.getData(), 0, dest.getSize());
+	}
+
+	void NullTexture::writeDataImpl(const PixelData& src, UINT32 mipLevel, UINT32 face, bool discardWholeBuffer,
+		UINT32 queueIdx)
+	{
+		if (mProperties.getNumSamples() > 1)
+			LOGERR("Multisampled textures cannot be accessed from the CPU directly.");
+	}
+}}
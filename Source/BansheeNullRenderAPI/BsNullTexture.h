@@ -0,0 +1,51 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "Image/BsTexture.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/**
+	 * Null render API implementation of a texture. Texture contents are not retained, writes are discarded and reads
+	 * return zeroed data. Locking provides a temporary staging buffer that is released on unlock.
+	 */
+	class NullTexture : public Texture
+	{
+	public:
+		~NullTexture();
+
+	protected:
+		friend class NullTextureManager;
+
+		NullTexture(const TEXTURE_DESC& desc, const SPtr<PixelData>& initialData, GpuDeviceFlags deviceMask);
+
+		/** @copydoc Texture::lockImpl */
+		PixelData lockImpl(GpuLockOptions options, UINT32 mipLevel = 0, UINT32 face = 0, UINT32 deviceIdx = 0,
+			UINT32 queueIdx = 0) override;
+
+		/** @copydoc Texture::unlockImpl */
+		void unlockImpl() override;
+
+		/** @copydoc Texture::copyImpl */
+		void copyImpl(const SPtr<Texture>& target, const TEXTURE_COPY_DESC& desc, 
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc Texture::readDataImpl */
+		void readDataImpl(PixelData& dest, UINT32 mipLevel = 0, UINT32 face = 0, UINT32 deviceIdx = 0,
+			UINT32 queueIdx = 0) override;
+
+		/** @copydoc Texture::writeDataImpl */
+		void writeDataImpl(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, 
+			bool discardWholeBuffer = false, UINT32 queueIdx = 0) override;
+
+		UINT8* mStagingBuffer;
+	};
+
+	/** @} */
+}}
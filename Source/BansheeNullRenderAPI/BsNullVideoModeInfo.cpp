@@ -0,0 +1,23 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullVideoModeInfo.h"
+
+namespace bs { namespace ct
+{
+	NullVideoOutputInfo::NullVideoOutputInfo()
+	{
+		mName = "Null output";
+
+		mVideoModes.push_back(bs_new<VideoMode>(1280, 720, 60.0f, 0));
+		mVideoModes.push_back(bs_new<VideoMode>(1920, 1080, 60.0f, 0));
+		mVideoModes.push_back(bs_new<VideoMode>(2560, 1440, 60.0f, 0));
+		mVideoModes.push_back(bs_new<VideoMode>(3840, 2160, 60.0f, 0));
+
+		mDesktopVideoMode = bs_new<VideoMode>(1920, 1080, 60.0f, 0);
+	}
+
+	NullVideoModeInfo::NullVideoModeInfo()
+	{
+		mOutputs.push_back(bs_new<NullVideoOutputInfo>());
+	}
+}}
@@ -0,0 +1,29 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "RenderAPI/BsVideoModeInfo.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup NullRenderAPI
+	 *  @{
+	 */
+
+	/** @copydoc VideoOutputInfo */
+	class NullVideoOutputInfo : public VideoOutputInfo
+	{
+	public:
+		NullVideoOutputInfo();
+	};
+
+	/** Reports a single virtual output device with a fixed set of common video modes. */
+	class NullVideoModeInfo : public VideoModeInfo
+	{
+	public:
+		NullVideoModeInfo();
+	};
+
+	/** @} */
+}}
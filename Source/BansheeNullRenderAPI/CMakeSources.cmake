@@ -0,0 +1,50 @@
+set(BS_BANSHEENULLRENDERAPI_INC_NOFILTER
+	"BsNullCommandBuffer.h"
+	"BsNullCommandBufferManager.h"
+	"BsNullCommandStats.h"
+	"BsNullGpuParamBlockBuffer.h"
+	"BsNullGpuProgram.h"
+	"BsNullHLSLParamParser.h"
+	"BsNullHLSLProgramFactory.h"
+	"BsNullHardwareBuffer.h"
+	"BsNullHardwareBufferManager.h"
+	"BsNullPrerequisites.h"
+	"BsNullQuery.h"
+	"BsNullQueryManager.h"
+	"BsNullRenderAPI.h"
+	"BsNullRenderAPIFactory.h"
+	"BsNullRenderTexture.h"
+	"BsNullRenderWindow.h"
+	"BsNullRenderWindowManager.h"
+	"BsNullTexture.h"
+	"BsNullTextureManager.h"
+	"BsNullVideoModeInfo.h"
+)
+
+set(BS_BANSHEENULLRENDERAPI_SRC_NOFILTER
+	"BsNullCommandBuffer.cpp"
+	"BsNullCommandBufferManager.cpp"
+	"BsNullGpuParamBlockBuffer.cpp"
+	"BsNullGpuProgram.cpp"
+	"BsNullHLSLParamParser.cpp"
+	"BsNullHLSLProgramFactory.cpp"
+	"BsNullHardwareBufferManager.cpp"
+	"BsNullPlugin.cpp"
+	"BsNullQueryManager.cpp"
+	"BsNullRenderAPI.cpp"
+	"BsNullRenderAPIFactory.cpp"
+	"BsNullRenderTexture.cpp"
+	"BsNullRenderWindow.cpp"
+	"BsNullRenderWindowManager.cpp"
+	"BsNullTexture.cpp"
+	"BsNullTextureManager.cpp"
+	"BsNullVideoModeInfo.cpp"
+)
+
+source_group("Header Files" FILES ${BS_BANSHEENULLRENDERAPI_INC_NOFILTER})
+source_group("Source Files" FILES ${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER})
+
+set(BS_BANSHEENULLRENDERAPI_SRC
+	${BS_BANSHEENULLRENDERAPI_INC_NOFILTER}
+	${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER}
+)
@@ -17,6 +17,9 @@
 #define XSC_ENABLE_LANGUAGE_EXT 1
 #include "Xsc/Xsc.h"
 #include "Material/BsShaderVariation.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
 
 extern "C" {
 #include "BsMMAlloc.h"
@@ -321,7 +324,7 @@ namespace bs
 		}
 	}
 
-	SPtr<SamplerState> parseSamplerState(const Xsc::Reflection::SamplerState& sampState)
+	SAMPLER_STATE_DESC parseSamplerState(const Xsc::Reflection::SamplerState& sampState)
 	{
 		SAMPLER_STATE_DESC desc;
 
@@ -400,128 +403,11 @@ namespace bs
 			break;
 		}
 		
-		return SamplerState::create(desc);
-	}
-
-	void parseParameters(const Xsc::Reflection::ReflectionData& reflData, SHADER_DESC& desc)
-	{
-		for(auto& entry : reflData.uniforms)
-		{
-			if ((entry.flags & Xsc::Reflection::Uniform::Flags::Internal) != 0)
-				continue;
-
-			String ident = entry.ident.c_str();
-			switch(entry.type)
-			{
-			case Xsc::Reflection::UniformType::UniformBuffer:
-				desc.setParamBlockAttribs(entry.ident.c_str(), false, GPBU_STATIC);
-				break;
-			case Xsc::Reflection::UniformType::Buffer:
-				{
-					GpuParamObjectType objType = ReflTypeToTextureType((Xsc::Reflection::BufferType)entry.baseType);
-					if(objType != GPOT_UNKNOWN)
-					{
-						// Ignore parameters that were already registered in some previous variation. Note that this implies
-						// you cannot have same names for different parameters in different variations.
-						if (desc.textureParams.find(ident) != desc.textureParams.end())
-							continue;
-
-						if (entry.defaultValue == -1)
-							desc.addParameter(ident, ident, objType);
-						else
-							desc.addParameter(ident, ident, objType, getBuiltinTexture(entry.defaultValue));
-					}
-					else
-					{
-						// Ignore parameters that were already registered in some previous variation. Note that this implies
-						// you cannot have same names for different parameters in different variations.
-						if (desc.bufferParams.find(ident) != desc.bufferParams.end())
-							continue;
-
-						objType = ReflTypeToBufferType((Xsc::Reflection::BufferType)entry.baseType);
-						desc.addParameter(ident, ident, objType);
-					}
-				}
-				break;
-			case Xsc::Reflection::UniformType::Sampler: 
-			{
-				auto findIter = reflData.samplerStates.find(entry.ident);
-				if (findIter != reflData.samplerStates.end())
-				{
-					// Ignore parameters that were already registered in some previous variation. Note that this implies
-					// you cannot have same names for different parameters in different variations.
-					if(desc.samplerParams.find(ident) != desc.samplerParams.end())
-						continue;
-
-					String alias = findIter->second.alias.c_str();
-
-					if(findIter->second.isNonDefault)
-					{
-						SPtr<SamplerState> defaultVal = parseSamplerState(findIter->second);
-						desc.addParameter(ident, ident, GPOT_SAMPLER2D, defaultVal);
-
-						if (!alias.empty())
-							desc.addParameter(ident, alias, GPOT_SAMPLER2D, defaultVal);
-					}
-					else
-					{
-						desc.addParameter(ident, ident, GPOT_SAMPLER2D);
-
-						if (!alias.empty())
-							desc.addParameter(ident, alias, GPOT_SAMPLER2D);
-					}
-				}
-				else
-				{
-					desc.addParameter(ident, ident, GPOT_SAMPLER2D);
-				}
-				break;
-			}
-			case Xsc::Reflection::UniformType::Variable: 
-			{
-				bool isBlockInternal = false;
-				if(entry.uniformBlock != -1)
-				{
-					std::string blockName = reflData.constantBuffers[entry.uniformBlock].ident;
-					for (auto& uniform : reflData.uniforms)
-					{
-						if (uniform.type == Xsc::Reflection::UniformType::UniformBuffer && uniform.ident == blockName)
-						{
-							isBlockInternal = (uniform.flags & Xsc::Reflection::Uniform::Flags::Internal) != 0;
-							break;
-						}
-					}
-				}
-
-				if (!isBlockInternal)
-				{
-					GpuParamDataType type = ReflTypeToDataType((Xsc::Reflection::DataType)entry.baseType);
-					if ((entry.flags & Xsc::Reflection::Uniform::Flags::Color) != 0 &&
-						(type == GPDT_FLOAT3 || type == GPDT_FLOAT4))
-					{
-						type = GPDT_COLOR;
-					}
-
-					if (entry.defaultValue == -1)
-						desc.addParameter(ident, ident, type);
-					else
-					{
-						const Xsc::Reflection::DefaultValue& defVal = reflData.defaultValues[entry.defaultValue];
-
-						desc.addParameter(ident, ident, type, StringID::NONE, 1, 0, (UINT8*)defVal.matrix);
-					}
-				}
-			}
-				break;
-			case Xsc::Reflection::UniformType::Struct:
-				break;
-			default: ;
-			}
-		}
+		return desc;
 	}
 
 	String crossCompile(const String& hlsl, GpuProgramType type, bool vulkan, bool optionalEntry, UINT32& startBindingSlot,
-		SHADER_DESC* shaderDesc = nullptr, Vector<GpuProgramType>* detectedTypes = nullptr)
+		Xsc::Reflection::ReflectionData* reflData = nullptr, Vector<GpuProgramType>* detectedTypes = nullptr)
 	{
 		SPtr<StringStream> input = bs_shared_ptr_new<StringStream>();
 
@@ -656,22 +542,274 @@ namespace bs
 			}
 		}
 
-		if (shaderDesc != nullptr)
-			parseParameters(reflectionData, *shaderDesc);
+		if (reflData != nullptr)
+			*reflData = std::move(reflectionData);
 
 		return output.str();
 	}
 
+	/** 
+	 * Version of the cross compiled code cache format. Increment whenever the cache contents become invalid, including
+	 * changes to the way reflected parameters are parsed or encoded.
+	 */
+	static const UINT32 CROSS_COMPILE_CACHE_VERSION = 2;
+
+	/** 
+	 * Maximum size of the cross compiled code cache, in bytes. When exceeded the least recently written entries are
+	 * removed until the cache is trimmed down to CROSS_COMPILE_CACHE_TRIM_SIZE.
+	 */
+	static const UINT64 CROSS_COMPILE_CACHE_MAX_SIZE = 256 * 1024 * 1024;
+
+	/** Size the cross compiled code cache is reduced to once it exceeds CROSS_COMPILE_CACHE_MAX_SIZE. */
+	static const UINT64 CROSS_COMPILE_CACHE_TRIM_SIZE = 192 * 1024 * 1024;
+
+	/** Age in seconds after which temporary files left over from interrupted cache writes are removed. */
+	static const std::time_t CROSS_COMPILE_CACHE_TEMP_FILE_LIFETIME = 24 * 60 * 60;
+
+	/** Used for generating unique names for cache files while they are being written. */
+	static std::atomic<UINT32> gCrossCompileCacheTempIdx { 0 };
+
+	/** Returns the folder containing cached cross compiler output. */
+	Path getCrossCompileCacheFolder()
+	{
+		Path path = FileSystem::getTempDirectoryPath();
+		path.append("BansheeShaderCache/");
+
+		return path;
+	}
+
+	/** 
+	 * Removes the oldest entries from the cross compiled code cache if it grew larger than the maximum allowed size, as
+	 * well as any stale temporary files. Should not be called while cache entries are being read or written from this
+	 * process.
+	 */
+	void trimCrossCompileCache(const Path& folder)
+	{
+		struct CacheEntry
+		{
+			Path path;
+			std::time_t time;
+			UINT64 size;
+		};
+
+		Vector<CacheEntry> entries;
+		UINT64 totalSize = 0;
+		std::time_t now = std::time(nullptr);
+
+		auto fileCallback = [&](const Path& path)
+		{
+			std::time_t time = FileSystem::getLastModifiedTime(path);
+
+			if (path.getExtension() == ".xsc")
+			{
+				UINT64 size = FileSystem::getFileSize(path);
+				entries.push_back({ path, time, size });
+				totalSize += size;
+			}
+			else if ((now - time) > CROSS_COMPILE_CACHE_TEMP_FILE_LIFETIME) // Left over from an interrupted write
+				FileSystem::remove(path);
+
+			return true;
+		};
+
+		FileSystem::iterate(folder, fileCallback, nullptr, false);
+
+		if (totalSize <= CROSS_COMPILE_CACHE_MAX_SIZE)
+			return;
+
+		std::sort(entries.begin(), entries.end(), 
+			[](const CacheEntry& lhs, const CacheEntry& rhs) { return lhs.time < rhs.time; });
+
+		for (auto& entry : entries)
+		{
+			if (totalSize <= CROSS_COMPILE_CACHE_TRIM_SIZE)
+				break;
+
+			FileSystem::remove(entry.path);
+			totalSize -= entry.size;
+		}
+	}
+
+	/** 
+	 * Prepares the cross compiled code cache folder for use, creating it if it doesn't exist or trimming it if it grew
+	 * too large. Only does work on the first call, and must be called before any cache reads or writes.
+	 */
+	void initCrossCompileCache()
+	{
+		static std::once_flag initFlag;
+		std::call_once(initFlag, []()
+		{
+			Path cacheFolder = getCrossCompileCacheFolder();
+			if (!FileSystem::exists(cacheFolder))
+				FileSystem::createDir(cacheFolder);
+			else
+				trimCrossCompileCache(cacheFolder);
+		});
+	}
+
+	/** Returns the path of the cache entry for the provided key. */
+	Path getCrossCompileCachePath(const String& key)
+	{
+		size_t hash = 0;
+		hash_combine(hash, key);
+
+		Path path = getCrossCompileCacheFolder();
+		path.append(toString((UINT64)hash, 16, '0', std::ios::hex) + ".xsc");
+
+		return path;
+	}
+
+	/** 
+	 * Attempts to find cross compiled code (or other cross compiler output) for the provided key in the on-disk cache.
+	 * Returns true and populates the outputs if found. The key stored in the cache entry is compared in full, so an
+	 * entry is never returned for different input, even if the file names of the two entries collide.
+	 */
+	bool readCrossCompileCache(const Path& path, const String& key, String& output, UINT32& endBindingSlot)
+	{
+		if (!FileSystem::isFile(path))
+			return false;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return false;
+
+		UINT32 version = 0;
+		UINT64 keySize = 0;
+		UINT32 bindingSlot = 0;
+
+		size_t headerSize = sizeof(version) + sizeof(keySize) + sizeof(bindingSlot);
+		if (stream->size() < headerSize)
+			return false;
+
+		stream->read(&version, sizeof(version));
+		stream->read(&keySize, sizeof(keySize));
+
+		if (version != CROSS_COMPILE_CACHE_VERSION || keySize != (UINT64)key.size())
+			return false;
+
+		headerSize += (size_t)keySize;
+		if (stream->size() < headerSize)
+			return false;
+
+		String storedKey;
+		storedKey.resize((size_t)keySize);
+
+		if (keySize > 0)
+			stream->read(&storedKey[0], (size_t)keySize);
+
+		if (storedKey != key)
+			return false;
+
+		stream->read(&bindingSlot, sizeof(bindingSlot));
+
+		size_t codeSize = stream->size() - headerSize;
+		output.resize(codeSize);
+
+		if (codeSize > 0)
+			stream->read(&output[0], codeSize);
+
+		endBindingSlot = bindingSlot;
+		return true;
+	}
+
+	/** 
+	 * Writes cross compiled code (or other cross compiler output) into the on-disk cache. Cache folder is expected to
+	 * exist.
+	 */
+	void writeCrossCompileCache(const Path& path, const String& key, const String& output, UINT32 endBindingSlot)
+	{
+		// Multiple variations can generate the same code, so write to a unique file and move it in place when done,
+		// in order to avoid other threads reading partially written files
+		Path tempPath = path;
+		tempPath.setFilename(path.getFilename() + ".tmp" + toString(gCrossCompileCacheTempIdx.fetch_add(1)));
+
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(tempPath);
+			if (stream == nullptr)
+				return;
+
+			UINT32 version = CROSS_COMPILE_CACHE_VERSION;
+			UINT64 keySize = (UINT64)key.size();
+
+			stream->write(&version, sizeof(version));
+			stream->write(&keySize, sizeof(keySize));
+			stream->write(key.data(), key.size());
+			stream->write(&endBindingSlot, sizeof(endBindingSlot));
+			stream->write(output.data(), output.size());
+			stream->close();
+		}
+
+		FileSystem::move(tempPath, path, true);
+	}
+
 	// Convert HLSL code to GLSL
 	String HLSLtoGLSL(const String& hlsl, GpuProgramType type, bool vulkan, UINT32& startBindingSlot)
 	{
-		return crossCompile(hlsl, type, vulkan, false, startBindingSlot);
+		// Output depends only on the (already preprocessed) input code, compile options and the compiler version, so
+		// identical code from different variations or imports shares the same cache entry. The full key is stored in
+		// the entry and compared on read, the hash is only used for naming the file.
+		StringStream keyStream;
+		keyStream << XSC_VERSION_STRING << "\n" << (UINT32)type << "\n" << vulkan << "\n" << startBindingSlot << "\n" << hlsl;
+		String key = keyStream.str();
+		Path cachePath = getCrossCompileCachePath(key);
+
+		String output;
+		if (readCrossCompileCache(cachePath, key, output, startBindingSlot))
+			return output;
+
+		output = crossCompile(hlsl, type, vulkan, false, startBindingSlot);
+
+		// Don't cache failures, so the errors get reported on every import
+		if (!output.empty())
+			writeCrossCompileCache(cachePath, key, output, startBindingSlot);
+
+		return output;
 	}
 
-	void reflectHLSL(const String& hlsl, SHADER_DESC& shaderDesc, Vector<GpuProgramType>& entryPoints)
+	void reflectHLSL(const String& hlsl, Xsc::Reflection::ReflectionData& reflData, Vector<GpuProgramType>& entryPoints)
 	{
 		UINT32 dummy = 0;
-		crossCompile(hlsl, GPT_VERTEX_PROGRAM, false, true, dummy, &shaderDesc, &entryPoints);
+		crossCompile(hlsl, GPT_VERTEX_PROGRAM, false, true, dummy, &reflData, &entryPoints);
+	}
+
+	/** Appends the binary representation of a trivially copyable value to a cache entry. */
+	template<class T>
+	void writeCacheValue(String& data, const T& value)
+	{
+		data.append((const char*)&value, sizeof(value));
+	}
+
+	/** Appends a string to a cache entry, prefixed with its length. */
+	void writeCacheValue(String& data, const String& value)
+	{
+		writeCacheValue(data, (UINT32)value.size());
+		data.append(value);
+	}
+
+	/** Reads a value written by writeCacheValue() and advances the offset. Returns false if there's not enough data. */
+	template<class T>
+	bool readCacheValue(const String& data, size_t& offset, T& value)
+	{
+		if (data.size() - offset < sizeof(value))
+			return false;
+
+		memcpy(&value, &data[offset], sizeof(value));
+		offset += sizeof(value);
+
+		return true;
+	}
+
+	/** Reads a string written by writeCacheValue() and advances the offset. Returns false if there's not enough data. */
+	bool readCacheValue(const String& data, size_t& offset, String& value)
+	{
+		UINT32 size;
+		if (!readCacheValue(data, offset, size) || data.size() - offset < size)
+			return false;
+
+		value = data.substr(offset, size);
+		offset += size;
+
+		return true;
 	}
 
 	BSLFXCompileResult BSLFXCompiler::compile(const String& name, const String& source, 
@@ -801,7 +939,7 @@ namespace bs
 			parseStateDelete(parseState);
 
 			// Build a list of different variations and re-parse the source using the relevant defines
-			Vector<SPtr<Technique>> techniques;
+			Vector<VariationTechniqueData> variationData;
 			UnorderedSet<String> includes;
 			for (auto& entry : techniqueMetaData)
 			{
@@ -885,7 +1023,8 @@ namespace bs
 					}
 				}
 
-				// For every variation, re-parse the file with relevant defines
+				// For every variation, re-parse the file with relevant defines. Parsing is kept on this thread since
+				// includes are resolved through the importer.
 				for(auto& variation : variations)
 				{
 					UnorderedMap<String, String> globalDefines = defines;
@@ -912,8 +1051,12 @@ namespace bs
 							codeString = codeString->next;
 						}
 
-						output = parseTechnique(variationParseState, entry.second.name, codeBlocks, variation, techniques, 
-							includes, shaderDesc);
+						variationData.push_back(VariationTechniqueData());
+						VariationTechniqueData& data = variationData.back();
+						data.variation = variation;
+
+						output = parseTechnique(variationParseState, entry.second.name, codeBlocks, data.techniques,
+							includes);
 
 						if(!output.errorMessage.empty())
 							return output;
@@ -921,6 +1064,50 @@ namespace bs
 				}
 			}
 
+			// Reflect and cross-compile all variations in parallel. Note that only this step runs in parallel: parsing
+			// above stays on this thread (includes are resolved through the importer), and backend compilation of the
+			// generated code (e.g. glslang) happens on the core thread when the GPU programs get initialized.
+			UINT32 numVariations = (UINT32)variationData.size();
+
+			// Prepare the cache folder up front, rather than having the workers race to create it
+			initCrossCompileCache();
+
+			Vector<SPtr<Task>> tasks;
+			if (numVariations > 1)
+			{
+				tasks.reserve(numVariations - 1);
+
+				// First variation gets processed on this thread
+				for (UINT32 i = 1; i < numVariations; i++)
+				{
+					SPtr<Task> task = Task::create("ShaderVariationCompile", 
+						std::bind(&BSLFXCompiler::generateCode, std::ref(variationData[i].techniques)));
+					TaskScheduler::instance().addTask(task);
+
+					tasks.push_back(task);
+				}
+			}
+
+			if (numVariations > 0)
+				generateCode(variationData[0].techniques);
+
+			for (auto& task : tasks)
+				task->wait();
+
+			// Register parameters and create GPU programs in variation order, so the results are the same as if the
+			// variations were compiled sequentially
+			Vector<SPtr<Technique>> techniques;
+			for (auto& entry : variationData)
+			{
+				for (auto& technique : entry.techniques)
+				{
+					for (auto& pass : technique.passes)
+						applyParameters(pass.params, shaderDesc);
+				}
+
+				createTechniques(entry.techniques, entry.variation, techniques);
+			}
+
 			// Generate a shader from the parsed techniques
 			Vector<String> includeArray;
 			for (auto& entry : includes)
@@ -1761,8 +1948,7 @@ namespace bs
 	}
 
 	BSLFXCompileResult BSLFXCompiler::parseTechnique(ParseState* parseState, const String& name, 
-		const Vector<String>& codeBlocks, const ShaderVariation& variation, Vector<SPtr<Technique>>& techniques, 
-		UnorderedSet<String>& includes, SHADER_DESC& shaderDesc)
+		const Vector<String>& codeBlocks, Vector<TechniqueData>& techniques, UnorderedSet<String>& includes)
 	{
 		BSLFXCompileResult output;
 
@@ -1890,17 +2076,24 @@ namespace bs
 
 		parseStateDelete(parseState);
 
+		for (auto& entry : techniqueData)
+		{
+			if (!entry.second.metaData.isMixin)
+				techniques.push_back(entry.second);
+		}
+
+		return output;
+	}
+
+	void BSLFXCompiler::generateCode(Vector<TechniqueData>& techniques)
+	{
 		// Parse extended HLSL code and generate per-program code, also convert to GLSL/VKSL
-		UINT32 end = (UINT32)techniqueData.size();
+		UINT32 end = (UINT32)techniques.size();
 		for(UINT32 i = 0; i < end; i++)
 		{
-			const TechniqueMetaData& metaData = techniqueData[i].second.metaData;
-			if (metaData.isMixin)
-				continue;
+			TechniqueData& hlslTechnique = techniques[i];
 
-			TechniqueData& hlslTechnique = techniqueData[i].second;
-
-			TechniqueData glslTechnique = techniqueData[i].second;
+			TechniqueData glslTechnique = techniques[i];
 
 			// When working with OpenGL, lower-end feature sets are supported. For other backends, high-end is always assumed.
 			if(glslTechnique.metaData.featureSet == "HighEnd")
@@ -1908,7 +2101,7 @@ namespace bs
 			else
 				glslTechnique.metaData.language = "glsl4_1";
 
-			TechniqueData vkslTechnique = techniqueData[i].second;
+			TechniqueData vkslTechnique = techniques[i];
 			vkslTechnique.metaData.language = "vksl";
 
 			UINT32 numPasses = (UINT32)hlslTechnique.passes.size();
@@ -1928,7 +2121,7 @@ namespace bs
 				// type. If performance is ever important here it could be good to update XShaderCompiler so it can
 				// somehow save the AST and then re-use it for multiple actions.
 				Vector<GpuProgramType> types;
-				reflectHLSL(glslPassData.code, shaderDesc, types);
+				reflect(glslPassData.code, hlslPassData.params, types);
 
 				UINT32 glslBinding = 0;
 				UINT32 vkslBinding = 0;
@@ -1977,18 +2170,20 @@ namespace bs
 				}
 			}
 
-			techniqueData.push_back(std::make_pair(nullptr, glslTechnique));
-			techniqueData.push_back(std::make_pair(nullptr, vkslTechnique));
+			techniques.push_back(glslTechnique);
+			techniques.push_back(vkslTechnique);
 		}
+	}
 
+	void BSLFXCompiler::createTechniques(const Vector<TechniqueData>& techniqueData, const ShaderVariation& variation,
+		Vector<SPtr<Technique>>& techniques)
+	{
 		for(auto& entry : techniqueData)
 		{
-			const TechniqueMetaData& metaData = entry.second.metaData;
-			if (metaData.isMixin)
-				continue;
+			const TechniqueMetaData& metaData = entry.metaData;
 
 			Map<UINT32, SPtr<Pass>, std::greater<UINT32>> passes;
-			for (auto& passData : entry.second.passes)
+			for (auto& passData : entry.passes)
 			{
 				PASS_DESC passDesc;
 
@@ -2070,8 +2265,291 @@ namespace bs
 				techniques.push_back(technique);
 			}
 		}
+	}
 
-		return output;
+	void BSLFXCompiler::reflect(const String& hlsl, Vector<ReflectedParam>& params, Vector<GpuProgramType>& types)
+	{
+		// Reflection output depends only on the code and the compiler version. Same as with cross compiled code, the
+		// full key is stored in the cache entry and compared on read.
+		StringStream keyStream;
+		keyStream << XSC_VERSION_STRING << "\n" << "reflection" << "\n" << hlsl;
+		String key = keyStream.str();
+		Path cachePath = getCrossCompileCachePath(key);
+
+		String data;
+		UINT32 dummy = 0;
+		if (readCrossCompileCache(cachePath, key, data, dummy))
+		{
+			Vector<ReflectedParam> cachedParams;
+			Vector<GpuProgramType> cachedTypes;
+			if (decodeReflection(data, cachedParams, cachedTypes))
+			{
+				params.insert(params.end(), cachedParams.begin(), cachedParams.end());
+				types.insert(types.end(), cachedTypes.begin(), cachedTypes.end());
+
+				return;
+			}
+		}
+
+		Vector<ReflectedParam> newParams;
+		Vector<GpuProgramType> newTypes;
+
+		Xsc::Reflection::ReflectionData reflData;
+		reflectHLSL(hlsl, reflData, newTypes);
+		parseParameters(reflData, newParams);
+
+		// Don't cache failures (no entry points found), so the errors get reported on every import
+		if (!newTypes.empty())
+			writeCrossCompileCache(cachePath, key, encodeReflection(newParams, newTypes), 0);
+
+		params.insert(params.end(), newParams.begin(), newParams.end());
+		types.insert(types.end(), newTypes.begin(), newTypes.end());
+	}
+
+	String BSLFXCompiler::encodeReflection(const Vector<ReflectedParam>& params, const Vector<GpuProgramType>& types)
+	{
+		String data;
+
+		writeCacheValue(data, (UINT32)types.size());
+		for (auto& entry : types)
+			writeCacheValue(data, (UINT32)entry);
+
+		writeCacheValue(data, (UINT32)params.size());
+		for (auto& entry : params)
+		{
+			writeCacheValue(data, (UINT32)entry.kind);
+			writeCacheValue(data, entry.name);
+			writeCacheValue(data, entry.alias);
+			writeCacheValue(data, (UINT32)entry.objectType);
+			writeCacheValue(data, (UINT32)entry.dataType);
+			writeCacheValue(data, entry.defaultTexture);
+			writeCacheValue(data, entry.hasDefaultSampler);
+			writeCacheValue(data, entry.defaultSampler);
+			writeCacheValue(data, entry.hasDefaultValue);
+			writeCacheValue(data, entry.defaultValue);
+		}
+
+		return data;
+	}
+
+	bool BSLFXCompiler::decodeReflection(const String& data, Vector<ReflectedParam>& params, 
+		Vector<GpuProgramType>& types)
+	{
+		size_t offset = 0;
+
+		UINT32 numTypes;
+		if (!readCacheValue(data, offset, numTypes))
+			return false;
+
+		for (UINT32 i = 0; i < numTypes; i++)
+		{
+			UINT32 type;
+			if (!readCacheValue(data, offset, type))
+				return false;
+
+			types.push_back((GpuProgramType)type);
+		}
+
+		UINT32 numParams;
+		if (!readCacheValue(data, offset, numParams))
+			return false;
+
+		for (UINT32 i = 0; i < numParams; i++)
+		{
+			ReflectedParam param;
+			UINT32 kind, objectType, dataType;
+
+			bool valid = readCacheValue(data, offset, kind) &&
+				readCacheValue(data, offset, param.name) &&
+				readCacheValue(data, offset, param.alias) &&
+				readCacheValue(data, offset, objectType) &&
+				readCacheValue(data, offset, dataType) &&
+				readCacheValue(data, offset, param.defaultTexture) &&
+				readCacheValue(data, offset, param.hasDefaultSampler) &&
+				readCacheValue(data, offset, param.defaultSampler) &&
+				readCacheValue(data, offset, param.hasDefaultValue) &&
+				readCacheValue(data, offset, param.defaultValue);
+
+			if (!valid)
+				return false;
+
+			param.kind = (ReflectedParam::Kind)kind;
+			param.objectType = (GpuParamObjectType)objectType;
+			param.dataType = (GpuParamDataType)dataType;
+
+			params.push_back(param);
+		}
+
+		return offset == data.size();
+	}
+
+	void BSLFXCompiler::parseParameters(const Xsc::Reflection::ReflectionData& reflData, Vector<ReflectedParam>& params)
+	{
+		for(auto& entry : reflData.uniforms)
+		{
+			if ((entry.flags & Xsc::Reflection::Uniform::Flags::Internal) != 0)
+				continue;
+
+			ReflectedParam param;
+			param.name = entry.ident.c_str();
+
+			switch(entry.type)
+			{
+			case Xsc::Reflection::UniformType::UniformBuffer:
+				param.kind = ReflectedParam::Kind::ParamBlock;
+				params.push_back(param);
+				break;
+			case Xsc::Reflection::UniformType::Buffer:
+				{
+					GpuParamObjectType objType = ReflTypeToTextureType((Xsc::Reflection::BufferType)entry.baseType);
+					if(objType != GPOT_UNKNOWN)
+					{
+						param.kind = ReflectedParam::Kind::Texture;
+						param.objectType = objType;
+						param.defaultTexture = entry.defaultValue;
+					}
+					else
+					{
+						param.kind = ReflectedParam::Kind::Buffer;
+						param.objectType = ReflTypeToBufferType((Xsc::Reflection::BufferType)entry.baseType);
+					}
+
+					params.push_back(param);
+				}
+				break;
+			case Xsc::Reflection::UniformType::Sampler: 
+			{
+				param.kind = ReflectedParam::Kind::Sampler;
+				param.objectType = GPOT_SAMPLER2D;
+
+				auto findIter = reflData.samplerStates.find(entry.ident);
+				if (findIter != reflData.samplerStates.end())
+				{
+					param.alias = findIter->second.alias.c_str();
+
+					if(findIter->second.isNonDefault)
+					{
+						param.hasDefaultSampler = true;
+						param.defaultSampler = parseSamplerState(findIter->second);
+					}
+				}
+
+				params.push_back(param);
+				break;
+			}
+			case Xsc::Reflection::UniformType::Variable: 
+			{
+				bool isBlockInternal = false;
+				if(entry.uniformBlock != -1)
+				{
+					std::string blockName = reflData.constantBuffers[entry.uniformBlock].ident;
+					for (auto& uniform : reflData.uniforms)
+					{
+						if (uniform.type == Xsc::Reflection::UniformType::UniformBuffer && uniform.ident == blockName)
+						{
+							isBlockInternal = (uniform.flags & Xsc::Reflection::Uniform::Flags::Internal) != 0;
+							break;
+						}
+					}
+				}
+
+				if (!isBlockInternal)
+				{
+					GpuParamDataType type = ReflTypeToDataType((Xsc::Reflection::DataType)entry.baseType);
+					if ((entry.flags & Xsc::Reflection::Uniform::Flags::Color) != 0 &&
+						(type == GPDT_FLOAT3 || type == GPDT_FLOAT4))
+					{
+						type = GPDT_COLOR;
+					}
+
+					param.kind = ReflectedParam::Kind::Data;
+					param.dataType = type;
+
+					if (entry.defaultValue != -1)
+					{
+						const Xsc::Reflection::DefaultValue& defVal = reflData.defaultValues[entry.defaultValue];
+
+						static_assert(sizeof(defVal.matrix) == sizeof(param.defaultValue), "Default value size mismatch.");
+						memcpy(param.defaultValue, defVal.matrix, sizeof(param.defaultValue));
+						param.hasDefaultValue = true;
+					}
+
+					params.push_back(param);
+				}
+			}
+				break;
+			case Xsc::Reflection::UniformType::Struct:
+				break;
+			default: ;
+			}
+		}
+	}
+
+	void BSLFXCompiler::applyParameters(const Vector<ReflectedParam>& params, SHADER_DESC& desc)
+	{
+		for(auto& param : params)
+		{
+			const String& ident = param.name;
+
+			switch(param.kind)
+			{
+			case ReflectedParam::Kind::ParamBlock:
+				desc.setParamBlockAttribs(ident, false, GPBU_STATIC);
+				break;
+			case ReflectedParam::Kind::Texture:
+				// Ignore parameters that were already registered in some previous variation. Note that this implies
+				// you cannot have same names for different parameters in different variations.
+				if (desc.textureParams.find(ident) != desc.textureParams.end())
+					continue;
+
+				if (param.defaultTexture == -1)
+					desc.addParameter(ident, ident, param.objectType);
+				else
+					desc.addParameter(ident, ident, param.objectType, getBuiltinTexture(param.defaultTexture));
+				break;
+			case ReflectedParam::Kind::Buffer:
+				// Ignore parameters that were already registered in some previous variation. Note that this implies
+				// you cannot have same names for different parameters in different variations.
+				if (desc.bufferParams.find(ident) != desc.bufferParams.end())
+					continue;
+
+				desc.addParameter(ident, ident, param.objectType);
+				break;
+			case ReflectedParam::Kind::Sampler:
+			{
+				// Ignore parameters that were already registered in some previous variation. Note that this implies
+				// you cannot have same names for different parameters in different variations.
+				if(desc.samplerParams.find(ident) != desc.samplerParams.end())
+					continue;
+
+				if(param.hasDefaultSampler)
+				{
+					SPtr<SamplerState> defaultVal = SamplerState::create(param.defaultSampler);
+					desc.addParameter(ident, ident, param.objectType, defaultVal);
+
+					if (!param.alias.empty())
+						desc.addParameter(ident, param.alias, param.objectType, defaultVal);
+				}
+				else
+				{
+					desc.addParameter(ident, ident, param.objectType);
+
+					if (!param.alias.empty())
+						desc.addParameter(ident, param.alias, param.objectType);
+				}
+				break;
+			}
+			case ReflectedParam::Kind::Data:
+				if (!param.hasDefaultValue)
+					desc.addParameter(ident, ident, param.dataType);
+				else
+				{
+					desc.addParameter(ident, ident, param.dataType, StringID::NONE, 1, 0, 
+						(UINT8*)param.defaultValue);
+				}
+				break;
+			}
+		}
 	}
 
 	String BSLFXCompiler::removeQuotes(const char* input)
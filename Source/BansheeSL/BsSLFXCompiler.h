@@ -8,11 +8,15 @@
 #include "RenderAPI/BsRasterizerState.h"
 #include "RenderAPI/BsDepthStencilState.h"
 #include "RenderAPI/BsBlendState.h"
+#include "RenderAPI/BsSamplerState.h"
+#include "Material/BsShaderVariation.h"
 
 extern "C" {
 #include "BsASTFX.h"
 }
 
+namespace Xsc { namespace Reflection { struct ReflectionData; } }
+
 namespace bs
 {
 	/** @addtogroup BansheeSL
@@ -38,6 +42,27 @@ namespace bs
 			Vertex, Fragment, Geometry, Hull, Domain, Compute, Common
 		};
 
+		/** Information about a single shader parameter found during reflection, before it is registered with the shader. */
+		struct ReflectedParam
+		{
+			enum class Kind
+			{
+				ParamBlock, Texture, Buffer, Sampler, Data
+			};
+
+			Kind kind = Kind::Data;
+			String name;
+			String alias;
+			GpuParamObjectType objectType = GPOT_UNKNOWN;
+			GpuParamDataType dataType = GPDT_UNKNOWN;
+
+			INT32 defaultTexture = -1; /**< Index of the built-in texture to use as the default value, or -1 if none. */
+			bool hasDefaultSampler = false;
+			SAMPLER_STATE_DESC defaultSampler;
+			bool hasDefaultValue = false;
+			UINT8 defaultValue[64];
+		};
+
 		/**	Temporary data describing a pass during parsing. */
 		struct PassData
 		{
@@ -59,6 +84,8 @@ namespace bs
 			String hullCode;
 			String domainCode;
 			String computeCode;
+
+			Vector<ReflectedParam> params; // Parameters found during reflection, only populated for HLSL passes
 		};
 
 		/** Information about different variations of a single technique. */
@@ -89,6 +116,13 @@ namespace bs
 			Vector<PassData> passes;
 		};
 
+		/** Techniques parsed for a single shader variation, before their GPU programs are created. */
+		struct VariationTechniqueData
+		{
+			ShaderVariation variation;
+			Vector<TechniqueData> techniques;
+		};
+
 	public:
 		/**	Transforms a source file written in BSL FX syntax into a Shader object. */
 		static BSLFXCompileResult compile(const String& name, const String& source, 
@@ -211,21 +245,63 @@ namespace bs
 		static void parseOptions(ASTFXNode* optionsNode, SHADER_DESC& shaderDesc);
 
 		/**
-		 * Parses the AST node hierarchy and generates a variation of the of the named technique.
+		 * Parses the AST node hierarchy and generates a variation of the of the named technique. Only the HLSL version of
+		 * the technique is generated, see generateCode().
 		 *
 		 * @param[in, out]	parseState	Parser state object that has previously been initialized with the AST using 
-		 *								parseFX().
+		 *								parseFX(). The state will be destroyed by this method.
 		 * @param[in]	name			Name of the technique to generate the variation for.
 		 * @param[in]	codeBlocks		Blocks containing GPU program source code that are referenced by the AST.
-		 * @param[in]	variation		Shader variation the AST was parsed with.
 		 * @param[out]	techniques		Vector to append newly found techniques to.
 		 * @param[out]	includes		Set to append newly found includes to.
-		 * @param[out]	shaderDesc		Shader descriptor too append new parameters to.
 		 * @return						A result object containing an error message if not successful.
 		 */
 		static BSLFXCompileResult parseTechnique(ParseState* parseState, const String& name, 
-			const Vector<String>& codeBlocks, const ShaderVariation& variation, Vector<SPtr<Technique>>& techniques, 
-			UnorderedSet<String>& includes, SHADER_DESC& shaderDesc);
+			const Vector<String>& codeBlocks, Vector<TechniqueData>& techniques, UnorderedSet<String>& includes);
+
+		/**
+		 * Parses the extended HLSL code of the provided techniques, finds their entry points and parameters, and generates
+		 * GLSL and VKSL versions of every technique. The new techniques are appended to the provided vector.
+		 *
+		 * @note	Doesn't touch any shared state and doesn't create any core objects, meaning it may be called for
+		 *			different variations from multiple threads at once.
+		 */
+		static void generateCode(Vector<TechniqueData>& techniques);
+
+		/**
+		 * Finds the entry points and parameters of the provided HLSL code, and appends them to the provided vectors.
+		 * Results are cached on disk alongside the cross compiled code, so reflection is skipped for code that was
+		 * reflected before.
+		 */
+		static void reflect(const String& hlsl, Vector<ReflectedParam>& params, Vector<GpuProgramType>& types);
+
+		/** Encodes reflection output into binary data that can be stored in the cross compiled code cache. */
+		static String encodeReflection(const Vector<ReflectedParam>& params, const Vector<GpuProgramType>& types);
+
+		/** 
+		 * Decodes reflection output encoded by encodeReflection(). Returns false if the data is invalid, in which case the
+		 * outputs might be partially populated.
+		 */
+		static bool decodeReflection(const String& data, Vector<ReflectedParam>& params, Vector<GpuProgramType>& types);
+
+		/** Converts reflection data returned by the cross compiler into a list of shader parameters. */
+		static void parseParameters(const Xsc::Reflection::ReflectionData& reflData, Vector<ReflectedParam>& params);
+
+		/** 
+		 * Registers the provided parameters with the shader descriptor. Parameters that were already registered by a 
+		 * previous variation are ignored.
+		 */
+		static void applyParameters(const Vector<ReflectedParam>& params, SHADER_DESC& shaderDesc);
+
+		/**
+		 * Creates GPU programs, passes and techniques from the fully generated technique data.
+		 *
+		 * @param[in]	techniqueData	Techniques to create, as output by generateCode().
+		 * @param[in]	variation		Shader variation the techniques were parsed with.
+		 * @param[out]	techniques		Vector to append the newly created techniques to.
+		 */
+		static void createTechniques(const Vector<TechniqueData>& techniqueData, const ShaderVariation& variation,
+			Vector<SPtr<Technique>>& techniques);
 
 		/**
 		 * Converts a null-terminated string into a standard string, and eliminates quotes that are assumed to be at the 
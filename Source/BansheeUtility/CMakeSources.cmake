@@ -42,6 +42,7 @@ set(BS_BANSHEEUTILITY_SRC_UTILITY
 	"Utility/BsDynLib.cpp"
 	"Utility/BsDynLibManager.cpp"
 	"Utility/BsMessageHandler.cpp"
+	"Utility/BsEvent.cpp"
 	"Utility/BsTimer.cpp"
 	"Utility/BsTime.cpp"
 	"Utility/BsUtil.cpp"
@@ -94,6 +95,7 @@ set(BS_BANSHEEUTILITY_INC_UTILITY
 	"Utility/BsNonCopyable.h"
 	"Utility/BsUUID.h"
 	"Utility/BsOctree.h"
+	"Utility/BsFlatHashMap.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_ALLOCATORS
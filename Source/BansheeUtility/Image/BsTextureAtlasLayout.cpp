@@ -6,23 +6,18 @@
 
 namespace bs
 {
-	TextureAtlasLayout::TexAtlasNode::TexAtlasNode()
-		:x(0), y(0), width(0), height(0), children{ (UINT32)-1, (UINT32)-1 }, nodeFull(false)
-	{ }
-
-	TextureAtlasLayout::TexAtlasNode::TexAtlasNode(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
-		: x(x), y(y), width(width), height(height), children{ (UINT32)-1, (UINT32)-1 }, nodeFull(false)
-	{ }
-
 	TextureAtlasLayout::TextureAtlasLayout()
 		: mInitialWidth(0), mInitialHeight(0), mWidth(0), mHeight(0), mMaxWidth(0), mMaxHeight(0), mPow2(false)
-	{ }
+		, mNumElements(0)
+	{
+		mSkyline.push_back({ 0, 0, 0 });
+	}
 
 	TextureAtlasLayout::TextureAtlasLayout(UINT32 width, UINT32 height, UINT32 maxWidth, UINT32 maxHeight, bool pow2)
 		: mInitialWidth(width), mInitialHeight(height), mWidth(width), mHeight(height), mMaxWidth(maxWidth)
-		, mMaxHeight(maxHeight), mPow2(pow2)
+		, mMaxHeight(maxHeight), mPow2(pow2), mNumElements(0)
 	{
-		mNodes.push_back(TexAtlasNode(0, 0, maxWidth, maxHeight));
+		mSkyline.push_back({ 0, 0, maxWidth });
 	}
 
 	bool TextureAtlasLayout::addElement(UINT32 width, UINT32 height, UINT32& x, UINT32& y)
@@ -34,13 +29,30 @@ namespace bs
 			return true;
 		}
 
-		// Try adding without expanding, if that fails try to expand
-		if(!addToNode(0, width, height, x, y, false))
+		// Try adding without expanding. If that fails grow the allowed area one dimension at a time, so the atlas stays
+		// roughly square instead of the skyline spreading out across the maximum width.
+		if(!addWithinBounds(width, height, mWidth, mHeight, x, y))
 		{
-			if (!addToNode(0, width, height, x, y, true))
+			UINT32 boundsWidth = mWidth;
+			UINT32 boundsHeight = mHeight;
+
+			bool added = false;
+			while(!added && (boundsWidth < mMaxWidth || boundsHeight < mMaxHeight))
+			{
+				if((boundsWidth <= boundsHeight && boundsWidth < mMaxWidth) || boundsHeight >= mMaxHeight)
+					boundsWidth = std::min(mMaxWidth, std::max(boundsWidth * 2, width));
+				else
+					boundsHeight = std::min(mMaxHeight, std::max(boundsHeight * 2, height));
+
+				added = addWithinBounds(width, height, boundsWidth, boundsHeight, x, y);
+			}
+
+			if(!added)
 				return false;
 		}
 
+		mNumElements++;
+
 		// Update size to cover all nodes
 		if(mPow2)
 		{
@@ -56,72 +68,282 @@ namespace bs
 		return true;
 	}
 
+	void TextureAtlasLayout::removeElement(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+	{
+		if(width == 0 || height == 0 || mNumElements == 0)
+			return;
+
+		mNumElements--;
+		if(mNumElements == 0)
+		{
+			mSkyline.clear();
+			mSkyline.push_back({ 0, 0, mMaxWidth });
+			mFreeRects.clear();
+
+			return;
+		}
+
+		// If the element alone forms a segment of the skyline, lower the skyline instead of fragmenting the free area
+		for(UINT32 i = 0; i < (UINT32)mSkyline.size(); i++)
+		{
+			SkylineNode& node = mSkyline[i];
+			if(node.x > x)
+				break;
+
+			if(node.x == x && node.width == width && node.y == y + height)
+			{
+				node.y = y;
+
+				if(i + 1 < (UINT32)mSkyline.size() && mSkyline[i + 1].y == node.y)
+				{
+					node.width += mSkyline[i + 1].width;
+					mSkyline.erase(mSkyline.begin() + i + 1);
+				}
+
+				if(i > 0 && mSkyline[i - 1].y == mSkyline[i].y)
+				{
+					mSkyline[i - 1].width += mSkyline[i].width;
+					mSkyline.erase(mSkyline.begin() + i);
+				}
+
+				return;
+			}
+		}
+
+		addFreeRect({ x, y, width, height });
+	}
+
 	void TextureAtlasLayout::clear()
 	{
-		mNodes.clear();
-		mNodes.push_back(TexAtlasNode(0, 0, mWidth, mHeight));
+		mSkyline.clear();
+		mSkyline.push_back({ 0, 0, mMaxWidth });
+		mFreeRects.clear();
+		mNumElements = 0;
 
 		mWidth = mInitialWidth;
 		mHeight = mInitialHeight;
 	}
 
-	bool TextureAtlasLayout::addToNode(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& x, UINT32& y, bool allowGrowth)
+	bool TextureAtlasLayout::addWithinBounds(UINT32 width, UINT32 height, UINT32 boundsWidth, UINT32 boundsHeight, 
+		UINT32& x, UINT32& y)
 	{
-		TexAtlasNode* node = &mNodes[nodeIdx];
-		float aspect = node->width / (float)node->height;
+		if (width > boundsWidth || height > boundsHeight)
+			return false;
+
+		// Fill the holes first, so the skyline rises as slowly as possible
+		if (addToFreeRect(width, height, boundsWidth, boundsHeight, x, y))
+			return true;
+
+		// Find the position that keeps the top of the element lowest, preferring narrower segments on ties
+		UINT32 bestNodeIdx = (UINT32)-1;
+		UINT32 bestTop = std::numeric_limits<UINT32>::max();
+		UINT32 bestWidth = std::numeric_limits<UINT32>::max();
+		UINT32 bestY = 0;
 
-		if (node->children[0] != (UINT32)-1)
+		for (UINT32 i = 0; i < (UINT32)mSkyline.size(); i++)
 		{
-			if (addToNode(node->children[0], width, height, x, y, allowGrowth))
-				return true;
+			UINT32 nodeY;
+			if (!fitsSkylineNode(i, width, height, boundsWidth, boundsHeight, nodeY))
+				continue;
 
-			return addToNode(node->children[1], width, height, x, y, allowGrowth);
+			UINT32 top = nodeY + height;
+			if (top < bestTop || (top == bestTop && mSkyline[i].width < bestWidth))
+			{
+				bestNodeIdx = i;
+				bestTop = top;
+				bestWidth = mSkyline[i].width;
+				bestY = nodeY;
+			}
 		}
-		else
+
+		if (bestNodeIdx == (UINT32)-1)
+			return false;
+
+		x = mSkyline[bestNodeIdx].x;
+		y = bestY;
+
+		addSkylineLevel(bestNodeIdx, x, y, width, height);
+		return true;
+	}
+
+	bool TextureAtlasLayout::addToFreeRect(UINT32 width, UINT32 height, UINT32 boundsWidth, UINT32 boundsHeight, 
+		UINT32& x, UINT32& y)
+	{
+		UINT32 bestRectIdx = (UINT32)-1;
+		UINT64 bestArea = std::numeric_limits<UINT64>::max();
+
+		for (UINT32 i = 0; i < (UINT32)mFreeRects.size(); i++)
 		{
-			if (node->nodeFull)
-				return false;
+			const FreeRect& rect = mFreeRects[i];
+			if (width > rect.width || height > rect.height)
+				continue;
 
-			if (width > node->width || height > node->height)
-				return false;
+			if (rect.x + width > boundsWidth || rect.y + height > boundsHeight)
+				continue;
 
-			if(!allowGrowth)
+			UINT64 area = (UINT64)rect.width * rect.height;
+			if (area < bestArea)
 			{
-				if (node->x + width > mWidth || node->y + height > mHeight)
-					return false;
+				bestRectIdx = i;
+				bestArea = area;
 			}
+		}
 
-			if (width == node->width && height == node->height)
-			{
-				x = node->x;
-				y = node->y;
-				node->nodeFull = true;
+		if (bestRectIdx == (UINT32)-1)
+			return false;
+
+		FreeRect rect = mFreeRects[bestRectIdx];
+		mFreeRects[bestRectIdx] = mFreeRects.back();
+		mFreeRects.pop_back();
+
+		x = rect.x;
+		y = rect.y;
+
+		// Split the remaining area in two, keeping the larger of the leftover pieces whole
+		UINT32 leftoverWidth = rect.width - width;
+		UINT32 leftoverHeight = rect.height - height;
+
+		FreeRect right;
+		FreeRect bottom;
+		if (leftoverWidth > leftoverHeight)
+		{
+			right = { rect.x + width, rect.y, leftoverWidth, rect.height };
+			bottom = { rect.x, rect.y + height, width, leftoverHeight };
+		}
+		else
+		{
+			right = { rect.x + width, rect.y, leftoverWidth, height };
+			bottom = { rect.x, rect.y + height, rect.width, leftoverHeight };
+		}
+
+		if (right.width > 0 && right.height > 0)
+			mFreeRects.push_back(right);
+
+		if (bottom.width > 0 && bottom.height > 0)
+			mFreeRects.push_back(bottom);
 
+		return true;
+	}
+
+	bool TextureAtlasLayout::fitsSkylineNode(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32 boundsWidth, 
+		UINT32 boundsHeight, UINT32& y) const
+	{
+		if (mSkyline[nodeIdx].x + width > boundsWidth)
+			return false;
+
+		// Element rests on the highest segment it spans
+		y = 0;
+		UINT32 widthLeft = width;
+		for (UINT32 i = nodeIdx; i < (UINT32)mSkyline.size(); i++)
+		{
+			const SkylineNode& node = mSkyline[i];
+
+			y = std::max(y, node.y);
+			if (y + height > boundsHeight)
+				return false;
+
+			if (node.width >= widthLeft)
 				return true;
+
+			widthLeft -= node.width;
+		}
+
+		return false;
+	}
+
+	void TextureAtlasLayout::addSkylineLevel(UINT32 nodeIdx, UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+	{
+		UINT32 right = x + width;
+
+		// Areas between the lower segments and the bottom of the new element can no longer be reached through the 
+		// skyline, so keep track of them separately
+		for (UINT32 i = nodeIdx; i < (UINT32)mSkyline.size(); i++)
+		{
+			const SkylineNode& node = mSkyline[i];
+			if (node.x >= right)
+				break;
+
+			if (node.y < y)
+			{
+				UINT32 holeRight = std::min(node.x + node.width, right);
+				addFreeRect({ node.x, node.y, holeRight - node.x, y - node.y });
 			}
+		}
 
-			float dw = (float)(node->width - width);
-			float dh = (node->height - height) * aspect;
+		mSkyline.insert(mSkyline.begin() + nodeIdx, { x, y + height, width });
 
-			UINT32 nextChildIdx = (UINT32)mNodes.size();
-			node->children[0] = nextChildIdx;
-			node->children[1] = nextChildIdx + 1;
+		// Remove or shrink the segments covered by the new segment
+		UINT32 i = nodeIdx + 1;
+		while (i < (UINT32)mSkyline.size())
+		{
+			SkylineNode& node = mSkyline[i];
+			if (node.x >= right)
+				break;
 
-			TexAtlasNode nodeCopy = *node;
-			node = nullptr; // Undefined past this point
-			if (dw > dh)
+			UINT32 nodeRight = node.x + node.width;
+			if (nodeRight <= right)
 			{
-				mNodes.emplace_back(nodeCopy.x, nodeCopy.y, width, nodeCopy.height);
-				mNodes.emplace_back(nodeCopy.x + width, nodeCopy.y, nodeCopy.width - width, nodeCopy.height);
+				mSkyline.erase(mSkyline.begin() + i);
+				continue;
 			}
-			else
+
+			node.width = nodeRight - right;
+			node.x = right;
+			break;
+		}
+
+		// Merge the new segment with neighbours of the same height
+		if (nodeIdx + 1 < (UINT32)mSkyline.size() && mSkyline[nodeIdx + 1].y == mSkyline[nodeIdx].y)
+		{
+			mSkyline[nodeIdx].width += mSkyline[nodeIdx + 1].width;
+			mSkyline.erase(mSkyline.begin() + nodeIdx + 1);
+		}
+
+		if (nodeIdx > 0 && mSkyline[nodeIdx - 1].y == mSkyline[nodeIdx].y)
+		{
+			mSkyline[nodeIdx - 1].width += mSkyline[nodeIdx].width;
+			mSkyline.erase(mSkyline.begin() + nodeIdx);
+		}
+	}
+
+	void TextureAtlasLayout::addFreeRect(const FreeRect& rect)
+	{
+		for (auto& other : mFreeRects)
+		{
+			if (other.x == rect.x && other.width == rect.width)
 			{
-				mNodes.emplace_back(nodeCopy.x, nodeCopy.y, nodeCopy.width, height);
-				mNodes.emplace_back(nodeCopy.x, nodeCopy.y + height, nodeCopy.width, nodeCopy.height - height);
+				if (other.y + other.height == rect.y)
+				{
+					other.height += rect.height;
+					return;
+				}
+
+				if (rect.y + rect.height == other.y)
+				{
+					other.y = rect.y;
+					other.height += rect.height;
+					return;
+				}
 			}
 
-			return addToNode(nodeCopy.children[0], width, height, x, y, allowGrowth);
+			if (other.y == rect.y && other.height == rect.height)
+			{
+				if (other.x + other.width == rect.x)
+				{
+					other.width += rect.width;
+					return;
+				}
+
+				if (rect.x + rect.width == other.x)
+				{
+					other.x = rect.x;
+					other.width += rect.width;
+					return;
+				}
+			}
 		}
+
+		mFreeRects.push_back(rect);
 	}
 
 	Vector<TextureAtlasUtility::Page> TextureAtlasUtility::createAtlasLayout(Vector<Element>& elements, UINT32 width, 
@@ -133,12 +355,26 @@ namespace bs
 			elements[i].output.page = -1;
 		}
 
+		// Skyline packing works best when elements are added from tallest to shortest
 		std::sort(elements.begin(), elements.end(), 
 			[](const Element& a, const Element& b)
 		{
-			return a.input.width * a.input.height > b.input.width * b.input.height;
+			if (a.input.height != b.input.height)
+				return a.input.height > b.input.height;
+
+			return a.input.width > b.input.width;
 		});
 
+		// Check if an element is too large to ever fit
+		for (auto& element : elements)
+		{
+			if(element.input.width > maxWidth || element.input.height > maxHeight)
+			{
+				LOGWRN("Some of the provided elements don't fit in an atlas of provided size. Returning empty array of pages.");
+				return Vector<Page>();
+			}
+		}
+
 		Vector<TextureAtlasLayout> layouts;
 		UINT32 remainingCount = (UINT32)elements.size();
 		while (remainingCount > 0)
@@ -146,45 +382,17 @@ namespace bs
 			layouts.push_back(TextureAtlasLayout(width, height, maxWidth, maxHeight, pow2));
 			TextureAtlasLayout& curLayout = layouts.back();
 
-			// Find largest unassigned element that fits
-			UINT32 sizeLimit = std::numeric_limits<UINT32>::max();
-			while (true)
+			// Add all unassigned elements that still fit, and leave the rest for the next page
+			for (auto& element : elements)
 			{
-				UINT32 largestId = -1;
-
-				// Assumes elements are sorted from largest to smallest
-				for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
-				{
-					if (elements[i].output.page == -1)
-					{
-						UINT32 size = elements[i].input.width * elements[i].input.height;
-						if (size < sizeLimit)
-						{
-							largestId = i;
-							break;
-						}
-					}
-				}
-
-				if (largestId == (UINT32)-1)
-					break; // Nothing fits, start a new page
-
-				Element& element = elements[largestId];
-
-				// Check if an element is too large to ever fit
-				if(element.input.width > maxWidth || element.input.height > maxHeight)
-				{
-					LOGWRN("Some of the provided elements don't fit in an atlas of provided size. Returning empty array of pages.");
-					return Vector<Page>();
-				}
+				if (element.output.page != -1)
+					continue;
 
 				if (curLayout.addElement(element.input.width, element.input.height, element.output.x, element.output.y))
 				{
 					element.output.page = (UINT32)layouts.size() - 1;
 					remainingCount--;
 				}
-				else
-					sizeLimit = element.input.width * element.input.height;
 			}
 		}
 
@@ -11,19 +11,25 @@ namespace bs
 	 *  @{
 	 */
 
-	/** Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space. */
+	/**
+	 * Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space. 
+	 *
+	 * Elements are placed using a skyline bottom-left heuristic, tracking the top edge of the occupied area as a list of 
+	 * horizontal segments. Areas left empty below the skyline, as well as areas of removed elements, are tracked 
+	 * separately and reused for new elements when possible. This allows elements to be added and removed incrementally. 
+	 */
 	class BS_UTILITY_EXPORT TextureAtlasLayout
 	{
-		/** Represent a single node in the texture atlas binary tree. */
-		class TexAtlasNode
+		/** Horizontal segment of the skyline, representing the top edge of the occupied area. */
+		struct SkylineNode
 		{
-		public:
-			TexAtlasNode();
-			TexAtlasNode(UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+			UINT32 x, y, width;
+		};
 
+		/** Empty rectangular area below the skyline. */
+		struct FreeRect
+		{
 			UINT32 x, y, width, height;
-			UINT32 children[2];
-			bool nodeFull;
 		};
 
 	public:
@@ -41,7 +47,7 @@ namespace bs
 		TextureAtlasLayout(UINT32 width, UINT32 height, UINT32 maxWidth, UINT32 maxHeight, bool pow2 = false);
 
 		/**
-		 * Attempts to add a new element in the layout. Elements should be added to the atlas from largest to smallest,
+		 * Attempts to add a new element in the layout. Elements should be added to the atlas from tallest to shortest,
 		 * otherwise a non-optimal layout is likely to be generated.
 		 * 
 		 * @param[in]	width	Width of the new element, in pixels.
@@ -52,11 +58,22 @@ namespace bs
 		 */
 		bool addElement(UINT32 width, UINT32 height, UINT32& x, UINT32& y);
 
+		/**
+		 * Removes an element previously added through addElement(), making its area available for new elements. The atlas
+		 * size doesn't shrink after removal.
+		 *
+		 * @param[in]	x		Horizontal position of the element, as returned by addElement().
+		 * @param[in]	y		Vertical position of the element, as returned by addElement().
+		 * @param[in]	width	Width of the element, in pixels.
+		 * @param[in]	height	Height of the element, in pixels.
+		 */
+		void removeElement(UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+
 		/** Removes all entries from the layout. */
 		void clear();
 
 		/** Checks have any elements been added to the layout. */
-		bool isEmpty() const { return mNodes.size() == 1; }
+		bool isEmpty() const { return mNumElements == 0; }
 
 		/** Returns the width of the atlas texture, in pixels. */
 		UINT32 getWidth() const { return mWidth; }
@@ -65,20 +82,36 @@ namespace bs
 		UINT32 getHeight() const { return mHeight; }
 
 	private:
-		/* 
-		 * Attempts to add a new element to the specified layout node. 
+		/**
+		 * Attempts to find a position for a new element within the provided bounds. 
 		 * 
-		 * @param[in]	nodeIdx			Index of the node to which to add the element.
 		 * @param[in]	width			Width of the new element, in pixels.
 		 * @param[in]	height			Height of the new element, in pixels.
+		 * @param[in]	boundsWidth		Width of the area the element must fit in, in pixels.
+		 * @param[in]	boundsHeight	Height of the area the element must fit in, in pixels.
 		 * @param[out]	x				Horizontal position of the new element within the atlas. Only valid if method
 		 *								returns true.
 		 * @param[out]	y				Vertical position of the new element within the atlas. Only valid if method returns
 		 *								true.
-		 * @param[in]	allowGrowth		When true, the width/height of the atlas will be allowed to grow to fit the element.
 		 * @return						True if the element was added to the atlas, false if the element doesn't fit.
 		 */
-		bool addToNode(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& x, UINT32& y, bool allowGrowth);
+		bool addWithinBounds(UINT32 width, UINT32 height, UINT32 boundsWidth, UINT32 boundsHeight, UINT32& x, UINT32& y);
+
+		/** Attempts to place the element in one of the free rectangles, picking the one that wastes the least area. */
+		bool addToFreeRect(UINT32 width, UINT32 height, UINT32 boundsWidth, UINT32 boundsHeight, UINT32& x, UINT32& y);
+
+		/**
+		 * Finds the lowest position on the skyline, starting at the specified node, that the element fits at. Returns false
+		 * if the element doesn't fit at that node.
+		 */
+		bool fitsSkylineNode(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32 boundsWidth, UINT32 boundsHeight, 
+			UINT32& y) const;
+
+		/** Raises the skyline to cover an element placed at the specified node. */
+		void addSkylineLevel(UINT32 nodeIdx, UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+
+		/** Registers a new free rectangle, merging it with an adjacent rectangle if possible. */
+		void addFreeRect(const FreeRect& rect);
 
 		UINT32 mInitialWidth;
 		UINT32 mInitialHeight;
@@ -88,7 +121,9 @@ namespace bs
 		UINT32 mMaxHeight;
 		bool mPow2;
 
-		Vector<TexAtlasNode> mNodes;
+		UINT32 mNumElements;
+		Vector<SkylineNode> mSkyline;
+		Vector<FreeRect> mFreeRects;
 	};
 
 	/** Utility class used for texture atlas layouts. */
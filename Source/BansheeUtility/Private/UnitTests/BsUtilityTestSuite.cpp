@@ -3,6 +3,10 @@
 #include "Private/UnitTests/BsUtilityTestSuite.h"
 #include "Private/UnitTests/BsFileSystemTestSuite.h"
 #include "Utility/BsOctree.h"
+#include "Utility/BsFlatHashMap.h"
+#include "Utility/BsEvent.h"
+#include "String/BsStringID.h"
+#include "Image/BsTextureAtlasLayout.h"
 
 namespace bs
 {
@@ -51,6 +55,10 @@ namespace bs
 	UtilityTestSuite::UtilityTestSuite()
 	{
 		BS_ADD_TEST(UtilityTestSuite::testOctree);
+		BS_ADD_TEST(UtilityTestSuite::testFlatHashMap);
+		BS_ADD_TEST(UtilityTestSuite::testEvent);
+		BS_ADD_TEST(UtilityTestSuite::testStringID);
+		BS_ADD_TEST(UtilityTestSuite::testTextureAtlasLayout);
 	}
 
 	void UtilityTestSuite::testOctree()
@@ -143,4 +151,295 @@ namespace bs
 		for(auto& entry : octreeData.elements)
 			octree.removeElement(entry.octreeId);
 	}
+
+	void UtilityTestSuite::testFlatHashMap()
+	{
+		FlatHashMap<UINT64, UINT32> map;
+		Map<UINT64, UINT32> reference;
+
+		// Random insertions, lookups and removals, checked against an ordered map
+		UINT64 seed = 1;
+		for(UINT32 i = 0; i < 50000; i++)
+		{
+			seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+			UINT64 key = (seed >> 33) % 2000;
+
+			switch((seed >> 20) % 3)
+			{
+			case 0:
+				map[key] = i;
+				reference[key] = i;
+				break;
+			case 1:
+				BS_TEST_ASSERT(map.erase(key) == (reference.erase(key) > 0));
+				break;
+			default:
+			{
+				auto iterFind = map.find(key);
+				auto iterFindRef = reference.find(key);
+
+				BS_TEST_ASSERT((iterFind == map.end()) == (iterFindRef == reference.end()));
+				if(iterFind != map.end() && iterFindRef != reference.end())
+					BS_TEST_ASSERT(iterFind->second == iterFindRef->second);
+			}
+				break;
+			}
+
+			BS_TEST_ASSERT(map.size() == (UINT32)reference.size());
+		}
+
+		UINT32 numIterated = 0;
+		for(auto& entry : map)
+		{
+			BS_TEST_ASSERT(reference[entry.first] == entry.second);
+			numIterated++;
+		}
+
+		BS_TEST_ASSERT(numIterated == (UINT32)reference.size());
+
+		map.clear();
+		BS_TEST_ASSERT(map.empty());
+		BS_TEST_ASSERT(map.find(0) == map.end());
+	}
+
+	void UtilityTestSuite::testEvent()
+	{
+		UnsyncEvent<void(INT32)> event;
+		INT32 sum = 0;
+
+		HEvent conn0 = event.connect([&sum](INT32 val) { sum += val; });
+		HEvent conn1 = event.connect([&sum](INT32 val) { sum += val * 10; });
+
+		event(1);
+		BS_TEST_ASSERT(sum == 11);
+
+		conn1.disconnect();
+		event(1);
+		BS_TEST_ASSERT(sum == 12);
+
+		// Disconnecting during trigger, and connecting during trigger (new connection not called until next trigger)
+		HEvent selfConn;
+		HEvent addedConn;
+		selfConn = event.connect([&](INT32)
+		{
+			selfConn.disconnect();
+			addedConn = event.connect([&sum](INT32 val) { sum += val * 100; });
+		});
+
+		event(1);
+		BS_TEST_ASSERT(sum == 13);
+
+		event(1);
+		BS_TEST_ASSERT(sum == 114);
+
+		event.clear();
+		BS_TEST_ASSERT(event.empty());
+
+		event(1);
+		BS_TEST_ASSERT(sum == 114);
+
+		// Event destroyed by one of its own callbacks
+		Event<void()>* syncEvent = bs_new<Event<void()>>();
+		UINT32 numCalls = 0;
+
+		syncEvent->connect([&]() { bs_delete(syncEvent); numCalls++; });
+		syncEvent->connect([&]() { numCalls++; });
+
+		(*syncEvent)();
+		BS_TEST_ASSERT(numCalls == 1);
+
+		// Disconnecting while the callback is executing on another thread waits for the callback to finish
+		Event<void()> threadedEvent;
+		std::atomic<bool> callbackEntered { false };
+		std::atomic<bool> callbackRunning { false };
+		std::atomic<UINT32> numThreadedCalls { 0 };
+
+		HEvent threadedConn = threadedEvent.connect([&]()
+		{
+			callbackRunning = true;
+			callbackEntered = true;
+
+			BS_THREAD_SLEEP(50)
+
+			numThreadedCalls++;
+			callbackRunning = false;
+		});
+
+		Thread triggerThread([&]() { threadedEvent(); });
+
+		while (!callbackEntered)
+			std::this_thread::yield();
+
+		threadedConn.disconnect();
+		BS_TEST_ASSERT(!callbackRunning);
+		BS_TEST_ASSERT(numThreadedCalls == 1);
+
+		triggerThread.join();
+
+		threadedEvent();
+		BS_TEST_ASSERT(numThreadedCalls == 1);
+
+		// Callback disconnecting itself doesn't wait on its own call
+		HEvent selfSyncConn;
+		selfSyncConn = threadedEvent.connect([&]()
+		{
+			selfSyncConn.disconnect();
+			numThreadedCalls++;
+		});
+
+		threadedEvent();
+		threadedEvent();
+		BS_TEST_ASSERT(numThreadedCalls == 2);
+	}
+
+	void UtilityTestSuite::testStringID()
+	{
+		StringID literalId = "TestStringID";
+		StringID hashedId = BS_SID("TestStringID");
+		StringID stringId = String("TestStringID");
+
+		BS_TEST_ASSERT(literalId == hashedId);
+		BS_TEST_ASSERT(literalId == stringId);
+		BS_TEST_ASSERT(literalId != StringID("TestStringId"));
+		BS_TEST_ASSERT(strcmp(literalId.cstr(), "TestStringID") == 0);
+		BS_TEST_ASSERT(StringID::NONE.empty());
+
+		// Enough entries to force the string table to grow multiple times
+		Vector<StringID> ids;
+		for(UINT32 i = 0; i < 20000; i++)
+			ids.push_back(StringID("TestStringID_" + toString(i)));
+
+		for(UINT32 i = 0; i < 20000; i++)
+		{
+			String name = "TestStringID_" + toString(i);
+
+			BS_TEST_ASSERT(ids[i] == StringID(name));
+			BS_TEST_ASSERT(name == ids[i].cstr());
+		}
+
+		// No limit on string length
+		String longName(4096, 'a');
+		StringID longId = longName;
+		BS_TEST_ASSERT(longId == StringID(longName));
+		BS_TEST_ASSERT(longName == longId.cstr());
+	}
+
+	struct DebugAtlasRect
+	{
+		UINT32 x, y, width, height;
+	};
+
+	/** Checks that none of the rectangles overlap, and that they are all contained within the provided area. */
+	static bool isValidAtlasLayout(const Vector<DebugAtlasRect>& rects, UINT32 width, UINT32 height)
+	{
+		for(UINT32 i = 0; i < (UINT32)rects.size(); i++)
+		{
+			const DebugAtlasRect& a = rects[i];
+			if(a.x + a.width > width || a.y + a.height > height)
+				return false;
+
+			for(UINT32 j = i + 1; j < (UINT32)rects.size(); j++)
+			{
+				const DebugAtlasRect& b = rects[j];
+				if(a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	void UtilityTestSuite::testTextureAtlasLayout()
+	{
+		// Incremental insertion
+		TextureAtlasLayout layout(0, 0, 512, 512, true);
+		BS_TEST_ASSERT(layout.isEmpty());
+
+		Vector<DebugAtlasRect> rects;
+		for(UINT32 i = 0; i < 400; i++)
+		{
+			DebugAtlasRect rect;
+			rect.width = 4 + (i * 7919) % 29;
+			rect.height = 4 + (i * 104729) % 23;
+
+			if(layout.addElement(rect.width, rect.height, rect.x, rect.y))
+				rects.push_back(rect);
+		}
+
+		BS_TEST_ASSERT(!layout.isEmpty());
+		BS_TEST_ASSERT(rects.size() == 400);
+		BS_TEST_ASSERT(layout.getWidth() <= 512 && layout.getHeight() <= 512);
+		BS_TEST_ASSERT(isValidAtlasLayout(rects, layout.getWidth(), layout.getHeight()));
+
+		// Removal, with the freed space being reused
+		Vector<DebugAtlasRect> remainingRects;
+		for(UINT32 i = 0; i < (UINT32)rects.size(); i++)
+		{
+			const DebugAtlasRect& rect = rects[i];
+			if(i % 2 == 0)
+				layout.removeElement(rect.x, rect.y, rect.width, rect.height);
+			else
+				remainingRects.push_back(rect);
+		}
+
+		rects = remainingRects;
+
+		UINT32 widthBeforeRefill = layout.getWidth();
+		UINT32 heightBeforeRefill = layout.getHeight();
+
+		for(UINT32 i = 0; i < 100; i++)
+		{
+			DebugAtlasRect rect;
+			rect.width = 4 + (i * 31) % 17;
+			rect.height = 4 + (i * 13) % 11;
+
+			BS_TEST_ASSERT(layout.addElement(rect.width, rect.height, rect.x, rect.y));
+			rects.push_back(rect);
+		}
+
+		BS_TEST_ASSERT(layout.getWidth() == widthBeforeRefill && layout.getHeight() == heightBeforeRefill);
+		BS_TEST_ASSERT(isValidAtlasLayout(rects, layout.getWidth(), layout.getHeight()));
+
+		for(auto& rect : rects)
+			layout.removeElement(rect.x, rect.y, rect.width, rect.height);
+
+		BS_TEST_ASSERT(layout.isEmpty());
+
+		// Elements that don't fit
+		UINT32 x, y;
+		BS_TEST_ASSERT(!layout.addElement(513, 16, x, y));
+
+		layout.clear();
+		BS_TEST_ASSERT(layout.addElement(512, 512, x, y));
+		BS_TEST_ASSERT(!layout.addElement(1, 1, x, y));
+
+		// Multi-page layout
+		Vector<TextureAtlasUtility::Element> elements;
+		for(UINT32 i = 0; i < 1000; i++)
+		{
+			TextureAtlasUtility::Element element;
+			element.input.width = 8 + (i * 7919) % 57;
+			element.input.height = 8 + (i * 104729) % 49;
+
+			elements.push_back(element);
+		}
+
+		Vector<TextureAtlasUtility::Page> pages = TextureAtlasUtility::createAtlasLayout(elements, 64, 64, 256, 256, true);
+		BS_TEST_ASSERT(pages.size() > 1);
+
+		Vector<Vector<DebugAtlasRect>> rectsPerPage(pages.size());
+		Vector<bool> usedIndices(elements.size(), false);
+		for(auto& element : elements)
+		{
+			BS_TEST_ASSERT(element.output.page >= 0 && element.output.page < (INT32)pages.size());
+			BS_TEST_ASSERT(!usedIndices[element.output.idx]);
+			usedIndices[element.output.idx] = true;
+
+			DebugAtlasRect rect = { element.output.x, element.output.y, element.input.width, element.input.height };
+			rectsPerPage[element.output.page].push_back(rect);
+		}
+
+		for(UINT32 i = 0; i < (UINT32)pages.size(); i++)
+			BS_TEST_ASSERT(isValidAtlasLayout(rectsPerPage[i], pages[i].width, pages[i].height));
+	}
 }
@@ -15,5 +15,9 @@ namespace bs
 
 	private:
 		void testOctree();
+		void testFlatHashMap();
+		void testEvent();
+		void testStringID();
+		void testTextureAtlasLayout();
 	};
 }
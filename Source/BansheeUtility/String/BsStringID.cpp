@@ -1,145 +1,149 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "String/BsStringID.h"
+#include "Math/BsMath.h"
 
 namespace bs
 {
 	const StringID StringID::NONE = StringID();
 
-	volatile StringID::InitStatics StringID::mInitStatics = StringID::InitStatics();
-
-	StringID::InternalData* StringID::mStringHashTable[HASH_TABLE_SIZE];
-	StringID::InternalData* StringID::mChunks[MAX_CHUNK_COUNT];
-
+	// Note: All of these except mSync are constant-initialized. mSync is zero-initialized before any dynamic
+	// initialization runs, which leaves it unlocked on all supported platforms. Static initialization is single-threaded,
+	// so the lock is never held when its constructor runs, and a StringID constructed during static initialization of
+	// another translation unit is still safe.
+	std::atomic<StringID::HashTable*> StringID::mTable { nullptr };
 	UINT32 StringID::mNextId = 0;
-	UINT32 StringID::mNumChunks = 0;
+	UINT8* StringID::mEntryBlock = nullptr;
+	UINT32 StringID::mEntryBlockOffset = 0;
 	SpinLock StringID::mSync;
 
-	StringID::InitStatics::InitStatics()
+	StringID::StringID()
+		:mData(nullptr)
+	{ }
+
+	void StringID::construct(const char* name, UINT32 length, UINT32 hash)
 	{
-		ScopedSpinLock lock(mSync);
+		// Fast path, no locking
+		mData = findEntry(mTable.load(std::memory_order_acquire), name, length, hash);
+		if (mData != nullptr)
+			return;
 
-		memset(mStringHashTable, 0, sizeof(mStringHashTable));
-		memset(mChunks, 0, sizeof(mChunks));
+		ScopedSpinLock lock(mSync);
 
-		mChunks[0] = (InternalData*)bs_alloc(sizeof(InternalData) * ELEMENTS_PER_CHUNK);
-		memset(mChunks[0], 0, sizeof(InternalData) * ELEMENTS_PER_CHUNK);
+		// Search for the value again in case other thread just added it, or replaced the table we were searching in
+		mData = findEntry(mTable.load(std::memory_order_relaxed), name, length, hash);
+		if (mData != nullptr)
+			return;
 
-		mNumChunks++;
+		mData = allocEntry(name, length, hash);
+		insertEntry(mData);
 	}
 
-	StringID::StringID()
-		:mData(nullptr)
-	{ }
-
-	template<class T>
-	void StringID::construct(T const& name)
+	StringID::InternalData* StringID::findEntry(const HashTable* table, const char* name, UINT32 length, UINT32 hash)
 	{
-		assert(StringIDUtil<T>::size(name) <= STRING_SIZE);
+		if (table == nullptr)
+			return nullptr;
+
+		UINT32 mask = table->size - 1;
+		UINT32 idx = hash & mask;
 
-		UINT32 hash = calcHash(name) & (sizeof(mStringHashTable) / sizeof(mStringHashTable[0]) - 1);
-		InternalData* existingEntry = mStringHashTable[hash];
-		
-		while (existingEntry != nullptr)
+		while (true)
 		{
-			if (StringIDUtil<T>::compare(name, existingEntry->chars))
-			{
-				mData = existingEntry;
-				return;
-			}
+			InternalData* entry = table->entries[idx].load(std::memory_order_acquire);
+			if (entry == nullptr)
+				return nullptr;
 
-			existingEntry = existingEntry->next;
+			if (entry->hash == hash && entry->length == length && memcmp(entry->chars, name, length) == 0)
+				return entry;
+
+			idx = (idx + 1) & mask;
 		}
+	}
 
-		ScopedSpinLock lock(mSync);
+	StringID::InternalData* StringID::allocEntry(const char* name, UINT32 length, UINT32 hash)
+	{
+		UINT32 entrySize = (UINT32)offsetof(InternalData, chars) + length + 1;
+		entrySize = Math::divideAndRoundUp(entrySize, (UINT32)alignof(InternalData)) * (UINT32)alignof(InternalData);
 
-		// Search for the value again in case other thread just added it
-		existingEntry = mStringHashTable[hash];
-		InternalData* lastEntry = nullptr;
-		while (existingEntry != nullptr)
+		InternalData* entry;
+		if (entrySize > ENTRY_BLOCK_SIZE / 4)
 		{
-			if (StringIDUtil<T>::compare(name, existingEntry->chars))
+			// Large strings get a dedicated allocation, in order not to waste the remainder of the current block
+			entry = (InternalData*)bs_alloc(entrySize);
+		}
+		else
+		{
+			if (mEntryBlock == nullptr || (mEntryBlockOffset + entrySize) > ENTRY_BLOCK_SIZE)
 			{
-				mData = existingEntry;
-				return;
+				mEntryBlock = (UINT8*)bs_alloc(ENTRY_BLOCK_SIZE);
+				mEntryBlockOffset = 0;
 			}
 
-			lastEntry = existingEntry;
-			existingEntry = existingEntry->next;
+			entry = (InternalData*)(mEntryBlock + mEntryBlockOffset);
+			mEntryBlockOffset += entrySize;
 		}
 
-		mData = allocEntry();
-		StringIDUtil<T>::copy(name, mData->chars);
+		entry->id = mNextId++;
+		entry->hash = hash;
+		entry->length = length;
+		memcpy(entry->chars, name, length);
+		entry->chars[length] = '\0';
 
-		if (lastEntry == nullptr)
-			mStringHashTable[hash] = mData;
-		else
-			lastEntry->next = mData;
+		return entry;
 	}
 
-	template<class T>
-	UINT32 StringID::calcHash(T const& input)
+	void StringID::insertEntry(InternalData* entry)
 	{
-		UINT32 size = StringIDUtil<T>::size(input);
+		HashTable* table = mTable.load(std::memory_order_relaxed);
 
-		UINT32 hash = 0;
-		for (UINT32 i = 0; i < size; i++)
-			hash = hash * 101 + input[i];
+		// Keep the load factor at or below one half, so probe sequences remain short
+		if (table == nullptr || mNextId * 2 > table->size)
+		{
+			HashTable* newTable = allocTable(table != nullptr ? table->size * 2 : INITIAL_TABLE_SIZE);
+			newTable->previous = table;
 
-		return hash;
-	}
+			if (table != nullptr)
+			{
+				UINT32 mask = newTable->size - 1;
+				for (UINT32 i = 0; i < table->size; i++)
+				{
+					InternalData* existing = table->entries[i].load(std::memory_order_relaxed);
+					if (existing == nullptr)
+						continue;
+
+					UINT32 idx = existing->hash & mask;
+					while (newTable->entries[idx].load(std::memory_order_relaxed) != nullptr)
+						idx = (idx + 1) & mask;
+
+					newTable->entries[idx].store(existing, std::memory_order_relaxed);
+				}
+			}
 
-	StringID::InternalData* StringID::allocEntry()
-	{
-		UINT32 chunkIdx = mNextId / ELEMENTS_PER_CHUNK;
+			// Readers still using the old table will not see the new entry, but will then fall back to the locked path
+			mTable.store(newTable, std::memory_order_release);
+			table = newTable;
+		}
 
-		assert(chunkIdx < MAX_CHUNK_COUNT);
-		assert(chunkIdx <= mNumChunks); // Can only increment sequentially
+		UINT32 mask = table->size - 1;
+		UINT32 idx = entry->hash & mask;
+		while (table->entries[idx].load(std::memory_order_relaxed) != nullptr)
+			idx = (idx + 1) & mask;
 
-		if (chunkIdx >= mNumChunks)
-		{
-			mChunks[chunkIdx] = (InternalData*)bs_alloc(sizeof(InternalData) * ELEMENTS_PER_CHUNK);
-			memset(mChunks[chunkIdx], 0, sizeof(InternalData) * ELEMENTS_PER_CHUNK);
+		table->entries[idx].store(entry, std::memory_order_release);
+	}
 
-			mNumChunks++;
-		}
+	StringID::HashTable* StringID::allocTable(UINT32 size)
+	{
+		UINT8* data = (UINT8*)bs_alloc(sizeof(HashTable) + sizeof(std::atomic<InternalData*>) * size);
 
-		InternalData* chunk = mChunks[chunkIdx];
-		UINT32 chunkSpecificIndex = mNextId % ELEMENTS_PER_CHUNK;
+		HashTable* table = (HashTable*)data;
+		table->size = size;
+		table->previous = nullptr;
+		table->entries = (std::atomic<InternalData*>*)(data + sizeof(HashTable));
 
-		InternalData* newEntry = &chunk[chunkSpecificIndex];
-		newEntry->id = mNextId++;
-		newEntry->next = nullptr;
+		for (UINT32 i = 0; i < size; i++)
+			new (&table->entries[i]) std::atomic<InternalData*>(nullptr);
 
-		return newEntry;
+		return table;
 	}
-
-	template<>
-	class StringID::StringIDUtil<const char*>
-	{
-	public:
-		static UINT32 size(const char* const& input) { return (UINT32)strlen(input); }
-		static void copy(const char* const& input, char* dest) { memcpy(dest, input, strlen(input) + 1); }
-		static bool compare(const char* const& a, char* b) { return strcmp(a, b) == 0; }
-	};
-
-	template<>
-	class StringID::StringIDUtil <String>
-	{
-	public:
-		static UINT32 size(String const& input) { return (UINT32)input.length(); }
-		static void copy(String const& input, char* dest)
-		{ 
-			UINT32 len = (UINT32)input.length();
-			input.copy(dest, len);
-			dest[len] = '\0';
-		}
-		static bool compare(String const& a, char* b) { return a.compare(b) == 0; }
-	};
-
-	template BS_UTILITY_EXPORT void StringID::construct(const char* const&);
-	template BS_UTILITY_EXPORT void StringID::construct(String const&);
-	
-	template BS_UTILITY_EXPORT UINT32 StringID::calcHash(const char* const&);
-	template BS_UTILITY_EXPORT UINT32 StringID::calcHash(String const&);
-}
\ No newline at end of file
+}
@@ -19,59 +19,82 @@ namespace bs
 	 * Essentially a unique ID is generated for each string and then the ID is used for comparisons as if you were using 
 	 * an integer or an enum.
 	 * @note
+	 * Looking up an existing string never locks. String hashes are only guaranteed to be calculated at compile time when
+	 * constructing through BS_SID. Other constructors calculate them at runtime, unless the compiler chooses to fold the
+	 * calculation.
+	 * @note
 	 * Thread safe.
 	 */
 	class BS_UTILITY_EXPORT StringID
 	{
-		static const int HASH_TABLE_SIZE = 4096;
-		static const int MAX_CHUNK_COUNT = 50;
-		static const int ELEMENTS_PER_CHUNK = 256;
-		static const int STRING_SIZE = 256;
-
-		/** Helper class that performs string actions on both null terminated character arrays and standard strings. */
-		template<class T>
-		class StringIDUtil
-		{
-		public:
-			static UINT32 size(T const& input) { return 0; }
-			static void copy(T const& input, char* dest) { }
-			static bool compare(T const& a, char* b) { return 0; }
-		};
+		/** Number of slots in the hash table when it is first created. */
+		static const UINT32 INITIAL_TABLE_SIZE = 1024;
+
+		/** Size of the memory blocks string entries are allocated from. */
+		static const UINT32 ENTRY_BLOCK_SIZE = 16 * 1024;
 
 		/**	Internal data that is shared by all instances for a specific string. */
 		struct InternalData
 		{
 			UINT32 id;
-			InternalData* next;
-			char chars[STRING_SIZE];
+			UINT32 hash;
+			UINT32 length;
+			char chars[1]; // Variable size, null-terminated
 		};
 
-		/**	Performs initialization of static members as soon as the library is loaded. */
-		struct InitStatics
+		/**
+		 * Open-addressing hash table containing all the string entries. When the table gets too full it gets replaced
+		 * with a larger copy. Old tables are never freed, as other threads might still be reading from them.
+		 */
+		struct HashTable
 		{
-			InitStatics();
+			UINT32 size; // Always a power of two
+			HashTable* previous;
+			std::atomic<InternalData*>* entries;
 		};
 
 	public:
 		StringID();
 
-		StringID(const char* name)
+		/** Constructs the string ID from a null-terminated string. */
+		template<class T, typename std::enable_if<
+			std::is_same<T, const char*>::value || std::is_same<T, char*>::value, int>::type = 0>
+		StringID(T name)
 			:mData(nullptr)
 		{
-			construct(name);
+			UINT32 length = (UINT32)strlen(name);
+			construct(name, length, calcHash(name, length));
+		}
+
+		/**
+		 * Constructs the string ID from a string literal. The hash is calculated using constexpr functions, but the
+		 * compiler isn't required to evaluate them at compile time. Use BS_SID if that needs to be guaranteed.
+		 */
+		template<UINT32 N>
+		StringID(const char (&name)[N])
+			:mData(nullptr)
+		{
+			// Note: Not assuming the length is N - 1, in case this is a character buffer and not a literal
+			UINT32 length = calcLength(name, N);
+			construct(name, length, calcHash(name, length));
 		}
 
 		StringID(const String& name)
 			:mData(nullptr)
 		{
-			construct(name);
+			UINT32 length = (UINT32)name.length();
+			construct(name.c_str(), length, calcHash(name.c_str(), length));
 		}
 
-		template<int N>
-		StringID(const char name[N])
+		/**
+		 * Constructs the string ID from a string with a pre-calculated hash. @p hash must be the value returned by
+		 * calcHash() for the same string. Normally used through the BS_SID macro, which calculates the hash at compile
+		 * time.
+		 */
+		StringID(const char* name, UINT32 length, UINT32 hash)
 			:mData(nullptr)
 		{
-			construct((const char*)name);
+			construct(name, length, hash);
 		}
 
 		/**	Compare to string ids for equality. Uses fast integer comparison. */
@@ -104,34 +127,66 @@ namespace bs
 		/** Returns the unique identifier of the string. */
 		UINT32 id() const { return mData ? mData->id : -1; }
 
+		/** Calculates a hash of the provided string, as used by the string table (32-bit FNV-1a). */
+		static constexpr UINT32 calcHash(const char* input, UINT32 length)
+		{
+			UINT32 hash = 2166136261u;
+			for (UINT32 i = 0; i < length; i++)
+				hash = (hash ^ (UINT8)input[i]) * 16777619u;
+
+			return hash;
+		}
+
 		static const StringID NONE;
 
 	private:
-		/**Constructs a StringID object in a way that works for pointers to character arrays and standard strings. */
-		template<class T>
-		void construct(T const& name);
+		/** Returns the length of a null-terminated string stored in a buffer of the provided size. */
+		static constexpr UINT32 calcLength(const char* input, UINT32 bufferSize)
+		{
+			UINT32 length = 0;
+			while (length < bufferSize && input[length] != '\0')
+				length++;
 
-		/**	Calculates a hash value for the provided null-terminated string. */
-		template<class T>
-		UINT32 calcHash(T const& input);
+			return length;
+		}
 
 		/**
-		 * Allocates a new string entry and assigns it a unique ID. Optionally expands the chunks buffer if the new entry 
-		 * doesn't fit.
+		 * Finds an existing entry for the provided string, or registers a new one if one doesn't exist. @p name doesn't
+		 * need to be null-terminated.
 		 */
-		InternalData* allocEntry();
+		void construct(const char* name, UINT32 length, UINT32 hash);
 
-		InternalData* mData;
+		/** Attempts to find an existing entry for the provided string in the provided table. Returns null if not found. */
+		static InternalData* findEntry(const HashTable* table, const char* name, UINT32 length, UINT32 hash);
 
-		static volatile InitStatics mInitStatics;
-		static InternalData* mStringHashTable[HASH_TABLE_SIZE];
-		static InternalData* mChunks[MAX_CHUNK_COUNT];
+		/** Allocates a new string entry and assigns it a unique ID. Caller must hold the write lock. */
+		static InternalData* allocEntry(const char* name, UINT32 length, UINT32 hash);
 
+		/**
+		 * Inserts a new entry in the hash table, growing the table if needed. Caller must hold the write lock, and ensure
+		 * the entry doesn't already exist.
+		 */
+		static void insertEntry(InternalData* entry);
+
+		/** Allocates a new hash table with the specified number of slots. */
+		static HashTable* allocTable(UINT32 size);
+
+		InternalData* mData;
+
+		static std::atomic<HashTable*> mTable;
 		static UINT32 mNextId;
-		static UINT32 mNumChunks;
+		static UINT8* mEntryBlock;
+		static UINT32 mEntryBlockOffset;
 		static SpinLock mSync;
 	};
 
+	/**
+	 * Constructs a StringID from a string literal, with its hash guaranteed to be calculated at compile time (it is
+	 * evaluated as a template argument). Only the string table lookup is performed at runtime.
+	 */
+#define BS_SID(name) bs::StringID(name, sizeof(name) - 1, \
+	std::integral_constant<bs::UINT32, bs::StringID::calcHash(name, sizeof(name) - 1)>::value)
+
 	/** @cond SPECIALIZATIONS */
 
 	template<> struct RTTIPlainType <StringID>
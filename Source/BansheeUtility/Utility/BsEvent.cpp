@@ -0,0 +1,43 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Utility/BsEvent.h"
+
+namespace bs
+{
+	BS_THREADLOCAL EventCallFrame* EventCallFrame::Top = nullptr;
+
+	bool EventCallFrame::isTriggering(const EventInternalData* event)
+	{
+		for (EventCallFrame* frame = Top; frame != nullptr; frame = frame->mParent)
+		{
+			if (frame->mEvent == event)
+				return true;
+		}
+
+		return false;
+	}
+
+	void EventCallFrame::keepAlive(const SPtr<EventInternalData>& event)
+	{
+		EventCallFrame* outermost = nullptr;
+		for (EventCallFrame* frame = Top; frame != nullptr; frame = frame->mParent)
+		{
+			if (frame->mEvent == event.get())
+				outermost = frame;
+		}
+
+		if (outermost != nullptr)
+			outermost->mKeepAlive = event;
+	}
+
+	void EventCallFrame::push(EventCallFrame* frame)
+	{
+		frame->mParent = Top;
+		Top = frame;
+	}
+
+	void EventCallFrame::pop(EventCallFrame* frame)
+	{
+		Top = frame->mParent;
+	}
+}
@@ -18,166 +18,61 @@ namespace bs
 	class BaseConnectionData
 	{
 	public:
-		BaseConnectionData()
-			:prev(nullptr), next(nullptr), isActive(true),
-			handleLinks(0)
-		{
-			
-		}
-
-		virtual ~BaseConnectionData()
-		{
-			assert(!handleLinks && !isActive);
-		}
+		virtual ~BaseConnectionData() = default;
 
-		virtual void deactivate()
-		{
-			isActive = false;
-		}
-
-		BaseConnectionData* prev;
-		BaseConnectionData* next;
-		bool isActive;
-		UINT32 handleLinks;
+		std::atomic<bool> isActive { true };
 	};
 
 	/** Internal data for an Event, storing all connections. */
-	struct EventInternalData
+	class EventInternalData
 	{
-		EventInternalData()
-			:mConnections(nullptr), mLastConnection(nullptr), mFreeConnections(nullptr), mNewConnections(nullptr), 
-			mIsCurrentlyTriggering(false)
-		{ }
-
-		~EventInternalData()
-		{
-			BaseConnectionData* conn = mConnections;
-			while (conn != nullptr)
-			{
-				BaseConnectionData* next = conn->next;
-				bs_free(conn);
-
-				conn = next;
-			}
-
-			conn = mFreeConnections;
-			while (conn != nullptr)
-			{
-				BaseConnectionData* next = conn->next;
-				bs_free(conn);
-
-				conn = next;
-			}
-
-			conn = mNewConnections;
-			while (conn != nullptr)
-			{
-				BaseConnectionData* next = conn->next;
-				bs_free(conn);
+	public:
+		virtual ~EventInternalData() = default;
 
-				conn = next;
-			}
-		}
+		/** Disconnects the connection with the specified data, ensuring the event doesn't call its callback again. */
+		virtual void disconnect(BaseConnectionData* conn) = 0;
+	};
 
-		/** Appends a new connection to the active connection array. */
-		void connect(BaseConnectionData* conn)
+	/**
+	 * Marks an event trigger in progress on the current thread. Frames of nested triggers form a per-thread stack, which
+	 * allows an event to detect it's being disconnected from or destroyed by one of its own callbacks.
+	 */
+	class EventCallFrame
+	{
+	public:
+		EventCallFrame(const EventInternalData* event)
+			:mEvent(event)
 		{
-			conn->prev = mLastConnection;
-
-			if (mLastConnection != nullptr)
-				mLastConnection->next = conn;
-
-			mLastConnection = conn;
-
-			// First connection
-			if (mConnections == nullptr)
-				mConnections = conn;
+			push(this);
 		}
 
-		/**
-		 * Disconnects the connection with the specified data, ensuring the event doesn't call its callback again.
-		 *
-		 * @note	Only call this once.
-		 */
-		void disconnect(BaseConnectionData* conn)
+		~EventCallFrame()
 		{
-			RecursiveLock lock(mMutex);
-
-			conn->deactivate();
-			conn->handleLinks--;
-
-			if (conn->handleLinks == 0)
-				free(conn);
+			pop(this);
 		}
 
-		/** Disconnects all connections in the event. */
-		void clear()
-		{
-			RecursiveLock lock(mMutex);
-
-			BaseConnectionData* conn = mConnections;
-			while (conn != nullptr)
-			{
-				BaseConnectionData* next = conn->next;
-				conn->deactivate();
-
-				if (conn->handleLinks == 0)
-					free(conn);
+		EventCallFrame(const EventCallFrame&) = delete;
+		EventCallFrame& operator=(const EventCallFrame&) = delete;
 
-				conn = next;
-			}
-
-			mConnections = nullptr;
-			mLastConnection = nullptr;
-		}
+		/** Checks if the calling thread is currently triggering the provided event. */
+		static BS_UTILITY_EXPORT bool isTriggering(const EventInternalData* event);
 
 		/**
-		 * Called when the event handle no longer keeps a reference to the connection data. This means we might be able to 
-		 * free (and reuse) its memory if the event is done with it too.
+		 * Keeps the event data alive until the outermost trigger of the event on the calling thread completes. Does
+		 * nothing if the calling thread isn't triggering the event.
 		 */
-		void freeHandle(BaseConnectionData* conn)
-		{
-			RecursiveLock lock(mMutex);
-
-			conn->handleLinks--;
-
-			if (conn->handleLinks == 0 && !conn->isActive)
-				free(conn);
-		}
-
-		/** Releases connection data and makes it available for re-use when next connection is formed. */
-		void free(BaseConnectionData* conn)
-		{
-			if (conn->prev != nullptr)
-				conn->prev->next = conn->next;
-			else
-				mConnections = conn->next;
-
-			if (conn->next != nullptr)
-				conn->next->prev = conn->prev;
-			else
-				mLastConnection = conn->prev;
-
-			conn->prev = nullptr;
-			conn->next = nullptr;
-
-			if (mFreeConnections != nullptr)
-			{
-				conn->next = mFreeConnections;
-				mFreeConnections->prev = conn;
-			}
+		static BS_UTILITY_EXPORT void keepAlive(const SPtr<EventInternalData>& event);
 
-			mFreeConnections = conn;
-			mFreeConnections->~BaseConnectionData();
-		}
+	private:
+		// Threadlocal data can't be exported, so the stack is only accessed through these
+		static BS_UTILITY_EXPORT void push(EventCallFrame* frame);
+		static BS_UTILITY_EXPORT void pop(EventCallFrame* frame);
 
-		BaseConnectionData* mConnections;
-		BaseConnectionData* mLastConnection;
-		BaseConnectionData* mFreeConnections;
-		BaseConnectionData* mNewConnections;
+		const EventInternalData* mEvent;
+		EventCallFrame* mParent = nullptr;
+		SPtr<EventInternalData> mKeepAlive;
 
-		RecursiveMutex mMutex;
-		bool mIsCurrentlyTriggering;
+		static BS_THREADLOCAL EventCallFrame* Top;
 	};
 
 	/** @} */
@@ -191,28 +86,18 @@ namespace bs
 	class HEvent
 	{
 	public:
-		HEvent()
-			:mConnection(nullptr)
-		{ }
+		HEvent() = default;
 
-		explicit HEvent(const SPtr<EventInternalData>& eventData, BaseConnectionData* connection)
+		explicit HEvent(const SPtr<EventInternalData>& eventData, const SPtr<BaseConnectionData>& connection)
 			:mConnection(connection), mEventData(eventData)
-		{
-			connection->handleLinks++;
-		}
-
-		~HEvent()
-		{
-			if (mConnection != nullptr)
-				mEventData->freeHandle(mConnection);
-		}
+		{ }
 
 		/** Disconnect from the event you are subscribed to. */
 		void disconnect()
 		{
 			if (mConnection != nullptr)
 			{
-				mEventData->disconnect(mConnection);
+				mEventData->disconnect(mConnection.get());
 				mConnection = nullptr;
 				mEventData = nullptr;
 			}
@@ -230,8 +115,8 @@ namespace bs
 		/**
 		* Allows direct conversion of a handle to bool.
 		*
-		* @note		
-		* Additional struct is needed because we can't directly convert to bool since then we can assign pointer to bool 
+		* @note
+		* Additional struct is needed because we can't directly convert to bool since then we can assign pointer to bool
 		* and that's wrong.
 		*/
 		operator int Bool_struct::*() const
@@ -239,21 +124,10 @@ namespace bs
 			return (mConnection != nullptr ? &Bool_struct::_Member : 0);
 		}
 
-		HEvent& operator=(const HEvent& rhs)
-		{
-			mConnection = rhs.mConnection;
-			mEventData = rhs.mEventData;
-
-			if (mConnection != nullptr)
-				mConnection->handleLinks++;
-
-			return *this;
-		}
-
 	private:
-		BaseConnectionData* mConnection;
+		SPtr<BaseConnectionData> mConnection;
 		SPtr<EventInternalData> mEventData;
-	};	
+	};
 
 	/** @} */
 
@@ -266,123 +140,553 @@ namespace bs
 	 */
 
 	/**
-	 * Events allows you to register method callbacks that get notified when the event is triggered.
-	 *
-	 * @note	Callback method return value is ignored.
+	 * Type-erased callable used for event callbacks. Callables that fit into the inline storage (which includes bound
+	 * member functions and lambdas capturing a few pointers) are stored without any dynamic allocation.
 	 */
-	// Note: I could create a policy template argument that allows creation of 
-	// lockable and non-lockable events in the case mutex is causing too much overhead.
 	template <class RetType, class... Args>
-	class TEvent
+	class TEventCallback
 	{
-		struct ConnectionData : BaseConnectionData
+		static constexpr UINT32 INLINE_STORAGE_SIZE = 32;
+
+		typedef typename std::aligned_storage<INLINE_STORAGE_SIZE>::type StorageType;
+		typedef RetType(*InvokeFunc)(void*, Args&...);
+		typedef void(*DestroyFunc)(void*);
+
+	public:
+		TEventCallback() = default;
+
+		template<class Func>
+		explicit TEventCallback(Func&& func)
+		{
+			typedef typename std::decay<Func>::type FuncType;
+
+			constexpr bool fitsInline = sizeof(FuncType) <= sizeof(StorageType) &&
+				alignof(FuncType) <= alignof(StorageType);
+
+			assign<FuncType>(std::forward<Func>(func), std::integral_constant<bool, fitsInline>());
+		}
+
+		~TEventCallback()
+		{
+			reset();
+		}
+
+		TEventCallback(const TEventCallback&) = delete;
+		TEventCallback& operator=(const TEventCallback&) = delete;
+
+		/** Calls the stored callable. Must not be called if the callback is empty. */
+		RetType operator()(Args&... args)
+		{
+			return mInvoke(&mStorage, args...);
+		}
+
+		/** Checks if the callback has a callable assigned. */
+		bool empty() const { return mInvoke == nullptr; }
+
+		/** Destroys the stored callable, if any. */
+		void reset()
+		{
+			if (mDestroy != nullptr)
+				mDestroy(&mStorage);
+
+			mInvoke = nullptr;
+			mDestroy = nullptr;
+		}
+
+	private:
+		/** Constructs the callable directly in the inline storage. */
+		template<class FuncType, class Func>
+		void assign(Func&& func, std::true_type)
+		{
+			new (&mStorage) FuncType(std::forward<Func>(func));
+
+			mInvoke = [](void* storage, Args&... args) -> RetType
+			{
+				return static_cast<RetType>((*static_cast<FuncType*>(storage))(args...));
+			};
+
+			mDestroy = [](void* storage)
+			{
+				static_cast<FuncType*>(storage)->~FuncType();
+			};
+		}
+
+		/** Allocates the callable on the heap, and stores only the pointer to it in the inline storage. */
+		template<class FuncType, class Func>
+		void assign(Func&& func, std::false_type)
 		{
-		public:
-			void deactivate() override
+			FuncType* funcPtr = bs_new<FuncType>(std::forward<Func>(func));
+			new (&mStorage) FuncType*(funcPtr);
+
+			mInvoke = [](void* storage, Args&... args) -> RetType
 			{
-				func = nullptr;
+				return static_cast<RetType>((**static_cast<FuncType**>(storage))(args...));
+			};
 
-				BaseConnectionData::deactivate();
-			}
+			mDestroy = [](void* storage)
+			{
+				bs_delete(*static_cast<FuncType**>(storage));
+			};
+		}
 
-			std::function<RetType(Args...)> func;
-		};
+		StorageType mStorage;
+		InvokeFunc mInvoke = nullptr;
+		DestroyFunc mDestroy = nullptr;
+	};
 
+	/** Connection data for an event with a specific signature. */
+	template <class RetType, class... Args>
+	class TEventConnection : public BaseConnectionData
+	{
 	public:
-		TEvent()
-			:mInternalData(bs_shared_ptr_new<EventInternalData>())
+		template<class Func>
+		explicit TEventConnection(Func&& func)
+			:func(std::forward<Func>(func))
 		{ }
 
-		~TEvent()
+		TEventCallback<RetType, Args...> func;
+	};
+
+	/**
+	 * Connection storage for events that are only ever used from a single thread. No locking is performed. Connections
+	 * are stored in a contiguous array, and any connections disconnected while the event is being triggered are removed
+	 * once triggering completes.
+	 */
+	template <class RetType, class... Args>
+	class TUnsyncEventInternalData : public EventInternalData
+	{
+	public:
+		typedef TEventConnection<RetType, Args...> ConnectionType;
+
+		/** Registers a new connection. Connections registered while triggering will not be called until next trigger. */
+		void connect(const SPtr<ConnectionType>& conn)
 		{
-			clear();
+			mConnections.push_back(conn);
 		}
 
-		/** Register a new callback that will get notified once the event is triggered. */
-		HEvent connect(std::function<RetType(Args...)> func)
+		/** @copydoc EventInternalData::disconnect */
+		void disconnect(BaseConnectionData* conn) override
 		{
-			RecursiveLock lock(mInternalData->mMutex);
+			if (!conn->isActive)
+				return;
 
-			ConnectionData* connData = nullptr;
-			if (mInternalData->mFreeConnections != nullptr)
-			{
-				connData = static_cast<ConnectionData*>(mInternalData->mFreeConnections);
-				mInternalData->mFreeConnections = connData->next;
+			conn->isActive = false;
+			mHasInactive = true;
+
+			if (mTriggerDepth == 0)
+				removeInactive();
+		}
+
+		/** Disconnects all connections in the event. */
+		void clear()
+		{
+			for (auto& entry : mConnections)
+				entry->isActive = false;
+
+			mHasInactive = !mConnections.empty();
+
+			if (mTriggerDepth == 0)
+				removeInactive();
+		}
 
-				new (connData)ConnectionData();
-				if (connData->next != nullptr)
-					connData->next->prev = nullptr;
+		/** Calls all active connections with the provided arguments. */
+		void trigger(Args&... args)
+		{
+			mTriggerDepth++;
+
+			// Note: Not iterating using iterators since connections can be added by the callbacks
+			UINT32 numConnections = (UINT32)mConnections.size();
+			for (UINT32 i = 0; i < numConnections; i++)
+			{
+				ConnectionType* conn = mConnections[i].get();
 
-				connData->isActive = true;
+				if (conn->isActive.load(std::memory_order_relaxed))
+					conn->func(args...);
 			}
 
-			if (connData == nullptr)
-				connData = bs_new<ConnectionData>();
+			mTriggerDepth--;
 
-			// If currently iterating over the connection list, delay modifying it until done
-			if(mInternalData->mIsCurrentlyTriggering)
+			if (mTriggerDepth == 0)
 			{
-				connData->prev = mInternalData->mNewConnections;
+				if (mHasInactive)
+					removeInactive();
 
-				if (mInternalData->mNewConnections != nullptr)
-					mInternalData->mNewConnections->next = connData;
+				// If the owning event was destroyed by one of the callbacks, release the last reference to this object
+				// (must be the last thing done in this method)
+				if (mKeepAlive != nullptr)
+				{
+					SPtr<EventInternalData> keepAlive = std::move(mKeepAlive);
+					return;
+				}
+			}
+		}
 
-				mInternalData->mNewConnections = connData;
+		/** Checks if there are any registered connections. */
+		bool empty() const
+		{
+			for (auto& entry : mConnections)
+			{
+				if (entry->isActive)
+					return false;
 			}
-			else
+
+			return true;
+		}
+
+		/**
+		 * Notifies the object that the owning event has been destroyed. If the event is currently being triggered the
+		 * object will keep itself alive until triggering completes.
+		 */
+		void notifyOwnerDestroyed(const SPtr<EventInternalData>& self)
+		{
+			if (mTriggerDepth > 0)
+				mKeepAlive = self;
+		}
+
+	private:
+		/** Removes all inactive connections from the connection list, and releases their callbacks. */
+		void removeInactive()
+		{
+			UINT32 numActive = 0;
+			for (UINT32 i = 0; i < (UINT32)mConnections.size(); i++)
 			{
-				mInternalData->connect(connData);
+				if (!mConnections[i]->isActive)
+				{
+					mConnections[i]->func.reset();
+					continue;
+				}
+
+				if (numActive != i)
+					mConnections[numActive] = std::move(mConnections[i]);
+
+				numActive++;
 			}
 
-			connData->func = func;
+			mConnections.resize(numActive);
+			mHasInactive = false;
+		}
 
-			return HEvent(mInternalData, connData);
+		Vector<SPtr<ConnectionType>> mConnections;
+		SPtr<EventInternalData> mKeepAlive;
+		UINT32 mTriggerDepth = 0;
+		bool mHasInactive = false;
+	};
+
+	/**
+	 * Connection storage for events that can be used from multiple threads. The connection list is copy-on-write:
+	 * connecting and disconnecting create a new list under a mutex, while triggering reads the current list without
+	 * taking any locks. Instead, triggers in progress are counted. This allows disconnecting to wait for the callbacks
+	 * to finish executing, and replaced lists to be released once no trigger can be reading them anymore.
+	 */
+	template <class RetType, class... Args>
+	class TSyncEventInternalData : public EventInternalData
+	{
+	public:
+		typedef TEventConnection<RetType, Args...> ConnectionType;
+		typedef Vector<SPtr<ConnectionType>> ConnectionList;
+
+		~TSyncEventInternalData()
+		{
+			// Owning event normally waits on all triggers when clearing the connections on destruction, except if it was
+			// destroyed by one of its own callbacks
+			while (isTriggered())
+				std::this_thread::yield();
+
+			ConnectionList* connections = mConnections.load();
+			if (connections != nullptr)
+				bs_delete(connections);
+
+			for (auto& entry : mRetiredConnections)
+				bs_delete(entry.list);
 		}
 
-		/** Trigger the event, notifying all register callback methods. */
-		void operator() (Args... args)
+		/** Registers a new connection. Connections registered while triggering will not be called until next trigger. */
+		void connect(const SPtr<ConnectionType>& conn)
 		{
-			// Increase ref count to ensure this event data isn't destroyed if one of the callbacks
-			// deletes the event itself.
-			SPtr<EventInternalData> internalData = mInternalData;
+			Lock lock(mMutex);
 
-			RecursiveLock lock(internalData->mMutex);
-			internalData->mIsCurrentlyTriggering = true;
+			ConnectionList* newConnections = copyActive(1);
+			newConnections->push_back(conn);
+
+			setConnections(newConnections);
+		}
+
+		/**
+		 * @copydoc EventInternalData::disconnect
+		 *
+		 * Blocks until all triggers of the event in progress on other threads complete, unless called from one of the
+		 * event's callbacks.
+		 */
+		void disconnect(BaseConnectionData* conn) override
+		{
+			if (!conn->isActive.exchange(false))
+				return;
 
-			ConnectionData* conn = static_cast<ConnectionData*>(internalData->mConnections);
-			while (conn != nullptr)
+			UINT64 retireId;
 			{
-				// Save next here in case the callback itself disconnects this connection
-				ConnectionData* next = static_cast<ConnectionData*>(conn->next);
-				
-				if (conn->func != nullptr)
-					conn->func(std::forward<Args>(args)...);
+				Lock lock(mMutex);
 
-				conn = next;
+				ConnectionList* newConnections = copyActive(0);
+				retireId = setConnections(newConnections);
 			}
 
-			internalData->mIsCurrentlyTriggering = false;
+			if (waitForTriggers())
+			{
+				Lock lock(mMutex);
+				releaseRetired(retireId);
+			}
+		}
 
-			// If any new connections were added during the above calls, add them to the connection list
-			if(internalData->mNewConnections != nullptr)
+		/**
+		 * Disconnects all connections in the event. Blocks until all triggers of the event in progress on other threads
+		 * complete, unless called from one of the event's callbacks.
+		 */
+		void clear()
+		{
+			UINT64 retireId;
 			{
-				BaseConnectionData* lastNewConnection = internalData->mNewConnections;
-				while (lastNewConnection != nullptr)
-					lastNewConnection = lastNewConnection->next;
+				Lock lock(mMutex);
 
-				BaseConnectionData* currentConnection = lastNewConnection;
-				while(currentConnection != nullptr)
+				ConnectionList* connections = mConnections.load();
+				if (connections != nullptr)
 				{
-					BaseConnectionData* prevConnection = currentConnection->prev;
-					currentConnection->next = nullptr;
-					currentConnection->prev = nullptr;
+					for (auto& entry : *connections)
+						entry->isActive = false;
+				}
+
+				retireId = setConnections(nullptr);
+			}
+
+			if (waitForTriggers())
+			{
+				Lock lock(mMutex);
+				releaseRetired(retireId);
+			}
+		}
+
+		/** Calls all active connections with the provided arguments. */
+		void trigger(Args&... args)
+		{
+			// Avoid registering the trigger at all for events nobody is listening to
+			if (mConnections.load(std::memory_order_acquire) == nullptr)
+				return;
+
+			// Must be constructed first, so it's destroyed last in case it's keeping this object alive
+			EventCallFrame frame(this);
+
+			// Trigger must be registered before the connections are read, so that the list can't be released while in
+			// use, and so that disconnect either sees the trigger and waits for it, or the trigger sees the connection
+			// as inactive
+			UINT32 slot = mTriggerEpoch.load() & 1;
+			mNumTriggers[slot].fetch_add(1);
 
-					mInternalData->connect(currentConnection);
-					currentConnection = prevConnection;
+			ConnectionList* connections = mConnections.load();
+			if (connections != nullptr)
+			{
+				for (auto& entry : *connections)
+				{
+					if (entry->isActive.load())
+						entry->func(args...);
 				}
+			}
+
+			mNumTriggers[slot].fetch_sub(1);
+
+			// Release any lists replaced during triggering (e.g. by callbacks disconnecting themselves), if it's safe
+			if (mHasRetiredConnections.load(std::memory_order_relaxed) && !isTriggered())
+			{
+				Lock lock(mMutex, std::try_to_lock);
+				if (lock.owns_lock() && !isTriggered())
+					releaseRetired(mNextRetireId);
+			}
+		}
+
+		/** Checks if there are any registered connections. */
+		bool empty() const
+		{
+			return mConnections.load(std::memory_order_acquire) == nullptr;
+		}
+
+		/**
+		 * Notifies the object that the owning event has been destroyed. If the event is currently being triggered by
+		 * the calling thread the object will keep itself alive until triggering completes. Triggers on other threads
+		 * are waited on before the object is destroyed.
+		 */
+		void notifyOwnerDestroyed(const SPtr<EventInternalData>& self)
+		{
+			EventCallFrame::keepAlive(self);
+		}
+
+	private:
+		/** Connection list that was replaced, but might still be read by a trigger in progress. */
+		struct RetiredConnections
+		{
+			ConnectionList* list;
+			UINT64 id;
+		};
+
+		/** Checks if any thread is currently triggering the event. */
+		bool isTriggered() const
+		{
+			return mNumTriggers[0].load() > 0 || mNumTriggers[1].load() > 0;
+		}
+
+		/**
+		 * Blocks until all triggers in progress complete. Returns immediately if the calling thread is itself triggering
+		 * the event, as waiting on other triggers could then deadlock.
+		 *
+		 * @return	True if all triggers that started before the call have completed, false if returned without waiting.
+		 */
+		bool waitForTriggers()
+		{
+			if (EventCallFrame::isTriggering(this))
+				return false;
 
-				internalData->mNewConnections = nullptr;
+			// New triggers are directed to the slot not being waited on, so continuous triggering can't stall the wait
+			for (UINT32 slot = 0; slot < 2; slot++)
+			{
+				while (mNumTriggers[slot].load() > 0)
+				{
+					mTriggerEpoch.store(slot ^ 1);
+					std::this_thread::yield();
+				}
 			}
+
+			return true;
+		}
+
+		/**
+		 * Replaces the current connection list with a new one. The old list is retired, and released only once no
+		 * trigger can be reading it. Caller must hold the mutex.
+		 *
+		 * @return	Identifier of the retired list. All lists with the same or lower identifier can be released once all
+		 *			triggers in progress at the time of the call complete.
+		 */
+		UINT64 setConnections(ConnectionList* connections)
+		{
+			if (connections != nullptr && connections->empty())
+			{
+				bs_delete(connections);
+				connections = nullptr;
+			}
+
+			ConnectionList* oldConnections = mConnections.exchange(connections);
+
+			UINT64 retireId = ++mNextRetireId;
+			if (oldConnections != nullptr)
+			{
+				mRetiredConnections.push_back({ oldConnections, retireId });
+				mHasRetiredConnections.store(true, std::memory_order_relaxed);
+			}
+
+			// Any trigger still reading one of the retired lists must have been registered before they were replaced
+			if (!isTriggered())
+				releaseRetired(retireId);
+
+			return retireId;
+		}
+
+		/**
+		 * Releases all retired lists with an identifier equal to or lower than the provided one. Caller must hold the
+		 * mutex.
+		 */
+		void releaseRetired(UINT64 retireId)
+		{
+			UINT32 numReleased = 0;
+			for (auto& entry : mRetiredConnections)
+			{
+				if (entry.id > retireId)
+					break;
+
+				bs_delete(entry.list);
+				numReleased++;
+			}
+
+			mRetiredConnections.erase(mRetiredConnections.begin(), mRetiredConnections.begin() + numReleased);
+			mHasRetiredConnections.store(!mRetiredConnections.empty(), std::memory_order_relaxed);
+		}
+
+		/**
+		 * Creates a new connection list containing all active connections from the current list, with room for
+		 * @p extraCount additional entries. Caller must hold the mutex.
+		 */
+		ConnectionList* copyActive(UINT32 extraCount) const
+		{
+			ConnectionList* connections = mConnections.load();
+
+			ConnectionList* output = bs_new<ConnectionList>();
+			output->reserve((connections != nullptr ? connections->size() : 0) + extraCount);
+
+			if (connections != nullptr)
+			{
+				for (auto& entry : *connections)
+				{
+					if (entry->isActive)
+						output->push_back(entry);
+				}
+			}
+
+			return output;
+		}
+
+		Mutex mMutex;
+		std::atomic<ConnectionList*> mConnections { nullptr }; // Null if empty. Written while holding the mutex.
+		Vector<RetiredConnections> mRetiredConnections; // Ordered by identifier. Accessed while holding the mutex.
+		UINT64 mNextRetireId = 0;
+		std::atomic<bool> mHasRetiredConnections { false };
+		std::atomic<UINT32> mNumTriggers[2] = { { 0 }, { 0 } }; // Triggers in progress, split in two slots by epoch
+		std::atomic<UINT32> mTriggerEpoch { 0 };
+	};
+
+	/**
+	 * Events allows you to register method callbacks that get notified when the event is triggered.
+	 *
+	 * @tparam	Sync	If true the event may be connected to, disconnected from and triggered from multiple threads.
+	 *					Callbacks of a synchronized event are executed without holding any locks. Disconnecting (or
+	 *					clearing the event) blocks until triggers in progress on other threads complete, so once it
+	 *					returns the callback is guaranteed not to be running anymore. The exception is disconnecting
+	 *					from within one of the event's own callbacks, which doesn't wait (as triggers on different
+	 *					threads could then wait on each other), and only guarantees the callback won't be called
+	 *					again. If false, the event must only be used from a single thread, but has lower overhead.
+	 *
+	 * @note	Callback method return value is ignored.
+	 */
+	template <bool Sync, class RetType, class... Args>
+	class TEvent
+	{
+		typedef TEventConnection<RetType, Args...> ConnectionType;
+		typedef typename std::conditional<Sync,
+			TSyncEventInternalData<RetType, Args...>,
+			TUnsyncEventInternalData<RetType, Args...>>::type InternalDataType;
+
+	public:
+		TEvent()
+			:mInternalData(bs_shared_ptr_new<InternalDataType>())
+		{ }
+
+		~TEvent()
+		{
+			clear();
+			mInternalData->notifyOwnerDestroyed(mInternalData);
+		}
+
+		/**
+		 * Register a new callback that will get notified once the event is triggered. Any callable object matching the
+		 * event signature can be provided (function pointer, lambda, std::function, std::bind result).
+		 */
+		template<class Func>
+		HEvent connect(Func&& func)
+		{
+			SPtr<ConnectionType> connData = bs_shared_ptr_new<ConnectionType>(std::forward<Func>(func));
+			mInternalData->connect(connData);
+
+			return HEvent(mInternalData, connData);
+		}
+
+		/** Trigger the event, notifying all register callback methods. */
+		void operator() (Args... args)
+		{
+			trigger(std::integral_constant<bool, Sync>(), args...);
 		}
 
 		/** Clear all callbacks from the event. */
@@ -398,13 +702,25 @@ namespace bs
 		 */
 		bool empty() const
 		{
-			RecursiveLock lock(mInternalData->mMutex);
-
-			return mInternalData->mConnections == nullptr;
+			return mInternalData->empty();
 		}
 
 	private:
-		SPtr<EventInternalData> mInternalData;
+		/** Triggers a synchronized event. */
+		void trigger(std::true_type, Args&... args)
+		{
+			// Note: Internal data keeps itself alive if one of the callbacks deletes the event, no need to copy the pointer
+			mInternalData->trigger(args...);
+		}
+
+		/** Triggers an unsynchronized event. */
+		void trigger(std::false_type, Args&... args)
+		{
+			// Note: Internal data keeps itself alive if one of the callbacks deletes the event, no need to copy the pointer
+			mInternalData->trigger(args...);
+		}
+
+		SPtr<InternalDataType> mInternalData;
 	};
 
 	/** @} */
@@ -418,15 +734,32 @@ namespace bs
 	/* 							SPECIALIZATIONS                      		*/
 	/* 	SO YOU MAY USE FUNCTION LIKE SYNTAX FOR DECLARING EVENT SIGNATURE   */
 	/************************************************************************/
-	
-	/** @copydoc TEvent */
+
+	/**
+	 * @copydoc TEvent
+	 *
+	 * @note	Thread safe.
+	 */
 	template <typename Signature>
 	class Event;
 
-	/** @copydoc TEvent */
+	/** @copydoc Event */
+	template <class RetType, class... Args>
+	class Event<RetType(Args...) > : public TEvent <true, RetType, Args...>
+	{ };
+
+	/**
+	 * @copydoc TEvent
+	 *
+	 * @note	Not thread safe. Connecting, disconnecting and triggering must all happen on the same thread.
+	 */
+	template <typename Signature>
+	class UnsyncEvent;
+
+	/** @copydoc UnsyncEvent */
 	template <class RetType, class... Args>
-	class Event<RetType(Args...) > : public TEvent <RetType, Args...>
+	class UnsyncEvent<RetType(Args...) > : public TEvent <false, RetType, Args...>
 	{ };
 
 	/** @} */
-}
\ No newline at end of file
+}
@@ -0,0 +1,267 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/**
+	 * Hash map that stores all of its entries in a single contiguous array, using open addressing with linear probing to
+	 * resolve collisions. Unlike UnorderedMap it performs no per-entry allocations, which makes it considerably faster for
+	 * large numbers of small keys (e.g. integer IDs). Removal uses backward shifting so no tombstones are ever left behind.
+	 *
+	 * Both the key and the value type must be default constructible. Any insertion or removal invalidates iterators and
+	 * pointers to existing entries.
+	 */
+	template<class Key, class Value, class Hasher = HashType<Key>, class Comparator = std::equal_to<Key>>
+	class FlatHashMap
+	{
+		/** Maximum load factor of the map, expressed as MAX_LOAD_NUMERATOR/MAX_LOAD_DENOMINATOR. */
+		static constexpr UINT32 MAX_LOAD_NUMERATOR = 3;
+		static constexpr UINT32 MAX_LOAD_DENOMINATOR = 4;
+		static constexpr UINT32 MIN_CAPACITY = 16;
+
+	public:
+		typedef std::pair<Key, Value> EntryType;
+
+		/** Iterator over the occupied entries of the map. */
+		template<class MapType, class EntryTypeT>
+		class TIterator
+		{
+		public:
+			TIterator(MapType* map, UINT32 idx)
+				:mMap(map), mIdx(idx)
+			{
+				skipEmpty();
+			}
+
+			EntryTypeT& operator*() const { return mMap->mEntries[mIdx]; }
+			EntryTypeT* operator->() const { return &mMap->mEntries[mIdx]; }
+
+			TIterator& operator++()
+			{
+				mIdx++;
+				skipEmpty();
+
+				return *this;
+			}
+
+			bool operator==(const TIterator& rhs) const { return mIdx == rhs.mIdx; }
+			bool operator!=(const TIterator& rhs) const { return mIdx != rhs.mIdx; }
+
+		private:
+			friend class FlatHashMap;
+
+			/** Advances the iterator until it reaches an occupied entry, or the end of the array. */
+			void skipEmpty()
+			{
+				UINT32 capacity = (UINT32)mMap->mOccupied.size();
+				while (mIdx < capacity && !mMap->mOccupied[mIdx])
+					mIdx++;
+			}
+
+			MapType* mMap;
+			UINT32 mIdx;
+		};
+
+		typedef TIterator<FlatHashMap, EntryType> iterator;
+		typedef TIterator<const FlatHashMap, const EntryType> const_iterator;
+
+		FlatHashMap() = default;
+
+		/** Returns the number of entries in the map. */
+		UINT32 size() const { return mSize; }
+
+		/** Checks if the map contains no entries. */
+		bool empty() const { return mSize == 0; }
+
+		/** Returns an iterator pointing to the first entry in the map. */
+		iterator begin() { return iterator(this, 0); }
+
+		/** Returns an iterator pointing past the last entry in the map. */
+		iterator end() { return iterator(this, (UINT32)mOccupied.size()); }
+
+		/** @copydoc begin() */
+		const_iterator begin() const { return const_iterator(this, 0); }
+
+		/** @copydoc end() */
+		const_iterator end() const { return const_iterator(this, (UINT32)mOccupied.size()); }
+
+		/** Returns an iterator pointing to the entry with the specified key, or end() if the key cannot be found. */
+		iterator find(const Key& key)
+		{
+			UINT32 idx = findIndex(key);
+			return iterator(this, idx != (UINT32)-1 ? idx : (UINT32)mOccupied.size());
+		}
+
+		/** @copydoc find() */
+		const_iterator find(const Key& key) const
+		{
+			UINT32 idx = findIndex(key);
+			return const_iterator(this, idx != (UINT32)-1 ? idx : (UINT32)mOccupied.size());
+		}
+
+		/** Checks if an entry with the specified key exists in the map. */
+		bool contains(const Key& key) const { return findIndex(key) != (UINT32)-1; }
+
+		/** Returns the value for the specified key. If the key doesn't exist a new, default constructed, value is added. */
+		Value& operator[](const Key& key)
+		{
+			UINT32 idx = findIndex(key);
+			if (idx != (UINT32)-1)
+				return mEntries[idx].second;
+
+			reserve(mSize + 1);
+
+			idx = findFreeIndex(key);
+			mEntries[idx].first = key;
+			mOccupied[idx] = true;
+			mSize++;
+
+			return mEntries[idx].second;
+		}
+
+		/**
+		 * Removes the entry with the specified key. Returns true if the entry was found and removed, false otherwise.
+		 * Subsequent entries in the same probe sequence are shifted back to fill the gap.
+		 */
+		bool erase(const Key& key)
+		{
+			UINT32 idx = findIndex(key);
+			if (idx == (UINT32)-1)
+				return false;
+
+			UINT32 mask = (UINT32)mOccupied.size() - 1;
+			UINT32 emptyIdx = idx;
+			UINT32 curIdx = (idx + 1) & mask;
+
+			while (mOccupied[curIdx])
+			{
+				// Move the entry into the gap if the gap is located cyclically between its ideal position and its
+				// current position
+				UINT32 idealIdx = getIdealIndex(mEntries[curIdx].first);
+				UINT32 distToCur = (curIdx - idealIdx) & mask;
+				UINT32 distToEmpty = (emptyIdx - idealIdx) & mask;
+
+				if (distToEmpty < distToCur)
+				{
+					mEntries[emptyIdx] = std::move(mEntries[curIdx]);
+					emptyIdx = curIdx;
+				}
+
+				curIdx = (curIdx + 1) & mask;
+			}
+
+			mEntries[emptyIdx] = EntryType();
+			mOccupied[emptyIdx] = false;
+			mSize--;
+
+			return true;
+		}
+
+		/** Removes all entries from the map. Keeps the allocated storage. */
+		void clear()
+		{
+			if (mSize == 0)
+				return;
+
+			for (UINT32 i = 0; i < (UINT32)mOccupied.size(); i++)
+			{
+				if (mOccupied[i])
+				{
+					mEntries[i] = EntryType();
+					mOccupied[i] = false;
+				}
+			}
+
+			mSize = 0;
+		}
+
+		/** Ensures the map can hold at least @p count entries without requiring a re-hash. */
+		void reserve(UINT32 count)
+		{
+			UINT32 capacity = (UINT32)mOccupied.size();
+			if (count * MAX_LOAD_DENOMINATOR <= capacity * MAX_LOAD_NUMERATOR)
+				return;
+
+			UINT32 newCapacity = std::max(MIN_CAPACITY, capacity);
+			while (count * MAX_LOAD_DENOMINATOR > newCapacity * MAX_LOAD_NUMERATOR)
+				newCapacity *= 2;
+
+			rehash(newCapacity);
+		}
+
+	private:
+		/** Returns the position an entry with the specified key would occupy if there were no collisions. */
+		UINT32 getIdealIndex(const Key& key) const
+		{
+			// Fibonacci hashing, spreads sequential keys (common for IDs) and weak hashes over the entire table
+			UINT64 hash = (UINT64)Hasher()(key) * 11400714819323198485ULL;
+			return (UINT32)(hash >> (64 - mCapacityLog2));
+		}
+
+		/** Returns the index of the entry with the specified key, or -1 if it cannot be found. */
+		UINT32 findIndex(const Key& key) const
+		{
+			if (mSize == 0)
+				return (UINT32)-1;
+
+			UINT32 mask = (UINT32)mOccupied.size() - 1;
+			UINT32 idx = getIdealIndex(key);
+			while (mOccupied[idx])
+			{
+				if (Comparator()(mEntries[idx].first, key))
+					return idx;
+
+				idx = (idx + 1) & mask;
+			}
+
+			return (UINT32)-1;
+		}
+
+		/** Returns the index of the first unoccupied entry in the probe sequence for the specified key. */
+		UINT32 findFreeIndex(const Key& key) const
+		{
+			UINT32 mask = (UINT32)mOccupied.size() - 1;
+			UINT32 idx = getIdealIndex(key);
+			while (mOccupied[idx])
+				idx = (idx + 1) & mask;
+
+			return idx;
+		}
+
+		/** Re-allocates the internal storage to the specified capacity (must be a power of two) and re-inserts entries. */
+		void rehash(UINT32 newCapacity)
+		{
+			Vector<EntryType> oldEntries = std::move(mEntries);
+			Vector<bool> oldOccupied = std::move(mOccupied);
+
+			mEntries = Vector<EntryType>(newCapacity);
+			mOccupied = Vector<bool>(newCapacity, false);
+			mCapacityLog2 = Bitwise::mostSignificantBitSet(newCapacity);
+
+			for (UINT32 i = 0; i < (UINT32)oldOccupied.size(); i++)
+			{
+				if (!oldOccupied[i])
+					continue;
+
+				UINT32 idx = findFreeIndex(oldEntries[i].first);
+				mEntries[idx] = std::move(oldEntries[i]);
+				mOccupied[idx] = true;
+			}
+		}
+
+		Vector<EntryType> mEntries;
+		Vector<bool> mOccupied;
+		UINT32 mSize = 0;
+		UINT32 mCapacityLog2 = 0;
+	};
+
+	/** @} */
+}
@@ -47,12 +47,48 @@ namespace bs { namespace ct
 
 	VulkanCmdBufferPool::VulkanCmdBufferPool(VulkanDevice& device)
 		:mDevice(device), mNextId(1)
+	{ }
+
+	VulkanCmdBufferPool::~VulkanCmdBufferPool()
 	{
+		// Note: Shutdown should be the only place command buffers are destroyed at, as the system relies on the fact that
+		// they won't be destroyed during normal operation.
+
+		for(auto& threadEntry : mPools)
+		{
+			for(auto& entry : threadEntry.second)
+			{
+				PoolInfo& poolInfo = entry.second;
+				for (UINT32 i = 0; i < BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY; i++)
+				{
+					VulkanCmdBuffer* buffer = poolInfo.buffers[i];
+					if (buffer == nullptr)
+						break;
+
+					bs_delete(buffer);
+				}
+
+				vkDestroyCommandPool(mDevice.getLogical(), poolInfo.pool, gVulkanAllocator);
+			}
+		}
+	}
+
+	VulkanCmdBufferPool::ThreadPools& VulkanCmdBufferPool::getThreadPools()
+	{
+		Lock lock(mMutex);
+
+		ThreadId threadId = BS_THREAD_CURRENT_ID;
+		auto iterFind = mPools.find(threadId);
+		if (iterFind != mPools.end())
+			return iterFind->second;
+
+		ThreadPools& pools = mPools[threadId];
 		for (UINT32 i = 0; i < GQT_COUNT; i++)
 		{
-			UINT32 familyIdx = device.getQueueFamily((GpuQueueType)i);
+			UINT32 familyIdx = mDevice.getQueueFamily((GpuQueueType)i);
 
-			if (familyIdx == (UINT32)-1)
+			// Different queue types can share a family
+			if (familyIdx == (UINT32)-1 || pools.find(familyIdx) != pools.end())
 				continue;
 
 			VkCommandPoolCreateInfo poolCI;
@@ -61,42 +97,27 @@ namespace bs { namespace ct
 			poolCI.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 			poolCI.queueFamilyIndex = familyIdx;
 
-			PoolInfo& poolInfo = mPools[familyIdx];
+			PoolInfo& poolInfo = pools[familyIdx];
 			poolInfo.queueFamily = familyIdx;
 			memset(poolInfo.buffers, 0, sizeof(poolInfo.buffers));
 
-			vkCreateCommandPool(device.getLogical(), &poolCI, gVulkanAllocator, &poolInfo.pool);
+			vkCreateCommandPool(mDevice.getLogical(), &poolCI, gVulkanAllocator, &poolInfo.pool);
 		}
-	}
-
-	VulkanCmdBufferPool::~VulkanCmdBufferPool()
-	{
-		// Note: Shutdown should be the only place command buffers are destroyed at, as the system relies on the fact that
-		// they won't be destroyed during normal operation.
 
-		for(auto& entry : mPools)
-		{
-			PoolInfo& poolInfo = entry.second;
-			for (UINT32 i = 0; i < BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY; i++)
-			{
-				VulkanCmdBuffer* buffer = poolInfo.buffers[i];
-				if (buffer == nullptr)
-					break;
-
-				bs_delete(buffer);
-			}
-
-			vkDestroyCommandPool(mDevice.getLogical(), poolInfo.pool, gVulkanAllocator);
-		}
+		return pools;
 	}
 
 	VulkanCmdBuffer* VulkanCmdBufferPool::getBuffer(UINT32 queueFamily, bool secondary)
 	{
-		auto iterFind = mPools.find(queueFamily);
-		if (iterFind == mPools.end())
+		// Only the calling thread ever accesses its own pools, so no need to lock past this point
+		ThreadPools& pools = getThreadPools();
+
+		auto iterFind = pools.find(queueFamily);
+		if (iterFind == pools.end())
 			return nullptr;
 
-		VulkanCmdBuffer** buffers = iterFind->second.buffers;
+		PoolInfo& poolInfo = iterFind->second;
+		VulkanCmdBuffer** buffers = poolInfo.buffers;
 
 		UINT32 i = 0;
 		for(; i < BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY; i++)
@@ -114,21 +135,16 @@ namespace bs { namespace ct
 		assert(i < BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY &&
 			"Too many command buffers allocated. Increment BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY to a higher value. ");
 
-		buffers[i] = createBuffer(queueFamily, secondary);
+		buffers[i] = createBuffer(poolInfo, secondary);
 		buffers[i]->begin();
 
 		return buffers[i];
 	}
 
-	VulkanCmdBuffer* VulkanCmdBufferPool::createBuffer(UINT32 queueFamily, bool secondary)
+	VulkanCmdBuffer* VulkanCmdBufferPool::createBuffer(const PoolInfo& poolInfo, bool secondary)
 	{
-		auto iterFind = mPools.find(queueFamily);
-		if (iterFind == mPools.end())
-			return nullptr;
-
-		const PoolInfo& poolInfo = iterFind->second;
-
-		return bs_new<VulkanCmdBuffer>(mDevice, mNextId++, poolInfo.pool, poolInfo.queueFamily, secondary);
+		return bs_new<VulkanCmdBuffer>(mDevice, mNextId.fetch_add(1, std::memory_order_relaxed), poolInfo.pool,
+			poolInfo.queueFamily, secondary);
 	}
 
 	/** Returns a set of pipeline stages that can are allowed to be used for the specified set of access flags. */
@@ -755,8 +771,13 @@ namespace bs { namespace ct
 	{
 		bool wasSubmitted = mState == State::Submitted;
 
+		// Submitted buffers are reset from the thread that checks the queue, which might not be the thread that owns the
+		// buffer's command pool. Resetting requires pool access, so leave it to the implicit reset in begin(), which is
+		// always called from the owning thread.
+		if (!wasSubmitted && mState != State::Ready)
+			vkResetCommandBuffer(mCmdBuffer, VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT); // Note: Maybe better not to release resources?
+
 		mState = State::Ready;
-		vkResetCommandBuffer(mCmdBuffer, VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT); // Note: Maybe better not to release resources?
 
 		if (wasSubmitted)
 		{
@@ -2329,7 +2350,7 @@ namespace bs { namespace ct
 		mQueue = device.getQueue(mType, mQueueIdx % numQueues);
 		mIdMask = device.getQueueMask(mType, mQueueIdx);
 
-		acquireNewBuffer();
+		// Note: Internal buffer is acquired on first use, so it gets allocated from the pool of the thread that records it
 	}
 
 	RenderSurfaceMask VulkanCmdBuffer::getFBReadMask()
@@ -2374,22 +2395,32 @@ namespace bs { namespace ct
 
 	VulkanCommandBuffer::~VulkanCommandBuffer()
 	{
-		mBuffer->reset();
+		if (mBuffer != nullptr)
+			mBuffer->reset();
+	}
+
+	VulkanCmdBuffer* VulkanCommandBuffer::getInternal()
+	{
+		if (mBuffer == nullptr)
+			acquireNewBuffer();
+
+		return mBuffer;
 	}
 
 	void VulkanCommandBuffer::acquireNewBuffer()
 	{
 		VulkanCmdBufferPool& pool = mDevice.getCmdBufferPool();
 
-		if (mBuffer != nullptr)
-			assert(mBuffer->isSubmitted());
-
 		UINT32 queueFamily = mDevice.getQueueFamily(mType);
 		mBuffer = pool.getBuffer(queueFamily, mIsSecondary);
 	}
 
 	void VulkanCommandBuffer::submit(UINT32 syncMask)
 	{
+		// Nothing was recorded since the last submit
+		if (mBuffer == nullptr)
+			return;
+
 		// Ignore myself
 		syncMask &= ~mIdMask;
 
@@ -2416,16 +2447,19 @@ namespace bs { namespace ct
 		if (mBuffer->isReadyForSubmit()) // Possibly nothing was recorded in the buffer
 		{
 			mBuffer->submit(mQueue, mQueueIdx, syncMask);
-			acquireNewBuffer();
+			mBuffer = nullptr;
+
+			// New internal buffer starts with no state bound
+			mStateCache.reset();
 
 			gVulkanCBManager().refreshStates(mDeviceIdx);
 		}
 
 		// Resume interrupted queries on the new command buffer
 		for (auto& query : timerQueries)
-			query->_resume(*mBuffer);
+			query->_resume(*getInternal());
 
 		for (auto& query : occlusionQueries)
-			query->_resume(*mBuffer);
+			query->_resume(*getInternal());
 	}
 }}
\ No newline at end of file
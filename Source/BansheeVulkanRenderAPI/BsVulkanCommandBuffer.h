@@ -39,7 +39,11 @@ namespace bs { namespace ct
 
 	class VulkanCmdBuffer;
 
-	/** Pool that allocates and distributes Vulkan command buffers. */
+	/** 
+	 * Pool that allocates and distributes Vulkan command buffers. Each thread that requests command buffers gets its own
+	 * set of Vulkan command pools, so that command buffers can be recorded on multiple threads at once (Vulkan requires
+	 * access to a command pool, including recording to any of its buffers, to be externally synchronized).
+	 */
 	class VulkanCmdBufferPool
 	{
 	public:
@@ -48,7 +52,8 @@ namespace bs { namespace ct
 
 		/** 
 		 * Attempts to find a free command buffer, or creates a new one if not found. Caller must guarantee the provided
-		 * queue family is valid. 
+		 * queue family is valid. The buffer is allocated from a pool owned by the calling thread, and must only be recorded
+		 * to from that thread.
 		 */
 		VulkanCmdBuffer* getBuffer(UINT32 queueFamily, bool secondary);
 
@@ -61,12 +66,19 @@ namespace bs { namespace ct
 			UINT32 queueFamily = -1;
 		};
 
+		/** Command buffer pools belonging to a single thread, mapped by queue family. */
+		typedef UnorderedMap<UINT32, PoolInfo> ThreadPools;
+
+		/** Returns the command buffer pools for the calling thread, creating them if they don't exist. */
+		ThreadPools& getThreadPools();
+
 		/** Creates a new command buffer. */
-		VulkanCmdBuffer* createBuffer(UINT32 queueFamily, bool secondary);
+		VulkanCmdBuffer* createBuffer(const PoolInfo& poolInfo, bool secondary);
 
 		VulkanDevice& mDevice;
-		UnorderedMap<UINT32, PoolInfo> mPools;
-		UINT32 mNextId;
+		UnorderedMap<ThreadId, ThreadPools> mPools;
+		std::atomic<UINT32> mNextId;
+		Mutex mMutex;
 	};
 
 	/** Determines where are the current descriptor sets bound to. */
@@ -541,11 +553,12 @@ namespace bs { namespace ct
 		void submit(UINT32 syncMask);
 
 		/** 
-		 * Returns the internal command buffer. 
+		 * Returns the internal command buffer. If the command buffer wasn't used since it was created or last submitted,
+		 * a new internal buffer is acquired from the calling thread's command pool.
 		 * 
 		 * @note	This buffer will change after a submit() call.
 		 */
-		VulkanCmdBuffer* getInternal() const { return mBuffer; }
+		VulkanCmdBuffer* getInternal();
 
 	private:
 		friend class VulkanCommandBufferManager;
@@ -556,8 +569,8 @@ namespace bs { namespace ct
 		~VulkanCommandBuffer();
 
 		/** 
-		 * Tasks the command buffer to find a new internal command buffer. Call this after the command buffer has been
-		 * submitted to a queue (it's not allowed to be used until the queue is done with it).
+		 * Tasks the command buffer to find a new internal command buffer. Called on first use after the command buffer
+		 * has been created or submitted to a queue (it's not allowed to be used until the queue is done with it).
 		 */
 		void acquireNewBuffer();
 
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsVulkanDescriptorSet.h"
 #include "BsVulkanDevice.h"
+#include "Managers/BsVulkanDescriptorManager.h"
 
 namespace bs { namespace ct
 {
@@ -11,8 +12,7 @@ namespace bs { namespace ct
 
 	VulkanDescriptorSet::~VulkanDescriptorSet()
 	{
-		VkResult result = vkFreeDescriptorSets(mOwner->getDevice().getLogical(), mPool, 1, &mSet);
-		assert(result == VK_SUCCESS);
+		mOwner->getDevice().getDescriptorManager().freeSet(mSet, mPool);
 	}
 
 	void VulkanDescriptorSet::write(VkWriteDescriptorSet* entries, UINT32 count)
@@ -5,6 +5,9 @@
 #include "BsVulkanCommandBuffer.h"
 #include "Managers/BsVulkanDescriptorManager.h"
 #include "Managers/BsVulkanQueryManager.h"
+#include "BsVulkanPipelineRecorder.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 #define VMA_IMPLEMENTATION
 #include "ThirdParty/vk_mem_alloc.h"
@@ -12,7 +15,8 @@
 namespace bs { namespace ct
 {
 	VulkanDevice::VulkanDevice(VkPhysicalDevice device, UINT32 deviceIdx)
-		: mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx), mQueueInfos()
+		: mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx)
+		, mPipelineCache(VK_NULL_HANDLE), mPipelineRecorder(nullptr), mQueueInfos()
 	{
 		// Set to default
 		for (UINT32 i = 0; i < GQT_COUNT; i++)
@@ -159,6 +163,9 @@ namespace bs { namespace ct
 		mQueryPool = bs_new<VulkanQueryPool>(*this);
 		mDescriptorManager = bs_new<VulkanDescriptorManager>(*this);
 		mResourceManager = bs_new<VulkanResourceManager>(*this);
+
+		createPipelineCache();
+		mPipelineRecorder = bs_new<VulkanPipelineRecorder>(getPipelineRecordsPath());
 	}
 
 	VulkanDevice::~VulkanDevice()
@@ -181,11 +188,132 @@ namespace bs { namespace ct
 
 		// Needs to happen after query pool & command buffer pool shutdown, to ensure their resources are destroyed
 		bs_delete(mResourceManager);
+
+		destroyPipelineCache();
+
+		mPipelineRecorder->save();
+		bs_delete(mPipelineRecorder);
 		
 		vmaDestroyAllocator(mAllocator);
 		vkDestroyDevice(mLogicalDevice, gVulkanAllocator);
 	}
 
+	Path VulkanDevice::getPipelineCachePath() const
+	{
+		// Separate file per physical device, so systems with multiple GPUs don't keep invalidating each other's caches
+		Path path = FileSystem::getTempDirectoryPath();
+		path.append("BansheeVulkanPipelineCache/");
+		path.append(toString(mDeviceProperties.vendorID) + "_" + toString(mDeviceProperties.deviceID) + ".cache");
+
+		return path;
+	}
+
+	Path VulkanDevice::getPipelineRecordsPath() const
+	{
+		Path path = getPipelineCachePath();
+		path.setExtension(".pipelines");
+
+		return path;
+	}
+
+	void VulkanDevice::createPipelineCache()
+	{
+		Vector<UINT8> initialData;
+
+		Path cachePath = getPipelineCachePath();
+		if(FileSystem::isFile(cachePath))
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(cachePath);
+			if(stream != nullptr)
+			{
+				initialData.resize(stream->size());
+
+				if(!initialData.empty())
+					stream->read(initialData.data(), initialData.size());
+			}
+		}
+
+		// Make sure the data was written by the same device and driver, as not all drivers properly validate the data
+		// themselves. Header layout is defined by the spec (VkPipelineCacheHeaderVersion).
+		if(!initialData.empty())
+		{
+			const UINT32 headerSize = 16 + VK_UUID_SIZE;
+
+			bool isValid = initialData.size() >= headerSize;
+			if(isValid)
+			{
+				UINT32 header[4];
+				memcpy(header, initialData.data(), sizeof(header));
+
+				isValid = header[0] >= headerSize &&
+					header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+					header[2] == mDeviceProperties.vendorID &&
+					header[3] == mDeviceProperties.deviceID &&
+					memcmp(initialData.data() + 16, mDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+			}
+
+			if(!isValid)
+				initialData.clear();
+		}
+
+		VkPipelineCacheCreateInfo cacheCI;
+		cacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		cacheCI.pNext = nullptr;
+		cacheCI.flags = 0;
+		cacheCI.initialDataSize = initialData.size();
+		cacheCI.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+		VkResult result = vkCreatePipelineCache(mLogicalDevice, &cacheCI, gVulkanAllocator, &mPipelineCache);
+		if(result != VK_SUCCESS && !initialData.empty())
+		{
+			// Try again without the persisted data
+			cacheCI.initialDataSize = 0;
+			cacheCI.pInitialData = nullptr;
+
+			result = vkCreatePipelineCache(mLogicalDevice, &cacheCI, gVulkanAllocator, &mPipelineCache);
+		}
+
+		if(result != VK_SUCCESS)
+		{
+			LOGWRN("Unable to create a Vulkan pipeline cache. Pipelines will be created without one.");
+			mPipelineCache = VK_NULL_HANDLE;
+		}
+	}
+
+	void VulkanDevice::destroyPipelineCache()
+	{
+		if(mPipelineCache == VK_NULL_HANDLE)
+			return;
+
+		size_t dataSize = 0;
+		VkResult result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &dataSize, nullptr);
+
+		if(result == VK_SUCCESS && dataSize > 0)
+		{
+			Vector<UINT8> data(dataSize);
+			result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &dataSize, data.data());
+
+			if(result == VK_SUCCESS)
+			{
+				Path cachePath = getPipelineCachePath();
+
+				Path cacheFolder = cachePath.getParent();
+				if(!FileSystem::exists(cacheFolder))
+					FileSystem::createDir(cacheFolder);
+
+				SPtr<DataStream> stream = FileSystem::createAndOpenFile(cachePath);
+				if(stream != nullptr)
+				{
+					stream->write(data.data(), dataSize);
+					stream->close();
+				}
+			}
+		}
+
+		vkDestroyPipelineCache(mLogicalDevice, mPipelineCache, gVulkanAllocator);
+		mPipelineCache = VK_NULL_HANDLE;
+	}
+
 	void VulkanDevice::waitIdle() const
 	{
 		VkResult result = vkDeviceWaitIdle(mLogicalDevice);
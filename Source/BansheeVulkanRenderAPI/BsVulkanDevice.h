@@ -84,6 +84,19 @@ namespace bs { namespace ct
 		/** Returns a manager that can be used for allocating Vulkan objects wrapped as managed resources. */
 		VulkanResourceManager& getResourceManager() const { return *mResourceManager; }
 
+		/** 
+		 * Returns the pipeline cache that should be used when creating pipelines on this device. The cache is loaded from
+		 * disk when the device is created, and saved when it is destroyed.
+		 */
+		VkPipelineCache getPipelineCache() const { return mPipelineCache; }
+
+		/** 
+		 * Returns an object that keeps track of all graphics pipelines created on this device, so they can be re-created
+		 * ahead of time on the next run. Records are loaded from disk when the device is created, and saved when it is
+		 * destroyed.
+		 */
+		VulkanPipelineRecorder& getPipelineRecorder() const { return *mPipelineRecorder; }
+
 		/** 
 		 * Allocates memory for the provided image, and binds it to the image. Returns null if it cannot find memory
 		 * with the specified flags.
@@ -111,6 +124,18 @@ namespace bs { namespace ct
 		/** Marks the device as a primary device. */
 		void setIsPrimary() { mIsPrimary = true; }
 
+		/** Returns the path to the file the pipeline cache for this device is persisted in. */
+		Path getPipelineCachePath() const;
+
+		/** Creates the pipeline cache, populating it with the data persisted by the previous run, if available. */
+		void createPipelineCache();
+
+		/** Saves the contents of the pipeline cache to disk, and destroys the cache. */
+		void destroyPipelineCache();
+
+		/** Returns the path to the file the pipeline records for this device are persisted in. */
+		Path getPipelineRecordsPath() const;
+
 		VkPhysicalDevice mPhysicalDevice;
 		VkDevice mLogicalDevice;
 		bool mIsPrimary;
@@ -120,6 +145,8 @@ namespace bs { namespace ct
 		VulkanQueryPool* mQueryPool;
 		VulkanDescriptorManager* mDescriptorManager;
 		VulkanResourceManager* mResourceManager;
+		VkPipelineCache mPipelineCache;
+		VulkanPipelineRecorder* mPipelineRecorder;
 		VmaAllocator mAllocator;
 
 		VkPhysicalDeviceProperties mDeviceProperties;
@@ -7,6 +7,31 @@
 
 namespace bs { namespace ct
 {
+	/** 
+	 * Populates the two subpass dependencies used for layout transitions by all render passes. Must be the same for
+	 * every render pass, as dependencies affect render pass compatibility.
+	 */
+	static void initSubpassDependencies(VkSubpassDependency* dependencies)
+	{
+		dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+		dependencies[0].dstSubpass = 0;
+		dependencies[0].srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		dependencies[0].dstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+		dependencies[0].srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+		dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | 
+			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+		dependencies[0].dependencyFlags = 0;
+
+		dependencies[1].srcSubpass = 0;
+		dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+		dependencies[1].srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+		dependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+		dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | 
+			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+		dependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+		dependencies[1].dependencyFlags = 0;
+	}
+
 	VulkanFramebuffer::VariantKey::VariantKey(RenderSurfaceMask loadMask, RenderSurfaceMask readMask, 
 		ClearMask clearMask)
 		:loadMask(loadMask), readMask(readMask), clearMask(clearMask)
@@ -28,7 +53,46 @@ namespace bs { namespace ct
 		return lhs.loadMask == rhs.loadMask && lhs.readMask == rhs.readMask && lhs.clearMask == rhs.clearMask;
 	}
 
+	VulkanFramebufferLayout::VulkanFramebufferLayout()
+		: depthFormat(VK_FORMAT_UNDEFINED), numColorAttachments(0), sampleFlags(VK_SAMPLE_COUNT_1_BIT)
+	{
+		for (UINT32 i = 0; i < BS_MAX_MULTIPLE_RENDER_TARGETS; i++)
+			colorFormats[i] = VK_FORMAT_UNDEFINED;
+	}
+
+	size_t VulkanFramebufferLayout::HashFunction::operator()(const VulkanFramebufferLayout& layout) const
+	{
+		size_t hash = 0;
+		for (UINT32 i = 0; i < layout.numColorAttachments; i++)
+			hash_combine(hash, (UINT32)layout.colorFormats[i]);
+
+		hash_combine(hash, (UINT32)layout.depthFormat);
+		hash_combine(hash, layout.numColorAttachments);
+		hash_combine(hash, (UINT32)layout.sampleFlags);
+
+		return hash;
+	}
+
+	bool VulkanFramebufferLayout::EqualFunction::operator()(const VulkanFramebufferLayout& lhs,
+															const VulkanFramebufferLayout& rhs) const
+	{
+		if (lhs.numColorAttachments != rhs.numColorAttachments || lhs.depthFormat != rhs.depthFormat ||
+			lhs.sampleFlags != rhs.sampleFlags)
+			return false;
+
+		for (UINT32 i = 0; i < lhs.numColorAttachments; i++)
+		{
+			if (lhs.colorFormats[i] != rhs.colorFormats[i])
+				return false;
+		}
+
+		return true;
+	}
+
 	UINT32 VulkanFramebuffer::sNextValidId = 1;
+	UnorderedMap<VulkanFramebufferLayout, UINT32, VulkanFramebufferLayout::HashFunction,
+		VulkanFramebufferLayout::EqualFunction> VulkanFramebuffer::sLayoutIds;
+	Mutex VulkanFramebuffer::sLayoutMutex;
 
 	VulkanFramebuffer::VulkanFramebuffer(VulkanResourceManager* owner, const VULKAN_FRAMEBUFFER_DESC& desc)
 		: VulkanResource(owner, false), mNumAttachments(0), mNumColorAttachments(0), mNumLayers(desc.layers)
@@ -114,6 +178,16 @@ namespace bs { namespace ct
 
 		mNumAttachments = attachmentIdx;
 
+		for (UINT32 i = 0; i < mNumColorAttachments; i++)
+			mLayout.colorFormats[i] = mAttachments[i].format;
+
+		if (mHasDepth)
+			mLayout.depthFormat = desc.depth.format;
+
+		mLayout.numColorAttachments = mNumColorAttachments;
+		mLayout.sampleFlags = mSampleFlags;
+		mLayoutId = getLayoutId(mLayout);
+
 		mSubpassDesc.flags = 0;
 		mSubpassDesc.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 		mSubpassDesc.colorAttachmentCount = mNumColorAttachments;
@@ -134,23 +208,7 @@ namespace bs { namespace ct
 			mSubpassDesc.pDepthStencilAttachment = nullptr;
 
 		// Subpass dependencies for layout transitions
-		mDependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
-		mDependencies[0].dstSubpass = 0;
-		mDependencies[0].srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		mDependencies[0].dstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-		mDependencies[0].srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
-		mDependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | 
-			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
-		mDependencies[0].dependencyFlags = 0;
-
-		mDependencies[1].srcSubpass = 0;
-		mDependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
-		mDependencies[1].srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-		mDependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
-		mDependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | 
-			VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
-		mDependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
-		mDependencies[1].dependencyFlags = 0;
+		initSubpassDependencies(mDependencies);
 
 		// Create render pass and frame buffer create infos
 		mRenderPassCI.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
@@ -279,21 +337,31 @@ namespace bs { namespace ct
 		return variant;
 	}
 
-	VkRenderPass VulkanFramebuffer::getRenderPass(RenderSurfaceMask loadMask, RenderSurfaceMask readMask,
-												  ClearMask clearMask) const
+	VulkanFramebuffer::Variant VulkanFramebuffer::getVariant(RenderSurfaceMask loadMask, RenderSurfaceMask readMask,
+															 ClearMask clearMask) const
 	{
-		if (loadMask == RT_NONE && readMask == RT_NONE && clearMask == CLEAR_NONE)
-			return mDefault.renderPass;
+		// Command buffers using the same framebuffer can be recorded from multiple threads (e.g. shadow map jobs
+		// rendering to the same atlas)
+		Lock lock(mVariantMutex);
 
 		VariantKey key(loadMask, readMask, clearMask);
 		auto iterFind = mVariants.find(key);
 		if (iterFind != mVariants.end())
-			return iterFind->second.renderPass;
+			return iterFind->second;
 
 		Variant newVariant = createVariant(loadMask, readMask, clearMask);
 		mVariants[key] = newVariant;
 
-		return newVariant.renderPass;
+		return newVariant;
+	}
+
+	VkRenderPass VulkanFramebuffer::getRenderPass(RenderSurfaceMask loadMask, RenderSurfaceMask readMask,
+												  ClearMask clearMask) const
+	{
+		if (loadMask == RT_NONE && readMask == RT_NONE && clearMask == CLEAR_NONE)
+			return mDefault.renderPass;
+
+		return getVariant(loadMask, readMask, clearMask).renderPass;
 	}
 
 	VkFramebuffer VulkanFramebuffer::getFramebuffer(RenderSurfaceMask loadMask, RenderSurfaceMask readMask,
@@ -302,15 +370,7 @@ namespace bs { namespace ct
 		if (loadMask == RT_NONE && readMask == RT_NONE && clearMask == CLEAR_NONE)
 			return mDefault.framebuffer;
 
-		VariantKey key(loadMask, readMask, clearMask);
-		auto iterFind = mVariants.find(key);
-		if (iterFind != mVariants.end())
-			return iterFind->second.framebuffer;
-
-		Variant newVariant = createVariant(loadMask, readMask, clearMask);
-		mVariants[key] = newVariant;
-
-		return newVariant.framebuffer;
+		return getVariant(loadMask, readMask, clearMask).framebuffer;
 	}
 
 	UINT32 VulkanFramebuffer::getNumClearEntries(ClearMask clearMask) const
@@ -334,4 +394,98 @@ namespace bs { namespace ct
 
 		return std::min(numAttachments, getNumColorAttachments());
 	}
+
+	UINT32 VulkanFramebuffer::getLayoutId(const VulkanFramebufferLayout& layout)
+	{
+		Lock lock(sLayoutMutex);
+
+		auto iterFind = sLayoutIds.find(layout);
+		if (iterFind != sLayoutIds.end())
+			return iterFind->second;
+
+		UINT32 id = (UINT32)sLayoutIds.size() + 1;
+		sLayoutIds[layout] = id;
+
+		return id;
+	}
+
+	VkRenderPass VulkanFramebuffer::createCompatibleRenderPass(VkDevice device, const VulkanFramebufferLayout& layout)
+	{
+		VkAttachmentDescription attachments[BS_MAX_MULTIPLE_RENDER_TARGETS + 1];
+		VkAttachmentReference colorReferences[BS_MAX_MULTIPLE_RENDER_TARGETS];
+		VkAttachmentReference depthReference;
+		VkSubpassDependency dependencies[2];
+
+		// Load/store operations and layouts don't affect compatibility, only formats, sample counts and the attachment
+		// references do
+		UINT32 numAttachments = 0;
+		for (UINT32 i = 0; i < layout.numColorAttachments; i++)
+		{
+			VkAttachmentDescription& attachmentDesc = attachments[numAttachments];
+			attachmentDesc.flags = 0;
+			attachmentDesc.format = layout.colorFormats[i];
+			attachmentDesc.samples = layout.sampleFlags;
+			attachmentDesc.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			attachmentDesc.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachmentDesc.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			attachmentDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			attachmentDesc.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			attachmentDesc.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+			colorReferences[i].attachment = numAttachments;
+			colorReferences[i].layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+			numAttachments++;
+		}
+
+		if (layout.hasDepthAttachment())
+		{
+			VkAttachmentDescription& attachmentDesc = attachments[numAttachments];
+			attachmentDesc.flags = 0;
+			attachmentDesc.format = layout.depthFormat;
+			attachmentDesc.samples = layout.sampleFlags;
+			attachmentDesc.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			attachmentDesc.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachmentDesc.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			attachmentDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
+			attachmentDesc.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			attachmentDesc.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+			depthReference.attachment = numAttachments;
+			depthReference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+			numAttachments++;
+		}
+
+		VkSubpassDescription subpassDesc;
+		subpassDesc.flags = 0;
+		subpassDesc.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		subpassDesc.colorAttachmentCount = layout.numColorAttachments;
+		subpassDesc.pColorAttachments = layout.numColorAttachments > 0 ? colorReferences : nullptr;
+		subpassDesc.inputAttachmentCount = 0;
+		subpassDesc.pInputAttachments = nullptr;
+		subpassDesc.preserveAttachmentCount = 0;
+		subpassDesc.pPreserveAttachments = nullptr;
+		subpassDesc.pResolveAttachments = nullptr;
+		subpassDesc.pDepthStencilAttachment = layout.hasDepthAttachment() ? &depthReference : nullptr;
+
+		initSubpassDependencies(dependencies);
+
+		VkRenderPassCreateInfo renderPassCI;
+		renderPassCI.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+		renderPassCI.pNext = nullptr;
+		renderPassCI.flags = 0;
+		renderPassCI.attachmentCount = numAttachments;
+		renderPassCI.pAttachments = attachments;
+		renderPassCI.subpassCount = 1;
+		renderPassCI.pSubpasses = &subpassDesc;
+		renderPassCI.dependencyCount = 2;
+		renderPassCI.pDependencies = dependencies;
+
+		VkRenderPass renderPass;
+		VkResult result = vkCreateRenderPass(device, &renderPassCI, gVulkanAllocator, &renderPass);
+		assert(result == VK_SUCCESS);
+
+		return renderPass;
+	}
 }}
\ No newline at end of file
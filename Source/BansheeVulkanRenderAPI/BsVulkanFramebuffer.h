@@ -62,6 +62,42 @@ namespace bs { namespace ct
 		UINT32 index = 0;
 	};
 
+	/** 
+	 * Describes the formats and sample counts of all attachments in a framebuffer. Render passes of framebuffers with
+	 * the same layout are compatible (as per spec 7.2.), meaning pipelines created for one can be used with the other.
+	 */
+	struct VulkanFramebufferLayout
+	{
+		VulkanFramebufferLayout();
+
+		/** Formats of the color attachments, in the order they are bound (without any gaps). */
+		VkFormat colorFormats[BS_MAX_MULTIPLE_RENDER_TARGETS];
+
+		/** Format of the depth-stencil attachment, or VK_FORMAT_UNDEFINED if there is none. */
+		VkFormat depthFormat;
+
+		/** Number of valid entries in @p colorFormats. */
+		UINT32 numColorAttachments;
+
+		/** Number of samples in each of the attachments. */
+		VkSampleCountFlagBits sampleFlags;
+
+		/** Returns true if the layout has a depth-stencil attachment. */
+		bool hasDepthAttachment() const { return depthFormat != VK_FORMAT_UNDEFINED; }
+
+		class HashFunction
+		{
+		public:
+			size_t operator()(const VulkanFramebufferLayout& layout) const;
+		};
+
+		class EqualFunction
+		{
+		public:
+			bool operator()(const VulkanFramebufferLayout& lhs, const VulkanFramebufferLayout& rhs) const;
+		};
+	};
+
 	/** Vulkan frame buffer containing one or multiple color surfaces, and an optional depth surface. */
 	class VulkanFramebuffer : public VulkanResource
 	{
@@ -77,6 +113,15 @@ namespace bs { namespace ct
 		/** Returns a unique ID of this framebuffer. */
 		UINT32 getId() const { return mId; }
 
+		/** Returns the formats and sample count of the framebuffer attachments. */
+		const VulkanFramebufferLayout& getLayout() const { return mLayout; }
+
+		/** 
+		 * Returns an ID shared by all framebuffers with the same layout. Such framebuffers have compatible render passes,
+		 * and can therefore share pipelines.
+		 */
+		UINT32 getLayoutId() const { return mLayoutId; }
+
 		/** 
 		 * Gets internal Vulkan render pass object. 
 		 * 
@@ -126,6 +171,19 @@ namespace bs { namespace ct
 		 * the clear mask and the attachments on the framebuffer. 
 		 */
 		UINT32 getNumClearEntries(ClearMask clearMask) const;
+
+		/** 
+		 * Returns an ID that uniquely identifies the provided framebuffer layout. The same layout always maps to the same
+		 * ID, for the lifetime of the application. Thread safe.
+		 */
+		static UINT32 getLayoutId(const VulkanFramebufferLayout& layout);
+
+		/** 
+		 * Creates a render pass compatible with the render passes of all framebuffers using the provided layout. Such a
+		 * render pass can be used for creating pipelines without needing an actual framebuffer. Caller is responsible for
+		 * destroying the render pass.
+		 */
+		static VkRenderPass createCompatibleRenderPass(VkDevice device, const VulkanFramebufferLayout& layout);
 	private:
 		/** Information about a single frame-buffer variant. */
 		struct Variant
@@ -159,10 +217,19 @@ namespace bs { namespace ct
 		/** Creates a new variant of the framebuffer. */
 		Variant createVariant(RenderSurfaceMask loadMask, RenderSurfaceMask readMask, ClearMask clearMask) const;
 
+		/** 
+		 * Returns an existing variant of the framebuffer, or creates a new one if it doesn't exist. Safe to call from
+		 * multiple threads at once.
+		 */
+		Variant getVariant(RenderSurfaceMask loadMask, RenderSurfaceMask readMask, ClearMask clearMask) const;
+
 		UINT32 mId;
+		UINT32 mLayoutId;
+		VulkanFramebufferLayout mLayout;
 
 		Variant mDefault;
 		mutable UnorderedMap<VariantKey, Variant, VariantKey::HashFunction, VariantKey::EqualFunction> mVariants;
+		mutable Mutex mVariantMutex; // Guards mVariants and the create-info structures used by createVariant()
 
 		UINT32 mNumAttachments;
 		UINT32 mNumColorAttachments;
@@ -182,6 +249,10 @@ namespace bs { namespace ct
 		mutable VkFramebufferCreateInfo mFramebufferCI;
 
 		static UINT32 sNextValidId;
+
+		static UnorderedMap<VulkanFramebufferLayout, UINT32, VulkanFramebufferLayout::HashFunction,
+			VulkanFramebufferLayout::EqualFunction> sLayoutIds;
+		static Mutex sLayoutMutex;
 	};
 
 	/** @} */
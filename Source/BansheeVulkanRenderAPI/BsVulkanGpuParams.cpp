@@ -237,8 +237,19 @@ namespace bs { namespace ct
 
 		Lock lock(mMutex);
 
-		VulkanGpuParamBlockBuffer* vulkanParamBlockBuffer =
-			static_cast<VulkanGpuParamBlockBuffer*>(paramBlockBuffer.get());
+		// Views bind a range of their parent's buffer
+		VulkanGpuParamBlockBuffer* vulkanParamBlockBuffer;
+		VkDeviceSize bufferOffset = 0;
+		VkDeviceSize bufferRange = VK_WHOLE_SIZE;
+		if (paramBlockBuffer != nullptr && paramBlockBuffer->getParent() != nullptr)
+		{
+			vulkanParamBlockBuffer = static_cast<VulkanGpuParamBlockBuffer*>(paramBlockBuffer->getParent().get());
+			bufferOffset = paramBlockBuffer->getOffset();
+			bufferRange = paramBlockBuffer->getSize();
+		}
+		else
+			vulkanParamBlockBuffer = static_cast<VulkanGpuParamBlockBuffer*>(paramBlockBuffer.get());
+
 		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
 		{
 			if (mPerDeviceData[i].perSetData == nullptr)
@@ -256,6 +267,8 @@ namespace bs { namespace ct
 				VkBuffer buffer = bufferRes->getHandle();
 
 				perSetData.writeInfos[bindingIdx].buffer.buffer = buffer;
+				perSetData.writeInfos[bindingIdx].buffer.offset = bufferOffset;
+				perSetData.writeInfos[bindingIdx].buffer.range = bufferRange;
 				mPerDeviceData[i].uniformBuffers[sequentialIdx] = buffer;
 			}
 			else
@@ -264,6 +277,8 @@ namespace bs { namespace ct
 					HardwareBufferManager::instance());
 
 				perSetData.writeInfos[bindingIdx].buffer.buffer = vkBufManager.getDummyUniformBuffer(i);
+				perSetData.writeInfos[bindingIdx].buffer.offset = 0;
+				perSetData.writeInfos[bindingIdx].buffer.range = VK_WHOLE_SIZE;
 				mPerDeviceData[i].uniformBuffers[sequentialIdx] = VK_NULL_HANDLE;
 			}
 		}
@@ -554,7 +569,12 @@ namespace bs { namespace ct
 			if (mParamBlockBuffers[i] == nullptr)
 				continue;
 
-			VulkanGpuParamBlockBuffer* element = static_cast<VulkanGpuParamBlockBuffer*>(mParamBlockBuffers[i].get());
+			// Views use their parent's resource, their offset is assigned in setParamBlockBuffer()
+			GpuParamBlockBuffer* paramBlockBuffer = mParamBlockBuffers[i].get();
+			if (paramBlockBuffer->getParent() != nullptr)
+				paramBlockBuffer = paramBlockBuffer->getParent().get();
+
+			VulkanGpuParamBlockBuffer* element = static_cast<VulkanGpuParamBlockBuffer*>(paramBlockBuffer);
 			VulkanBuffer* resource = element->getResource(deviceIdx);
 			if (resource == nullptr)
 				continue;
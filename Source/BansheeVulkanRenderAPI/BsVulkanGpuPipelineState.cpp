@@ -13,6 +13,9 @@
 #include "RenderAPI/BsDepthStencilState.h"
 #include "RenderAPI/BsBlendState.h"
 #include "Profiling/BsRenderStats.h"
+#include "Threading/BsTaskScheduler.h"
+#include "BsVulkanPipelineRecorder.h"
+#include "Managers/BsHardwareBufferManager.h"
 
 namespace bs { namespace ct
 {
@@ -32,8 +35,8 @@ namespace bs { namespace ct
 	}
 
 	VulkanGraphicsPipelineState::GpuPipelineKey::GpuPipelineKey(
-		UINT32 framebufferId, UINT32 vertexInputId, UINT32 readOnlyFlags, DrawOperationType drawOp)
-		: framebufferId(framebufferId), vertexInputId(vertexInputId), readOnlyFlags(readOnlyFlags)
+		UINT32 framebufferLayoutId, UINT32 vertexInputId, UINT32 readOnlyFlags, DrawOperationType drawOp)
+		: framebufferLayoutId(framebufferLayoutId), vertexInputId(vertexInputId), readOnlyFlags(readOnlyFlags)
 		, drawOp(drawOp)
 	{
 		
@@ -42,7 +45,7 @@ namespace bs { namespace ct
 	size_t VulkanGraphicsPipelineState::HashFunc::operator()(const GpuPipelineKey& key) const
 	{
 		size_t hash = 0;
-		hash_combine(hash, key.framebufferId);
+		hash_combine(hash, key.framebufferLayoutId);
 		hash_combine(hash, key.vertexInputId);
 		hash_combine(hash, key.readOnlyFlags);
 		hash_combine(hash, key.drawOp);
@@ -52,7 +55,7 @@ namespace bs { namespace ct
 
 	bool VulkanGraphicsPipelineState::EqualFunc::operator()(const GpuPipelineKey& a, const GpuPipelineKey& b) const
 	{
-		if (a.framebufferId != b.framebufferId)
+		if (a.framebufferLayoutId != b.framebufferLayoutId)
 			return false;
 
 		if (a.vertexInputId != b.vertexInputId)
@@ -69,7 +72,7 @@ namespace bs { namespace ct
 
 	VulkanGraphicsPipelineState::VulkanGraphicsPipelineState(const PIPELINE_STATE_DESC& desc,
 																	 GpuDeviceFlags deviceMask)
-		:GraphicsPipelineState(desc, deviceMask), mScissorEnabled(false), mDeviceMask(deviceMask)
+		:GraphicsPipelineState(desc, deviceMask), mScissorEnabled(false), mStateHash(0), mDeviceMask(deviceMask)
 	{
 		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
 		{
@@ -80,6 +83,21 @@ namespace bs { namespace ct
 
 	VulkanGraphicsPipelineState::~VulkanGraphicsPipelineState()
 	{
+		// Pipelines being created on worker threads reference this object, so wait until they finish
+		Vector<SPtr<Task>> pendingTasks;
+		{
+			Lock lock(mMutex);
+
+			for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+			{
+				for (auto& entry : mPerDeviceData[i].pendingPipelines)
+					pendingTasks.push_back(entry.second);
+			}
+		}
+
+		for (auto& entry : pendingTasks)
+			entry->wait();
+
 		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
 		{
 			if (mPerDeviceData[i].device == nullptr)
@@ -288,6 +306,26 @@ namespace bs { namespace ct
 		if(mData.vertexProgram != nullptr)
 			mVertexDecl = mData.vertexProgram->getInputDeclaration();
 
+		// Hash needs to be stable between runs, as it is used for finding pipelines recorded during previous runs
+		size_t stateHash = 0;
+		for(UINT32 i = 0; i < numStages; i++)
+		{
+			if (stages[i].second == nullptr)
+				continue;
+
+			const GpuProgramProperties& programProps = stages[i].second->getProperties();
+
+			hash_combine(stateHash, i);
+			hash_combine(stateHash, programProps.getSource());
+			hash_combine(stateHash, programProps.getEntryPoint());
+		}
+
+		hash_combine(stateHash, rstProps.getHash());
+		hash_combine(stateHash, blendProps.getHash());
+		hash_combine(stateHash, dsProps.getHash());
+
+		mStateHash = stateHash;
+
 		VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPI::instance());
 
 		VulkanDevice* devices[BS_MAX_DEVICES];
@@ -312,6 +350,8 @@ namespace bs { namespace ct
 			mPerDeviceData[i].pipelineLayout = descManager.getPipelineLayout(layouts, numLayouts);
 
 			bs_stack_free(layouts);
+
+			prewarmRecorded(i);
 		}
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_PipelineState);
@@ -327,17 +367,160 @@ namespace bs { namespace ct
 			return nullptr;
 
 		readOnlyFlags &= ~FBT_COLOR; // Ignore the color
-		GpuPipelineKey key(framebuffer->getId(), vertexInput->getId(), readOnlyFlags, drawOp);
+		GpuPipelineKey key(framebuffer->getLayoutId(), vertexInput->getId(), readOnlyFlags, drawOp);
 
 		PerDeviceData& perDeviceData = mPerDeviceData[deviceIdx];
 		auto iterFind = perDeviceData.pipelines.find(key);
 		if (iterFind != perDeviceData.pipelines.end())
 			return iterFind->second;
 
-		VulkanPipeline* newPipeline = createPipeline(deviceIdx, framebuffer, readOnlyFlags, drawOp, vertexInput);
-		perDeviceData.pipelines[key] = newPipeline;
+		auto iterFindPending = perDeviceData.pendingPipelines.find(key);
+		if (iterFindPending == perDeviceData.pendingPipelines.end())
+		{
+			// Note: We can use the default render pass here (default clear/load/read flags), even though that might not
+			// be the exact one currently bound. This is because load/store operations and layout transitions are allowed
+			// to differ (as per spec 7.2., such render passes are considered compatible).
+			VkRenderPass renderPass = framebuffer->getRenderPass(RT_NONE, RT_NONE, CLEAR_NONE);
+
+			PipelineCreateInfo createInfo;
+			populateCreateInfo(deviceIdx, renderPass, framebuffer->getLayout(), readOnlyFlags, drawOp, vertexInput, 
+				createInfo);
+
+			VulkanPipeline* newPipeline = createPipeline(deviceIdx, createInfo);
+			perDeviceData.pipelines[key] = newPipeline;
+
+			recordPipeline(deviceIdx, framebuffer->getLayout(), readOnlyFlags, drawOp, vertexInput);
+			return newPipeline;
+		}
+
+		SPtr<Task> pendingTask = iterFindPending->second;
+
+		// Task needs the lock in order to register the pipeline once done
+		lock.unlock();
+		pendingTask->wait();
+		lock.lock();
+
+		iterFind = perDeviceData.pipelines.find(key);
+		if (iterFind != perDeviceData.pipelines.end())
+			return iterFind->second;
+
+		return nullptr;
+	}
+
+	void VulkanGraphicsPipelineState::prewarm(UINT32 deviceIdx, const VulkanFramebufferLayout& layout, 
+		UINT32 readOnlyFlags, DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput)
+	{
+		Lock lock(mMutex);
+
+		if (mPerDeviceData[deviceIdx].device == nullptr)
+			return;
+
+		readOnlyFlags &= ~FBT_COLOR; // Ignore the color
+		GpuPipelineKey key(VulkanFramebuffer::getLayoutId(layout), vertexInput->getId(), readOnlyFlags, drawOp);
+
+		PerDeviceData& perDeviceData = mPerDeviceData[deviceIdx];
+		if (perDeviceData.pipelines.find(key) != perDeviceData.pipelines.end())
+			return;
+
+		if (perDeviceData.pendingPipelines.find(key) != perDeviceData.pendingPipelines.end())
+			return;
+
+		createPipelineAsync(deviceIdx, key, layout, readOnlyFlags, drawOp, vertexInput);
+		recordPipeline(deviceIdx, layout, readOnlyFlags, drawOp, vertexInput);
+	}
+
+	SPtr<Task> VulkanGraphicsPipelineState::createPipelineAsync(UINT32 deviceIdx, const GpuPipelineKey& key, 
+		const VulkanFramebufferLayout& layout, UINT32 readOnlyFlags, DrawOperationType drawOp, 
+		const SPtr<VulkanVertexInput>& vertexInput)
+	{
+		VkDevice vkDevice = mPerDeviceData[deviceIdx].device->getLogical();
+
+		// No framebuffer is required, as any compatible render pass will do. Vertex input is kept alive by the task.
+		VkRenderPass renderPass = VulkanFramebuffer::createCompatibleRenderPass(vkDevice, layout);
+
+		SPtr<PipelineCreateInfo> createInfo = bs_shared_ptr_new<PipelineCreateInfo>();
+		populateCreateInfo(deviceIdx, renderPass, layout, readOnlyFlags, drawOp, vertexInput, *createInfo);
+
+		auto createWorker = [this, deviceIdx, key, createInfo, renderPass, vkDevice, vertexInput]()
+		{
+			VulkanPipeline* newPipeline = createPipeline(deviceIdx, *createInfo);
+			vkDestroyRenderPass(vkDevice, renderPass, gVulkanAllocator);
+
+			Lock lock(mMutex);
+
+			PerDeviceData& perDeviceData = mPerDeviceData[deviceIdx];
+			perDeviceData.pipelines[key] = newPipeline;
+			perDeviceData.pendingPipelines.erase(key);
+		};
+
+		SPtr<Task> task = Task::create("VulkanPipelineCreate", createWorker);
+		mPerDeviceData[deviceIdx].pendingPipelines[key] = task;
+
+		TaskScheduler::instance().addTask(task);
+		return task;
+	}
+
+	void VulkanGraphicsPipelineState::recordPipeline(UINT32 deviceIdx, const VulkanFramebufferLayout& layout, 
+		UINT32 readOnlyFlags, DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput)
+	{
+		const SPtr<VertexDeclaration>& bufferDecl = vertexInput->getBufferDeclaration();
+		if (bufferDecl == nullptr)
+			return;
 
-		return newPipeline;
+		VulkanPipelineRecord record;
+		record.stateHash = mStateHash;
+		record.framebufferLayout = layout;
+		record.readOnlyFlags = readOnlyFlags;
+		record.drawOp = drawOp;
+		record.vertexElements = bufferDecl->getProperties().getElements();
+
+		mPerDeviceData[deviceIdx].device->getPipelineRecorder().record(record);
+	}
+
+	void VulkanGraphicsPipelineState::prewarmRecorded(UINT32 deviceIdx)
+	{
+		// Pipelines can't be created without a vertex declaration, or if any of the programs failed to compile
+		if (mVertexDecl == nullptr)
+			return;
+
+		GpuProgram* programs[] = { mData.vertexProgram.get(), mData.hullProgram.get(), mData.domainProgram.get(),
+			mData.geometryProgram.get(), mData.fragmentProgram.get() };
+
+		for (auto& program : programs)
+		{
+			if (program != nullptr && !program->isCompiled())
+				return;
+		}
+
+		PerDeviceData& perDeviceData = mPerDeviceData[deviceIdx];
+		VulkanPipelineRecorder& recorder = perDeviceData.device->getPipelineRecorder();
+
+		Vector<VulkanPipelineRecord> records = recorder.getRecords(mStateHash);
+		for (auto& record : records)
+		{
+			// Declarations are cached by their elements, so this will generally return the same declaration (with the
+			// same ID) as the one used for rendering, resulting in the same pipeline key
+			SPtr<VertexDeclaration> bufferDecl = 
+				HardwareBufferManager::instance().createVertexDeclaration(record.vertexElements);
+
+			SPtr<VulkanVertexInput> vertexInput = 
+				VulkanVertexInputManager::instance().getVertexInfo(bufferDecl, mVertexDecl);
+
+			UINT32 layoutId = VulkanFramebuffer::getLayoutId(record.framebufferLayout);
+			GpuPipelineKey key(layoutId, vertexInput->getId(), record.readOnlyFlags, record.drawOp);
+
+			if (perDeviceData.pipelines.find(key) != perDeviceData.pipelines.end())
+				continue;
+
+			if (perDeviceData.pendingPipelines.find(key) != perDeviceData.pendingPipelines.end())
+				continue;
+
+			createPipelineAsync(deviceIdx, key, record.framebufferLayout, record.readOnlyFlags, record.drawOp, 
+				vertexInput);
+
+			// Marks the record as used, so it is persisted in favor of records of pipeline states that no longer exist
+			recorder.record(record);
+		}
 	}
 
 	VkPipelineLayout VulkanGraphicsPipelineState::getPipelineLayout(UINT32 deviceIdx) const
@@ -369,13 +552,21 @@ namespace bs { namespace ct
 		}
 	}
 
-	VulkanPipeline* VulkanGraphicsPipelineState::createPipeline(UINT32 deviceIdx, VulkanFramebuffer* framebuffer,
-		UINT32 readOnlyFlags, DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput)
+	void VulkanGraphicsPipelineState::populateCreateInfo(UINT32 deviceIdx, VkRenderPass renderPass, 
+		const VulkanFramebufferLayout& layout, UINT32 readOnlyFlags, DrawOperationType drawOp, 
+		const SPtr<VulkanVertexInput>& vertexInput, PipelineCreateInfo& output)
 	{
-		mInputAssemblyInfo.topology = VulkanUtility::getDrawOp(drawOp);
-		mTesselationInfo.patchControlPoints = 3; // Not provided by our shaders for now
-		mMultiSampleInfo.rasterizationSamples = framebuffer->getSampleFlags();
-		mColorBlendStateInfo.attachmentCount = framebuffer->getNumColorAttachments();
+		output.pipelineInfo = mPipelineInfo;
+		output.inputAssemblyInfo = mInputAssemblyInfo;
+		output.tesselationInfo = mTesselationInfo;
+		output.multiSampleInfo = mMultiSampleInfo;
+		output.depthStencilInfo = mDepthStencilInfo;
+		output.colorBlendStateInfo = mColorBlendStateInfo;
+
+		output.inputAssemblyInfo.topology = VulkanUtility::getDrawOp(drawOp);
+		output.tesselationInfo.patchControlPoints = 3; // Not provided by our shaders for now
+		output.multiSampleInfo.rasterizationSamples = layout.sampleFlags;
+		output.colorBlendStateInfo.attachmentCount = layout.numColorAttachments;
 
 		DepthStencilState* dsState = getDepthStencilState().get();
 		if (dsState == nullptr)
@@ -384,65 +575,58 @@ namespace bs { namespace ct
 		const DepthStencilProperties dsProps = dsState->getProperties();
 		bool enableDepthWrites = dsProps.getDepthWriteEnable() && (readOnlyFlags & FBT_DEPTH) == 0;
 
-		mDepthStencilInfo.depthWriteEnable = enableDepthWrites; // If depth stencil attachment is read only, depthWriteEnable must be VK_FALSE
-
-		// Save stencil ops as we might need to change them if depth/stencil is read-only
-		VkStencilOp oldFrontPassOp = mDepthStencilInfo.front.passOp;
-		VkStencilOp oldFrontFailOp = mDepthStencilInfo.front.failOp;
-		VkStencilOp oldFrontZFailOp = mDepthStencilInfo.front.depthFailOp;
-
-		VkStencilOp oldBackPassOp = mDepthStencilInfo.back.passOp;
-		VkStencilOp oldBackFailOp = mDepthStencilInfo.back.failOp;
-		VkStencilOp oldBackZFailOp = mDepthStencilInfo.back.depthFailOp;
+		VkPipelineDepthStencilStateCreateInfo& depthStencilInfo = output.depthStencilInfo;
+		depthStencilInfo.depthWriteEnable = enableDepthWrites; // If depth stencil attachment is read only, depthWriteEnable must be VK_FALSE
 
 		if((readOnlyFlags & FBT_STENCIL) != 0)
 		{
 			// Disable any stencil writes
-			mDepthStencilInfo.front.passOp = VK_STENCIL_OP_KEEP;
-			mDepthStencilInfo.front.failOp = VK_STENCIL_OP_KEEP;
-			mDepthStencilInfo.front.depthFailOp = VK_STENCIL_OP_KEEP;
+			depthStencilInfo.front.passOp = VK_STENCIL_OP_KEEP;
+			depthStencilInfo.front.failOp = VK_STENCIL_OP_KEEP;
+			depthStencilInfo.front.depthFailOp = VK_STENCIL_OP_KEEP;
 
-			mDepthStencilInfo.back.passOp = VK_STENCIL_OP_KEEP;
-			mDepthStencilInfo.back.failOp = VK_STENCIL_OP_KEEP;
-			mDepthStencilInfo.back.depthFailOp = VK_STENCIL_OP_KEEP;
+			depthStencilInfo.back.passOp = VK_STENCIL_OP_KEEP;
+			depthStencilInfo.back.failOp = VK_STENCIL_OP_KEEP;
+			depthStencilInfo.back.depthFailOp = VK_STENCIL_OP_KEEP;
 		}
 
-		// Note: We can use the default render pass here (default clear/load/read flags), even though that might not be the
-		// exact one currently bound. This is because load/store operations and layout transitions are allowed to differ
-		// (as per spec 7.2., such render passes are considered compatible).
-		mPipelineInfo.renderPass = framebuffer->getRenderPass(RT_NONE, RT_NONE, CLEAR_NONE);
-		mPipelineInfo.layout = mPerDeviceData[deviceIdx].pipelineLayout;
-		mPipelineInfo.pVertexInputState = vertexInput->getCreateInfo();
+		VkGraphicsPipelineCreateInfo& pipelineInfo = output.pipelineInfo;
+
+		pipelineInfo.renderPass = renderPass;
+		pipelineInfo.layout = mPerDeviceData[deviceIdx].pipelineLayout;
+		pipelineInfo.pVertexInputState = vertexInput->getCreateInfo();
+		pipelineInfo.pStages = output.shaderStageInfos;
+		pipelineInfo.pInputAssemblyState = &output.inputAssemblyInfo;
+		pipelineInfo.pTessellationState = mPipelineInfo.pTessellationState != nullptr ? &output.tesselationInfo : nullptr;
+		pipelineInfo.pMultisampleState = &output.multiSampleInfo;
 
-		bool depthReadOnly;
-		if (framebuffer->hasDepthAttachment())
+		if (layout.hasDepthAttachment())
 		{
-			mPipelineInfo.pDepthStencilState = &mDepthStencilInfo;
-			depthReadOnly = (readOnlyFlags & FBT_DEPTH) != 0;
+			pipelineInfo.pDepthStencilState = &output.depthStencilInfo;
+			output.depthReadOnly = (readOnlyFlags & FBT_DEPTH) != 0;
 		}
 		else
 		{
-			mPipelineInfo.pDepthStencilState = nullptr;
-			depthReadOnly = true;
+			pipelineInfo.pDepthStencilState = nullptr;
+			output.depthReadOnly = true;
 		}
 
-		std::array<bool, BS_MAX_MULTIPLE_RENDER_TARGETS> colorReadOnly;
-		if (framebuffer->getNumColorAttachments() > 0)
+		if (layout.numColorAttachments > 0)
 		{
-			mPipelineInfo.pColorBlendState = &mColorBlendStateInfo;
+			pipelineInfo.pColorBlendState = &output.colorBlendStateInfo;
 
 			for (UINT32 i = 0; i < BS_MAX_MULTIPLE_RENDER_TARGETS; i++)
 			{
-				VkPipelineColorBlendAttachmentState& blendState = mAttachmentBlendStates[i];
-				colorReadOnly[i] = blendState.colorWriteMask == 0;
+				const VkPipelineColorBlendAttachmentState& blendState = mAttachmentBlendStates[i];
+				output.colorReadOnly[i] = blendState.colorWriteMask == 0;
 			}
 		}
 		else
 		{
-			mPipelineInfo.pColorBlendState = nullptr;
+			pipelineInfo.pColorBlendState = nullptr;
 
 			for (UINT32 i = 0; i < BS_MAX_MULTIPLE_RENDER_TARGETS; i++)
-				colorReadOnly[i] = true;
+				output.colorReadOnly[i] = true;
 		}
 
 		std::pair<VkShaderStageFlagBits, GpuProgram*> stages[] =
@@ -462,7 +646,8 @@ namespace bs { namespace ct
 			if (program == nullptr)
 				continue;
 
-			VkPipelineShaderStageCreateInfo& stageCI = mShaderStageInfos[stageOutputIdx];
+			VkPipelineShaderStageCreateInfo& stageCI = output.shaderStageInfos[stageOutputIdx];
+			stageCI = mShaderStageInfos[stageOutputIdx];
 
 			VulkanShaderModule* module = program->getShaderModule(deviceIdx);
 
@@ -473,24 +658,20 @@ namespace bs { namespace ct
 
 			stageOutputIdx++;
 		}
+	}
 
+	VulkanPipeline* VulkanGraphicsPipelineState::createPipeline(UINT32 deviceIdx, const PipelineCreateInfo& createInfo)
+	{
 		VulkanDevice* device = mPerDeviceData[deviceIdx].device;
-		VkDevice vkDevice = mPerDeviceData[deviceIdx].device->getLogical();
+		VkDevice vkDevice = device->getLogical();
 
 		VkPipeline pipeline;
-		VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &mPipelineInfo, gVulkanAllocator, &pipeline);
+		VkResult result = vkCreateGraphicsPipelines(vkDevice, device->getPipelineCache(), 1, &createInfo.pipelineInfo, 
+			gVulkanAllocator, &pipeline);
 		assert(result == VK_SUCCESS);
 
-		// Restore previous stencil op states
-		mDepthStencilInfo.front.passOp = oldFrontPassOp;
-		mDepthStencilInfo.front.failOp = oldFrontFailOp;
-		mDepthStencilInfo.front.depthFailOp = oldFrontZFailOp;
-
-		mDepthStencilInfo.back.passOp = oldBackPassOp;
-		mDepthStencilInfo.back.failOp = oldBackFailOp;
-		mDepthStencilInfo.back.depthFailOp = oldBackZFailOp;
-
-		return device->getResourceManager().create<VulkanPipeline>(pipeline, colorReadOnly, depthReadOnly);
+		return device->getResourceManager().create<VulkanPipeline>(pipeline, createInfo.colorReadOnly, 
+			createInfo.depthReadOnly);
 	}
 
 	VulkanComputePipelineState::VulkanComputePipelineState(const SPtr<GpuProgram>& program, 
@@ -571,8 +752,8 @@ namespace bs { namespace ct
 			pipelineCI.layout = descManager.getPipelineLayout(layouts, numLayouts);
 
 			VkPipeline pipeline;
-			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), VK_NULL_HANDLE, 1, &pipelineCI,
-														gVulkanAllocator, &pipeline);
+			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), devices[i]->getPipelineCache(), 1, 
+				&pipelineCI, gVulkanAllocator, &pipeline);
 			assert(result == VK_SUCCESS);
 
 
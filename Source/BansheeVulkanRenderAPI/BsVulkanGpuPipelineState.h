@@ -4,6 +4,7 @@
 
 #include "BsVulkanPrerequisites.h"
 #include "BsVulkanResource.h"
+#include "BsVulkanFramebuffer.h"
 #include "RenderAPI/BsGpuPipelineState.h"
 
 namespace bs { namespace ct
@@ -50,7 +51,8 @@ namespace bs { namespace ct
 
 		/** 
 		 * Attempts to find an existing pipeline matching the provided parameters, or creates a new one if one cannot be 
-		 * found.
+		 * found. If a matching pipeline is still being created on a worker thread (e.g. because it was recorded during a
+		 * previous run and is being re-created ahead of time), waits until it is done.
 		 * 
 		 * @param[in]	deviceIdx			Index of the device to retrieve the pipeline for.
 		 * @param[in]	framebuffer			Framebuffer object that defines the surfaces this pipeline will render to.
@@ -65,6 +67,24 @@ namespace bs { namespace ct
 		VulkanPipeline* getPipeline(UINT32 deviceIdx, VulkanFramebuffer* framebuffer, UINT32 readOnlyFlags, 
 			DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput);
 
+		/** 
+		 * Starts creating a pipeline matching the provided parameters on a worker thread, unless one already exists. Use
+		 * this to create pipelines ahead of time (e.g. during loading), so that getPipeline() doesn't need to wait for
+		 * them. Pipelines recorded during previous runs are pre-warmed automatically when the pipeline state is
+		 * initialized.
+		 * 
+		 * @param[in]	deviceIdx			Index of the device to create the pipeline for.
+		 * @param[in]	layout				Layout of the framebuffers this pipeline will render to.
+		 * @param[in]	readOnlyFlags		Flags that control which portion of the framebuffer is read-only. Accepts
+		 *									combinations of FrameBufferType enum.
+		 * @param[in]	drawOp				Type of geometry that will be drawn using the pipeline.
+		 * @param[in]	vertexInput			State describing inputs to the vertex program.
+		 * 
+		 * @note	Thread safe.
+		 */
+		void prewarm(UINT32 deviceIdx, const VulkanFramebufferLayout& layout, UINT32 readOnlyFlags, 
+			DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput);
+
 		/** 
 		 * Returns a pipeline layout object for the specified device index. If the device index doesn't match a bit in the
 		 * device mask provided on pipeline creation, null is returned.
@@ -86,27 +106,59 @@ namespace bs { namespace ct
 		void initialize() override;
 
 		/** 
-		 * Create a new Vulkan graphics pipeline. 
+		 * Contains all the information required for creating a single graphics pipeline. Unlike the pipeline state 
+		 * members, a single instance is used for a single pipeline only, which allows pipelines to be created on 
+		 * different threads at once.
+		 */
+		struct PipelineCreateInfo
+		{
+			VkGraphicsPipelineCreateInfo pipelineInfo;
+			VkPipelineShaderStageCreateInfo shaderStageInfos[5];
+			VkPipelineInputAssemblyStateCreateInfo inputAssemblyInfo;
+			VkPipelineTessellationStateCreateInfo tesselationInfo;
+			VkPipelineMultisampleStateCreateInfo multiSampleInfo;
+			VkPipelineDepthStencilStateCreateInfo depthStencilInfo;
+			VkPipelineColorBlendStateCreateInfo colorBlendStateInfo;
+
+			std::array<bool, BS_MAX_MULTIPLE_RENDER_TARGETS> colorReadOnly;
+			bool depthReadOnly;
+		};
+
+		/** 
+		 * Populates the information required for creating a new Vulkan graphics pipeline. Caller must hold the pipeline
+		 * state mutex.
 		 * 
 		 * @param[in]	deviceIdx			Index of the device to create the pipeline for.
-		 * @param[in]	framebuffer			Framebuffer object that defines the surfaces this pipeline will render to.
+		 * @param[in]	renderPass			Render pass the pipeline will be used with, or one compatible with it.
+		 * @param[in]	layout				Layout of the framebuffers this pipeline will render to.
 		 * @param[in]	readOnlyFlags		Flags that control which portion of the framebuffer is read-only. Accepts
 		 *									combinations of FrameBufferType enum.
 		 * @param[in]	drawOp				Type of geometry that will be drawn using the pipeline.
 		 * @param[in]	vertexInput			State describing inputs to the vertex program.
-		 * @return							Vulkan graphics pipeline object.
+		 * @param[out]	output				Object to populate. Must not be moved until the pipeline has been created, as
+		 *									it contains pointers to its own members.
+		 */
+		void populateCreateInfo(UINT32 deviceIdx, VkRenderPass renderPass, const VulkanFramebufferLayout& layout,
+			UINT32 readOnlyFlags, DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput, 
+			PipelineCreateInfo& output);
+
+		/** 
+		 * Create a new Vulkan graphics pipeline from the information populated by populateCreateInfo().
 		 * 
 		 * @note	Thread safe.
 		 */
-		VulkanPipeline* createPipeline(UINT32 deviceIdx, VulkanFramebuffer* framebuffer, UINT32 readOnlyFlags, 
-			DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput);
+		VulkanPipeline* createPipeline(UINT32 deviceIdx, const PipelineCreateInfo& createInfo);
 
-		/**	Key uniquely identifying GPU pipelines. */
+		/** 
+		 * Key uniquely identifying GPU pipelines. Pipelines are shared between all framebuffers with the same layout, as
+		 * their render passes are compatible.
+		 */
 		struct GpuPipelineKey
 		{
-			GpuPipelineKey(UINT32 framebufferId, UINT32 vertexInputId, UINT32 readOnlyFlags, DrawOperationType drawOp);
+			GpuPipelineKey(UINT32 framebufferLayoutId, UINT32 vertexInputId, UINT32 readOnlyFlags, 
+				DrawOperationType drawOp);
 
-			UINT32 framebufferId;
+			UINT32 framebufferLayoutId;
 			UINT32 vertexInputId;
 			UINT32 readOnlyFlags;
 			DrawOperationType drawOp;
@@ -132,8 +184,30 @@ namespace bs { namespace ct
 			VulkanDevice* device;
 			VkPipelineLayout pipelineLayout;
 			UnorderedMap<GpuPipelineKey, VulkanPipeline*, HashFunc, EqualFunc> pipelines;
+			UnorderedMap<GpuPipelineKey, SPtr<Task>, HashFunc, EqualFunc> pendingPipelines;
 		};
 
+		/** 
+		 * Starts creating a pipeline on a worker thread and registers it as pending. The pipeline is created against a
+		 * temporary render pass compatible with the provided framebuffer layout, and is moved to the list of created
+		 * pipelines once done. Caller must hold the pipeline state mutex.
+		 */
+		SPtr<Task> createPipelineAsync(UINT32 deviceIdx, const GpuPipelineKey& key, const VulkanFramebufferLayout& layout,
+			UINT32 readOnlyFlags, DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput);
+
+		/** 
+		 * Registers a newly created pipeline with the device's pipeline recorder, so it can be pre-warmed on the next
+		 * run.
+		 */
+		void recordPipeline(UINT32 deviceIdx, const VulkanFramebufferLayout& layout, UINT32 readOnlyFlags,
+			DrawOperationType drawOp, const SPtr<VulkanVertexInput>& vertexInput);
+
+		/** 
+		 * Starts creating all the pipelines recorded for this pipeline state during previous runs, on worker threads.
+		 * Caller must hold the pipeline state mutex.
+		 */
+		void prewarmRecorded(UINT32 deviceIdx);
+
 		VkPipelineShaderStageCreateInfo mShaderStageInfos[5];
 		VkPipelineInputAssemblyStateCreateInfo mInputAssemblyInfo;
 		VkPipelineTessellationStateCreateInfo mTesselationInfo;
@@ -148,6 +222,7 @@ namespace bs { namespace ct
 		VkGraphicsPipelineCreateInfo mPipelineInfo;
 		bool mScissorEnabled;
 		SPtr<VertexDeclaration> mVertexDecl;
+		UINT64 mStateHash;
 
 		GpuDeviceFlags mDeviceMask;
 		PerDeviceData mPerDeviceData[BS_MAX_DEVICES];
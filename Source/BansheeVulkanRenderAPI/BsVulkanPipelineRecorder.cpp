@@ -0,0 +1,210 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsVulkanPipelineRecorder.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs { namespace ct
+{
+	/** Identifier written at the start of the records file. */
+	static const UINT32 RECORDS_FILE_MAGIC = 0x52504B56; // "VKPR"
+
+	/** Version of the records file format. Increment whenever the format, or the way state hashes are generated, changes. */
+	static const UINT32 RECORDS_FILE_VERSION = 1;
+
+	/** Maximum number of vertex elements in a single record. Used for validating the records file. */
+	static const UINT32 MAX_VERTEX_ELEMENTS = 64;
+
+	VulkanPipelineRecorder::VulkanPipelineRecorder(const Path& path)
+		:mPath(path)
+	{
+		load();
+	}
+
+	size_t VulkanPipelineRecorder::getHash(const VulkanPipelineRecord& record)
+	{
+		size_t hash = 0;
+		hash_combine(hash, record.stateHash);
+		hash_combine(hash, VulkanFramebufferLayout::HashFunction()(record.framebufferLayout));
+		hash_combine(hash, record.readOnlyFlags);
+		hash_combine(hash, (UINT32)record.drawOp);
+
+		for(auto& element : record.vertexElements)
+			hash_combine(hash, VertexElement::getHash(element));
+
+		return hash;
+	}
+
+	void VulkanPipelineRecorder::record(const VulkanPipelineRecord& record)
+	{
+		size_t hash = getHash(record);
+
+		Lock lock(mMutex);
+
+		auto iterFind = mEntryLookup.find(hash);
+		if(iterFind != mEntryLookup.end())
+		{
+			iterFind->second->used = true;
+			return;
+		}
+
+		auto iter = mEntries.insert(std::make_pair(record.stateHash, Entry { record, true }));
+		mEntryLookup[hash] = &iter->second;
+	}
+
+	Vector<VulkanPipelineRecord> VulkanPipelineRecorder::getRecords(UINT64 stateHash) const
+	{
+		Vector<VulkanPipelineRecord> output;
+
+		Lock lock(mMutex);
+
+		auto range = mEntries.equal_range(stateHash);
+		for(auto iter = range.first; iter != range.second; ++iter)
+			output.push_back(iter->second.record);
+
+		return output;
+	}
+
+	void VulkanPipelineRecorder::load()
+	{
+		if(!FileSystem::isFile(mPath))
+			return;
+
+		SPtr<DataStream> stream = FileSystem::openFile(mPath);
+		if(stream == nullptr)
+			return;
+
+		auto readValue = [&stream](UINT32& value)
+		{
+			return stream->read(&value, sizeof(value)) == sizeof(value);
+		};
+
+		UINT32 header[3];
+		if(stream->read(header, sizeof(header)) != sizeof(header))
+			return;
+
+		if(header[0] != RECORDS_FILE_MAGIC || header[1] != RECORDS_FILE_VERSION)
+			return;
+
+		UINT32 numRecords = std::min(header[2], MAX_RECORDS);
+		for(UINT32 i = 0; i < numRecords; i++)
+		{
+			VulkanPipelineRecord record;
+			if(stream->read(&record.stateHash, sizeof(record.stateHash)) != sizeof(record.stateHash))
+				return;
+
+			VulkanFramebufferLayout& layout = record.framebufferLayout;
+
+			UINT32 numColorAttachments;
+			if(!readValue(numColorAttachments) || numColorAttachments > BS_MAX_MULTIPLE_RENDER_TARGETS)
+				return;
+
+			layout.numColorAttachments = numColorAttachments;
+			for(UINT32 j = 0; j < numColorAttachments; j++)
+			{
+				UINT32 format;
+				if(!readValue(format))
+					return;
+
+				layout.colorFormats[j] = (VkFormat)format;
+			}
+
+			UINT32 depthFormat, sampleFlags, drawOp, numElements;
+			if(!readValue(depthFormat) || !readValue(sampleFlags) || !readValue(record.readOnlyFlags) ||
+				!readValue(drawOp) || !readValue(numElements))
+				return;
+
+			if(numElements > MAX_VERTEX_ELEMENTS)
+				return;
+
+			layout.depthFormat = (VkFormat)depthFormat;
+			layout.sampleFlags = (VkSampleCountFlagBits)sampleFlags;
+			record.drawOp = (DrawOperationType)drawOp;
+
+			for(UINT32 j = 0; j < numElements; j++)
+			{
+				UINT32 element[6];
+				if(stream->read(element, sizeof(element)) != sizeof(element))
+					return;
+
+				record.vertexElements.push_back(VertexElement((UINT16)element[0], element[1],
+					(VertexElementType)element[2], (VertexElementSemantic)element[3], (UINT16)element[4], element[5]));
+			}
+
+			size_t hash = getHash(record);
+			if(mEntryLookup.find(hash) != mEntryLookup.end())
+				continue;
+
+			auto iter = mEntries.insert(std::make_pair(record.stateHash, Entry { record, false }));
+			mEntryLookup[hash] = &iter->second;
+		}
+	}
+
+	void VulkanPipelineRecorder::save() const
+	{
+		Lock lock(mMutex);
+
+		// Prefer records used during this run, so records of pipeline states that no longer exist eventually get dropped
+		Vector<const VulkanPipelineRecord*> records;
+		for(auto& entry : mEntries)
+		{
+			if(entry.second.used)
+				records.push_back(&entry.second.record);
+		}
+
+		for(auto& entry : mEntries)
+		{
+			if(!entry.second.used)
+				records.push_back(&entry.second.record);
+		}
+
+		if(records.size() > MAX_RECORDS)
+			records.resize(MAX_RECORDS);
+
+		Path folder = mPath.getParent();
+		if(!FileSystem::exists(folder))
+			FileSystem::createDir(folder);
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(mPath);
+		if(stream == nullptr)
+			return;
+
+		auto writeValue = [&stream](UINT32 value)
+		{
+			stream->write(&value, sizeof(value));
+		};
+
+		writeValue(RECORDS_FILE_MAGIC);
+		writeValue(RECORDS_FILE_VERSION);
+		writeValue((UINT32)records.size());
+
+		for(auto& record : records)
+		{
+			const VulkanFramebufferLayout& layout = record->framebufferLayout;
+
+			stream->write(&record->stateHash, sizeof(record->stateHash));
+
+			writeValue(layout.numColorAttachments);
+			for(UINT32 i = 0; i < layout.numColorAttachments; i++)
+				writeValue((UINT32)layout.colorFormats[i]);
+
+			writeValue((UINT32)layout.depthFormat);
+			writeValue((UINT32)layout.sampleFlags);
+			writeValue(record->readOnlyFlags);
+			writeValue((UINT32)record->drawOp);
+			writeValue((UINT32)record->vertexElements.size());
+
+			for(auto& element : record->vertexElements)
+			{
+				writeValue(element.getStreamIdx());
+				writeValue(element.getOffset());
+				writeValue((UINT32)element.getType());
+				writeValue((UINT32)element.getSemantic());
+				writeValue(element.getSemanticIdx());
+				writeValue(element.getInstanceStepRate());
+			}
+		}
+
+		stream->close();
+	}
+}}
@@ -0,0 +1,85 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsVulkanPrerequisites.h"
+#include "BsVulkanFramebuffer.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Vulkan
+	 *  @{
+	 */
+
+	/** Describes the non-pipeline-state inputs a graphics pipeline was created with. */
+	struct VulkanPipelineRecord
+	{
+		/** Hash identifying the pipeline state the pipeline was created from. Stable between application runs. */
+		UINT64 stateHash = 0;
+
+		/** Formats and sample count of the render targets the pipeline renders to. */
+		VulkanFramebufferLayout framebufferLayout;
+
+		/** Flags that control which portion of the framebuffer is read-only. Combination of FrameBufferType. */
+		UINT32 readOnlyFlags = 0;
+
+		/** Type of geometry drawn using the pipeline. */
+		DrawOperationType drawOp = DOT_TRIANGLE_LIST;
+
+		/** Elements of the vertex buffer declaration the pipeline was used with. */
+		List<VertexElement> vertexElements;
+	};
+
+	/**
+	 * Keeps a list of all graphics pipelines created on a device, which is persisted between application runs. This
+	 * allows the pipelines to be re-created ahead of time on the next run, as soon as the pipeline state they belong to
+	 * is created, rather than when they are first used for drawing.
+	 *
+	 * @note	Thread safe.
+	 */
+	class VulkanPipelineRecorder
+	{
+	public:
+		/**
+		 * Creates a new recorder, populating it with the records stored in the provided file, if it exists and is
+		 * valid.
+		 */
+		VulkanPipelineRecorder(const Path& path);
+
+		/** Registers a newly created pipeline. Does nothing if a matching record already exists. */
+		void record(const VulkanPipelineRecord& record);
+
+		/** Returns all records belonging to the pipeline state with the provided hash. */
+		Vector<VulkanPipelineRecord> getRecords(UINT64 stateHash) const;
+
+		/**
+		 * Saves the records to the file provided on construction. Records registered during this run are saved first,
+		 * followed by records from previous runs, up to a maximum number of records.
+		 */
+		void save() const;
+
+	private:
+		/** Loads the records from the file provided on construction, if it exists and is valid. */
+		void load();
+
+		/** Contains a record, along with information about whether it was used during this run. */
+		struct Entry
+		{
+			VulkanPipelineRecord record;
+			bool used;
+		};
+
+		/** Generates a hash that uniquely identifies the record. */
+		static size_t getHash(const VulkanPipelineRecord& record);
+
+		static const UINT32 MAX_RECORDS = 8192;
+
+		Path mPath;
+		UnorderedMultimap<UINT64, Entry> mEntries;
+		UnorderedMap<size_t, Entry*> mEntryLookup;
+		mutable Mutex mMutex;
+	};
+
+	/** @} */
+}}
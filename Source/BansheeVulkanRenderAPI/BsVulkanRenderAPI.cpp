@@ -326,6 +326,9 @@ namespace bs { namespace ct
 	void VulkanRenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getCB(commandBuffer)->_getStateCache().setGraphicsPipeline(pipelineState))
+			return;
+
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
@@ -337,6 +340,9 @@ namespace bs { namespace ct
 	void VulkanRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getCB(commandBuffer)->_getStateCache().setComputePipeline(pipelineState))
+			return;
+
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
@@ -347,6 +353,8 @@ namespace bs { namespace ct
 
 	void VulkanRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		// Note: Not using the state cache for GPU params and vertex/index buffers, as writes to buffers and textures
+		// that are in use can replace their internal Vulkan objects, requiring a re-bind
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
@@ -405,6 +413,9 @@ namespace bs { namespace ct
 	void VulkanRenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getCB(commandBuffer)->_getStateCache().setVertexDeclaration(vertexDeclaration))
+			return;
+
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
@@ -413,6 +424,9 @@ namespace bs { namespace ct
 
 	void VulkanRenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
 	{
+		if (!getCB(commandBuffer)->_getStateCache().setDrawOperation(op))
+			return;
+
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
@@ -568,7 +582,8 @@ namespace bs { namespace ct
 			RenderAPIFeatureFlag::MSAAImageStores |
 			RenderAPIFeatureFlag::TextureViews |
 			RenderAPIFeatureFlag::Compute |
-			RenderAPIFeatureFlag::LoadStore;
+			RenderAPIFeatureFlag::LoadStore |
+			RenderAPIFeatureFlag::ParamBlockViews; // minUniformBufferOffsetAlignment is at most 256 bytes
 
 		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, featureFlags);
 		return info;
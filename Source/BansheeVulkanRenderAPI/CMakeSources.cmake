@@ -26,6 +26,7 @@ set(BS_BANSHEEVULKANRENDERAPI_INC_NOFILTER
 	"BsVulkanDescriptorSet.h"
 	"BsVulkanSamplerState.h"
 	"BsVulkanGpuPipelineParamInfo.h"
+	"BsVulkanPipelineRecorder.h"
 )
 
 set(BS_BANSHEEVULKANRENDERAPI_INC_MANAGERS
@@ -69,6 +70,7 @@ set(BS_BANSHEEVULKANRENDERAPI_SRC_NOFILTER
 	"BsVulkanDescriptorSet.cpp"
 	"BsVulkanSamplerState.cpp"
 	"BsVulkanGpuPipelineParamInfo.cpp"
+	"BsVulkanPipelineRecorder.cpp"
 )
 
 set(BS_BANSHEEVULKANRENDERAPI_SRC_MANAGERS
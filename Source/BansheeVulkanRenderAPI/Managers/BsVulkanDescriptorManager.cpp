@@ -95,6 +95,8 @@ namespace bs { namespace ct
 
 	VulkanDescriptorLayout* VulkanDescriptorManager::getLayout(VkDescriptorSetLayoutBinding* bindings, UINT32 numBindings)
 	{
+		Lock lock(mMutex);
+
 		VulkanLayoutKey key(bindings, numBindings);
 
 		auto iterFind = mLayouts.find(key);
@@ -122,26 +124,44 @@ namespace bs { namespace ct
 		VkDescriptorSetAllocateInfo allocateInfo;
 		allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
 		allocateInfo.pNext = nullptr;
-		allocateInfo.descriptorPool = mPools.back()->getHandle();
 		allocateInfo.descriptorSetCount = 1;
 		allocateInfo.pSetLayouts = &setLayout;
 
 		VkDescriptorSet set;
-		VkResult result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &set);
-		if(result < 0) // Possible fragmentation, try in a new pool
+
+		// Vulkan requires access to descriptor pools to be externally synchronized. The lock is released before
+		// registering the set with the resource manager, so the two locks are never held at once.
 		{
-			mPools.push_back(bs_new<VulkanDescriptorPool>(mDevice));
+			Lock lock(mMutex);
+
 			allocateInfo.descriptorPool = mPools.back()->getHandle();
 
-			result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &set);
-			assert(result == VK_SUCCESS);
+			VkResult result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &set);
+			if(result < 0) // Possible fragmentation, try in a new pool
+			{
+				mPools.push_back(bs_new<VulkanDescriptorPool>(mDevice));
+				allocateInfo.descriptorPool = mPools.back()->getHandle();
+
+				result = vkAllocateDescriptorSets(mDevice.getLogical(), &allocateInfo, &set);
+				assert(result == VK_SUCCESS);
+			}
 		}
 
 		return mDevice.getResourceManager().create<VulkanDescriptorSet>(set, allocateInfo.descriptorPool);
 	}
 
+	void VulkanDescriptorManager::freeSet(VkDescriptorSet set, VkDescriptorPool pool)
+	{
+		Lock lock(mMutex);
+
+		VkResult result = vkFreeDescriptorSets(mDevice.getLogical(), pool, 1, &set);
+		assert(result == VK_SUCCESS);
+	}
+
 	VkPipelineLayout VulkanDescriptorManager::getPipelineLayout(VulkanDescriptorLayout** layouts, UINT32 numLayouts)
 	{
+		Lock lock(mMutex);
+
 		VulkanPipelineLayoutKey key(layouts, numLayouts);
 
 		auto iterFind = mPipelineLayouts.find(key);
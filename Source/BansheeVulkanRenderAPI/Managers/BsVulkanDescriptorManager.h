@@ -77,7 +77,12 @@ namespace bs { namespace ct
 	 *  @{
 	 */
 
-	/** Manages allocation of descriptor layouts and sets for a single Vulkan device. */
+	/** 
+	 * Manages allocation of descriptor layouts and sets for a single Vulkan device. 
+	 * 
+	 * @note	Thread safe. Descriptor sets can be allocated and freed while command buffers are being recorded on
+	 *			multiple threads.
+	 */
 	class VulkanDescriptorManager
 	{
 	public:
@@ -90,6 +95,9 @@ namespace bs { namespace ct
 		/** Allocates a new empty descriptor set matching the provided layout. */
 		VulkanDescriptorSet* createSet(VulkanDescriptorLayout* layout);
 
+		/** Releases a descriptor set allocated through createSet(). Called by VulkanDescriptorSet on destruction. */
+		void freeSet(VkDescriptorSet set, VkDescriptorPool pool);
+
 		/** Attempts to find an existing one, or allocates a new pipeline layout based on the provided descriptor layouts. */
 		VkPipelineLayout getPipelineLayout(VulkanDescriptorLayout** layouts, UINT32 numLayouts);
 
@@ -99,6 +107,7 @@ namespace bs { namespace ct
 		UnorderedSet<VulkanLayoutKey> mLayouts; 
 		UnorderedMap<VulkanPipelineLayoutKey, VkPipelineLayout> mPipelineLayouts;
 		Vector<VulkanDescriptorPool*> mPools;
+		Mutex mMutex;
 	};
 
 	/** @} */
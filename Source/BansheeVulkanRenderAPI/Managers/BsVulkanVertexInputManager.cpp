@@ -7,8 +7,9 @@
 
 namespace bs { namespace ct
 {
-	VulkanVertexInput::VulkanVertexInput(UINT32 id, const VkPipelineVertexInputStateCreateInfo& createInfo)
-		:mId(id), mCreateInfo(createInfo)
+	VulkanVertexInput::VulkanVertexInput(UINT32 id, const VkPipelineVertexInputStateCreateInfo& createInfo,
+		const SPtr<VertexDeclaration>& bufferDecl)
+		:mId(id), mCreateInfo(createInfo), mBufferDecl(bufferDecl)
 	{ }
 
 	size_t VulkanVertexInputManager::HashFunc::operator()(const VertexDeclarationKey& key) const
@@ -182,7 +183,7 @@ namespace bs { namespace ct
 		pair.bufferDeclId = vbDecl->getId();
 		pair.shaderDeclId = shaderInputDecl->getId();
 
-		newEntry.vertexInput = bs_shared_ptr_new<VulkanVertexInput>(mNextId++, vertexInputCI);
+		newEntry.vertexInput = bs_shared_ptr_new<VulkanVertexInput>(mNextId++, vertexInputCI, vbDecl);
 		newEntry.lastUsedIdx = ++mLastUsedCounter;
 
 		mVertexInputMap[pair] = std::move(newEntry);
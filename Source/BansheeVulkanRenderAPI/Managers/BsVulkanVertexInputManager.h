@@ -16,7 +16,8 @@ namespace bs { namespace ct
 	class VulkanVertexInput
 	{
 	public:
-		VulkanVertexInput(UINT32 id, const VkPipelineVertexInputStateCreateInfo& createInfo);
+		VulkanVertexInput(UINT32 id, const VkPipelineVertexInputStateCreateInfo& createInfo,
+			const SPtr<VertexDeclaration>& bufferDecl);
 
 		/** Returns an object contining the necessary information to initialize the vertex input on a pipeline. */
 		const VkPipelineVertexInputStateCreateInfo* getCreateInfo() const { return &mCreateInfo; }
@@ -24,9 +25,13 @@ namespace bs { namespace ct
 		/** Returns an identifier which uniquely represents this vertex input configuration. */
 		UINT32 getId() const { return mId; }
 
+		/** Returns the vertex buffer declaration the vertex input was created for. */
+		const SPtr<VertexDeclaration>& getBufferDeclaration() const { return mBufferDecl; }
+
 	private:
 		UINT32 mId;
 		VkPipelineVertexInputStateCreateInfo mCreateInfo;
+		SPtr<VertexDeclaration> mBufferDecl;
 	};
 
 	/** 
@@ -0,0 +1,187 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMicroBenchmark.h"
+#include "Image/BsTextureAtlasLayout.h"
+#include "Utility/BsTimer.h"
+
+#include <cstdio>
+#include <random>
+
+namespace bs
+{
+	/** Describes a set of randomly sized elements to pack into an atlas. */
+	struct AtlasBenchmarkCase
+	{
+		const char* name;
+		UINT32 numElements;
+		UINT32 minSize;
+		UINT32 maxSize;
+		UINT32 maxPageSize;
+	};
+
+	/** Axis aligned rectangle of an element placed in an atlas. */
+	struct AtlasRect
+	{
+		UINT32 x, y, width, height;
+	};
+
+	/** Returns the number of pairs of overlapping rectangles, and rectangles falling outside of the provided bounds. */
+	UINT32 countInvalidRects(const Vector<AtlasRect>& rects, UINT32 width, UINT32 height)
+	{
+		UINT32 numInvalid = 0;
+		for (size_t i = 0; i < rects.size(); i++)
+		{
+			const AtlasRect& a = rects[i];
+			if ((a.x + a.width) > width || (a.y + a.height) > height)
+				numInvalid++;
+
+			for (size_t j = i + 1; j < rects.size(); j++)
+			{
+				const AtlasRect& b = rects[j];
+				if (a.x < (b.x + b.width) && b.x < (a.x + a.width) && a.y < (b.y + b.height) && b.y < (a.y + a.height))
+					numInvalid++;
+			}
+		}
+
+		return numInvalid;
+	}
+
+	/** Packs the elements described by the provided case using createAtlasLayout() and prints the results. */
+	bool runAtlasLayoutCase(const AtlasBenchmarkCase& benchCase, UINT32 scale, std::mt19937& rng)
+	{
+		std::uniform_int_distribution<UINT32> sizeDist(benchCase.minSize, benchCase.maxSize);
+
+		Vector<TextureAtlasUtility::Element> elements(benchCase.numElements);
+		UINT64 elementArea = 0;
+		for (auto& element : elements)
+		{
+			element.input.width = sizeDist(rng);
+			element.input.height = sizeDist(rng);
+
+			elementArea += element.input.width * element.input.height;
+		}
+
+		// Layout gets recalculated from scratch each iteration, so the same element list can be reused
+		Vector<TextureAtlasUtility::Page> pages;
+		Timer timer;
+		for (UINT32 i = 0; i < scale; i++)
+			pages = TextureAtlasUtility::createAtlasLayout(elements, 64, 64, benchCase.maxPageSize, 
+				benchCase.maxPageSize, true);
+
+		double timeMs = timer.getMicroseconds() / (1000.0 * scale);
+
+		UINT64 pageArea = 0;
+		for (auto& page : pages)
+			pageArea += page.width * page.height;
+
+		// Validate the layout of each page
+		Vector<Vector<AtlasRect>> pageRects(pages.size());
+		UINT32 numUnplaced = 0;
+		for (auto& element : elements)
+		{
+			if (element.output.page < 0 || element.output.page >= (INT32)pages.size())
+			{
+				numUnplaced++;
+				continue;
+			}
+
+			pageRects[element.output.page].push_back(
+				{ element.output.x, element.output.y, element.input.width, element.input.height });
+		}
+
+		UINT32 numInvalid = numUnplaced;
+		for (size_t i = 0; i < pages.size(); i++)
+			numInvalid += countInvalidRects(pageRects[i], pages[i].width, pages[i].height);
+
+		printf("  %-28s %6u %8u %11.1f%% %12.3f %8u\n", benchCase.name, benchCase.numElements, (UINT32)pages.size(),
+			pageArea > 0 ? (elementArea * 100.0 / pageArea) : 0.0, timeMs, numInvalid);
+
+		return numInvalid == 0;
+	}
+
+	/** 
+	 * Adds and removes randomly sized elements to a single TextureAtlasLayout, similar to how a dynamic font atlas gets
+	 * used, and prints the results.
+	 */
+	bool runIncrementalAtlasCase(UINT32 scale, std::mt19937& rng)
+	{
+		static constexpr UINT32 ATLAS_SIZE = 1024;
+		static constexpr UINT32 NUM_OPERATIONS = 3000;
+
+		std::uniform_int_distribution<UINT32> sizeDist(4, 40);
+
+		TextureAtlasLayout layout(0, 0, ATLAS_SIZE, ATLAS_SIZE, false);
+		Vector<AtlasRect> rects;
+
+		UINT32 numOperations = NUM_OPERATIONS * scale;
+		UINT32 numFailed = 0;
+
+		Timer timer;
+		for (UINT32 i = 0; i < numOperations; i++)
+		{
+			AtlasRect rect;
+			rect.width = sizeDist(rng);
+			rect.height = sizeDist(rng);
+
+			if (layout.addElement(rect.width, rect.height, rect.x, rect.y))
+				rects.push_back(rect);
+			else
+				numFailed++;
+
+			// Remove an element every few additions, so the free area gets fragmented
+			if ((i % 3) == 0 && !rects.empty())
+			{
+				size_t removeIdx = rng() % rects.size();
+
+				const AtlasRect& removed = rects[removeIdx];
+				layout.removeElement(removed.x, removed.y, removed.width, removed.height);
+
+				rects.erase(rects.begin() + removeIdx);
+			}
+		}
+
+		double timeUs = timer.getMicroseconds() / (double)numOperations;
+
+		UINT64 elementArea = 0;
+		for (auto& rect : rects)
+			elementArea += rect.width * rect.height;
+
+		UINT32 numInvalid = countInvalidRects(rects, ATLAS_SIZE, ATLAS_SIZE);
+
+		printf("\nIncremental add/remove (%ux%u max):\n", ATLAS_SIZE, ATLAS_SIZE);
+		printf("  %-28s %12u\n", "Operations", numOperations);
+		printf("  %-28s %12u\n", "Failed additions", numFailed);
+		printf("  %-28s %12u\n", "Live elements", (UINT32)rects.size());
+		printf("  %-28s %11.1f%%\n", "Area used", 
+			elementArea * 100.0 / (layout.getWidth() * (UINT64)layout.getHeight()));
+		printf("  %-28s %12.3f\n", "Time per operation (us)", timeUs);
+		printf("  %-28s %12u\n", "Overlaps/out of bounds", numInvalid);
+
+		return numInvalid == 0;
+	}
+
+	bool runAtlasBenchmark(const MicroBenchmarkOptions& options)
+	{
+		static const AtlasBenchmarkCase CASES[] =
+		{
+			{ "Glyphs (8-24px)", 2000, 8, 24, 1024 },
+			{ "Glyphs (8-32px)", 20000, 8, 32, 2048 },
+			{ "Sprites (16-128px)", 1000, 16, 128, 2048 },
+			{ "Sprites (16-256px)", 5000, 16, 256, 2048 },
+		};
+
+		std::mt19937 rng(options.seed);
+
+		printf("Texture atlas packing (power of two pages):\n");
+		printf("  %-28s %6s %8s %12s %12s %8s\n", "Case", "Count", "Pages", "Area used", "Time (ms)", "Invalid");
+
+		bool success = true;
+		for (auto& entry : CASES)
+			success &= runAtlasLayoutCase(entry, options.scale, rng);
+
+		success &= runIncrementalAtlasCase(options.scale, rng);
+
+		printf("\n");
+		return success;
+	}
+}
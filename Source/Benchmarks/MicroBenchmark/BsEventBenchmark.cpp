@@ -0,0 +1,265 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMicroBenchmark.h"
+#include "Utility/BsEvent.h"
+#include "Utility/BsTimer.h"
+
+#include <cstdio>
+
+namespace bs
+{
+	/**
+	 * Event implementation used before events were reworked, kept as a baseline for comparison. Connections are kept in
+	 * a linked list (disconnected entries are pooled for reuse), callbacks are stored as std::function, and a single
+	 * recursive mutex is held while connecting, disconnecting and for the entire duration of the trigger.
+	 */
+	template <class... Args>
+	class LegacyEvent
+	{
+		struct Connection
+		{
+			Connection* prev = nullptr;
+			Connection* next = nullptr;
+			std::function<void(Args...)> func;
+		};
+
+		struct InternalData
+		{
+			~InternalData()
+			{
+				for (Connection* list : { connections, freeConnections })
+				{
+					while (list != nullptr)
+					{
+						Connection* next = list->next;
+						bs_delete(list);
+						list = next;
+					}
+				}
+			}
+
+			Connection* connections = nullptr;
+			Connection* lastConnection = nullptr;
+			Connection* freeConnections = nullptr;
+			RecursiveMutex mutex;
+			bool isCurrentlyTriggering = false;
+		};
+
+	public:
+		/** Handle to a connection, allowing it to be disconnected. */
+		class Handle
+		{
+		public:
+			Handle(const SPtr<InternalData>& data, Connection* connection)
+				:mData(data), mConnection(connection)
+			{ }
+
+			/** Disconnects the callback, and moves the connection to the pool of free connections. */
+			void disconnect()
+			{
+				if (mConnection == nullptr)
+					return;
+
+				RecursiveLock lock(mData->mutex);
+				mConnection->func = nullptr;
+
+				if (mConnection->prev != nullptr)
+					mConnection->prev->next = mConnection->next;
+				else
+					mData->connections = mConnection->next;
+
+				if (mConnection->next != nullptr)
+					mConnection->next->prev = mConnection->prev;
+				else
+					mData->lastConnection = mConnection->prev;
+
+				mConnection->prev = nullptr;
+				mConnection->next = mData->freeConnections;
+				mData->freeConnections = mConnection;
+
+				mConnection = nullptr;
+			}
+
+		private:
+			SPtr<InternalData> mData;
+			Connection* mConnection;
+		};
+
+		LegacyEvent()
+			:mData(bs_shared_ptr_new<InternalData>())
+		{ }
+
+		/** Registers a new callback, reusing a pooled connection if available. */
+		Handle connect(std::function<void(Args...)> func)
+		{
+			RecursiveLock lock(mData->mutex);
+
+			Connection* conn = mData->freeConnections;
+			if (conn != nullptr)
+				mData->freeConnections = conn->next;
+			else
+				conn = bs_new<Connection>();
+
+			conn->prev = mData->lastConnection;
+			conn->next = nullptr;
+			conn->func = std::move(func);
+
+			if (mData->lastConnection != nullptr)
+				mData->lastConnection->next = conn;
+			else
+				mData->connections = conn;
+
+			mData->lastConnection = conn;
+			return Handle(mData, conn);
+		}
+
+		/** Calls all connected callbacks while holding the event mutex. */
+		void operator() (Args... args)
+		{
+			SPtr<InternalData> data = mData;
+
+			RecursiveLock lock(data->mutex);
+			data->isCurrentlyTriggering = true;
+
+			Connection* conn = data->connections;
+			while (conn != nullptr)
+			{
+				Connection* next = conn->next;
+
+				if (conn->func != nullptr)
+					conn->func(std::forward<Args>(args)...);
+
+				conn = next;
+			}
+
+			data->isCurrentlyTriggering = false;
+		}
+
+	private:
+		SPtr<InternalData> mData;
+	};
+
+	/** Object whose method is connected to the benchmarked events. */
+	struct EventReceiver
+	{
+		void onEvent(UINT32 value) { sum += value; }
+
+		volatile UINT32 sum = 0;
+	};
+
+	/** Returns the average time in nanoseconds it takes to trigger the event. */
+	template<class EventType>
+	double measureEventTrigger(EventType& event, UINT32 numIterations)
+	{
+		Timer timer;
+		for (UINT32 i = 0; i < numIterations; i++)
+			event(i);
+
+		return timer.getMicroseconds() * 1000.0 / numIterations;
+	}
+
+	/**
+	 * Returns the average time in nanoseconds it takes to trigger the event, while the same event is being triggered
+	 * from the provided number of threads at once.
+	 */
+	template<class EventType>
+	double measureEventTriggerThreaded(EventType& event, UINT32 numIterations, UINT32 numThreads)
+	{
+		Vector<Thread> threads;
+		std::atomic<bool> start { false };
+		std::atomic<UINT64> totalTime { 0 };
+
+		for (UINT32 i = 0; i < numThreads; i++)
+		{
+			threads.push_back(Thread([&]()
+			{
+				while (!start)
+					std::this_thread::yield();
+
+				totalTime += (UINT64)(measureEventTrigger(event, numIterations) * 1000.0);
+			}));
+		}
+
+		start = true;
+		for (auto& thread : threads)
+			thread.join();
+
+		return totalTime / (numThreads * 1000.0);
+	}
+
+	/** Returns the average time in nanoseconds it takes to connect to and disconnect from an event with no connections. */
+	template<class EventType>
+	double measureEventConnect(UINT32 numIterations)
+	{
+		EventReceiver receiver;
+		EventType event;
+
+		Timer timer;
+		for (UINT32 i = 0; i < numIterations; i++)
+		{
+			auto handle = event.connect(std::bind(&EventReceiver::onEvent, &receiver, std::placeholders::_1));
+			handle.disconnect();
+		}
+
+		return timer.getMicroseconds() * 1000.0 / numIterations;
+	}
+
+	/**
+	 * Measures and prints out triggering and connection costs of the provided event type. Threaded triggering is only
+	 * measured if @p numThreads is not zero.
+	 */
+	template<class EventType>
+	void measureEvent(const char* name, UINT32 numIterations, UINT32 numThreads)
+	{
+		static constexpr UINT32 NUM_RECEIVERS = 8;
+
+		EventReceiver receivers[NUM_RECEIVERS];
+		EventType emptyEvent;
+		EventType singleEvent;
+		EventType multiEvent;
+
+		singleEvent.connect(std::bind(&EventReceiver::onEvent, &receivers[0], std::placeholders::_1));
+		for (auto& entry : receivers)
+			multiEvent.connect(std::bind(&EventReceiver::onEvent, &entry, std::placeholders::_1));
+
+		double emptyTime = measureEventTrigger(emptyEvent, numIterations);
+		double singleTime = measureEventTrigger(singleEvent, numIterations);
+		double multiTime = measureEventTrigger(multiEvent, numIterations);
+
+		// Only measured for events that can be triggered from multiple threads
+		char threadedTime[32] = "-";
+		if (numThreads > 0)
+		{
+			snprintf(threadedTime, sizeof(threadedTime), "%.1f",
+				measureEventTriggerThreaded(multiEvent, numIterations / numThreads, numThreads));
+		}
+
+		double connectTime = measureEventConnect<EventType>(numIterations / 10);
+
+		printf("  %-16s %12.1f %12.1f %12.1f %20s %16.1f\n", name, emptyTime, singleTime, multiTime, threadedTime,
+			connectTime);
+	}
+
+	bool runEventBenchmark(const MicroBenchmarkOptions& options)
+	{
+		UINT32 numIterations = 2000000 * options.scale;
+
+		UINT32 numThreads = std::max(BS_THREAD_HARDWARE_CONCURRENCY, 2U);
+
+		// Standard library skips atomic operations in mutexes and shared pointers until the process starts its first
+		// thread. Engine always runs multiple threads, so make sure the single-threaded measurements reflect that.
+		Thread([]() { }).join();
+
+		printf("Events (ns per operation, callbacks are bound member functions, %u threads for threaded triggers):\n",
+			numThreads);
+		printf("  %-16s %12s %12s %12s %20s %16s\n", "Type", "Trigger (0)", "Trigger (1)", "Trigger (8)",
+			"Trigger (8, threads)", "Connect+discon.");
+
+		measureEvent<LegacyEvent<UINT32>>("Event (legacy)", numIterations, numThreads);
+		measureEvent<Event<void(UINT32)>>("Event", numIterations, numThreads);
+		measureEvent<UnsyncEvent<void(UINT32)>>("UnsyncEvent", numIterations, 0);
+
+		printf("\n");
+		return true;
+	}
+}
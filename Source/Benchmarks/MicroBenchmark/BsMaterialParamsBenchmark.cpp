@@ -0,0 +1,174 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMicroBenchmark.h"
+#include "Material/BsMaterialParams.h"
+#include "Material/BsMaterialParamHandle.h"
+#include "Material/BsShader.h"
+#include "Utility/BsTimer.h"
+
+#include <cstdio>
+
+namespace bs
+{
+	/**
+	 * Material parameters with a layout built directly from a set of parameter descriptions, without requiring a shader
+	 * (and therefore the core thread and resources). Objects created with the same layout ID are treated as if they
+	 * were created from the same shader.
+	 */
+	class BenchmarkMaterialParams : public MaterialParamsBase
+	{
+	public:
+		BenchmarkMaterialParams(const Map<String, SHADER_DATA_PARAM_DESC>& dataParams,
+			const Map<String, SHADER_OBJECT_PARAM_DESC>& textureParams, UINT32 layoutId)
+			:MaterialParamsBase(dataParams, textureParams, {}, {})
+		{
+			mLayoutId = layoutId;
+		}
+	};
+
+	/** Parameters of the default shader used by the renderer, and of the shaders derived from it. */
+	static const char* DATA_PARAM_NAMES[] = { "gTiling", "gOffset", "gEmissiveColor", "gRoughness", "gMetalness" };
+	static const GpuParamDataType DATA_PARAM_TYPES[] = { GPDT_FLOAT2, GPDT_FLOAT2, GPDT_FLOAT4, GPDT_FLOAT1, GPDT_FLOAT1 };
+	static const char* TEXTURE_PARAM_NAMES[] =
+		{ "gAlbedoTex", "gNormalTex", "gRoughnessTex", "gMetalnessTex", "gEmissiveMaskTex" };
+
+	/**
+	 * Creates a set of parameter objects sharing the same layout. If @p extraParam is provided it is added to the
+	 * layout, so that parameter indices differ from a layout without it.
+	 */
+	Vector<SPtr<BenchmarkMaterialParams>> createMaterialParams(UINT32 count, UINT32 layoutId, const char* extraParam)
+	{
+		Map<String, SHADER_DATA_PARAM_DESC> dataParams;
+		for (UINT32 i = 0; i < sizeof(DATA_PARAM_NAMES) / sizeof(DATA_PARAM_NAMES[0]); i++)
+		{
+			SHADER_DATA_PARAM_DESC desc;
+			desc.name = DATA_PARAM_NAMES[i];
+			desc.gpuVariableName = DATA_PARAM_NAMES[i];
+			desc.type = DATA_PARAM_TYPES[i];
+			desc.arraySize = 1;
+			desc.elementSize = 0;
+			desc.defaultValueIdx = (UINT32)-1;
+
+			dataParams[desc.name] = desc;
+		}
+
+		if (extraParam != nullptr)
+		{
+			SHADER_DATA_PARAM_DESC desc = dataParams["gRoughness"];
+			desc.name = extraParam;
+			desc.gpuVariableName = extraParam;
+
+			dataParams[desc.name] = desc;
+		}
+
+		Map<String, SHADER_OBJECT_PARAM_DESC> textureParams;
+		for (auto& name : TEXTURE_PARAM_NAMES)
+		{
+			SHADER_OBJECT_PARAM_DESC desc;
+			desc.name = name;
+			desc.gpuVariableNames.push_back(name);
+			desc.type = GPOT_TEXTURE2D;
+			desc.defaultValueIdx = (UINT32)-1;
+
+			textureParams[desc.name] = desc;
+		}
+
+		Vector<SPtr<BenchmarkMaterialParams>> output;
+		for (UINT32 i = 0; i < count; i++)
+			output.push_back(bs_shared_ptr_new<BenchmarkMaterialParams>(dataParams, textureParams, layoutId));
+
+		return output;
+	}
+
+	/**
+	 * Assigns the roughness parameter on the provided parameter objects in a round-robin fashion, either by name (the
+	 * same way Material::setFloat(const String&, ...) does), or through a single handle. Returns the average time per
+	 * assignment, in nanoseconds.
+	 */
+	double measureMaterialParams(const Vector<SPtr<BenchmarkMaterialParams>>& params, bool byHandle, UINT32 numSets,
+		bool& valid)
+	{
+		static const String PARAM_NAME = "gRoughness";
+		MaterialFloatParamHandle handle(BS_SID("gRoughness"));
+
+		UINT32 numParams = (UINT32)params.size();
+		Timer timer;
+
+		for (UINT32 i = 0; i < numSets; i++)
+		{
+			const MaterialParamsBase& target = *params[i % numParams];
+
+			UINT32 paramIdx;
+			if (byHandle)
+				paramIdx = handle.resolve(target);
+			else
+				paramIdx = MaterialFloatParamHandle(PARAM_NAME).resolve(target);
+
+			if (paramIdx == (UINT32)-1)
+			{
+				valid = false;
+				return 0.0;
+			}
+
+			target.setDataParam(*target.getParamData(paramIdx), 0, (float)i);
+		}
+
+		double elapsed = timer.getMicroseconds() * 1000.0 / numSets;
+
+		// Validate the last value assigned to each object made it to the right parameter
+		for (UINT32 i = 0; i < std::min(numParams, numSets); i++)
+		{
+			const MaterialParamsBase& target = *params[(numSets - 1 - i) % numParams];
+
+			UINT32 paramIdx = target.getParamIndex(BS_SID("gRoughness"));
+			if (paramIdx == (UINT32)-1)
+			{
+				valid = false;
+				break;
+			}
+
+			float value = 0.0f;
+			target.getDataParam(*target.getParamData(paramIdx), 0, value);
+
+			valid &= value == (float)(numSets - 1 - i);
+		}
+
+		return elapsed;
+	}
+
+	bool runMaterialParamsBenchmark(const MicroBenchmarkOptions& options)
+	{
+		static constexpr UINT32 MATERIAL_COUNTS[] = { 1, 64, 1024 };
+		UINT32 numSets = 1000000 * options.scale;
+
+		printf("Material parameter assignment (%u sets, ns per set):\n", numSets);
+		printf("  %-24s %12s %12s\n", "Materials", "By name", "By handle");
+
+		bool valid = true;
+		for (auto numMaterials : MATERIAL_COUNTS)
+		{
+			Vector<SPtr<BenchmarkMaterialParams>> params = createMaterialParams(numMaterials, 1, nullptr);
+
+			double byName = measureMaterialParams(params, false, numSets, valid);
+			double byHandle = measureMaterialParams(params, true, numSets, valid);
+
+			printf("  %-24u %12.1f %12.1f\n", numMaterials, byName, byHandle);
+		}
+
+		// Worst case for the handle, every assignment alternates between shaders with different layouts
+		Vector<SPtr<BenchmarkMaterialParams>> params = createMaterialParams(1, 1, nullptr);
+		Vector<SPtr<BenchmarkMaterialParams>> otherParams = createMaterialParams(1, 2, "gAnisotropy");
+		params.push_back(otherParams[0]);
+
+		double byName = measureMaterialParams(params, false, numSets, valid);
+		double byHandle = measureMaterialParams(params, true, numSets, valid);
+
+		printf("  %-24s %12.1f %12.1f\n", "2 (alternating shaders)", byName, byHandle);
+
+		if (!valid)
+			printf("  Error: Parameter values don't match the assigned values.\n");
+
+		printf("\n");
+		return valid;
+	}
+}
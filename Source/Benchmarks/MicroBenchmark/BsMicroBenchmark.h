@@ -0,0 +1,64 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** Options shared by all the micro-benchmarks, parsed from the command line. */
+	struct MicroBenchmarkOptions
+	{
+		/** Multiplier applied to the default number of iterations of each benchmark. */
+		UINT32 scale = 1;
+
+		/** Seed used for generating random benchmark inputs. Same seed always results in the same inputs. */
+		UINT32 seed = 1234;
+	};
+
+	/** 
+	 * Measures packing efficiency and throughput of TextureAtlasUtility::createAtlasLayout() over sets of randomly sized
+	 * elements resembling font glyphs and sprites, as well as incremental addition and removal of elements through
+	 * TextureAtlasLayout. Validates that no placed elements overlap.
+	 *
+	 * @return	False if the benchmark detected invalid results.
+	 */
+	bool runAtlasBenchmark(const MicroBenchmarkOptions& options);
+
+	/** 
+	 * Measures the time it takes to convert rows of pixels between every pair from a set of common uncompressed 
+	 * formats that has a specialized conversion kernel, compared to the generic per-pixel conversion. Validates that
+	 * both produce identical output.
+	 *
+	 * @return	False if the benchmark detected invalid results.
+	 */
+	bool runPixelConversionBenchmark(const MicroBenchmarkOptions& options);
+
+	/** 
+	 * Measures the cost of triggering synchronized and unsynchronized events with different numbers of connections,
+	 * including a synchronized event triggered from multiple threads at once, as well as the cost of connecting to and
+	 * disconnecting from an event. The previous synchronized event implementation is measured as a baseline.
+	 *
+	 * @return	False if the benchmark detected invalid results.
+	 */
+	bool runEventBenchmark(const MicroBenchmarkOptions& options);
+
+	/** 
+	 * Measures the cost of writing and uploading per-object parameter blocks through a ParamBlockRing, with every slice
+	 * backed by its own buffer compared to slices being views of a single per-page buffer. Uses buffers that emulate GPU
+	 * memory with a CPU allocation, so driver overhead of individual uploads isn't included. Validates the uploaded data.
+	 *
+	 * @return	False if the benchmark detected invalid results.
+	 */
+	bool runParamBlockRingBenchmark(const MicroBenchmarkOptions& options);
+
+	/** 
+	 * Measures the cost of assigning a material parameter by name, compared to assigning it through a 
+	 * MaterialParamHandle, on sets of materials sharing the same shader as well as on materials alternating between
+	 * different shaders. Uses parameter objects built directly from parameter descriptions, so no shader compilation
+	 * or core thread is required. Validates the assigned values.
+	 *
+	 * @return	False if the benchmark detected invalid results.
+	 */
+	bool runMaterialParamsBenchmark(const MicroBenchmarkOptions& options);
+}
@@ -0,0 +1,171 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMicroBenchmark.h"
+#include "Renderer/BsParamBlockRing.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "Managers/BsHardwareBufferManager.h"
+#include "Utility/BsTimer.h"
+
+#include <cstdio>
+
+namespace bs
+{
+	namespace ct
+	{
+		/**
+		 * Parameter block buffer whose GPU memory is emulated by a separate CPU allocation, same as in the null render
+		 * API. Counts the number of uploads.
+		 */
+		class BenchmarkParamBlockBuffer : public GpuParamBlockBuffer
+		{
+		public:
+			BenchmarkParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
+				:GpuParamBlockBuffer(size, usage, deviceMask)
+			{
+				mGPUData = (UINT8*)bs_alloc(size);
+			}
+
+			~BenchmarkParamBlockBuffer()
+			{
+				bs_free(mGPUData);
+			}
+
+			void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override
+			{
+				memcpy(mGPUData, data, mSize);
+				NumUploads++;
+			}
+
+			/** Checks if the emulated GPU memory matches the provided data. */
+			bool compare(UINT32 offset, const UINT8* data, UINT32 size) const
+			{
+				return memcmp(mGPUData + offset, data, size) == 0;
+			}
+
+			static UINT32 NumUploads;
+
+		private:
+			UINT8* mGPUData;
+		};
+
+		UINT32 BenchmarkParamBlockBuffer::NumUploads = 0;
+
+		/** Hardware buffer manager only capable of creating benchmark parameter block buffers. */
+		class BenchmarkHardwareBufferManager : public HardwareBufferManager
+		{
+		protected:
+			SPtr<VertexBuffer> createVertexBufferInternal(const VERTEX_BUFFER_DESC& desc,
+				GpuDeviceFlags deviceMask = GDF_DEFAULT) override { return nullptr; }
+
+			SPtr<IndexBuffer> createIndexBufferInternal(const INDEX_BUFFER_DESC& desc,
+				GpuDeviceFlags deviceMask = GDF_DEFAULT) override { return nullptr; }
+
+			SPtr<GpuParamBlockBuffer> createGpuParamBlockBufferInternal(UINT32 size,
+				GpuParamBlockUsage usage = GPBU_DYNAMIC, GpuDeviceFlags deviceMask = GDF_DEFAULT) override
+			{
+				BenchmarkParamBlockBuffer* buffer =
+					new (bs_alloc<BenchmarkParamBlockBuffer>()) BenchmarkParamBlockBuffer(size, usage, deviceMask);
+
+				SPtr<GpuParamBlockBuffer> bufferPtr = bs_shared_ptr<BenchmarkParamBlockBuffer>(buffer);
+				bufferPtr->_setThisPtr(bufferPtr);
+
+				return bufferPtr;
+			}
+
+			SPtr<GpuBuffer> createGpuBufferInternal(const GPU_BUFFER_DESC& desc,
+				GpuDeviceFlags deviceMask = GDF_DEFAULT) override { return nullptr; }
+		};
+	}
+
+	/** Size of the per-object parameter block used by the renderer (four matrices and a float). */
+	static constexpr UINT32 PER_OBJECT_BLOCK_SIZE = 4 * 64 + 4;
+
+	/**
+	 * Writes and uploads the provided number of blocks through a ring, the same way the renderer uploads per-object data
+	 * every frame. Returns the average time per frame, in microseconds, and outputs the number of uploads per frame.
+	 */
+	double measureParamBlockRing(bool useViews, UINT32 numBlocks, UINT32 numFrames, UINT32& uploadsPerFrame,
+		bool& valid)
+	{
+		ct::ParamBlockRing ring(PER_OBJECT_BLOCK_SIZE, 256, useViews);
+
+		UINT8 source[PER_OBJECT_BLOCK_SIZE];
+		Vector<const SPtr<ct::GpuParamBlockBuffer>*> buffers(numBlocks);
+
+		UINT32 numUploads = 0;
+		Timer timer;
+
+		// First frame is a warm up, so that all buffers are allocated before timing starts
+		for (UINT32 frame = 0; frame <= numFrames; frame++)
+		{
+			if (frame == 1)
+			{
+				numUploads = ct::BenchmarkParamBlockBuffer::NumUploads;
+				timer.reset();
+			}
+
+			ring.reset();
+			for (UINT32 i = 0; i < numBlocks; i++)
+			{
+				ct::ParamBlockRing::Slice slice = ring.allocate();
+
+				memset(source, (UINT8)(i + frame), sizeof(source));
+				memcpy(slice.data, source, sizeof(source));
+
+				buffers[i] = slice.buffer;
+			}
+
+			ring.flush();
+		}
+
+		double elapsed = timer.getMicroseconds() / (double)numFrames;
+		uploadsPerFrame = (ct::BenchmarkParamBlockBuffer::NumUploads - numUploads) / numFrames;
+
+		// Validate the last frame made it to the emulated GPU memory, at the offset the slice is bound at
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			const SPtr<ct::GpuParamBlockBuffer>& buffer = *buffers[i];
+			const SPtr<ct::GpuParamBlockBuffer>& parent = buffer->getParent();
+
+			auto gpuBuffer = static_cast<const ct::BenchmarkParamBlockBuffer*>(
+				parent != nullptr ? parent.get() : buffer.get());
+
+			memset(source, (UINT8)(i + numFrames), sizeof(source));
+			valid &= gpuBuffer->compare(buffer->getOffset(), source, sizeof(source));
+		}
+
+		return elapsed;
+	}
+
+	bool runParamBlockRingBenchmark(const MicroBenchmarkOptions& options)
+	{
+		static constexpr UINT32 BLOCK_COUNTS[] = { 256, 1024, 4096, 16384 };
+		UINT32 numFrames = 100 * options.scale;
+
+		ct::HardwareBufferManager::startUp<ct::BenchmarkHardwareBufferManager>();
+
+		printf("Parameter block ring (per-object blocks of %u bytes, us per frame, uploads per frame):\n",
+			PER_OBJECT_BLOCK_SIZE);
+		printf("  %-10s %16s %10s %16s %10s\n", "Blocks", "Buffer per slice", "Uploads", "Views", "Uploads");
+
+		bool valid = true;
+		for (auto numBlocks : BLOCK_COUNTS)
+		{
+			UINT32 sliceUploads = 0;
+			UINT32 viewUploads = 0;
+
+			double sliceTime = measureParamBlockRing(false, numBlocks, numFrames, sliceUploads, valid);
+			double viewTime = measureParamBlockRing(true, numBlocks, numFrames, viewUploads, valid);
+
+			printf("  %-10u %16.1f %10u %16.1f %10u\n", numBlocks, sliceTime, sliceUploads, viewTime, viewUploads);
+		}
+
+		ct::HardwareBufferManager::shutDown();
+
+		if (!valid)
+			printf("  Error: Uploaded data doesn't match the written data.\n");
+
+		printf("\n");
+		return valid;
+	}
+}
@@ -0,0 +1,120 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMicroBenchmark.h"
+#include "Image/BsPixelUtil.h"
+#include "Utility/BsBitwise.h"
+#include "Utility/BsTimer.h"
+
+#include <cstdio>
+#include <random>
+
+namespace bs
+{
+	/** Fills the buffer with random pixels of the provided format. */
+	void fillBenchmarkPixels(PixelFormat format, UINT8* data, UINT32 numPixels, std::mt19937& rng)
+	{
+		UINT32 pixelSize = PixelUtil::getNumElemBytes(format);
+		PixelComponentType componentType = PixelUtil::getElementType(format);
+		bool isFloat = PixelUtil::isFloatingPoint(format);
+
+		std::uniform_real_distribution<float> floatDist(0.0f, 1.0f);
+		for (UINT32 i = 0; i < numPixels; i++)
+		{
+			UINT8* pixel = data + i * pixelSize;
+
+			if (isFloat && componentType == PCT_FLOAT32)
+			{
+				for (UINT32 j = 0; j < pixelSize / sizeof(float); j++)
+				{
+					float value = floatDist(rng);
+					memcpy(pixel + j * sizeof(float), &value, sizeof(value));
+				}
+			}
+			else if (isFloat && componentType == PCT_FLOAT16)
+			{
+				for (UINT32 j = 0; j < pixelSize / sizeof(UINT16); j++)
+				{
+					UINT16 value = Bitwise::floatToHalf(floatDist(rng));
+					memcpy(pixel + j * sizeof(UINT16), &value, sizeof(value));
+				}
+			}
+			else
+			{
+				for (UINT32 j = 0; j < pixelSize; j++)
+					pixel[j] = (UINT8)rng();
+			}
+		}
+	}
+
+	/** Returns the average time in milliseconds it takes to convert a row of pixels, over the provided iterations. */
+	double measurePixelConversion(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, 
+		UINT32 numPixels, UINT32 numIterations, bool generic)
+	{
+		Timer timer;
+		for (UINT32 i = 0; i < numIterations; i++)
+			PixelUtil::_convertPixelRow(src, srcFormat, dst, dstFormat, numPixels, generic);
+
+		return timer.getMicroseconds() / (1000.0 * numIterations);
+	}
+
+	bool runPixelConversionBenchmark(const MicroBenchmarkOptions& options)
+	{
+		static const PixelFormat FORMATS[] = { PF_R8, PF_RG8, PF_RGB8, PF_BGR8, PF_BGRA8, PF_RGBA8, PF_R16F, PF_RG16F,
+			PF_RGBA16F, PF_R32F, PF_RG32F, PF_RGB32F, PF_RGBA32F, PF_RGBA16, PF_RG16, PF_RGBA16U, PF_R8U, PF_RGBA8S };
+
+		static constexpr UINT32 NUM_PIXELS = 256 * 1024;
+		static constexpr UINT32 MAX_PIXEL_SIZE = 16;
+
+		std::mt19937 rng(options.seed);
+
+		Vector<UINT8> src(NUM_PIXELS * MAX_PIXEL_SIZE);
+		Vector<UINT8> kernelOutput(NUM_PIXELS * MAX_PIXEL_SIZE);
+		Vector<UINT8> genericOutput(NUM_PIXELS * MAX_PIXEL_SIZE);
+
+		UINT32 numIterations = 4 * options.scale;
+		UINT32 numPairs = 0;
+		UINT32 numSpecialized = 0;
+		UINT32 numMismatched = 0;
+
+		printf("Pixel conversion (%u pixels per row, single thread):\n", NUM_PIXELS);
+		printf("  %-12s %-12s %14s %14s %9s\n", "Source", "Destination", "Generic (ms)", "Kernel (ms)", "Speed-up");
+
+		for (auto& srcFormat : FORMATS)
+		{
+			fillBenchmarkPixels(srcFormat, src.data(), NUM_PIXELS, rng);
+
+			for (auto& dstFormat : FORMATS)
+			{
+				if (srcFormat == dstFormat)
+					continue;
+
+				numPairs++;
+
+				// Pairs without a specialized kernel go through the generic path either way
+				if (!PixelUtil::_convertPixelRow(src.data(), srcFormat, kernelOutput.data(), dstFormat, NUM_PIXELS))
+					continue;
+
+				numSpecialized++;
+
+				double genericTime = measurePixelConversion(src.data(), srcFormat, genericOutput.data(), dstFormat, 
+					NUM_PIXELS, numIterations, true);
+				double kernelTime = measurePixelConversion(src.data(), srcFormat, kernelOutput.data(), dstFormat, 
+					NUM_PIXELS, numIterations, false);
+
+				UINT32 numBytes = NUM_PIXELS * PixelUtil::getNumElemBytes(dstFormat);
+				bool matches = memcmp(kernelOutput.data(), genericOutput.data(), numBytes) == 0;
+				if (!matches)
+					numMismatched++;
+
+				printf("  %-12s %-12s %14.3f %14.3f %8.1fx%s\n", PixelUtil::getFormatName(srcFormat).c_str(), 
+					PixelUtil::getFormatName(dstFormat).c_str(), genericTime, kernelTime, 
+					kernelTime > 0.0 ? (genericTime / kernelTime) : 0.0, matches ? "" : " MISMATCH");
+			}
+		}
+
+		printf("\n  %u format pairs, %u with a specialized kernel, %u mismatched.\n\n", numPairs, numSpecialized, 
+			numMismatched);
+
+		return numMismatched == 0;
+	}
+}
@@ -0,0 +1,20 @@
+set(BS_MICROBENCHMARK_INC_NOFILTER
+	"BsMicroBenchmark.h"
+)
+
+set(BS_MICROBENCHMARK_SRC_NOFILTER
+	"Main.cpp"
+	"BsAtlasBenchmark.cpp"
+	"BsPixelConversionBenchmark.cpp"
+	"BsEventBenchmark.cpp"
+	"BsParamBlockRingBenchmark.cpp"
+	"BsMaterialParamsBenchmark.cpp"
+)
+
+source_group("Header Files" FILES ${BS_MICROBENCHMARK_INC_NOFILTER})
+source_group("Source Files" FILES ${BS_MICROBENCHMARK_SRC_NOFILTER})
+
+set(BS_MICROBENCHMARK_SRC
+	${BS_MICROBENCHMARK_INC_NOFILTER}
+	${BS_MICROBENCHMARK_SRC_NOFILTER}
+)
@@ -0,0 +1,107 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMicroBenchmark.h"
+
+#include <cstdio>
+
+/**
+ * Runs benchmarks of low level engine systems that don't require the engine to be started up (and therefore need no
+ * window, GPU or display connection), and reports their timings and other relevant metrics.
+ *
+ * Usage: MicroBenchmark [--atlas] [--pixels] [--events] [--paramring] [--params] [--scale N] [--seed N]
+ *
+ * When no benchmark is selected explicitly, all of them are ran. --scale multiplies the number of iterations of each
+ * benchmark.
+ */
+
+using namespace bs;
+
+/** Main entry point into the benchmark. */
+int main(int argc, char* argv[])
+{
+	MicroBenchmarkOptions options;
+	bool atlas = false;
+	bool pixels = false;
+	bool events = false;
+	bool paramRing = false;
+	bool params = false;
+
+	bool validArgs = true;
+	for (int i = 1; i < argc; i++)
+	{
+		String arg = argv[i];
+
+		if (arg == "--atlas")
+		{
+			atlas = true;
+			continue;
+		}
+
+		if (arg == "--pixels")
+		{
+			pixels = true;
+			continue;
+		}
+
+		if (arg == "--events")
+		{
+			events = true;
+			continue;
+		}
+
+		if (arg == "--paramring")
+		{
+			paramRing = true;
+			continue;
+		}
+
+		if (arg == "--params")
+		{
+			params = true;
+			continue;
+		}
+
+		if ((i + 1) >= argc)
+		{
+			validArgs = false;
+			break;
+		}
+
+		UINT32 value = parseUINT32(argv[++i], 0);
+		if (arg == "--scale")
+			options.scale = std::max(value, 1U);
+		else if (arg == "--seed")
+			options.seed = value;
+		else
+		{
+			validArgs = false;
+			break;
+		}
+	}
+
+	if (!validArgs)
+	{
+		printf("Usage: MicroBenchmark [--atlas] [--pixels] [--events] [--paramring] [--params] [--scale N] [--seed N]\n");
+		return 1;
+	}
+
+	bool runAll = !atlas && !pixels && !events && !paramRing && !params;
+	bool success = true;
+
+	if (runAll || atlas)
+		success &= runAtlasBenchmark(options);
+
+	if (runAll || pixels)
+		success &= runPixelConversionBenchmark(options);
+
+	if (runAll || events)
+		success &= runEventBenchmark(options);
+
+	if (runAll || paramRing)
+		success &= runParamBlockRingBenchmark(options);
+
+	if (runAll || params)
+		success &= runMaterialParamsBenchmark(options);
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+set(BS_RENDERBEASTBENCHMARK_SRC_NOFILTER
+	"Main.cpp"
+)
+
+source_group("Source Files" FILES ${BS_RENDERBEASTBENCHMARK_SRC_NOFILTER})
+
+set(BS_RENDERBEASTBENCHMARK_SRC
+	${BS_RENDERBEASTBENCHMARK_SRC_NOFILTER}
+)
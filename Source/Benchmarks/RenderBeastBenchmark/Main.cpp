@@ -0,0 +1,491 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2017 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+// Engine includes
+#include "BsApplication.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Material/BsMaterial.h"
+#include "Material/BsShader.h"
+#include "Mesh/BsMesh.h"
+#include "Components/BsCCamera.h"
+#include "Components/BsCRenderable.h"
+#include "Components/BsCLight.h"
+#include "RenderAPI/BsRenderWindow.h"
+#include "RenderAPI/BsViewport.h"
+#include "Scene/BsSceneObject.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Profiling/BsProfilingManager.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Profiling/BsRenderStats.h"
+#include "Utility/BsDynLibManager.h"
+#include "Utility/BsDynLib.h"
+#include "Utility/BsTime.h"
+#include "Math/BsMath.h"
+#include "BsEngineConfig.h"
+
+// Null render API includes
+#include "BsNullCommandStats.h"
+
+#include <cstdio>
+
+/**
+ * Renders a synthetic scene through RenderBeast using the null render API, and reports per-phase CPU timings, along with
+ * the number of draw calls and state changes per frame. No GPU is required, but on Linux a display connection is still
+ * needed by the platform layer (a virtual framebuffer like Xvfb is sufficient).
+ *
+ * Usage: RenderBeastBenchmark [--objects N] [--lights N] [--materials N] [--frames N] [--warmup N] [--shadows] [--hash]
+ *			[--params N]
+ *
+ * When --params is provided, the benchmark additionally measures the cost of N material parameter assignments performed
+ * by name, and through a cached parameter handle.
+ */
+
+namespace bs
+{
+	/** Options controlling the benchmark, parsed from the command line. */
+	struct BenchmarkOptions
+	{
+		UINT32 numObjects = 1000;
+		UINT32 numLights = 16;
+		UINT32 numMaterials = 8;
+		UINT32 numFrames = 300;
+		UINT32 numWarmupFrames = 30;
+		bool shadows = false;
+		bool hashing = false;
+		UINT32 numParamSets = 0;
+	};
+
+	/** Accumulated timings of a single profiler sample across all measured frames. */
+	struct PhaseTiming
+	{
+		double totalTimeMs = 0.0;
+		UINT64 numCalls = 0;
+	};
+
+	/** Results gathered on the core thread, over all the measured frames. */
+	struct CoreThreadResults
+	{
+		RenderStatsData renderStats;
+		ct::NullCommandStats commandStats;
+	};
+
+	BenchmarkOptions gOptions;
+
+	/** Application that builds the benchmark scene on start-up and records statistics as the frames are rendered. */
+	class BenchmarkApplication : public Application
+	{
+	public:
+		BenchmarkApplication(const START_UP_DESC& desc)
+			:Application(desc)
+		{ }
+
+		/** Outputs the gathered results to the standard output. Must be called after the main loop finishes. */
+		void printResults() const;
+
+	protected:
+		/** @copydoc Application::onStartUp */
+		void onStartUp() override;
+
+		/** @copydoc Application::postUpdate */
+		void postUpdate() override;
+
+	private:
+		/** Populates the scene with a camera, a grid of renderable objects and a set of lights. */
+		void setUpScene();
+
+		/** Measures the cost of assigning material parameters by name and by handle, on the provided materials. */
+		void measureMaterialParams(const Vector<HMaterial>& materials);
+
+		/** Starts measuring command statistics on the core thread. */
+		void beginMeasurement();
+
+		/** Stops measuring command statistics on the core thread and stores them in mCoreResults. */
+		void endMeasurement();
+
+		/** Adds timings of all the samples in the provided profiler entry hierarchy to the provided set of timings. */
+		static void accumulateTimings(const CPUProfilerBasicSamplingEntry& entry, Map<String, PhaseTiming>& timings);
+
+		/** Prints average per-frame timings for all the provided samples. */
+		void printTimings(const char* threadName, const Map<String, PhaseTiming>& timings) const;
+
+		UINT32 mFrameIdx = 0;
+		UINT32 mNumMeasuredFrames = 0;
+		UINT64 mMeasureStartTime = 0;
+		UINT64 mMeasureEndTime = 0;
+
+		UINT64 mParamsByNameTime = 0;
+		UINT64 mParamsByHandleTime = 0;
+
+		Map<String, PhaseTiming> mSimTimings;
+		Map<String, PhaseTiming> mCoreTimings;
+
+		// Accessed from the core thread only, until the main loop finishes
+		RenderStatsData mStartRenderStats;
+		CoreThreadResults mCoreResults;
+
+		ct::GetNullCommandStatsFunc mGetCommandStats = nullptr;
+		ct::ResetNullCommandStatsFunc mResetCommandStats = nullptr;
+	};
+
+	void BenchmarkApplication::onStartUp()
+	{
+		Application::onStartUp();
+
+		// Render as fast as possible, we want to measure the frame cost, not the frame limiter
+		setFPSLimit(0);
+
+		// The plugin is already loaded by now, so this just retrieves it
+		DynLib* renderAPILib = gDynLibManager().load(mStartUpDesc.renderAPI);
+		if (renderAPILib != nullptr)
+		{
+			mGetCommandStats = (ct::GetNullCommandStatsFunc)renderAPILib->getSymbol("getNullCommandStats");
+			mResetCommandStats = (ct::ResetNullCommandStatsFunc)renderAPILib->getSymbol("resetNullCommandStats");
+
+			ct::SetNullCommandHashingFunc setHashing =
+				(ct::SetNullCommandHashingFunc)renderAPILib->getSymbol("setNullCommandHashing");
+
+			if (setHashing != nullptr)
+			{
+				bool hashing = gOptions.hashing;
+				gCoreThread().queueCommand([setHashing, hashing]() { setHashing(hashing); });
+			}
+		}
+
+		if (mGetCommandStats == nullptr || mResetCommandStats == nullptr)
+			LOGWRN("Render API doesn't provide command statistics. Make sure the null render API is used.");
+
+		setUpScene();
+	}
+
+	void BenchmarkApplication::postUpdate()
+	{
+		Application::postUpdate();
+
+		// Note: Core thread reports lag one frame behind, which doesn't matter when looking at averages
+		if (mFrameIdx > gOptions.numWarmupFrames)
+		{
+			accumulateTimings(gProfiler().getReport(ProfiledThread::Sim).cpuReport.getBasicSamplingData(), mSimTimings);
+			accumulateTimings(gProfiler().getReport(ProfiledThread::Core).cpuReport.getBasicSamplingData(), mCoreTimings);
+		}
+
+		// Commands queued here execute on the core thread before the rendering commands for this frame
+		if (mFrameIdx == gOptions.numWarmupFrames)
+		{
+			mMeasureStartTime = gTime().getTimePrecise();
+			gCoreThread().queueCommand(std::bind(&BenchmarkApplication::beginMeasurement, this));
+		}
+		else if (mFrameIdx == (gOptions.numWarmupFrames + gOptions.numFrames))
+		{
+			mMeasureEndTime = gTime().getTimePrecise();
+			mNumMeasuredFrames = gOptions.numFrames;
+
+			gCoreThread().queueCommand(std::bind(&BenchmarkApplication::endMeasurement, this));
+			quitRequested();
+		}
+
+		mFrameIdx++;
+	}
+
+	void BenchmarkApplication::setUpScene()
+	{
+		HMesh mesh = BuiltinResources::instance().getMesh(BuiltinMesh::Box);
+		HShader shader = BuiltinResources::instance().getBuiltinShader(BuiltinShader::Standard);
+
+		Vector<HMaterial> materials;
+		for (UINT32 i = 0; i < std::max(gOptions.numMaterials, 1U); i++)
+			materials.push_back(Material::create(shader));
+
+		// Objects are laid out in a square grid on the XZ plane, around the origin
+		const float SPACING = 3.0f;
+
+		UINT32 gridSize = (UINT32)std::ceil(std::sqrt((float)gOptions.numObjects));
+		float gridExtent = gridSize * SPACING * 0.5f;
+
+		for (UINT32 i = 0; i < gOptions.numObjects; i++)
+		{
+			UINT32 x = i % gridSize;
+			UINT32 z = i / gridSize;
+
+			HSceneObject so = SceneObject::create("Object");
+			so->setPosition(Vector3(x * SPACING - gridExtent, 0.0f, z * SPACING - gridExtent));
+
+			HRenderable renderable = so->addComponent<CRenderable>();
+			renderable->setMesh(mesh);
+			renderable->setMaterial(materials[i % materials.size()]);
+		}
+
+		for (UINT32 i = 0; i < gOptions.numLights; i++)
+		{
+			float angle = (i / (float)gOptions.numLights) * Math::TWO_PI;
+
+			HSceneObject so = SceneObject::create("Light");
+			so->setPosition(Vector3(std::cos(angle) * gridExtent * 0.5f, 5.0f, std::sin(angle) * gridExtent * 0.5f));
+
+			HLight light = so->addComponent<CLight>();
+			light->setType(LightType::Radial);
+			light->setUseAutoAttenuation(false);
+			light->setAttenuationRadius(gridExtent * 0.5f);
+			light->setIntensity(1000.0f);
+			light->setCastsShadow(gOptions.shadows);
+		}
+
+		HSceneObject sunSO = SceneObject::create("Sun");
+		sunSO->setPosition(Vector3(0.0f, 100.0f, 0.0f));
+		sunSO->lookAt(Vector3(gridExtent * 0.25f, 0.0f, gridExtent * 0.5f));
+
+		HLight sun = sunSO->addComponent<CLight>();
+		sun->setType(LightType::Directional);
+		sun->setCastsShadow(gOptions.shadows);
+
+		SPtr<RenderWindow> window = getPrimaryWindow();
+		const RenderWindowProperties& windowProps = window->getProperties();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		cameraSO->setPosition(Vector3(0.0f, gridExtent * 0.75f, gridExtent * 1.5f));
+		cameraSO->lookAt(Vector3(0.0f, 0.0f, 0.0f));
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(window);
+		camera->setNearClipDistance(0.5f);
+		camera->setFarClipDistance(gridExtent * 10.0f);
+		camera->setAspectRatio(windowProps.width / (float)windowProps.height);
+
+		if (gOptions.numParamSets > 0)
+			measureMaterialParams(materials);
+	}
+
+	void BenchmarkApplication::measureMaterialParams(const Vector<HMaterial>& materials)
+	{
+		// Assigning a null texture resets the parameter to its default, so the material contents don't change
+		HTexture texture;
+		UINT32 numMaterials = (UINT32)materials.size();
+
+		UINT64 startTime = gTime().getTimePrecise();
+		for (UINT32 i = 0; i < gOptions.numParamSets; i++)
+			materials[i % numMaterials]->setTexture("gAlbedoTex", texture);
+
+		mParamsByNameTime = gTime().getTimePrecise() - startTime;
+
+		MaterialTextureParamHandle albedoTex(BS_SID("gAlbedoTex"));
+
+		startTime = gTime().getTimePrecise();
+		for (UINT32 i = 0; i < gOptions.numParamSets; i++)
+			materials[i % numMaterials]->setTexture(albedoTex, texture);
+
+		mParamsByHandleTime = gTime().getTimePrecise() - startTime;
+	}
+
+	void BenchmarkApplication::beginMeasurement()
+	{
+		mStartRenderStats = RenderStats::instance().getData();
+
+		if (mResetCommandStats != nullptr)
+			mResetCommandStats();
+	}
+
+	void BenchmarkApplication::endMeasurement()
+	{
+		const RenderStatsData& renderStats = RenderStats::instance().getData();
+
+		RenderStatsData& output = mCoreResults.renderStats;
+		output.numDrawCalls = renderStats.numDrawCalls - mStartRenderStats.numDrawCalls;
+		output.numComputeCalls = renderStats.numComputeCalls - mStartRenderStats.numComputeCalls;
+		output.numRenderTargetChanges = renderStats.numRenderTargetChanges - mStartRenderStats.numRenderTargetChanges;
+		output.numPresents = renderStats.numPresents - mStartRenderStats.numPresents;
+		output.numClears = renderStats.numClears - mStartRenderStats.numClears;
+		output.numVertices = renderStats.numVertices - mStartRenderStats.numVertices;
+		output.numPrimitives = renderStats.numPrimitives - mStartRenderStats.numPrimitives;
+		output.numPipelineStateChanges = renderStats.numPipelineStateChanges - mStartRenderStats.numPipelineStateChanges;
+		output.numGpuParamBinds = renderStats.numGpuParamBinds - mStartRenderStats.numGpuParamBinds;
+		output.numVertexBufferBinds = renderStats.numVertexBufferBinds - mStartRenderStats.numVertexBufferBinds;
+		output.numIndexBufferBinds = renderStats.numIndexBufferBinds - mStartRenderStats.numIndexBufferBinds;
+		output.numInstancedDrawCalls = renderStats.numInstancedDrawCalls - mStartRenderStats.numInstancedDrawCalls;
+		output.numMergedDrawCalls = renderStats.numMergedDrawCalls - mStartRenderStats.numMergedDrawCalls;
+		output.numRedundantStateChanges = 
+			renderStats.numRedundantStateChanges - mStartRenderStats.numRedundantStateChanges;
+		output.numShadowCacheHits = renderStats.numShadowCacheHits - mStartRenderStats.numShadowCacheHits;
+		output.numShadowCacheMisses = renderStats.numShadowCacheMisses - mStartRenderStats.numShadowCacheMisses;
+
+		if (mGetCommandStats != nullptr)
+			mGetCommandStats(mCoreResults.commandStats);
+	}
+
+	void BenchmarkApplication::accumulateTimings(const CPUProfilerBasicSamplingEntry& entry,
+		Map<String, PhaseTiming>& timings)
+	{
+		for (auto& child : entry.childEntries)
+		{
+			PhaseTiming& timing = timings[child.data.name];
+			timing.totalTimeMs += child.data.totalTimeMs;
+			timing.numCalls += child.data.numCalls;
+
+			accumulateTimings(child, timings);
+		}
+	}
+
+	void BenchmarkApplication::printTimings(const char* threadName, const Map<String, PhaseTiming>& timings) const
+	{
+		printf("\n%s thread (average per frame):\n", threadName);
+		printf("  %-32s %12s %10s\n", "Sample", "Time (ms)", "Calls");
+
+		for (auto& entry : timings)
+		{
+			printf("  %-32s %12.4f %10.1f\n", entry.first.c_str(), entry.second.totalTimeMs / mNumMeasuredFrames,
+				entry.second.numCalls / (double)mNumMeasuredFrames);
+		}
+	}
+
+	void BenchmarkApplication::printResults() const
+	{
+		if (mNumMeasuredFrames == 0)
+		{
+			printf("No frames were measured.\n");
+			return;
+		}
+
+		double totalTimeMs = (mMeasureEndTime - mMeasureStartTime) / 1000.0;
+		double numFrames = (double)mNumMeasuredFrames;
+
+		printf("RenderBeast CPU benchmark\n");
+		printf("  Objects: %u, lights: %u, materials: %u, shadows: %s\n", gOptions.numObjects, gOptions.numLights,
+			gOptions.numMaterials, gOptions.shadows ? "on" : "off");
+		printf("  Measured frames: %u (after %u warm-up frames)\n", mNumMeasuredFrames, gOptions.numWarmupFrames);
+		printf("  Average frame time: %.4f ms\n", totalTimeMs / numFrames);
+
+		printTimings("Sim", mSimTimings);
+		printTimings("Core", mCoreTimings);
+
+		if (gOptions.numParamSets > 0)
+		{
+			double numSets = (double)gOptions.numParamSets;
+
+			printf("\nMaterial parameter assignment (%u sets):\n", gOptions.numParamSets);
+			printf("  %-32s %12.1f ns/set\n", "By name", mParamsByNameTime * 1000.0 / numSets);
+			printf("  %-32s %12.1f ns/set\n", "By handle", mParamsByHandleTime * 1000.0 / numSets);
+		}
+
+		const RenderStatsData& renderStats = mCoreResults.renderStats;
+		printf("\nRender statistics (average per frame):\n");
+		printf("  %-32s %12.1f\n", "Draw calls", renderStats.numDrawCalls / numFrames);
+		printf("  %-32s %12.1f\n", "Draw calls (before batching)", 
+			(renderStats.numDrawCalls + renderStats.numMergedDrawCalls) / numFrames);
+		printf("  %-32s %12.1f\n", "Instanced draw calls", renderStats.numInstancedDrawCalls / numFrames);
+		printf("  %-32s %12.1f\n", "Compute calls", renderStats.numComputeCalls / numFrames);
+		printf("  %-32s %12.1f\n", "Pipeline state changes", renderStats.numPipelineStateChanges / numFrames);
+		printf("  %-32s %12.1f\n", "GPU param binds", renderStats.numGpuParamBinds / numFrames);
+		printf("  %-32s %12.1f\n", "Vertex buffer binds", renderStats.numVertexBufferBinds / numFrames);
+		printf("  %-32s %12.1f\n", "Index buffer binds", renderStats.numIndexBufferBinds / numFrames);
+		printf("  %-32s %12.1f\n", "Skipped redundant binds", renderStats.numRedundantStateChanges / numFrames);
+		printf("  %-32s %12.1f\n", "Render target changes", renderStats.numRenderTargetChanges / numFrames);
+		printf("  %-32s %12.1f\n", "Clears", renderStats.numClears / numFrames);
+		printf("  %-32s %12.1f\n", "Vertices", renderStats.numVertices / numFrames);
+		printf("  %-32s %12.1f\n", "Primitives", renderStats.numPrimitives / numFrames);
+
+		UINT64 numShadowCacheLookups = renderStats.numShadowCacheHits + renderStats.numShadowCacheMisses;
+		if (numShadowCacheLookups > 0)
+		{
+			printf("  %-32s %12.1f\n", "Static shadow map updates", renderStats.numShadowCacheMisses / numFrames);
+			printf("  %-32s %11.1f%%\n", "Static shadow map hit rate", 
+				renderStats.numShadowCacheHits * 100.0 / numShadowCacheLookups);
+		}
+
+		if (mGetCommandStats == nullptr)
+			return;
+
+		static const char* COMMAND_NAMES[] = { "SetGraphicsPipeline", "SetComputePipeline", "SetGpuParams",
+			"SetViewport", "SetScissorRect", "SetStencilRef", "SetVertexBuffers", "SetIndexBuffer",
+			"SetVertexDeclaration", "SetDrawOperation", "SetRenderTarget", "ClearRenderTarget", "ClearViewport", "Draw",
+			"DrawIndexed", "DispatchCompute", "SwapBuffers" };
+
+		static_assert(sizeof(COMMAND_NAMES) / sizeof(COMMAND_NAMES[0]) == (UINT32)ct::NullCommandType::Count,
+			"Command name list out of sync with the command types.");
+
+		const ct::NullCommandStats& commandStats = mCoreResults.commandStats;
+		printf("\nExecuted commands (average per frame):\n");
+		for (UINT32 i = 0; i < (UINT32)ct::NullCommandType::Count; i++)
+			printf("  %-32s %12.1f\n", COMMAND_NAMES[i], commandStats.numCommands[i] / numFrames);
+
+		printf("  %-32s %12.1f\n", "Submitted command buffers", commandStats.numSubmittedCommandBuffers / numFrames);
+		printf("  %-32s %12.1f\n", "Instances", commandStats.numInstances / numFrames);
+
+		if (gOptions.hashing)
+			printf("  Command hash: %016llx\n", (unsigned long long)commandStats.hash);
+	}
+
+	/** Parses the command line arguments into gOptions. Returns false if the arguments are not valid. */
+	bool parseArguments(int argc, char* argv[])
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			String arg = argv[i];
+
+			if (arg == "--shadows")
+			{
+				gOptions.shadows = true;
+				continue;
+			}
+
+			if (arg == "--hash")
+			{
+				gOptions.hashing = true;
+				continue;
+			}
+
+			if ((i + 1) >= argc)
+				return false;
+
+			UINT32 value = parseUINT32(argv[++i], 0);
+			if (arg == "--objects")
+				gOptions.numObjects = value;
+			else if (arg == "--lights")
+				gOptions.numLights = value;
+			else if (arg == "--materials")
+				gOptions.numMaterials = value;
+			else if (arg == "--frames")
+				gOptions.numFrames = std::max(value, 1U);
+			else if (arg == "--warmup")
+				gOptions.numWarmupFrames = value;
+			else if (arg == "--params")
+				gOptions.numParamSets = value;
+			else
+				return false;
+		}
+
+		return true;
+	}
+}
+
+using namespace bs;
+
+/** Main entry point into the benchmark. */
+int main(int argc, char* argv[])
+{
+	if (!parseArguments(argc, argv))
+	{
+		printf("Usage: RenderBeastBenchmark [--objects N] [--lights N] [--materials N] [--frames N] [--warmup N] "
+			"[--shadows] [--hash] [--params N]\n");
+		return 1;
+	}
+
+	START_UP_DESC startUpDesc;
+
+	// Always use the null render API, the remaining plugins are the defaults specified by the build system
+	startUpDesc.renderAPI = "BansheeNullRenderAPI";
+	startUpDesc.renderer = BS_RENDERER_MODULE;
+	startUpDesc.audio = BS_AUDIO_MODULE;
+	startUpDesc.physics = BS_PHYSICS_MODULE;
+
+	startUpDesc.primaryWindowDesc.videoMode = VideoMode(1280, 720);
+	startUpDesc.primaryWindowDesc.title = "RenderBeast Benchmark";
+	startUpDesc.primaryWindowDesc.fullscreen = false;
+
+	startUpDesc.importers.push_back("BansheeSL");
+
+	Application::startUp<BenchmarkApplication>(startUpDesc);
+	Application::instance().runMainLoop();
+
+	static_cast<BenchmarkApplication&>(Application::instance()).printResults();
+
+	Application::shutDown();
+
+	return 0;
+}
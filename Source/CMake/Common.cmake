@@ -3,6 +3,8 @@ function(add_engine_dependencies target_name)
 		add_dependencies(${target_name} BansheeD3D11RenderAPI)
 	elseif(RENDER_API_MODULE MATCHES "Vulkan")
 		add_dependencies(${target_name} BansheeVulkanRenderAPI)
+	elseif(RENDER_API_MODULE MATCHES "Null")
+		add_dependencies(${target_name} BansheeNullRenderAPI)
 	else()
 		add_dependencies(${target_name} BansheeGLRenderAPI)
 	endif()
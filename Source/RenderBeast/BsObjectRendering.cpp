@@ -17,6 +17,8 @@ namespace bs { namespace ct
 	PerFrameParamDef gPerFrameParamDef;
 
 	ObjectRenderer::ObjectRenderer()
+		: mPerObjectRing(gPerObjectParamDef.getBlockSize()), mPerCallRing(gPerCallParamDef.getBlockSize())
+		, mInstanceBatchRing(gPerInstanceBatchParamDef.getBlockSize())
 	{
 		mPerFrameParamBuffer = gPerFrameParamDef.createBuffer();
 	}
@@ -35,8 +37,16 @@ namespace bs { namespace ct
 		// Note: Perhaps perform buffer validation to ensure expected buffer has the same size and layout as the provided
 		// buffer, and show a warning otherwise. But this is perhaps better handled on a higher level.
 		gpuParams->setParamBlockBuffer("PerFrame", mPerFrameParamBuffer);
-		gpuParams->setParamBlockBuffer("PerObject", owner.perObjectParamBuffer);
-		gpuParams->setParamBlockBuffer("PerCall", owner.perCallParamBuffer);
+
+		// Per-object buffers are allocated from a ring every frame, and bound when the ring is written to. Force the
+		// owner to re-bind so the new element receives its buffer.
+		gpuParams->getParamInfo()->getBindings(
+			GpuPipelineParamInfoBase::ParamType::ParamBlock, 
+			"PerObject",
+			element.perObjectBindings
+		);
+
+		owner.perObjectBuffer = nullptr;
 
 		gpuParams->getParamInfo()->getBindings(
 			GpuPipelineParamInfoBase::ParamType::ParamBlock, 
@@ -44,6 +54,13 @@ namespace bs { namespace ct
 			element.perCameraBindings
 		);
 
+		// Per-call buffers are allocated from a ring every frame, and bound when the view is rendered
+		gpuParams->getParamInfo()->getBindings(
+			GpuPipelineParamInfoBase::ParamType::ParamBlock, 
+			"PerCall",
+			element.perCallBindings
+		);
+
 		if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
 			gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", element.boneMatrixBuffer);
 
@@ -95,6 +112,29 @@ namespace bs { namespace ct
 			element.imageBasedParams.populate(gpuParams, GPT_FRAGMENT_PROGRAM, true, supportsClusteredForward, 
 				supportsClusteredForward);
 		}
+
+	}
+
+	void ObjectRenderer::initInstancedElement(BeastRenderableElement& element)
+	{
+		SPtr<GpuParams> gpuParams = element.instancedParams->getGpuParams();
+		gpuParams->setParamBlockBuffer("PerFrame", mPerFrameParamBuffer);
+
+		gpuParams->getParamInfo()->getBindings(
+			GpuPipelineParamInfoBase::ParamType::ParamBlock, 
+			"PerCamera",
+			element.instancedPerCameraBindings
+		);
+
+		gpuParams->getParamInfo()->getBindings(
+			GpuPipelineParamInfoBase::ParamType::ParamBlock, 
+			"PerInstanceBatch",
+			element.instanceBatchBindings
+		);
+
+		// Per-object data for instanced draws is read from a per-instance buffer, bound when the view is rendered
+		if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gPerInstanceData"))
+			gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gPerInstanceData", element.instanceDataParam);
 	}
 
 	void ObjectRenderer::setParamFrameParams(float time)
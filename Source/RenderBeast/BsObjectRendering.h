@@ -9,6 +9,7 @@
 #include "Renderer/BsRendererMaterial.h"
 #include "Renderer/BsParamBlocks.h"
 #include "BsRendererObject.h"
+#include "Renderer/BsParamBlockRing.h"
 
 namespace bs 
 { 
@@ -35,11 +36,29 @@ namespace bs
 		/** Initializes the specified renderable element, making it ready to be used. */
 		void initElement(RendererObject& owner, BeastRenderableElement& element);
 
+		/** 
+		 * Initializes the instanced parameters of the specified renderable element, making it ready to be rendered as the
+		 * first element of an instance batch. Must be called after the instanced parameters are created.
+		 */
+		void initInstancedElement(BeastRenderableElement& element);
+
 		/** Updates global per frame parameter buffers with new values. To be called at the start of every frame. */
 		void setParamFrameParams(float time);
 
+		/** Returns the ring from which per-object parameter blocks for all renderables are allocated. */
+		ParamBlockRing& getPerObjectRing() { return mPerObjectRing; }
+
+		/** Returns the ring from which per-call parameter blocks for all views are allocated. */
+		ParamBlockRing& getPerCallRing() { return mPerCallRing; }
+
+		/** Returns the ring from which parameter blocks describing instance batches for all views are allocated. */
+		ParamBlockRing& getInstanceBatchRing() { return mInstanceBatchRing; }
+
 	protected:
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
+		ParamBlockRing mPerObjectRing;
+		ParamBlockRing mPerCallRing;
+		ParamBlockRing mInstanceBatchRing;
 	};
 
 	/** Basic shader that is used when no other is available. */
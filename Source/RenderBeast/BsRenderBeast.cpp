@@ -318,9 +318,13 @@ namespace bs { namespace ct
 			}
 		}
 
+		gProfilerCPU().beginSample("Visibility");
+
 		mMainViewGroup->setViews(views.data(), (UINT32)views.size());
 		mMainViewGroup->determineVisibility(sceneInfo);
 
+		gProfilerCPU().endSample("Visibility");
+
 		// Update reflection probe array if required
 		updateReflProbeArray();
 
@@ -344,11 +348,22 @@ namespace bs { namespace ct
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
 		const VisibilityInfo& visibility = viewGroup.getVisibilityInfo();
 
+		// Upload per-object data for all renderables, used by both the shadow and the view passes
+		gProfilerCPU().beginSample("FlushPerObjectParams");
+		mScene->updatePerObjectBuffers(mObjectRenderer->getPerObjectRing());
+		gProfilerCPU().endSample("FlushPerObjectParams");
+
 		// Render shadow maps
+		gProfilerCPU().beginSample("ShadowMaps");
+
 		ShadowRendering& shadowRenderer = viewGroup.getShadowRenderer();
 		shadowRenderer.renderShadowMaps(*mScene, viewGroup, frameInfo);
 
+		gProfilerCPU().endSample("ShadowMaps");
+
 		// Update various buffers required by each renderable
+		gProfilerCPU().beginSample("PrepareRenderables");
+
 		UINT32 numRenderables = (UINT32)sceneInfo.renderables.size();
 		for (UINT32 i = 0; i < numRenderables; i++)
 		{
@@ -358,7 +373,40 @@ namespace bs { namespace ct
 			mScene->prepareRenderable(i, frameInfo);
 		}
 
+		// Write per-call and instance data for all views in a single pass, and upload it all together
+		ParamBlockRing& perCallRing = mObjectRenderer->getPerCallRing();
+		ParamBlockRing& instanceBatchRing = mObjectRenderer->getInstanceBatchRing();
+		perCallRing.reset();
+		instanceBatchRing.reset();
+
 		UINT32 numViews = viewGroup.getNumViews();
+		for (UINT32 i = 0; i < numViews; i++)
+		{
+			RendererView* view = viewGroup.getView(i);
+
+			view->updatePerCallBuffers(sceneInfo.renderables, perCallRing);
+			view->updateInstanceData(sceneInfo.renderables, instanceBatchRing);
+
+			// Instanced parameters are only created for elements that actually start an instance batch
+			const SPtr<RenderQueue>& opaqueQueue = view->getOpaqueQueue();
+			const Vector<RenderableElement*>& instancedElements = opaqueQueue->getInstancedElements();
+			for (auto& batch : opaqueQueue->getInstanceBatches())
+			{
+				auto element = static_cast<BeastRenderableElement*>(instancedElements[batch.firstElement]);
+				if (mScene->prepareInstancedElement(*element))
+					mObjectRenderer->initInstancedElement(*element);
+			}
+		}
+
+		gProfilerCPU().beginSample("FlushParamBlocks");
+
+		perCallRing.flush();
+		instanceBatchRing.flush();
+
+		gProfilerCPU().endSample("FlushParamBlocks");
+
+		gProfilerCPU().endSample("PrepareRenderables");
+
 		for (UINT32 i = 0; i < numViews; i++)
 		{
 			RendererView* view = viewGroup.getView(i);
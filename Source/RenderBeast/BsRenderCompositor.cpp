@@ -18,6 +18,7 @@
 #include "Renderer/BsRendererExtension.h"
 #include "Renderer/BsSkybox.h"
 #include "BsLightProbes.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -264,9 +265,7 @@ namespace bs { namespace ct
 			if (!visibility.renderables[i])
 				continue;
 
-			RendererObject* rendererObject = inputs.scene.renderables[i];
-			rendererObject->updatePerCallBuffer(viewProps.viewProjTransform);
-
+			const SPtr<GpuParamBlockBuffer>& perCallBuffer = inputs.view.getPerCallBuffer(i);
 			for (auto& element : inputs.scene.renderables[i]->elements)
 			{
 				SPtr<GpuParams> gpuParams = element.params->getGpuParams();
@@ -275,10 +274,39 @@ namespace bs { namespace ct
 					const GpuParamBinding& binding = element.perCameraBindings[j];
 					if(binding.slot != (UINT32)-1)
 						gpuParams->setParamBlockBuffer(binding.set, binding.slot, inputs.view.getPerViewBuffer());
+
+					const GpuParamBinding& perCallBinding = element.perCallBindings[j];
+					if(perCallBinding.slot != (UINT32)-1)
+						gpuParams->setParamBlockBuffer(perCallBinding.set, perCallBinding.slot, perCallBuffer);
 				}
 			}
 		}
 
+		// Prepare instance batches. Instanced parameters of the first element in the batch are used for the entire batch.
+		const SPtr<RenderQueue>& opaqueQueue = inputs.view.getOpaqueQueue();
+		const Vector<RenderQueueInstanceBatch>& instanceBatches = opaqueQueue->getInstanceBatches();
+		const Vector<RenderableElement*>& instancedElements = opaqueQueue->getInstancedElements();
+
+		for (UINT32 i = 0; i < (UINT32)instanceBatches.size(); i++)
+		{
+			const RenderQueueInstanceBatch& batch = instanceBatches[i];
+			BeastRenderableElement* element = static_cast<BeastRenderableElement*>(instancedElements[batch.firstElement]);
+
+			SPtr<GpuParams> gpuParams = element->instancedParams->getGpuParams();
+			for(UINT32 j = 0; j < GPT_COUNT; j++)
+			{
+				const GpuParamBinding& binding = element->instancedPerCameraBindings[j];
+				if(binding.slot != (UINT32)-1)
+					gpuParams->setParamBlockBuffer(binding.set, binding.slot, inputs.view.getPerViewBuffer());
+
+				const GpuParamBinding& batchBinding = element->instanceBatchBindings[j];
+				if(batchBinding.slot != (UINT32)-1)
+					gpuParams->setParamBlockBuffer(batchBinding.set, batchBinding.slot, inputs.view.getInstanceBatchBuffer(i));
+			}
+
+			element->instanceDataParam.set(inputs.view.getInstanceBuffer());
+		}
+
 		Camera* sceneCamera = inputs.view.getSceneCamera();
 
 		// Trigger prepare callbacks
@@ -312,13 +340,28 @@ namespace bs { namespace ct
 		}
 
 		// Render all visible opaque elements
-		const Vector<RenderQueueElement>& opaqueElements = inputs.view.getOpaqueQueue()->getSortedElements();
+		const Vector<RenderQueueElement>& opaqueElements = opaqueQueue->getSortedElements();
 		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
 		{
 			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
 
 			SPtr<Material> material = renderElem->material;
 
+			if (iter->instanceBatchIdx != (UINT32)-1)
+			{
+				const RenderQueueInstanceBatch& batch = instanceBatches[iter->instanceBatchIdx];
+
+				if (iter->applyPass)
+					gRendererUtility().setPass(material, iter->passIdx, renderElem->instancedTechniqueIdx);
+
+				gRendererUtility().setPassParams(renderElem->instancedParams, iter->passIdx);
+				gRendererUtility().draw(renderElem->mesh, renderElem->subMesh, batch.numElements);
+
+				BS_INC_RENDER_STAT(NumInstancedDrawCalls);
+				BS_ADD_RENDER_STAT(NumMergedDrawCalls, batch.numElements - 1);
+				continue;
+			}
+
 			if (iter->applyPass)
 				gRendererUtility().setPass(material, iter->passIdx, renderElem->techniqueIdx);
 
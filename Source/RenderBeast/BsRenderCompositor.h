@@ -178,7 +178,7 @@ namespace ct
 		// Outputs
 		SPtr<PooledRenderTexture> depthTex;
 
-		static StringID getNodeId() { return "SceneDepth"; }
+		static StringID getNodeId() { return BS_SID("SceneDepth"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -202,7 +202,7 @@ namespace ct
 
 		SPtr<RenderTexture> renderTarget;
 
-		static StringID getNodeId() { return "GBuffer"; }
+		static StringID getNodeId() { return BS_SID("GBuffer"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -231,7 +231,7 @@ namespace ct
 
 		SPtr<RenderTexture> renderTarget;
 
-		static StringID getNodeId() { return "SceneColor"; }
+		static StringID getNodeId() { return BS_SID("SceneColor"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -252,7 +252,7 @@ namespace ct
 		// Outputs
 		SPtr<PooledRenderTexture> output;
 
-		static StringID getNodeId() { return "MSAACoverage"; }
+		static StringID getNodeId() { return BS_SID("MSAACoverage"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -285,7 +285,7 @@ namespace ct
 
 		SPtr<RenderTexture> renderTarget;
 
-		static StringID getNodeId() { return "LightAccumulation"; }
+		static StringID getNodeId() { return BS_SID("LightAccumulation"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -307,7 +307,7 @@ namespace ct
 		// Outputs
 		RCNodeLightAccumulation* output;
 
-		static StringID getNodeId() { return "TiledDeferredLighting"; }
+		static StringID getNodeId() { return BS_SID("TiledDeferredLighting"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -325,7 +325,7 @@ namespace ct
 	class RCNodeStandardDeferredLighting : public RenderCompositorNode
 	{
 	public:
-		static StringID getNodeId() { return "StandardDeferredLighting"; }
+		static StringID getNodeId() { return BS_SID("StandardDeferredLighting"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -344,7 +344,7 @@ namespace ct
 	class RCNodeStandardDeferredIBL : public RenderCompositorNode
 	{
 	public:
-		static StringID getNodeId() { return "StandardDeferredIBL"; }
+		static StringID getNodeId() { return BS_SID("StandardDeferredIBL"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -364,7 +364,7 @@ namespace ct
 		// Outputs
 		RCNodeLightAccumulation* output;
 
-		static StringID getNodeId() { return "UnflattenLightAccum"; }
+		static StringID getNodeId() { return BS_SID("UnflattenLightAccum"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -380,7 +380,7 @@ namespace ct
 	public:
 		// Outputs to the unflattened RCNodeLightAccumulation
 
-		static StringID getNodeId() { return "IndirectLighting"; }
+		static StringID getNodeId() { return BS_SID("IndirectLighting"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -400,7 +400,7 @@ namespace ct
 		// Outputs
 		RCNodeLightAccumulation* output;
 
-		static StringID getNodeId() { return "TiledDeferredIBL"; }
+		static StringID getNodeId() { return BS_SID("TiledDeferredIBL"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -416,7 +416,7 @@ namespace ct
 	public:
 		RCNodeClusteredForward();
 
-		static StringID getNodeId() { return "ClusteredForward"; }
+		static StringID getNodeId() { return BS_SID("ClusteredForward"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -436,7 +436,7 @@ namespace ct
 		// Outputs
 		RCNodeSceneColor* output;
 
-		static StringID getNodeId() { return "UnflattenSceneColor"; }
+		static StringID getNodeId() { return BS_SID("UnflattenSceneColor"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -453,7 +453,7 @@ namespace ct
 	class RCNodeSkybox : public RenderCompositorNode
 	{
 	public:
-		static StringID getNodeId() { return "Skybox"; }
+		static StringID getNodeId() { return BS_SID("Skybox"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -467,7 +467,7 @@ namespace ct
 	class RCNodeFinalResolve : public RenderCompositorNode
 	{
 	public:
-		static StringID getNodeId() { return "FinalResolve"; }
+		static StringID getNodeId() { return BS_SID("FinalResolve"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -499,7 +499,7 @@ namespace ct
 		/** Returns a texture that contains the last rendererd post process output. */
 		SPtr<Texture> getLastOutput() const;
 
-		static StringID getNodeId() { return "PostProcess"; }
+		static StringID getNodeId() { return BS_SID("PostProcess"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -525,7 +525,7 @@ namespace ct
 
 		~RCNodeTonemapping();
 
-		static StringID getNodeId() { return "Tonemapping"; }
+		static StringID getNodeId() { return BS_SID("Tonemapping"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -548,7 +548,7 @@ namespace ct
 	class RCNodeGaussianDOF : public RenderCompositorNode
 	{
 	public:
-		static StringID getNodeId() { return "GaussianDOF"; }
+		static StringID getNodeId() { return BS_SID("GaussianDOF"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -562,7 +562,7 @@ namespace ct
 	class RCNodeFXAA : public RenderCompositorNode
 	{
 	public:
-		static StringID getNodeId() { return "FXAA"; }
+		static StringID getNodeId() { return BS_SID("FXAA"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -582,7 +582,7 @@ namespace ct
 	public:
 		SPtr<PooledRenderTexture> output;
 
-		static StringID getNodeId() { return "ResolvedSceneDepth"; }
+		static StringID getNodeId() { return BS_SID("ResolvedSceneDepth"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -600,7 +600,7 @@ namespace ct
 	public:
 		SPtr<PooledRenderTexture> output;
 
-		static StringID getNodeId() { return "HiZ"; }
+		static StringID getNodeId() { return BS_SID("HiZ"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -616,7 +616,7 @@ namespace ct
 	public:
 		SPtr<PooledRenderTexture> output;
 
-		static StringID getNodeId() { return "SSAO"; }
+		static StringID getNodeId() { return BS_SID("SSAO"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -634,7 +634,7 @@ namespace ct
 
 		~RCNodeSSR();
 
-		static StringID getNodeId() { return "SSR"; }
+		static StringID getNodeId() { return BS_SID("SSR"); }
 		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
 	protected:
 		/** @copydoc RenderCompositorNode::render */
@@ -6,32 +6,31 @@ namespace bs { namespace ct
 {
 	PerObjectParamDef gPerObjectParamDef;
 	PerCallParamDef gPerCallParamDef;
+	PerInstanceBatchParamDef gPerInstanceBatchParamDef;
 
 	RendererObject::RendererObject()
+		: renderable(nullptr), perObjectBuffer(nullptr)
 	{
-		perObjectParamBuffer = gPerObjectParamDef.createBuffer();
-		perCallParamBuffer = gPerCallParamDef.createBuffer();
+		perObjectData.resize(gPerObjectParamDef.getBlockSize(), 0);
 	}
 
-	void RendererObject::updatePerObjectBuffer()
+	void RendererObject::updatePerObjectData()
 	{
 		Matrix4 worldTransform = renderable->getMatrix();
 		Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
 
-		gPerObjectParamDef.gMatWorld.set(perObjectParamBuffer, worldTransform);
-		gPerObjectParamDef.gMatInvWorld.set(perObjectParamBuffer, worldTransform.inverseAffine());
-		gPerObjectParamDef.gMatWorldNoScale.set(perObjectParamBuffer, worldNoScaleTransform);
-		gPerObjectParamDef.gMatInvWorldNoScale.set(perObjectParamBuffer, worldNoScaleTransform.inverseAffine());
-		gPerObjectParamDef.gWorldDeterminantSign.set(perObjectParamBuffer, worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
+		UINT8* data = perObjectData.data();
+		gPerObjectParamDef.gMatWorld.set(data, worldTransform);
+		gPerObjectParamDef.gMatInvWorld.set(data, worldTransform.inverseAffine());
+		gPerObjectParamDef.gMatWorldNoScale.set(data, worldNoScaleTransform);
+		gPerObjectParamDef.gMatInvWorldNoScale.set(data, worldNoScaleTransform.inverseAffine());
+		gPerObjectParamDef.gWorldDeterminantSign.set(data, worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
 	}
 
-	void RendererObject::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
+	void RendererObject::writePerCallData(const Matrix4& viewProj, UINT8* data) const
 	{
 		Matrix4 worldViewProjMatrix = viewProj * renderable->getMatrix();
 
-		gPerCallParamDef.gMatWorldViewProj.set(perCallParamBuffer, worldViewProjMatrix);
-
-		if(flush)
-			perCallParamBuffer->flushToGPU();
+		gPerCallParamDef.gMatWorldViewProj.set(data, worldViewProjMatrix);
 	}
 }}
\ No newline at end of file
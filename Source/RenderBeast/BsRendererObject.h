@@ -32,6 +32,12 @@ namespace bs { namespace ct
 
 	extern PerCallParamDef gPerCallParamDef;
 
+	BS_PARAM_BLOCK_BEGIN(PerInstanceBatchParamDef)
+		BS_PARAM_BLOCK_ENTRY(INT32, gInstanceOffset)
+	BS_PARAM_BLOCK_END
+
+	extern PerInstanceBatchParamDef gPerInstanceBatchParamDef;
+
 	struct MaterialSamplerOverrides;
 
 	/**
@@ -63,9 +69,42 @@ namespace bs { namespace ct
 		/** Index of the technique in the material to render the element with. */
 		UINT32 techniqueIdx;
 
+		/** 
+		 * Index of the technique in the material to render the element with, when the element is rendered as part of an
+		 * instanced draw call. -1 if the element doesn't support instancing.
+		 */
+		UINT32 instancedTechniqueIdx;
+
+		/** 
+		 * GPU parameters used when the element is the first element of an instanced draw call. Created on demand, the
+		 * first time the element ends up as the first element of an instance batch. Null until then.
+		 */
+		SPtr<GpuParamsSet> instancedParams;
+
+		/** Sampler state overrides for the instanced parameters. Null if instanced parameters haven't been created. */
+		MaterialSamplerOverrides* instancedSamplerOverrides;
+
+		/** Binding indices representing where should the per-camera param block buffer be bound to, when instancing. */
+		GpuParamBinding instancedPerCameraBindings[GPT_COUNT];
+
+		/** 
+		 * Binding indices representing where should the param block buffer containing instance batch information be bound
+		 * to, when instancing.
+		 */
+		GpuParamBinding instanceBatchBindings[GPT_COUNT];
+
+		/** Parameter to which to bind a buffer containing per-object data for all instances, when instancing. */
+		GpuParamBuffer instanceDataParam;
+
 		/** Binding indices representing where should the per-camera param block buffer be bound to. */
 		GpuParamBinding perCameraBindings[GPT_COUNT];
 
+		/** Binding indices representing where should the per-call param block buffer be bound to. */
+		GpuParamBinding perCallBindings[GPT_COUNT];
+
+		/** Binding indices representing where should the per-object param block buffer be bound to. */
+		GpuParamBinding perObjectBindings[GPT_COUNT];
+
 		/** Binding indices representing where should lights param block buffer be bound to. */
 		GpuParamBinding gridParamsBindings[GPT_COUNT];
 
@@ -120,22 +159,28 @@ namespace bs { namespace ct
 	{
 		RendererObject();
 
-		/** Updates the per-object GPU buffer according to the currently set properties. */
-		void updatePerObjectBuffer();
+		/** Updates the per-object parameter data according to the currently set properties. */
+		void updatePerObjectData();
 
 		/** 
-		 * Updates the per-call GPU buffer according to the provided parameters. 
+		 * Writes per-call parameters according to the provided parameters. 
 		 * 
 		 * @param[in]	viewProj	Combined view-projection matrix of the current camera.
-		 * @param[in]	flush		True if the buffer contents should be immediately flushed to the GPU.
+		 * @param[out]	data		Memory to write the parameters to, laid out the same as the per-call parameter block.
 		 */
-		void updatePerCallBuffer(const Matrix4& viewProj, bool flush = true);
+		void writePerCallData(const Matrix4& viewProj, UINT8* data) const;
 
 		Renderable* renderable;
 		Vector<BeastRenderableElement> elements;
 
-		SPtr<GpuParamBlockBuffer> perObjectParamBuffer;
-		SPtr<GpuParamBlockBuffer> perCallParamBuffer;
+		/** Per-object parameters, laid out the same as the per-object parameter block. */
+		Vector<UINT8> perObjectData;
+
+		/** 
+		 * Buffer containing the per-object parameters for the current frame, allocated from the per-object ring. Null 
+		 * until the object's data is first written to the ring, or after its elements have been re-initialized.
+		 */
+		const SPtr<GpuParamBlockBuffer>* perObjectBuffer;
 	};
 
 	/** @} */
@@ -14,6 +14,63 @@
 
 namespace bs {	namespace ct
 {
+	/** 
+	 * Finds a technique matching the provided variation. If the shader supports instancing, the technique with instancing
+	 * disabled is preferred. Returns the default technique if no matching technique can be found.
+	 */
+	UINT32 findNonInstancedTechnique(const Material& material, const ShaderVariation& variation)
+	{
+		ShaderVariation nonInstancedVariation = variation;
+		nonInstancedVariation.addParam(ShaderVariation::Param("INSTANCED", false));
+
+		FIND_TECHNIQUE_DESC findDesc;
+		findDesc.variation = &nonInstancedVariation;
+
+		UINT32 techniqueIdx = material.findTechnique(findDesc);
+		if (techniqueIdx == (UINT32)-1)
+		{
+			findDesc.variation = &variation;
+			techniqueIdx = material.findTechnique(findDesc);
+		}
+
+		if (techniqueIdx == (UINT32)-1)
+			techniqueIdx = material.getDefaultTechnique();
+
+		return techniqueIdx;
+	}
+
+	/** Assigns sampler state overrides to the GPU parameters used by all passes of the provided parameter set. */
+	void applySamplerOverrides(const SPtr<GpuParamsSet>& paramsSet, const MaterialSamplerOverrides& overrides, 
+		UINT32 numPasses)
+	{
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<GpuParams> params = paramsSet->getGpuParams(i);
+
+			const UINT32 numStages = 6;
+			for (UINT32 j = 0; j < numStages; j++)
+			{
+				GpuProgramType type = (GpuProgramType)j;
+
+				SPtr<GpuParamDesc> paramDesc = params->getParamDesc(type);
+				if (paramDesc == nullptr)
+					continue;
+
+				for (auto& samplerDesc : paramDesc->samplers)
+				{
+					UINT32 set = samplerDesc.second.set;
+					UINT32 slot = samplerDesc.second.slot;
+
+					UINT32 overrideIndex = overrides.passes[i].stateOverrides[set][slot];
+					if (overrideIndex == (UINT32)-1)
+						continue;
+
+					params->setSamplerState(set, slot, overrides.overrides[overrideIndex].state);
+				}
+			}
+		}
+	}
+
 	RendererScene::RendererScene(const SPtr<RenderBeastOptions>& options)
 		:mOptions(options)
 	{
@@ -224,7 +281,7 @@ namespace bs {	namespace ct
 
 		RendererObject* rendererObject = mInfo.renderables.back();
 		rendererObject->renderable = renderable;
-		rendererObject->updatePerObjectBuffer();
+		rendererObject->updatePerObjectData();
 
 		SPtr<Mesh> mesh = renderable->getMesh();
 		if (mesh != nullptr)
@@ -296,15 +353,18 @@ namespace bs {	namespace ct
 
 				const ShaderVariation* variation = VAR_LOOKUP[(int)animType];
 
-				FIND_TECHNIQUE_DESC findDesc;
-				findDesc.variation = variation;
-
-				UINT32 techniqueIdx = renElement.material->findTechnique(findDesc);
+				UINT32 techniqueIdx = findNonInstancedTechnique(*renElement.material, *variation);
+				renElement.techniqueIdx = techniqueIdx;
 
-				if (techniqueIdx == (UINT32)-1)
-					techniqueIdx = renElement.material->getDefaultTechnique();
+				// Only static opaque elements can be merged into instanced draw calls, and only if the shader supports it
+				renElement.instancedTechniqueIdx = (UINT32)-1;
+				if(!usesForwardRendering && animType == RenderableAnimType::None)
+				{
+					FIND_TECHNIQUE_DESC findDesc;
+					findDesc.variation = &getVertexInputVariation<false, false, true>();
 
-				renElement.techniqueIdx = techniqueIdx;
+					renElement.instancedTechniqueIdx = renElement.material->findTechnique(findDesc);
+				}
 
 				// Validate mesh <-> shader vertex bindings
 				if (renElement.material != nullptr)
@@ -352,24 +412,12 @@ namespace bs {	namespace ct
 				renElement.material->updateParamsSet(renElement.params, true);
 
 				// Generate or assign sampler state overrides
-				SamplerOverrideKey samplerKey(renElement.material, techniqueIdx);
-				auto iterFind = mSamplerOverrides.find(samplerKey);
-				if (iterFind != mSamplerOverrides.end())
-				{
-					renElement.samplerOverrides = iterFind->second;
-					iterFind->second->refCount++;
-				}
-				else
-				{
-					SPtr<Shader> shader = renElement.material->getShader();
-					MaterialSamplerOverrides* samplerOverrides = SamplerOverrideUtility::generateSamplerOverrides(shader,
-						renElement.material->_getInternalParams(), renElement.params, mOptions);
+				renElement.samplerOverrides = acquireSamplerOverrides(renElement.material, techniqueIdx, renElement.params);
 
-					mSamplerOverrides[samplerKey] = samplerOverrides;
-
-					renElement.samplerOverrides = samplerOverrides;
-					samplerOverrides->refCount++;
-				}
+				// Parameters used when the element is the first element of an instance batch are created on demand, as
+				// most elements never end up starting a batch
+				renElement.instancedParams = nullptr;
+				renElement.instancedSamplerOverrides = nullptr;
 			}
 		}
 	}
@@ -378,7 +426,7 @@ namespace bs {	namespace ct
 	{
 		UINT32 renderableId = renderable->getRendererId();
 
-		mInfo.renderables[renderableId]->updatePerObjectBuffer();
+		mInfo.renderables[renderableId]->updatePerObjectData();
 		mInfo.renderableCullInfos[renderableId].bounds = renderable->getBounds();
 	}
 
@@ -392,20 +440,14 @@ namespace bs {	namespace ct
 		Vector<BeastRenderableElement>& elements = rendererObject->elements;
 		for (auto& element : elements)
 		{
-			SamplerOverrideKey samplerKey(element.material, element.techniqueIdx);
-
-			auto iterFind = mSamplerOverrides.find(samplerKey);
-			assert(iterFind != mSamplerOverrides.end());
+			releaseSamplerOverrides(element.material, element.techniqueIdx);
+			element.samplerOverrides = nullptr;
 
-			MaterialSamplerOverrides* samplerOverrides = iterFind->second;
-			samplerOverrides->refCount--;
-			if (samplerOverrides->refCount == 0)
+			if (element.instancedSamplerOverrides != nullptr)
 			{
-				SamplerOverrideUtility::destroySamplerOverrides(samplerOverrides);
-				mSamplerOverrides.erase(iterFind);
+				releaseSamplerOverrides(element.material, element.instancedTechniqueIdx);
+				element.instancedSamplerOverrides = nullptr;
 			}
-
-			element.samplerOverrides = nullptr;
 		}
 
 		if (renderableId != lastRenderableId)
@@ -733,40 +775,104 @@ namespace bs {	namespace ct
 			{
 				MaterialSamplerOverrides* overrides = element.samplerOverrides;
 				if(overrides != nullptr && overrides->isDirty)
+					applySamplerOverrides(element.params, *overrides, element.material->getNumPasses());
+
+				MaterialSamplerOverrides* instancedOverrides = element.instancedSamplerOverrides;
+				if(instancedOverrides != nullptr && instancedOverrides->isDirty)
 				{
-					UINT32 numPasses = element.material->getNumPasses();
-					for(UINT32 j = 0; j < numPasses; j++)
-					{
-						SPtr<GpuParams> params = element.params->getGpuParams(j);
+					applySamplerOverrides(element.instancedParams, *instancedOverrides, 
+						element.material->getNumPasses(element.instancedTechniqueIdx));
+				}
+			}
+		}
 
-						const UINT32 numStages = 6;
-						for (UINT32 k = 0; k < numStages; k++)
-						{
-							GpuProgramType type = (GpuProgramType)k;
+		for (auto& entry : mSamplerOverrides)
+			entry.second->isDirty = false;
+	}
 
-							SPtr<GpuParamDesc> paramDesc = params->getParamDesc(type);
-							if (paramDesc == nullptr)
-								continue;
+	MaterialSamplerOverrides* RendererScene::acquireSamplerOverrides(const SPtr<Material>& material, UINT32 techniqueIdx,
+		const SPtr<GpuParamsSet>& paramsSet)
+	{
+		SamplerOverrideKey samplerKey(material, techniqueIdx);
+		auto iterFind = mSamplerOverrides.find(samplerKey);
+		if (iterFind != mSamplerOverrides.end())
+		{
+			iterFind->second->refCount++;
+			return iterFind->second;
+		}
 
-							for (auto& samplerDesc : paramDesc->samplers)
-							{
-								UINT32 set = samplerDesc.second.set;
-								UINT32 slot = samplerDesc.second.slot;
+		SPtr<Shader> shader = material->getShader();
+		MaterialSamplerOverrides* samplerOverrides = SamplerOverrideUtility::generateSamplerOverrides(shader,
+			material->_getInternalParams(), paramsSet, mOptions);
 
-								UINT32 overrideIndex = overrides->passes[j].stateOverrides[set][slot];
-								if (overrideIndex == (UINT32)-1)
-									continue;
+		mSamplerOverrides[samplerKey] = samplerOverrides;
+		samplerOverrides->refCount++;
 
-								params->setSamplerState(set, slot, overrides->overrides[overrideIndex].state);
-							}
-						}
-					}
+		return samplerOverrides;
+	}
+
+	void RendererScene::releaseSamplerOverrides(const SPtr<Material>& material, UINT32 techniqueIdx)
+	{
+		SamplerOverrideKey samplerKey(material, techniqueIdx);
+
+		auto iterFind = mSamplerOverrides.find(samplerKey);
+		assert(iterFind != mSamplerOverrides.end());
+
+		MaterialSamplerOverrides* samplerOverrides = iterFind->second;
+		samplerOverrides->refCount--;
+		if (samplerOverrides->refCount == 0)
+		{
+			SamplerOverrideUtility::destroySamplerOverrides(samplerOverrides);
+			mSamplerOverrides.erase(iterFind);
+		}
+	}
+
+	bool RendererScene::prepareInstancedElement(BeastRenderableElement& element)
+	{
+		if (element.instancedParams != nullptr || element.instancedTechniqueIdx == (UINT32)-1)
+			return false;
+
+		element.instancedParams = element.material->createParamsSet(element.instancedTechniqueIdx);
+		element.material->updateParamsSet(element.instancedParams, true);
+
+		element.instancedSamplerOverrides = acquireSamplerOverrides(element.material, element.instancedTechniqueIdx, 
+			element.instancedParams);
+
+		return true;
+	}
+
+	void RendererScene::updatePerObjectBuffers(ParamBlockRing& ring)
+	{
+		UINT32 blockSize = gPerObjectParamDef.getBlockSize();
+
+		ring.reset();
+		for (auto& rendererObject : mInfo.renderables)
+		{
+			ParamBlockRing::Slice slice = ring.allocate();
+			memcpy(slice.data, rendererObject->perObjectData.data(), blockSize);
+
+			// Slices are allocated in the same order every frame, so bindings only need to change when renderables are
+			// added, removed or re-initialized
+			if (rendererObject->perObjectBuffer == slice.buffer)
+				continue;
+
+			rendererObject->perObjectBuffer = slice.buffer;
+			for (auto& element : rendererObject->elements)
+			{
+				if (element.params == nullptr)
+					continue;
+
+				SPtr<GpuParams> gpuParams = element.params->getGpuParams();
+				for (UINT32 i = 0; i < GPT_COUNT; i++)
+				{
+					const GpuParamBinding& binding = element.perObjectBindings[i];
+					if (binding.slot != (UINT32)-1)
+						gpuParams->setParamBlockBuffer(binding.set, binding.slot, *slice.buffer);
 				}
 			}
 		}
 
-		for (auto& entry : mSamplerOverrides)
-			entry.second->isDirty = false;
+		ring.flush();
 	}
 
 	void RendererScene::prepareRenderable(UINT32 idx, const FrameInfo& frameInfo)
@@ -781,9 +887,13 @@ namespace bs {	namespace ct
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
 		for (auto& element : mInfo.renderables[idx]->elements)
+		{
 			element.material->updateParamsSet(element.params);
-		
-		mInfo.renderables[idx]->perObjectParamBuffer->flushToGPU();
+
+			if (element.instancedParams != nullptr)
+				element.material->updateParamsSet(element.instancedParams);
+		}
+
 		mInfo.renderableReady[idx] = true;
 	}
 }}
@@ -152,6 +152,23 @@ namespace bs
 		 */
 		void prepareRenderable(UINT32 idx, const FrameInfo& frameInfo);
 
+		/**
+		 * Writes the per-object parameters of all renderables into slices of the provided ring, binds the slices to the
+		 * renderable elements and uploads them with a single flush. The ring is reset before writing. Must be called before
+		 * renderables are drawn, whenever a new set of views is rendered.
+		 */
+		void updatePerObjectBuffers(ParamBlockRing& ring);
+
+		/**
+		 * Creates the GPU parameters required for rendering the element as the first element of an instance batch, if they
+		 * weren't created already. Must be called before an element is rendered as part of an instance batch.
+		 *
+		 * @param[in]	element		Element to prepare. Must belong to a renderable registered with the scene.
+		 * @return					True if the parameters were created by this call, false if they already existed or the
+		 *							element doesn't support instancing.
+		 */
+		bool prepareInstancedElement(BeastRenderableElement& element);
+
 		/** Returns a modifiable version of SceneInfo. Only to be used by friends who know what they are doing. */
 		SceneInfo& _getSceneInfo() { return mInfo; }
 	private:
@@ -164,6 +181,19 @@ namespace bs
 		 */
 		void updateCameraRenderTargets(Camera* camera, bool remove = false);
 
+		/** 
+		 * Returns sampler overrides for the provided material technique, creating them if they don't exist already. 
+		 * Increments the reference count of the returned overrides.
+		 */
+		MaterialSamplerOverrides* acquireSamplerOverrides(const SPtr<Material>& material, UINT32 techniqueIdx, 
+			const SPtr<GpuParamsSet>& paramsSet);
+
+		/** 
+		 * Decrements the reference count of sampler overrides for the provided material technique, destroying them if 
+		 * they are no longer referenced.
+		 */
+		void releaseSamplerOverrides(const SPtr<Material>& material, UINT32 techniqueIdx);
+
 		SceneInfo mInfo;
 		UnorderedMap<SamplerOverrideKey, MaterialSamplerOverrides*> mSamplerOverrides;
 
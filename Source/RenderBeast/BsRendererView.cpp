@@ -8,6 +8,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "BsLightRendering.h"
 #include "Material/BsGpuParamsSet.h"
+#include "RenderAPI/BsGpuBuffer.h"
 #include "BsRendererScene.h"
 #include "BsRenderBeast.h"
 
@@ -184,7 +185,12 @@ namespace bs { namespace ct
 				if (isTransparent)
 					mTransparentQueue->add(&renderElem, distanceToCamera);
 				else
-					mOpaqueQueue->add(&renderElem, distanceToCamera);
+				{
+					bool instanceable = renderElem.instancedTechniqueIdx != (UINT32)-1 && 
+						renderElem.material->getInstancingEnabled();
+
+					mOpaqueQueue->add(&renderElem, distanceToCamera, instanceable);
+				}
 			}
 		}
 
@@ -202,6 +208,71 @@ namespace bs { namespace ct
 		mTransparentQueue->sort();
 	}
 
+	void RendererView::updatePerCallBuffers(const Vector<RendererObject*>& renderables, ParamBlockRing& ring)
+	{
+		mPerCallBuffers.resize(renderables.size(), nullptr);
+
+		UINT32 numRenderables = (UINT32)mVisibility.renderables.size();
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			if (!mVisibility.renderables[i])
+				continue;
+
+			ParamBlockRing::Slice slice = ring.allocate();
+			renderables[i]->writePerCallData(mProperties.viewProjTransform, slice.data);
+
+			mPerCallBuffers[i] = slice.buffer;
+		}
+	}
+
+	void RendererView::updateInstanceData(const Vector<RendererObject*>& renderables, ParamBlockRing& batchRing)
+	{
+		// Note: Must be called after the opaque queue has been sorted, as that's when instance batches get determined
+		const Vector<RenderQueueInstanceBatch>& batches = mOpaqueQueue->getInstanceBatches();
+		const Vector<RenderableElement*>& instancedElements = mOpaqueQueue->getInstancedElements();
+
+		mInstanceBatchBuffers.resize(batches.size());
+		if (batches.empty())
+			return;
+
+		// Per-instance data is laid out the same as the per-object parameter block, so we can copy it directly
+		UINT32 instanceSize = gPerObjectParamDef.getBlockSize();
+		UINT32 numInstances = (UINT32)instancedElements.size();
+
+		mInstanceData.resize(numInstances * instanceSize);
+		for (UINT32 i = 0; i < numInstances; i++)
+		{
+			const BeastRenderableElement* element = static_cast<const BeastRenderableElement*>(instancedElements[i]);
+			const RendererObject* rendererObject = renderables[element->renderableId];
+
+			memcpy(&mInstanceData[i * instanceSize], rendererObject->perObjectData.data(), instanceSize);
+		}
+
+		if (mInstanceBuffer == nullptr || mInstanceBuffer->getProperties().getElementCount() < numInstances)
+		{
+			static const UINT32 INSTANCE_BUFFER_INCREMENT = 256;
+
+			GPU_BUFFER_DESC bufferDesc;
+			bufferDesc.type = GBT_STRUCTURED;
+			bufferDesc.elementCount = Math::divideAndRoundUp(numInstances, INSTANCE_BUFFER_INCREMENT) * 
+				INSTANCE_BUFFER_INCREMENT;
+			bufferDesc.elementSize = instanceSize;
+			bufferDesc.format = BF_UNKNOWN;
+
+			mInstanceBuffer = GpuBuffer::create(bufferDesc);
+		}
+
+		mInstanceBuffer->writeData(0, numInstances * instanceSize, mInstanceData.data(), BWT_DISCARD);
+
+		for (UINT32 i = 0; i < (UINT32)batches.size(); i++)
+		{
+			ParamBlockRing::Slice slice = batchRing.allocate();
+			gPerInstanceBatchParamDef.gInstanceOffset.set(slice.data, (INT32)batches[i].firstElement);
+
+			mInstanceBatchBuffers[i] = slice.buffer;
+		}
+	}
+
 	void RendererView::determineVisible(const Vector<RendererLight>& lights, const Vector<Sphere>& bounds, 
 		LightType lightType, Vector<bool>* visibility)
 	{
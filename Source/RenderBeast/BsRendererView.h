@@ -330,6 +330,40 @@ namespace bs { namespace ct
 		/** Returns a buffer that stores per-view parameters. */
 		SPtr<GpuParamBlockBuffer> getPerViewBuffer() const { return mParamBuffer; }
 
+		/**
+		 * Allocates per-call parameter blocks for all renderables visible from this view, and populates them with the
+		 * view's transform. Allocated blocks won't be visible to the GPU until the provided ring is flushed. Must be
+		 * called after visibility was determined.
+		 */
+		void updatePerCallBuffers(const Vector<RendererObject*>& renderables, ParamBlockRing& ring);
+
+		/**
+		 * Returns a buffer containing per-call parameters for the renderable at the specified index. Only valid for
+		 * renderables visible from this view, after a call to updatePerCallBuffers().
+		 */
+		const SPtr<GpuParamBlockBuffer>& getPerCallBuffer(UINT32 renderableIdx) const 
+		{ return *mPerCallBuffers[renderableIdx]; }
+
+		/**
+		 * Populates the per-instance data buffer for all instance batches in the opaque render queue, and allocates a 
+		 * parameter block containing the instance offset for each batch. Must be called after the render queues have been
+		 * sorted. Allocated blocks won't be visible to the GPU until the provided ring is flushed.
+		 */
+		void updateInstanceData(const Vector<RendererObject*>& renderables, ParamBlockRing& batchRing);
+
+		/** 
+		 * Returns a buffer containing per-object data for every instance drawn by this view. Only valid after a call to
+		 * updateInstanceData() and if the view has at least one instance batch.
+		 */
+		const SPtr<GpuBuffer>& getInstanceBuffer() const { return mInstanceBuffer; }
+
+		/**
+		 * Returns a buffer containing parameters for the instance batch at the specified index (as reported by the opaque
+		 * render queue). Only valid after a call to updateInstanceData().
+		 */
+		const SPtr<GpuParamBlockBuffer>& getInstanceBatchBuffer(UINT32 batchIdx) const 
+		{ return *mInstanceBatchBuffers[batchIdx]; }
+
 		/** 
 		 * Returns information about visible lights, in the form of a light grid, used for forward rendering. Only valid
 		 * after a call to updateLightGrid().
@@ -391,6 +425,10 @@ namespace bs { namespace ct
 		UINT32 mRenderSettingsHash;
 
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		Vector<const SPtr<GpuParamBlockBuffer>*> mPerCallBuffers;
+		Vector<const SPtr<GpuParamBlockBuffer>*> mInstanceBatchBuffers;
+		Vector<UINT8> mInstanceData;
+		SPtr<GpuBuffer> mInstanceBuffer;
 		VisibilityInfo mVisibility;
 		LightGrid mLightGrid;
 		UINT32 mViewIdx;
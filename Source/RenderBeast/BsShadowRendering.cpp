@@ -7,10 +7,16 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Mesh/BsMesh.h"
+#include "Material/BsMaterial.h"
+#include "Material/BsShader.h"
 #include "Renderer/BsCamera.h"
 #include "Utility/BsBitwise.h"
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Renderer/BsRenderer.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "Threading/BsTaskScheduler.h"
+#include "BsRendererObject.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -19,19 +25,21 @@ namespace bs { namespace ct
 	ShadowDepthNormalMat::ShadowDepthNormalMat()
 	{ }
 
-	void ShadowDepthNormalMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams)
+	void ShadowDepthNormalMat::bind(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& shadowParams,
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 	
-	void ShadowDepthNormalMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams)
+	void ShadowDepthNormalMat::setPerObjectBuffer(const SPtr<GpuParams>& params, 
+		const SPtr<GpuParamBlockBuffer>& perObjectParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
+		params->setParamBlockBuffer("PerObject", perObjectParams);
 
-		RenderAPI::instance().setGpuParams(mParams);
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 	
 	ShadowDepthNormalMat* ShadowDepthNormalMat::getVariation(bool skinned, bool morph)
@@ -55,18 +63,21 @@ namespace bs { namespace ct
 	ShadowDepthDirectionalMat::ShadowDepthDirectionalMat()
 	{ }
 
-	void ShadowDepthDirectionalMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams)
+	void ShadowDepthDirectionalMat::bind(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& shadowParams,
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 	
-	void ShadowDepthDirectionalMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams)
+	void ShadowDepthDirectionalMat::setPerObjectBuffer(const SPtr<GpuParams>& params, 
+		const SPtr<GpuParamBlockBuffer>& perObjectParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
-		RenderAPI::instance().setGpuParams(mParams);
+		params->setParamBlockBuffer("PerObject", perObjectParams);
+
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 	
 	ShadowDepthDirectionalMat* ShadowDepthDirectionalMat::getVariation(bool skinned, bool morph)
@@ -93,23 +104,24 @@ namespace bs { namespace ct
 	ShadowDepthCubeMat::ShadowDepthCubeMat()
 	{ }
 
-	void ShadowDepthCubeMat::bind(const SPtr<GpuParamBlockBuffer>& shadowParams, 
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMatrices)
+	void ShadowDepthCubeMat::bind(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& shadowParams,
+		const SPtr<GpuParamBlockBuffer>& shadowCubeMatrices, const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("ShadowParams", shadowParams);
-		mParams->setParamBlockBuffer("ShadowCubeMatrices", shadowCubeMatrices);
+		params->setParamBlockBuffer("ShadowParams", shadowParams);
+		params->setParamBlockBuffer("ShadowCubeMatrices", shadowCubeMatrices);
 
-		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline);
-		RenderAPI::instance().setStencilRef(mStencilRef);
+		RenderAPI::instance().setGraphicsPipeline(mGfxPipeline, commandBuffer);
+		RenderAPI::instance().setStencilRef(mStencilRef, commandBuffer);
 	}
 
-	void ShadowDepthCubeMat::setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams,
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMasks)
+	void ShadowDepthCubeMat::setPerObjectBuffer(const SPtr<GpuParams>& params, 
+		const SPtr<GpuParamBlockBuffer>& perObjectParams, const SPtr<GpuParamBlockBuffer>& shadowCubeMasks,
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
-		mParams->setParamBlockBuffer("PerObject", perObjectParams);
-		mParams->setParamBlockBuffer("ShadowCubeMasks", shadowCubeMasks);
+		params->setParamBlockBuffer("PerObject", perObjectParams);
+		params->setParamBlockBuffer("ShadowCubeMasks", shadowCubeMasks);
 
-		RenderAPI::instance().setGpuParams(mParams);
+		RenderAPI::instance().setGpuParams(params, commandBuffer);
 	}
 	
 	ShadowDepthCubeMat* ShadowDepthCubeMat::getVariation(bool skinned, bool morph)
@@ -399,121 +411,153 @@ namespace bs { namespace ct
 	}
 
 	/** 
-	 * Provides a common way for all types of shadow depth rendering to render the relevant objects into the depth map. 
-	 * Iterates over all relevant objects in the scene, binds the relevant materials and renders the objects into the depth
-	 * map.
+	 * Checks can the renderable's shadow be stored in a static shadow map. Such renderables must not move or be animated,
+	 * although they can still change in other ways, which is detected through hashStaticCaster().
 	 */
-	class ShadowRenderQueue
+	bool isStaticCaster(const RendererObject& renderable)
 	{
-	public:
-		struct Command
+		return renderable.renderable->getMobility() != ObjectMobility::Movable &&
+			renderable.renderable->getAnimType() == RenderableAnimType::None;
+	}
+
+	/** Checks does the render job have any commands to execute. */
+	bool hasCommands(const ShadowRenderJob& job)
+	{
+		for (auto& entry : job.commands)
 		{
-			Command()
-			{ }
+			if (!entry.empty())
+				return true;
+		}
 
-			Command(BeastRenderableElement* element)
-				:element(element), isElement(true)
-			{ }
+		return false;
+	}
 
-			union
-			{
-				BeastRenderableElement* element;
-				RendererObject* renderable;
-			};
+	/** Combines all the elements of the provided matrix with the hash. */
+	void hashMatrix(size_t& hash, const Matrix4& matrix)
+	{
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+				hash_combine(hash, matrix[i][j]);
+		}
+	}
 
+	/** Combines the properties of a static shadow caster that affect its shadow with the provided hash. */
+	void hashStaticCaster(size_t& hash, const RendererObject& renderable)
+	{
+		hash_combine(hash, renderable.renderable);
+		hashMatrix(hash, renderable.renderable->getMatrix());
 
-			bool isElement : 1;
-			UINT32 mask : 6;
-		};
+		for (auto& element : renderable.elements)
+		{
+			// Pointers alone aren't enough, as mesh contents and material shaders can change in place
+			hash_combine(hash, element.mesh.get());
+			hash_combine(hash, element.mesh->getVersion());
+			hash_combine(hash, element.subMesh.indexOffset);
+			hash_combine(hash, element.subMesh.indexCount);
+
+			hash_combine(hash, element.material.get());
+			if (element.material != nullptr)
+			{
+				SPtr<Shader> shader = element.material->getShader();
+				hash_combine(hash, shader != nullptr ? shader->getId() : (UINT32)-1);
+			}
+		}
+	}
 
+	/** 
+	 * Provides a common way for all types of shadow depth rendering to find the relevant objects to render into the depth
+	 * map. Iterates over all relevant objects in the scene, prepares them for rendering and outputs the commands required
+	 * for rendering them into a shadow render job.
+	 */
+	class ShadowRenderQueue
+	{
+	public:
+		/**
+		 * Finds the shadow casters relevant to the shadow map and outputs their commands into the render job.
+		 *
+		 * @param[in]	scene		Scene containing the shadow casters.
+		 * @param[in]	frameInfo	Information about the current frame.
+		 * @param[in]	opt			Shadow map type specific options, determining which casters are relevant.
+		 * @param[out]	job			Job to output the commands for the casters into.
+		 * @param[out]	staticJob	Optional job to output the commands for the static casters into (see isStaticCaster()),
+		 *							instead of @p job.
+		 * @param[out]	staticHash	Hash to combine the properties of all the static casters with. Must be provided if
+		 *							@p staticJob is provided.
+		 */
 		template<class Options>
-		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt)
+		static void prepare(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt, ShadowRenderJob& job,
+			ShadowRenderJob* staticJob = nullptr, size_t* staticHash = nullptr)
 		{
 			static_assert((UINT32)RenderableAnimType::Count == 4, "RenderableAnimType is expected to have four sequential entries.");
 
 			const SceneInfo& sceneInfo = scene.getSceneInfo();
 
-			bs_frame_mark();
+			// Make a list of relevant renderables and prepare them for rendering
+			for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
 			{
-				FrameVector<Command> commands[4];
-
-				// Make a list of relevant renderables and prepare them for rendering
-				for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
-				{
-					const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
-					if (!opt.intersects(bounds))
-						continue;
-
-					scene.prepareRenderable(i, frameInfo);
-
-					Command renderableCommand;
-					renderableCommand.mask = 0;
-
-					RendererObject* renderable = sceneInfo.renderables[i];
-					renderableCommand.isElement = false;
-					renderableCommand.renderable = renderable;
+				const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
+				if (!opt.intersects(bounds))
+					continue;
 
-					opt.prepare(renderableCommand, bounds);
+				scene.prepareRenderable(i, frameInfo);
 
-					bool renderableBound[4];
-					bs_zero_out(renderableBound);
+				RendererObject* renderable = sceneInfo.renderables[i];
 
-					for (auto& element : renderable->elements)
-					{
-						UINT32 arrayIdx = (int)element.animType;
+				ShadowRenderJob* outputJob = &job;
+				if (staticJob != nullptr && isStaticCaster(*renderable))
+				{
+					outputJob = staticJob;
+					hashStaticCaster(*staticHash, *renderable);
+				}
 
-						if (!renderableBound[arrayIdx])
-						{
-							commands[arrayIdx].push_back(renderableCommand);
-							renderableBound[arrayIdx] = true;
-						}
+				ShadowRenderJob::Command renderableCommand;
+				renderableCommand.isElement = false;
+				renderableCommand.renderable = renderable;
 
-						commands[arrayIdx].push_back(Command(&element));
-					}
-				}
+				opt.prepare(renderableCommand, bounds);
 
-				static const ShaderVariation* VAR_LOOKUP[4];
-				VAR_LOOKUP[0] = &getVertexInputVariation<false, false>();
-				VAR_LOOKUP[1] = &getVertexInputVariation<true, false>();
-				VAR_LOOKUP[2] = &getVertexInputVariation<false, true>();
-				VAR_LOOKUP[3] = &getVertexInputVariation<true, true>();
+				bool renderableBound[4];
+				bs_zero_out(renderableBound);
 
-				for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+				for (auto& element : renderable->elements)
 				{
-					opt.bindMaterial(*VAR_LOOKUP[i]);
+					UINT32 arrayIdx = (int)element.animType;
 
-					for (auto& command : commands[i])
+					if (!renderableBound[arrayIdx])
 					{
-						if (command.isElement)
-						{
-							const BeastRenderableElement& element = *command.element;
-
-							if (element.morphVertexDeclaration == nullptr)
-								gRendererUtility().draw(element.mesh, element.subMesh);
-							else
-								gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
-									element.morphVertexDeclaration);
-						}
-						else
-							opt.bindRenderable(command);
+						outputJob->commands[arrayIdx].push_back(renderableCommand);
+						renderableBound[arrayIdx] = true;
 					}
+
+					outputJob->commands[arrayIdx].push_back(ShadowRenderJob::Command(&element));
 				}
 			}
-			bs_frame_clear();
+		}
+
+		/** Returns the shader variation to use for rendering renderables with the specified vertex input type. */
+		static const ShaderVariation& getVariation(UINT32 animType)
+		{
+			static const ShaderVariation* VAR_LOOKUP[4] = 
+			{
+				&getVertexInputVariation<false, false>(),
+				&getVertexInputVariation<true, false>(),
+				&getVertexInputVariation<false, true>(),
+				&getVertexInputVariation<true, true>()
+			};
+
+			return *VAR_LOOKUP[animType];
 		}
 	};
 
-	/** Specialization used for ShadowRenderQueue when rendering cube (omnidirectional) shadow maps. */
+	/** Specialization used for ShadowRenderQueue when preparing cube (omnidirectional) shadow maps. */
 	struct ShadowRenderQueueCubeOptions
 	{
 		ShadowRenderQueueCubeOptions(
 			const ConvexVolume (&frustums)[6], 
 			const ConvexVolume& boundingVolume, 
-			const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer, 
-			const SPtr<GpuParamBlockBuffer>& shadowCubeMatricesBuffer,
-			const SPtr<GpuParamBlockBuffer>& shadowCubeMasksBuffer)
-			: frustums(frustums), boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
-			, shadowCubeMatricesBuffer(shadowCubeMatricesBuffer), shadowCubeMasksBuffer(shadowCubeMasksBuffer)
+			ParamBlockRing& faceMaskRing)
+			: frustums(frustums), boundingVolume(boundingVolume), faceMaskRing(faceMaskRing)
 		{ }
 
 		bool intersects(const Sphere& bounds) const
@@ -521,81 +565,26 @@ namespace bs { namespace ct
 			return boundingVolume.intersects(bounds);
 		}
 
-		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
+		void prepare(ShadowRenderJob::Command& command, const Sphere& bounds) const
 		{
+			// Each renderable needs its own buffer, as the buffers are uploaded before any of the commands execute
+			ParamBlockRing::Slice slice = faceMaskRing.allocate();
 			for (UINT32 j = 0; j < 6; j++)
-				command.mask |= (frustums[j].intersects(bounds) ? 1 : 0) << j;
-		}
+				gShadowCubeMasksDef.gFaceMasks.set(slice.data, frustums[j].intersects(bounds) ? 1 : 0, j);
 
-		void bindMaterial(const ShaderVariation& variation) const
-		{
-			material = ShadowDepthCubeMat::get(variation);
-			material->bind(shadowParamsBuffer, shadowCubeMatricesBuffer);
-		}
-
-		void bindRenderable(ShadowRenderQueue::Command& command) const
-		{
-			RendererObject* renderable = command.renderable;
-
-			for (UINT32 j = 0; j < 6; j++)
-				gShadowCubeMasksDef.gFaceMasks.set(shadowCubeMasksBuffer, (command.mask & (1 << j)), j);
-
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer, shadowCubeMasksBuffer);
+			command.faceMasks = slice.buffer;
 		}
 		
 		const ConvexVolume (&frustums)[6];
 		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMatricesBuffer;
-		const SPtr<GpuParamBlockBuffer>& shadowCubeMasksBuffer;
-
-		mutable ShadowDepthCubeMat* material = nullptr;
-	};
-
-	/** Specialization used for ShadowRenderQueue when rendering spot light shadow maps. */
-	struct ShadowRenderQueueSpotOptions
-	{
-		ShadowRenderQueueSpotOptions(
-			const ConvexVolume& boundingVolume, 
-			const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer)
-			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
-		{ }
-
-		bool intersects(const Sphere& bounds) const
-		{
-			return boundingVolume.intersects(bounds);
-		}
-
-		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
-		{
-		}
-
-		void bindMaterial(const ShaderVariation& variation) const
-		{
-			material = ShadowDepthNormalMat::get(variation);
-			material->bind(shadowParamsBuffer);
-		}
-
-		void bindRenderable(ShadowRenderQueue::Command& command) const
-		{
-			RendererObject* renderable = command.renderable;
-
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer);
-		}
-		
-		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
-
-		mutable ShadowDepthNormalMat* material = nullptr;
+		ParamBlockRing& faceMaskRing;
 	};
 
-	/** Specialization used for ShadowRenderQueue when rendering directional light shadow maps. */
-	struct ShadowRenderQueueDirOptions
+	/** Specialization used for ShadowRenderQueue when preparing spot light and directional light shadow maps. */
+	struct ShadowRenderQueueFrustumOptions
 	{
-		ShadowRenderQueueDirOptions(
-			const ConvexVolume& boundingVolume, 
-			const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer)
-			: boundingVolume(boundingVolume), shadowParamsBuffer(shadowParamsBuffer)
+		ShadowRenderQueueFrustumOptions(const ConvexVolume& boundingVolume)
+			: boundingVolume(boundingVolume)
 		{ }
 
 		bool intersects(const Sphere& bounds) const
@@ -603,27 +592,11 @@ namespace bs { namespace ct
 			return boundingVolume.intersects(bounds);
 		}
 
-		void prepare(ShadowRenderQueue::Command& command, const Sphere& bounds) const
+		void prepare(ShadowRenderJob::Command& command, const Sphere& bounds) const
 		{
 		}
 
-		void bindMaterial(const ShaderVariation& variation) const
-		{
-			material = ShadowDepthDirectionalMat::get(variation);
-			material->bind(shadowParamsBuffer);
-		}
-
-		void bindRenderable(ShadowRenderQueue::Command& command) const
-		{
-			RendererObject* renderable = command.renderable;
-
-			material->setPerObjectBuffer(renderable->perObjectParamBuffer);
-		}
-		
 		const ConvexVolume& boundingVolume;
-		const SPtr<GpuParamBlockBuffer>& shadowParamsBuffer;
-
-		mutable ShadowDepthDirectionalMat* material = nullptr;
 	};
 
 	const UINT32 ShadowRendering::MAX_ATLAS_SIZE = 4096;
@@ -634,7 +607,7 @@ namespace bs { namespace ct
 	const float ShadowRendering::CASCADE_FRACTION_FADE = 0.1f;
 
 	ShadowRendering::ShadowRendering(UINT32 shadowMapSize)
-		: mShadowMapSize(shadowMapSize)
+		: mShadowMapSize(shadowMapSize), mCubeFaceMaskRing(gShadowCubeMasksDef.getBlockSize())
 	{
 		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
 		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
@@ -696,15 +669,16 @@ namespace bs { namespace ct
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+		mStaticShadowMaps.clear();
 	}
 
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, 
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Spot and radial lights that aren't movable keep a static shadow map containing only the static casters,
+		// which is only re-rendered when the light or the casters change. Directional lights are always fully dynamic,
+		// as their cascades follow the view. Per-object shadow maps for dynamic objects could further reduce the amount
+		// of geometry that needs to be redrawn every frame.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -714,6 +688,8 @@ namespace bs { namespace ct
 		
 		// Clear all transient data from last frame
 		mShadowInfos.clear();
+		mNumRenderJobs = 0;
+		mCubeFaceMaskRing.reset();
 
 		mSpotLightShadows.resize(sceneInfo.spotLights.size());
 		mRadialLightShadows.resize(sceneInfo.radialLights.size());
@@ -819,34 +795,340 @@ namespace bs { namespace ct
 				++iter;
 		}
 
-		// Render shadow maps
+		for(auto iter = mStaticShadowMaps.begin(); iter != mStaticShadowMaps.end();)
+		{
+			if (iter->second.lastUsedCounter++ >= MAX_UNUSED_FRAMES)
+				iter = mStaticShadowMaps.erase(iter);
+			else
+				++iter;
+		}
+
+		// Allocate shadow maps and find the shadow casters to render for each of them
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
 			const RendererLight& light = sceneInfo.directionalLights[i];
 
 			if (!light.internal->getCastsShadow())
-				return;
+				continue;
 
 			UINT32 numViews = viewGroup.getNumViews();
 			mDirectionalLightShadows[i].viewShadows.resize(numViews);
 
 			for (UINT32 j = 0; j < numViews; ++j)
-				renderCascadedShadowMaps(*viewGroup.getView(j), i, scene, frameInfo);
+				prepareCascadedShadowMaps(*viewGroup.getView(j), i, scene, frameInfo);
 		}
 
 		for(auto& entry : mSpotLightShadowOptions)
 		{
 			UINT32 lightIdx = entry.lightIdx;
-			renderSpotShadowMap(sceneInfo.spotLights[lightIdx], entry, scene, frameInfo);
+			prepareSpotShadowMap(sceneInfo.spotLights[lightIdx], entry, scene, frameInfo);
 		}
 
 		for (auto& entry : mRadialLightShadowOptions)
 		{
 			UINT32 lightIdx = entry.lightIdx;
-			renderRadialShadowMap(sceneInfo.radialLights[lightIdx], entry, scene, frameInfo);
+			prepareRadialShadowMap(sceneInfo.radialLights[lightIdx], entry, scene, frameInfo);
+		}
+
+		// Upload all the per-renderable data before rendering, as rendering might happen on other threads
+		mCubeFaceMaskRing.flush();
+
+		// Render shadow maps
+		renderJobs();
+	}
+
+	ShadowRenderJob& ShadowRendering::allocRenderJob(ShadowMapType type)
+	{
+		if (mNumRenderJobs >= (UINT32)mRenderJobs.size())
+			mRenderJobs.resize(mNumRenderJobs + 1);
+
+		ShadowRenderJob& job = mRenderJobs[mNumRenderJobs++];
+		job.type = type;
+		job.viewport = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
+		job.isStaticCacheUpdate = false;
+
+		for (auto& entry : job.commands)
+			entry.clear();
+
+		return job;
+	}
+
+	void ShadowRendering::renderJobs()
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+
+		// Static shadow maps need to be up to date before they're copied into the shadow maps that use them
+		std::stable_partition(mRenderJobs.begin(), mRenderJobs.begin() + mNumRenderJobs, 
+			[](const ShadowRenderJob& job) { return job.isStaticCacheUpdate; });
+
+		bool multiThreaded = mNumRenderJobs > 1 && rapi.getAPIInfo().isFlagSet(RenderAPIFeatureFlag::MultiThreadedCB);
+		if (!multiThreaded)
+		{
+			for (UINT32 i = 0; i < mNumRenderJobs; i++)
+			{
+				blitStaticShadowMap(mRenderJobs[i]);
+				recordRenderJob(mRenderJobs[i], nullptr);
+			}
+
+			releaseRenderJobResources();
+			return;
+		}
+
+		// Command buffers and parameters cannot be created from worker threads, so create them ahead of time. They are
+		// kept around and re-used in later frames.
+		for (UINT32 i = 0; i < mNumRenderJobs; i++)
+		{
+			ShadowRenderJob& job = mRenderJobs[i];
+
+			if (job.commandBuffer == nullptr)
+				job.commandBuffer = CommandBuffer::create(GQT_GRAPHICS);
+
+			if (job.paramsType != job.type)
+			{
+				for (auto& entry : job.params)
+					entry = nullptr;
+
+				job.paramsType = job.type;
+			}
+
+			for (UINT32 j = 0; j < (UINT32)RenderableAnimType::Count; j++)
+			{
+				if (job.commands[j].empty() || job.params[j] != nullptr)
+					continue;
+
+				const ShaderVariation& variation = ShadowRenderQueue::getVariation(j);
+				switch (job.type)
+				{
+				case ShadowMapType::Normal:
+					job.params[j] = ShadowDepthNormalMat::get(variation)->createParams();
+					break;
+				case ShadowMapType::Directional:
+					job.params[j] = ShadowDepthDirectionalMat::get(variation)->createParams();
+					break;
+				case ShadowMapType::Cube:
+					job.params[j] = ShadowDepthCubeMat::get(variation)->createParams();
+					break;
+				}
+			}
+		}
+
+		// First job gets recorded on this thread
+		Vector<SPtr<Task>> tasks;
+		tasks.reserve(mNumRenderJobs - 1);
+
+		for (UINT32 i = 1; i < mNumRenderJobs; i++)
+		{
+			const ShadowRenderJob& job = mRenderJobs[i];
+
+			SPtr<Task> task = Task::create("ShadowMapRecord", 
+				std::bind(&ShadowRendering::recordRenderJob, std::cref(job), std::cref(job.commandBuffer)));
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		recordRenderJob(mRenderJobs[0], mRenderJobs[0].commandBuffer);
+
+		for (auto& task : tasks)
+			task->wait();
+
+		// Commands queued on the main command buffer so far need to execute before the shadow maps are rendered, and the
+		// shadow maps must be rendered before anything queued afterwards, which is ensured by submitting in order
+		rapi.submitCommandBuffer(nullptr);
+
+		UINT32 jobIdx = 0;
+		for (; jobIdx < mNumRenderJobs && mRenderJobs[jobIdx].isStaticCacheUpdate; jobIdx++)
+			rapi.submitCommandBuffer(mRenderJobs[jobIdx].commandBuffer);
+
+		// Static shadow maps are copied using the main command buffer, in between the static shadow map updates and the
+		// jobs rendering on top of the copied data
+		bool anyBlits = false;
+		for (UINT32 i = jobIdx; i < mNumRenderJobs; i++)
+		{
+			if (mRenderJobs[i].staticShadowMap == nullptr)
+				continue;
+
+			blitStaticShadowMap(mRenderJobs[i]);
+			anyBlits = true;
+		}
+
+		if (anyBlits)
+		{
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+			rapi.submitCommandBuffer(nullptr);
+		}
+
+		for (; jobIdx < mNumRenderJobs; jobIdx++)
+			rapi.submitCommandBuffer(mRenderJobs[jobIdx].commandBuffer);
+
+		releaseRenderJobResources();
+	}
+
+	void ShadowRendering::releaseRenderJobResources()
+	{
+		// Keep the command buffers and parameters around for re-use, but don't hold onto textures or buffers that might
+		// otherwise get released
+		for (UINT32 i = 0; i < mNumRenderJobs; i++)
+		{
+			ShadowRenderJob& job = mRenderJobs[i];
+			job.target = nullptr;
+			job.shadowParams = nullptr;
+			job.shadowCubeMatrices = nullptr;
+			job.staticShadowMap = nullptr;
 		}
 	}
 
+	void ShadowRendering::recordRenderJob(const ShadowRenderJob& job, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		// Shadow maps in an atlas share the render target with other jobs, so make sure their contents are preserved
+		RenderSurfaceMask loadMask = job.type == ShadowMapType::Normal ? RT_DEPTH : RT_NONE;
+
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.setRenderTarget(job.target, 0, loadMask, commandBuffer);
+		rapi.setViewport(job.viewport, commandBuffer);
+
+		// Static shadow map copy overwrites the entire viewport, so no need to clear
+		if (job.staticShadowMap == nullptr)
+			rapi.clearViewport(FBT_DEPTH, Color::Black, 1.0f, 0, 0xFF, commandBuffer);
+
+		for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+		{
+			if (job.commands[i].empty())
+				continue;
+
+			const ShaderVariation& variation = ShadowRenderQueue::getVariation(i);
+
+			// When executing immediately the material's own parameters can be used
+			ShadowDepthNormalMat* normalMat = nullptr;
+			ShadowDepthDirectionalMat* directionalMat = nullptr;
+			ShadowDepthCubeMat* cubeMat = nullptr;
+			SPtr<GpuParams> params = job.params[i];
+
+			switch (job.type)
+			{
+			case ShadowMapType::Normal:
+				normalMat = ShadowDepthNormalMat::get(variation);
+				if (commandBuffer == nullptr)
+					params = normalMat->getParams();
+
+				normalMat->bind(params, job.shadowParams, commandBuffer);
+				break;
+			case ShadowMapType::Directional:
+				directionalMat = ShadowDepthDirectionalMat::get(variation);
+				if (commandBuffer == nullptr)
+					params = directionalMat->getParams();
+
+				directionalMat->bind(params, job.shadowParams, commandBuffer);
+				break;
+			case ShadowMapType::Cube:
+				cubeMat = ShadowDepthCubeMat::get(variation);
+				if (commandBuffer == nullptr)
+					params = cubeMat->getParams();
+
+				cubeMat->bind(params, job.shadowParams, job.shadowCubeMatrices, commandBuffer);
+				break;
+			}
+
+			for (auto& command : job.commands[i])
+			{
+				if (command.isElement)
+				{
+					const BeastRenderableElement& element = *command.element;
+
+					if (element.morphVertexDeclaration == nullptr)
+						gRendererUtility().draw(element.mesh, element.subMesh, 1, commandBuffer);
+					else
+						gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
+							element.morphVertexDeclaration, commandBuffer);
+				}
+				else
+				{
+					const SPtr<GpuParamBlockBuffer>& perObjectBuffer = *command.renderable->perObjectBuffer;
+
+					switch (job.type)
+					{
+					case ShadowMapType::Normal:
+						normalMat->setPerObjectBuffer(params, perObjectBuffer, commandBuffer);
+						break;
+					case ShadowMapType::Directional:
+						directionalMat->setPerObjectBuffer(params, perObjectBuffer, commandBuffer);
+						break;
+					case ShadowMapType::Cube:
+						cubeMat->setPerObjectBuffer(params, perObjectBuffer, *command.faceMasks, commandBuffer);
+						break;
+					}
+				}
+			}
+		}
+
+		// Restore viewport
+		if (commandBuffer == nullptr)
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+	}
+
+	ShadowRenderJob* ShadowRendering::prepareStaticShadowMapUpdate(StaticShadowMap& shadowMap, ShadowMapType type, 
+		size_t hash)
+	{
+		if (shadowMap.hash == hash)
+		{
+			BS_INC_RENDER_STAT(NumShadowCacheHits);
+			return nullptr;
+		}
+
+		BS_INC_RENDER_STAT(NumShadowCacheMisses);
+		shadowMap.hash = hash;
+
+		ShadowRenderJob& job = allocRenderJob(type);
+		job.target = shadowMap.texture->renderTexture;
+		job.isStaticCacheUpdate = true;
+
+		for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+			std::swap(job.commands[i], mStaticCasters.commands[i]);
+
+		return &job;
+	}
+
+	void ShadowRendering::blitStaticShadowMap(const ShadowRenderJob& job)
+	{
+		if (job.staticShadowMap == nullptr)
+			return;
+
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.setRenderTarget(job.target, 0, RT_DEPTH);
+		rapi.setViewport(job.viewport);
+
+		gRendererUtility().blit(job.staticShadowMap, Rect2I::EMPTY, false, true);
+	}
+
+	ShadowRendering::StaticShadowMap& ShadowRendering::getStaticShadowMap(const Light* light, UINT32 size, bool cube)
+	{
+		StaticShadowMap& entry = mStaticShadowMaps[light];
+		entry.lastUsedCounter = 0;
+
+		if (entry.texture != nullptr)
+		{
+			const TextureProperties& props = entry.texture->texture->getProperties();
+			bool isCube = props.getTextureType() == TEX_TYPE_CUBE_MAP;
+
+			if (props.getWidth() == size && isCube == cube)
+				return entry;
+		}
+
+		if (cube)
+		{
+			entry.texture = GpuResourcePool::instance().get(
+				POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL));
+		}
+		else
+		{
+			entry.texture = GpuResourcePool::instance().get(
+				POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL));
+		}
+
+		entry.hash = 0;
+		return entry;
+	}
+
 	/**
 	 * Generates a frustum from the provided view-projection matrix.
 	 * 
@@ -986,7 +1268,10 @@ namespace bs { namespace ct
 				float lightRadius = light->getAttenuationRadius() + viewProps.nearPlane * 3.0f;
 				bool viewerInsideVolume = (tfrm.getPosition() - viewProps.viewOrigin).length() < lightRadius;
 
-				SPtr<Texture> shadowMap = mShadowCubemaps[shadowInfo.textureIdx].getTexture();
+				SPtr<Texture> shadowMap = shadowInfo.cachedTexture;
+				if (shadowMap == nullptr)
+					shadowMap = mShadowCubemaps[shadowInfo.textureIdx].getTexture();
+
 				ShadowProjectParams shadowParams(*light, shadowMap, shadowOmniParamBuffer, perViewBuffer, gbuffer);
 
 				ShadowProjectOmniMat* mat = ShadowProjectOmniMat::getVariation(effectiveShadowQuality, viewerInsideVolume, 
@@ -1130,7 +1415,7 @@ namespace bs { namespace ct
 		}
 	}
 
-	void ShadowRendering::renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene, 
+	void ShadowRendering::prepareCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene, 
 		const FrameInfo& frameInfo)
 	{
 		UINT32 viewIdx = view.getViewIdx();
@@ -1153,11 +1438,8 @@ namespace bs { namespace ct
 		const RendererLight& rendererLight = sceneInfo.directionalLights[lightIdx];
 		Light* light = rendererLight.internal;
 
-		RenderAPI& rapi = RenderAPI::instance();
-
 		const Transform& tfrm = light->getTransform();
 		Vector3 lightDir = -tfrm.getRotation().zAxis();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
 
 		ShadowInfo shadowInfo;
 		shadowInfo.lightIdx = lightIdx;
@@ -1248,23 +1530,21 @@ namespace bs { namespace ct
 			shadowInfo.depthFar = shadowInfo.depthFade + shadowInfo.fadeRange;
 			shadowInfo.depthBias = getDepthBias(*light, frustumBounds.getRadius(), shadowInfo.depthRange, mapSize);
 
+			// Each cascade needs its own buffer, as all cascades are rendered after their parameters are set
+			SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
 			gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, shadowInfo.depthBias);
 			gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / shadowInfo.depthRange);
 			gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowInfo.shadowVPTransform);
 			gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
+			shadowParamsBuffer->flushToGPU();
 
-			rapi.setRenderTarget(shadowMap.getTarget(i));
-			rapi.clearRenderTarget(FBT_DEPTH);
+			ShadowRenderJob& job = allocRenderJob(ShadowMapType::Directional);
+			job.target = shadowMap.getTarget(i);
+			job.shadowParams = shadowParamsBuffer;
 
-			ShadowDepthDirectionalMat* depthDirMat = ShadowDepthDirectionalMat::get();
-			depthDirMat->bind(shadowParamsBuffer);
-
-			// Render all renderables into the shadow map
-			ShadowRenderQueueDirOptions dirOptions(
-				cascadeCullVolume,
-				shadowParamsBuffer);
-			
-			ShadowRenderQueue::execute(scene, frameInfo, dirOptions);
+			// Find all renderables to render into the shadow map
+			ShadowRenderQueueFrustumOptions dirOptions(cascadeCullVolume);
+			ShadowRenderQueue::prepare(scene, frameInfo, dirOptions, job);
 
 			shadowMap.setShadowInfo(i, shadowInfo);
 		}
@@ -1273,7 +1553,7 @@ namespace bs { namespace ct
 		lightShadows.numShadows = 1;
 	}
 
-	void ShadowRendering::renderSpotShadowMap(const RendererLight& rendererLight, const ShadowMapOptions& options,
+	void ShadowRendering::prepareSpotShadowMap(const RendererLight& rendererLight, const ShadowMapOptions& options,
 		RendererScene& scene, const FrameInfo& frameInfo)
 	{
 		Light* light = rendererLight.internal;
@@ -1312,11 +1592,6 @@ namespace bs { namespace ct
 		mapInfo.updateNormArea(MAX_ATLAS_SIZE);
 		ShadowMapAtlas& atlas = mDynamicShadowMaps[mapInfo.textureIdx];
 
-		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
-
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
 		mapInfo.depthFade = mapInfo.depthFar;
@@ -1340,6 +1615,7 @@ namespace bs { namespace ct
 		gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / mapInfo.depthRange);
 		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, mapInfo.shadowVPTransform);
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
+		shadowParamsBuffer->flushToGPU();
 
 		const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
 		Matrix4 worldMatrix = view.transpose();
@@ -1354,15 +1630,44 @@ namespace bs { namespace ct
 
 		ConvexVolume worldFrustum(worldPlanes);
 
-		// Render all renderables into the shadow map
-		ShadowRenderQueueSpotOptions spotOptions(
-			worldFrustum,
-			shadowParamsBuffer);
+		UINT32 jobIdx = mNumRenderJobs;
 
-		ShadowRenderQueue::execute(scene, frameInfo, spotOptions);
+		ShadowRenderJob& job = allocRenderJob(ShadowMapType::Normal);
+		job.target = atlas.getTarget();
+		job.viewport = mapInfo.normArea;
+		job.shadowParams = shadowParamsBuffer;
 
-		// Restore viewport
-		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+		// Find all renderables to render into the shadow map
+		ShadowRenderQueueFrustumOptions spotOptions(worldFrustum);
+		if (light->getMobility() == ObjectMobility::Movable)
+			ShadowRenderQueue::prepare(scene, frameInfo, spotOptions, job);
+		else
+		{
+			// Static casters are rendered into a separate shadow map that persists between frames, which is then
+			// copied into the atlas and has the dynamic casters rendered on top
+			size_t staticHash = 0;
+			hashMatrix(staticHash, mapInfo.shadowVPTransform);
+			hash_combine(staticHash, mapInfo.depthBias);
+			hash_combine(staticHash, options.mapSize);
+
+			for (auto& entry : mStaticCasters.commands)
+				entry.clear();
+
+			ShadowRenderQueue::prepare(scene, frameInfo, spotOptions, job, &mStaticCasters, &staticHash);
+
+			if (hasCommands(mStaticCasters))
+			{
+				StaticShadowMap& staticShadowMap = getStaticShadowMap(light, options.mapSize, false);
+
+				ShadowRenderJob* updateJob = 
+					prepareStaticShadowMapUpdate(staticShadowMap, ShadowMapType::Normal, staticHash);
+				if (updateJob != nullptr)
+					updateJob->shadowParams = shadowParamsBuffer;
+
+				// Note: Not using 'job' as it might have been invalidated by the update job allocation
+				mRenderJobs[jobIdx].staticShadowMap = staticShadowMap.texture->texture;
+			}
+		}
 
 		LightShadows& lightShadows = mSpotLightShadows[options.lightIdx];
 
@@ -1370,7 +1675,7 @@ namespace bs { namespace ct
 		lightShadows.numShadows++;
 	}
 
-	void ShadowRendering::renderRadialShadowMap(const RendererLight& rendererLight, 
+	void ShadowRendering::prepareRadialShadowMap(const RendererLight& rendererLight, 
 		const ShadowMapOptions& options, RendererScene& scene, const FrameInfo& frameInfo)
 	{
 		Light* light = rendererLight.internal;
@@ -1378,7 +1683,6 @@ namespace bs { namespace ct
 		const SceneInfo& sceneInfo = scene.getSceneInfo();
 		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
 		SPtr<GpuParamBlockBuffer> shadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
 
 		ShadowInfo mapInfo;
 		mapInfo.lightIdx = options.lightIdx;
@@ -1388,30 +1692,6 @@ namespace bs { namespace ct
 		mapInfo.area = Rect2I(0, 0, options.mapSize, options.mapSize);
 		mapInfo.updateNormArea(options.mapSize);
 
-		for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size(); i++)
-		{
-			ShadowCubemap& cubemap = mShadowCubemaps[i];
-
-			if (!cubemap.isUsed() && cubemap.getSize() == options.mapSize)
-			{
-				mapInfo.textureIdx = i;
-				cubemap.markAsUsed();
-
-				break;
-			}
-		}
-
-		if (mapInfo.textureIdx == (UINT32)-1)
-		{
-			mapInfo.textureIdx = (UINT32)mShadowCubemaps.size();
-			mShadowCubemaps.push_back(ShadowCubemap(options.mapSize));
-
-			ShadowCubemap& cubemap = mShadowCubemaps.back();
-			cubemap.markAsUsed();
-		}
-
-		ShadowCubemap& cubemap = mShadowCubemaps[mapInfo.textureIdx];
-
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
 		mapInfo.depthFade = mapInfo.depthFar;
@@ -1510,19 +1790,93 @@ namespace bs { namespace ct
 			boundingPlanes.push_back(worldPlanes.back());
 		}
 
-		rapi.setRenderTarget(cubemap.getTarget());
-		rapi.clearRenderTarget(FBT_DEPTH);
+		shadowParamsBuffer->flushToGPU();
+		shadowCubeMatricesBuffer->flushToGPU();
+
+		ShadowRenderJob& job = allocRenderJob(ShadowMapType::Cube);
+		job.shadowParams = shadowParamsBuffer;
+		job.shadowCubeMatrices = shadowCubeMatricesBuffer;
 
-		// Render all renderables into the shadow map
+		// Find all renderables to render into the shadow map
 		ConvexVolume boundingVolume(boundingPlanes);
 		ShadowRenderQueueCubeOptions cubeOptions(
 			frustums,
 			boundingVolume,
-			shadowParamsBuffer,
-			shadowCubeMatricesBuffer,
-			shadowCubeMasksBuffer);
+			mCubeFaceMaskRing);
+
+		if (light->getMobility() == ObjectMobility::Movable)
+			ShadowRenderQueue::prepare(scene, frameInfo, cubeOptions, job);
+		else
+		{
+			size_t staticHash = 0;
+			for (UINT32 i = 0; i < 6; i++)
+				hashMatrix(staticHash, mapInfo.shadowVPTransforms[i]);
+
+			hash_combine(staticHash, mapInfo.depthBias);
+			hash_combine(staticHash, options.mapSize);
+
+			for (auto& entry : mStaticCasters.commands)
+				entry.clear();
+
+			ShadowRenderQueue::prepare(scene, frameInfo, cubeOptions, job, &mStaticCasters, &staticHash);
+
+			// Cubemap faces cannot be copied on all render APIs, so the static shadow map can only be used if there are
+			// no dynamic casters to render on top of it. Otherwise all casters are rendered into a dynamic shadow map.
+			if (!hasCommands(job) && hasCommands(mStaticCasters))
+			{
+				// Job is no longer needed, and no other jobs were allocated since
+				mNumRenderJobs--;
+
+				StaticShadowMap& staticShadowMap = getStaticShadowMap(light, options.mapSize, true);
+
+				ShadowRenderJob* updateJob = 
+					prepareStaticShadowMapUpdate(staticShadowMap, ShadowMapType::Cube, staticHash);
+				if (updateJob != nullptr)
+				{
+					updateJob->shadowParams = shadowParamsBuffer;
+					updateJob->shadowCubeMatrices = shadowCubeMatricesBuffer;
+				}
+
+				mapInfo.cachedTexture = staticShadowMap.texture->texture;
+
+				LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
+
+				mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = mapInfo;
+				lightShadows.numShadows++;
+
+				return;
+			}
+
+			for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+			{
+				job.commands[i].insert(job.commands[i].end(), mStaticCasters.commands[i].begin(), 
+					mStaticCasters.commands[i].end());
+			}
+		}
+
+		for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size(); i++)
+		{
+			ShadowCubemap& cubemap = mShadowCubemaps[i];
+
+			if (!cubemap.isUsed() && cubemap.getSize() == options.mapSize)
+			{
+				mapInfo.textureIdx = i;
+				cubemap.markAsUsed();
+
+				break;
+			}
+		}
+
+		if (mapInfo.textureIdx == (UINT32)-1)
+		{
+			mapInfo.textureIdx = (UINT32)mShadowCubemaps.size();
+			mShadowCubemaps.push_back(ShadowCubemap(options.mapSize));
+
+			ShadowCubemap& cubemap = mShadowCubemaps.back();
+			cubemap.markAsUsed();
+		}
 
-		ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+		job.target = mShadowCubemaps[mapInfo.textureIdx].getTarget();
 
 		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
 
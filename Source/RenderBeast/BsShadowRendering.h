@@ -10,13 +10,17 @@
 #include "Renderer/BsRendererMaterial.h"
 #include "Image/BsTextureAtlasLayout.h"
 #include "Renderer/BsLight.h"
+#include "Renderer/BsRenderable.h"
 #include "BsLightRendering.h"
+#include "Renderer/BsParamBlockRing.h"
 
 namespace bs { namespace ct
 {
 	struct FrameInfo;
 	class RendererLight;
 	class RendererScene;
+	class BeastRenderableElement;
+	struct RendererObject;
 	struct ShadowInfo;
 
 	/** @addtogroup RenderBeast
@@ -52,11 +56,29 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthNormalMat();
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams);
+		/** 
+		 * Binds the material to the pipeline, ready to be used on subsequent draw calls. 
+		 * 
+		 * @param[in]	params			Parameters to bind the material with. Either the material's own parameters, or a
+		 *								set created through createParams().
+		 * @param[in]	shadowParams	Buffer containing the shadow map parameters.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operations on.
+		 */
+		void bind(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& shadowParams, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** 
+		 * Sets a new buffer that determines per-object properties, and binds the parameters to the pipeline. Parameters
+		 * must be the same as the ones provided to bind().
+		 */
+		void setPerObjectBuffer(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& perObjectParams,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
-		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams);
+		/** 
+		 * Creates a new set of parameters compatible with this material. Allows the material to be bound on multiple
+		 * command buffers at once, as each command buffer can use its own set of parameters.
+		 */
+		SPtr<GpuParams> createParams() const { return GpuParams::create(mGfxPipeline); }
 
 		/** 
 		 * Returns the material variation matching the provided parameters. 
@@ -86,11 +108,29 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthDirectionalMat();
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams);
+		/** 
+		 * Binds the material to the pipeline, ready to be used on subsequent draw calls. 
+		 * 
+		 * @param[in]	params			Parameters to bind the material with. Either the material's own parameters, or a
+		 *								set created through createParams().
+		 * @param[in]	shadowParams	Buffer containing the shadow map parameters.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operations on.
+		 */
+		void bind(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& shadowParams, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** 
+		 * Sets a new buffer that determines per-object properties, and binds the parameters to the pipeline. Parameters
+		 * must be the same as the ones provided to bind().
+		 */
+		void setPerObjectBuffer(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& perObjectParams,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
-		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams);
+		/** 
+		 * Creates a new set of parameters compatible with this material. Allows the material to be bound on multiple
+		 * command buffers at once, as each command buffer can use its own set of parameters.
+		 */
+		SPtr<GpuParams> createParams() const { return GpuParams::create(mGfxPipeline); }
 
 		/** 
 		 * Returns the material variation matching the provided parameters. 
@@ -132,12 +172,27 @@ namespace bs { namespace ct
 	public:
 		ShadowDepthCubeMat();
 
-		/** Binds the material to the pipeline, ready to be used on subsequent draw calls. */
-		void bind(const SPtr<GpuParamBlockBuffer>& shadowParams, const SPtr<GpuParamBlockBuffer>& shadowCubeParams);
+		/** 
+		 * Binds the material to the pipeline, ready to be used on subsequent draw calls. 
+		 * 
+		 * @param[in]	params				Parameters to bind the material with. Either the material's own parameters, or
+		 *									a set created through createParams().
+		 * @param[in]	shadowParams		Buffer containing the shadow map parameters.
+		 * @param[in]	shadowCubeParams	Buffer containing the view-projection matrices of all cubemap faces.
+		 * @param[in]	commandBuffer		Optional command buffer to queue the operations on.
+		 */
+		void bind(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& shadowParams, 
+			const SPtr<GpuParamBlockBuffer>& shadowCubeParams, const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** 
+		 * Sets new buffers that determine per-object properties, and binds the parameters to the pipeline. Parameters
+		 * must be the same as the ones provided to bind().
+		 */
+		void setPerObjectBuffer(const SPtr<GpuParams>& params, const SPtr<GpuParamBlockBuffer>& perObjectParams, 
+			const SPtr<GpuParamBlockBuffer>& shadowCubeMasks, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
-		/** Sets a new buffer that determines per-object properties. */
-		void setPerObjectBuffer(const SPtr<GpuParamBlockBuffer>& perObjectParams, 
-			const SPtr<GpuParamBlockBuffer>& shadowCubeMasks);
+		/** @copydoc ShadowDepthNormalMat::createParams */
+		SPtr<GpuParams> createParams() const { return GpuParams::create(mGfxPipeline); }
 
 		/** 
 		 * Returns the material variation matching the provided parameters. 
@@ -356,6 +411,12 @@ namespace bs { namespace ct
 
 		/** Determines the fade amount of the shadow, for each view in the scene. */
 		SmallVector<float, 6> fadePerView;
+
+		/** 
+		 * Texture containing the shadow map, if it is provided directly by the static shadow map cache. If null the
+		 * texture is determined by @p textureIdx instead.
+		 */
+		SPtr<Texture> cachedTexture;
 	};
 
 	/** 
@@ -467,6 +528,77 @@ namespace bs { namespace ct
 		Vector<ShadowInfo> mShadowInfos;
 	};
 
+	/** Determines which type of shadow map is a ShadowRenderJob rendering. */
+	enum class ShadowMapType
+	{
+		/** Shadow map in a shadow map atlas, used by spot lights. */
+		Normal,
+		/** Single cascade of a cascaded shadow map, used by directional lights. */
+		Directional,
+		/** Omnidirectional cubemap, used by radial lights. */
+		Cube
+	};
+
+	/** 
+	 * Contains everything required for rendering shadow casters into a single shadow map (or a single cascade of a 
+	 * cascaded shadow map). Jobs are prepared on the core thread, after which they can be recorded on any thread.
+	 */
+	struct ShadowRenderJob
+	{
+		/** Renderable whose per-object parameters need to be bound, or a renderable element to draw. */
+		struct Command
+		{
+			Command()
+			{ }
+
+			Command(BeastRenderableElement* element)
+				:element(element), isElement(true)
+			{ }
+
+			union
+			{
+				BeastRenderableElement* element;
+				RendererObject* renderable;
+			};
+
+			/** Buffer containing the cubemap faces to render the renderable to. Only relevant for cube shadow maps. */
+			const SPtr<GpuParamBlockBuffer>* faceMasks = nullptr;
+			bool isElement = false;
+		};
+
+		ShadowMapType type = ShadowMapType::Normal;
+		SPtr<RenderTarget> target;
+		Rect2 viewport = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
+
+		SPtr<GpuParamBlockBuffer> shadowParams;
+		SPtr<GpuParamBlockBuffer> shadowCubeMatrices;
+
+		/** Commands to execute, grouped per renderable vertex input type (see RenderableAnimType). */
+		Vector<Command> commands[(UINT32)RenderableAnimType::Count];
+
+		/** 
+		 * Shadow map containing only the static shadow casters, to be copied into the target before the job's commands
+		 * execute. If null the target is cleared instead.
+		 */
+		SPtr<Texture> staticShadowMap;
+
+		/** 
+		 * True if the job renders static shadow casters into a cached shadow map. Such jobs are rendered before all other
+		 * jobs, as those may use their output.
+		 */
+		bool isStaticCacheUpdate = false;
+
+		/** Command buffer to record the job in. Only used when recording jobs on worker threads. */
+		SPtr<CommandBuffer> commandBuffer;
+
+		/** 
+		 * Material parameters for each vertex input type, for the material type specified by @p paramsType. Only used
+		 * when recording jobs on worker threads, as material's own parameters cannot be shared between threads.
+		 */
+		SPtr<GpuParams> params[(UINT32)RenderableAnimType::Count];
+		ShadowMapType paramsType = ShadowMapType::Normal;
+	};
+
 	/** Provides functionality for rendering shadow maps. */
 	class ShadowRendering
 	{
@@ -490,6 +622,17 @@ namespace bs { namespace ct
 		{
 			SmallVector<LightShadows, 6> viewShadows;
 		};
+
+		/** 
+		 * Shadow map containing only the static shadow casters of a single light. Kept around between frames and only
+		 * re-rendered when the light or one of the static casters change.
+		 */
+		struct StaticShadowMap
+		{
+			SPtr<PooledRenderTexture> texture;
+			size_t hash = 0; /**< Hash of the light and caster properties the contents were rendered with. 0 if empty. */
+			UINT32 lastUsedCounter = 0;
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -505,18 +648,74 @@ namespace bs { namespace ct
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
 	private:
-		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
-		void renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene, 
+		/** 
+		 * Prepares jobs for rendering cascaded shadow maps for the provided directional light viewed from the provided
+		 * view. 
+		 */
+		void prepareCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene, 
 			const FrameInfo& frameInfo);
 
-		/** Renders shadow maps for the provided spot light. */
-		void renderSpotShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
+		/** Prepares jobs for rendering shadow maps for the provided spot light. */
+		void prepareSpotShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
 			const FrameInfo& frameInfo);
 
-		/** Renders shadow maps for the provided radial light. */
-		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene, 
+		/** Prepares jobs for rendering shadow maps for the provided radial light. */
+		void prepareRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene, 
 			const FrameInfo& frameInfo);
 
+		/** 
+		 * Returns a new render job, with no commands. The returned reference is only valid until the next call to
+		 * this method.
+		 */
+		ShadowRenderJob& allocRenderJob(ShadowMapType type);
+
+		/** 
+		 * Renders all jobs prepared since the last call. If the render API supports multi-threaded command buffer
+		 * recording, the jobs are recorded on worker threads, each in its own command buffer, and then submitted in 
+		 * order. Otherwise the jobs are executed immediately on the calling thread.
+		 */
+		void renderJobs();
+
+		/** 
+		 * Finds the static shadow map for the specified light, or allocates a new one. Contents of the returned shadow
+		 * map are only valid if its hash matches the hash of the current light and caster properties.
+		 * 
+		 * @param[in]	light	Light that casts the shadow.
+		 * @param[in]	size	Size of the shadow map, in pixels.
+		 * @param[in]	cube	True if the shadow map is an omnidirectional cubemap, false if it is a 2D texture.
+		 * @return				Static shadow map entry. Only valid until the next call to this method.
+		 */
+		StaticShadowMap& getStaticShadowMap(const Light* light, UINT32 size, bool cube);
+
+		/** 
+		 * Checks is the static shadow map up to date with the provided hash. If not, allocates a job that renders the
+		 * static shadow casters into it, moving their commands from the transient static caster list. Also records
+		 * the cache hit or miss in render stats.
+		 * 
+		 * @param[in]	shadowMap	Static shadow map to check.
+		 * @param[in]	type		Type of the shadow map.
+		 * @param[in]	hash		Hash of the current light and static caster properties.
+		 * @return					Job updating the shadow map, or null if the shadow map is up to date. Caller must
+		 *							assign the job's shadow parameters. Only valid until the next call to 
+		 *							allocRenderJob().
+		 */
+		ShadowRenderJob* prepareStaticShadowMapUpdate(StaticShadowMap& shadowMap, ShadowMapType type, size_t hash);
+
+		/** Releases references to resources used by the render jobs, once the jobs have been rendered. */
+		void releaseRenderJobResources();
+
+		/** 
+		 * Records all the commands from the render job into the provided command buffer, or executes them immediately
+		 * if no command buffer is provided.
+		 */
+		static void recordRenderJob(const ShadowRenderJob& job, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** 
+		 * Copies the static shadow map of the render job into its render target, if the job has one. Executes 
+		 * immediately on the calling thread.
+		 */
+		static void blitStaticShadowMap(const ShadowRenderJob& job);
+
 		/** 
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
 		 * that can be used for fading out small shadow maps.
@@ -606,7 +805,7 @@ namespace bs { namespace ct
 		/** Size of a single shadow map atlas, in pixels. */
 		static const UINT32 MAX_ATLAS_SIZE;
 
-		/** Determines how long will an unused shadow map atlas stay allocated, in frames. */
+		/** Determines how long will an unused shadow map atlas (or static shadow map) stay allocated, in frames. */
 		static const UINT32 MAX_UNUSED_FRAMES;
 
 		/** Determines the minimal resolution of a shadow map. */
@@ -643,6 +842,14 @@ namespace bs { namespace ct
 		mutable SPtr<IndexBuffer> mFrustumIB;
 		mutable SPtr<VertexBuffer> mFrustumVB;
 
+		Vector<ShadowRenderJob> mRenderJobs;
+		UINT32 mNumRenderJobs = 0;
+		ParamBlockRing mCubeFaceMaskRing;
+
+		UnorderedMap<const Light*, StaticShadowMap> mStaticShadowMaps;
+
+		ShadowRenderJob mStaticCasters; // Transient
+
 		Vector<bool> mRenderableVisibility; // Transient
 		Vector<ShadowMapOptions> mSpotLightShadowOptions; // Transient
 		Vector<ShadowMapOptions> mRadialLightShadowOptions; // Transient